@@ -0,0 +1,151 @@
+#include "MappedFile.h"
+#include <utility>
+
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <Windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+EmuCore::FileHelpers::ReadOnlyMappedFile::ReadOnlyMappedFile() noexcept : mapped_data(nullptr), mapped_size(0), mapping_handle(nullptr)
+{
+}
+
+EmuCore::FileHelpers::ReadOnlyMappedFile::ReadOnlyMappedFile(const std::filesystem::path& path_) : ReadOnlyMappedFile()
+{
+	Open(path_);
+}
+
+EmuCore::FileHelpers::ReadOnlyMappedFile::ReadOnlyMappedFile(ReadOnlyMappedFile&& to_move_) noexcept :
+	mapped_data(to_move_.mapped_data),
+	mapped_size(to_move_.mapped_size),
+	mapping_handle(to_move_.mapping_handle)
+{
+	to_move_.mapped_data = nullptr;
+	to_move_.mapped_size = 0;
+	to_move_.mapping_handle = nullptr;
+}
+
+EmuCore::FileHelpers::ReadOnlyMappedFile::~ReadOnlyMappedFile()
+{
+	Close();
+}
+
+EmuCore::FileHelpers::ReadOnlyMappedFile& EmuCore::FileHelpers::ReadOnlyMappedFile::operator=(ReadOnlyMappedFile&& to_move_) noexcept
+{
+	ReadOnlyMappedFile(std::move(to_move_)).swap(*this);
+	return *this;
+}
+
+bool EmuCore::FileHelpers::ReadOnlyMappedFile::Open(const std::filesystem::path& path_)
+{
+	Close();
+
+#if defined(_WIN32)
+	HANDLE file_ = CreateFileW(path_.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file_ == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER file_size_;
+	if (!GetFileSizeEx(file_, &file_size_) || file_size_.QuadPart <= 0)
+	{
+		CloseHandle(file_);
+		return false;
+	}
+
+	// The mapping object keeps the file open, so the file handle itself is no longer needed once it exists
+	HANDLE mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file_);
+	if (mapping_ == nullptr)
+	{
+		return false;
+	}
+
+	const void* view_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+	if (view_ == nullptr)
+	{
+		CloseHandle(mapping_);
+		return false;
+	}
+
+	mapped_data = view_;
+	mapped_size = static_cast<std::size_t>(file_size_.QuadPart);
+	mapping_handle = mapping_;
+	return true;
+#else
+	const int file_ = ::open(path_.c_str(), O_RDONLY);
+	if (file_ == -1)
+	{
+		return false;
+	}
+
+	struct stat file_stats_;
+	if (::fstat(file_, &file_stats_) != 0 || file_stats_.st_size <= 0)
+	{
+		::close(file_);
+		return false;
+	}
+
+	// The mapping remains valid after the descriptor is closed
+	const std::size_t file_size_ = static_cast<std::size_t>(file_stats_.st_size);
+	void* view_ = ::mmap(nullptr, file_size_, PROT_READ, MAP_SHARED, file_, 0);
+	::close(file_);
+	if (view_ == MAP_FAILED)
+	{
+		return false;
+	}
+
+	mapped_data = view_;
+	mapped_size = file_size_;
+	return true;
+#endif
+}
+
+void EmuCore::FileHelpers::ReadOnlyMappedFile::Close() noexcept
+{
+	if (mapped_data != nullptr)
+	{
+#if defined(_WIN32)
+		UnmapViewOfFile(mapped_data);
+		CloseHandle(static_cast<HANDLE>(mapping_handle));
+#else
+		::munmap(const_cast<void*>(mapped_data), mapped_size);
+#endif
+		mapped_data = nullptr;
+		mapped_size = 0;
+		mapping_handle = nullptr;
+	}
+}
+
+bool EmuCore::FileHelpers::ReadOnlyMappedFile::IsOpen() const noexcept
+{
+	return mapped_data != nullptr;
+}
+
+const void* EmuCore::FileHelpers::ReadOnlyMappedFile::data() const noexcept
+{
+	return mapped_data;
+}
+
+std::size_t EmuCore::FileHelpers::ReadOnlyMappedFile::size() const noexcept
+{
+	return mapped_size;
+}
+
+void EmuCore::FileHelpers::ReadOnlyMappedFile::swap(ReadOnlyMappedFile& other_) noexcept
+{
+	std::swap(mapped_data, other_.mapped_data);
+	std::swap(mapped_size, other_.mapped_size);
+	std::swap(mapping_handle, other_.mapping_handle);
+}
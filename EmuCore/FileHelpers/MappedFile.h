@@ -0,0 +1,57 @@
+#ifndef EMU_CORE_MAPPED_FILE_H_INC_
+#define EMU_CORE_MAPPED_FILE_H_INC_ 1
+
+#include <cstddef>
+#include <filesystem>
+
+namespace EmuCore::FileHelpers
+{
+	/// <summary>
+	/// <para> Read-only memory mapping of an entire file, unmapped when this object is destroyed or closed. </para>
+	/// <para> Pages are loaded on demand by the operating system, and are shared between all processes mapping the same file. </para>
+	/// <para> Mappings are move-only. Empty files cannot be mapped. </para>
+	/// </summary>
+	class ReadOnlyMappedFile
+	{
+	public:
+		ReadOnlyMappedFile() noexcept;
+		/// <summary>
+		/// <para> Maps the file at the provided path. IsOpen may be used to determine if the file was successfully mapped. </para>
+		/// </summary>
+		/// <param name="path_">Path of the file to map.</param>
+		explicit ReadOnlyMappedFile(const std::filesystem::path& path_);
+		ReadOnlyMappedFile(const ReadOnlyMappedFile&) = delete;
+		ReadOnlyMappedFile(ReadOnlyMappedFile&& to_move_) noexcept;
+		~ReadOnlyMappedFile();
+
+		ReadOnlyMappedFile& operator=(const ReadOnlyMappedFile&) = delete;
+		ReadOnlyMappedFile& operator=(ReadOnlyMappedFile&& to_move_) noexcept;
+
+		/// <summary>
+		/// <para> Maps the file at the provided path, closing any mapping currently held by this object first. </para>
+		/// </summary>
+		/// <param name="path_">Path of the file to map.</param>
+		/// <returns>True if the file was successfully mapped, otherwise false.</returns>
+		bool Open(const std::filesystem::path& path_);
+		/// <summary>
+		/// <para> Unmaps the file currently mapped by this object, if any. </para>
+		/// </summary>
+		void Close() noexcept;
+
+		[[nodiscard]] bool IsOpen() const noexcept;
+		/// <summary> Pointer to the first byte of the mapped file, aligned to at least the system's page size. Null if no file is mapped. </summary>
+		[[nodiscard]] const void* data() const noexcept;
+		/// <summary> Number of bytes in the mapped file. 0 if no file is mapped. </summary>
+		[[nodiscard]] std::size_t size() const noexcept;
+
+		void swap(ReadOnlyMappedFile& other_) noexcept;
+
+	private:
+		const void* mapped_data;
+		std::size_t mapped_size;
+		/// <summary> Handle to the mapping object on Windows. Unused on other platforms. </summary>
+		void* mapping_handle;
+	};
+}
+
+#endif
@@ -2,7 +2,11 @@
 #define EMU_MATH_FAST_NOISE_H_INC_ 1
 
 #include "_do_not_manually_include/_noise/_fast_noise_table.h"
+#include "_do_not_manually_include/_noise/_fast_noise_chunk_generator.h"
+#include "_do_not_manually_include/_noise/_fast_noise_batch_sampler.h"
+#include "_do_not_manually_include/_noise/_fast_noise_table_cache.h"
 #include "_do_not_manually_include/_noise/_fast_noise_sample_processors.h"
+#include "_do_not_manually_include/_noise/_fast_noise_sample_processor_analytics.h"
 #include "_do_not_manually_include/_noise/_noise_sample_processor_analytics.h"
 
 #endif
@@ -0,0 +1,8 @@
+#ifndef EMU_MATH_FAST_RANDOM_H_INC_
+#define EMU_MATH_FAST_RANDOM_H_INC_ 1
+
+#include "Random.h"
+#include "_do_not_manually_include/_random/_fast_simd_rng_engines.h"
+#include "_do_not_manually_include/_random/_fast_counter_rng.h"
+
+#endif
@@ -2,6 +2,9 @@
 #define EMU_MATH_RANDOM_H_INC_ 1
 
 #include "_do_not_manually_include/_random/_rng_wrapper.h"
+#include "_do_not_manually_include/_random/_fast_rng_engines.h"
+#include "_do_not_manually_include/_random/_fast_rng_wrapper.h"
+#include "_do_not_manually_include/_random/_counter_rng.h"
 #include "_do_not_manually_include/_random/_shuffled_int_sequence.h"
 
 #endif
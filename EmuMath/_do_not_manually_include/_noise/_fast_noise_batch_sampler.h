@@ -0,0 +1,423 @@
+#ifndef EMU_MATH_FAST_NOISE_BATCH_SAMPLER_H_INC_
+#define EMU_MATH_FAST_NOISE_BATCH_SAMPLER_H_INC_ 1
+
+#include "_fast_noise_sample_processors.h"
+#include "_fast_noise_functors.h"
+#include "_fast_noise_parallel.h"
+#include "_noise_table_options.h"
+#include "_noise_tmp.h"
+#include "../../../EmuSIMD/SIMDHelpers.h"
+#include "../../../EmuCore/TMPHelpers/TypeComparators.h"
+#include "../../../EmuCore/TMPHelpers/Values.h"
+#include "../../../EmuThreads/BasicThreadPool.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <immintrin.h>
+#include <type_traits>
+#include <vector>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> Sampler used to evaluate SIMD-optimised noise at arbitrary points, provided as separate (SoA) arrays of coordinates for each dimension. </para>
+	/// <para> This is intended for unstructured points such as particles, where noise is not needed on a grid and so cannot be generated via a FastNoiseTable. </para>
+	/// <para>
+	///		Permutations and the underlying generator are created once upon construction, and reused for every call.
+	///		As sampling modifies the generator's scratch state, Sample is not const; SampleParallel gives every task its own copy of the generator instead.
+	/// </para>
+	/// <para>
+	///		Points are processed a full register at a time. The final batch of fewer than a register's worth of points is loaded and stored with masks,
+	///		so no memory is read or written beyond the end of the provided arrays, and samples are never evaluated by scalar code.
+	/// </para>
+	/// <para> Samples are the same as those a FastNoiseTable would produce at the same points with the same register, noise type, frequency, and permutations. </para>
+	/// </summary>
+	template<std::size_t NumDimensions_, EmuMath::NoiseType NoiseType_, EmuConcepts::KnownSIMD SIMDRegister_ = EmuSIMD::f32x4>
+	class FastNoiseBatchSampler
+	{
+	public:
+		static_assert(EmuMath::TMP::assert_valid_noise_dimensions<NumDimensions_>(), "Provided invalid NumDimensions_ value to instantiate an EmuMath::FastNoiseBatchSampler template.");
+		static_assert
+		(
+			EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>,
+			"Provided an invalid SIMDRegister_ to instantiate an EmuMath::FastNoiseBatchSampler template. The register must be a floating-point SIMD register."
+		);
+
+		static constexpr std::size_t num_dimensions = NumDimensions_;
+		static constexpr EmuMath::NoiseType noise_type = NoiseType_;
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		static constexpr std::size_t per_element_width = EmuSIMD::TMP::floating_point_register_element_width_v<register_type>;
+		/// <summary> Float if register_type contains 32-bit elements, otherwise double. </summary>
+		using value_type = std::conditional_t<per_element_width == 32, float, double>;
+		using this_type = FastNoiseBatchSampler<NumDimensions_, NoiseType_, SIMDRegister_>;
+		using options_type = EmuMath::NoiseTableOptions<num_dimensions, value_type>;
+		using fractal_info_type = typename options_type::fractal_info_type;
+		/// <summary> Pointers to the coordinates of every point in each dimension, in XYZ order. </summary>
+		using coordinate_arrays_type = std::array<const value_type*, num_dimensions>;
+		using generator_type = EmuMath::Functors::fractal_noise_wrapper<EmuMath::fast_noise_gen_functor<num_dimensions, noise_type, register_type>, register_type>;
+
+		static constexpr std::size_t num_elements_per_batch = EmuSIMD::TMP::simd_register_width_v<register_type> / per_element_width;
+
+	private:
+		/// <summary> Number of tasks targeted per thread during parallel sampling, allowing threads that finish early to take on more work. </summary>
+		static constexpr std::size_t _parallel_tasks_per_thread = 4;
+		/// <summary> Parallel sampling will not create tasks of fewer than this many points, as smaller tasks would spend more time being queued than executed. </summary>
+		static constexpr std::size_t _min_points_per_task = 4096;
+
+	public:
+#pragma region CONSTRUCTORS
+		/// <summary>
+		/// <para> Creates a sampler using the frequency, permutations, and fractal settings of the provided options. Other options are not used. </para>
+		/// <para> If options_.use_fractal_noise is false, the generator is created with a single octave, which produces the same results as non-fractal noise. </para>
+		/// </summary>
+		/// <param name="options_">Options to sample noise with.</param>
+		explicit FastNoiseBatchSampler(const options_type& options_) :
+			generator(options_.freq, options_.permutation_info.MakePermutations(), _make_fractal_info(options_))
+		{
+		}
+
+		/// <summary> Creates a sampler producing fractal noise with the provided settings. A fractal_info_ of 1 octave may be used to produce non-fractal noise. </summary>
+		/// <param name="freq_">Frequency to sample noise at.</param>
+		/// <param name="permutation_info_">Information used to create the permutations that noise is generated from.</param>
+		/// <param name="fractal_info_">Information describing the octaves of noise to accumulate.</param>
+		FastNoiseBatchSampler(value_type freq_, const EmuMath::Info::NoisePermutationInfo& permutation_info_, const fractal_info_type& fractal_info_) :
+			generator(freq_, permutation_info_.MakePermutations(), fractal_info_)
+		{
+		}
+
+		FastNoiseBatchSampler(const this_type& to_copy_) = default;
+		FastNoiseBatchSampler(this_type&& to_move_) noexcept = default;
+		this_type& operator=(const this_type& rhs_) = default;
+		this_type& operator=(this_type&& rhs_) noexcept = default;
+#pragma endregion
+
+#pragma region SAMPLING
+		/// <summary>
+		/// <para> Evaluates noise at count_ points, where the coordinates of point i in each dimension are points_[dimension][i]. </para>
+		/// <para> Sample i is output to out_samples_[i]. No arrays need to be aligned. </para>
+		/// </summary>
+		/// <param name="points_">Pointers to the coordinates of all points in each dimension, in XYZ order. Each must point to at least count_ values.</param>
+		/// <param name="out_samples_">Pointer to a buffer which can contain at least count_ samples.</param>
+		/// <param name="count_">Number of points to evaluate.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of samples.</param>
+		/// <returns>True if all points were evaluated; otherwise false, which will be the case if count_ is not 0 and any of the provided pointers are null.</returns>
+		template<class SampleProcessor_>
+		inline bool Sample(const coordinate_arrays_type& points_, value_type* out_samples_, const std::size_t count_, SampleProcessor_&& sample_processor_)
+		{
+			if (!_valid_arrays(points_, out_samples_, count_))
+			{
+				return false;
+			}
+
+			_sample_range(generator, EmuCore::TMP::lval_ref_cast<SampleProcessor_>(std::forward<SampleProcessor_>(sample_processor_)), points_, out_samples_, 0, count_);
+			return true;
+		}
+		template<class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool Sample(const coordinate_arrays_type& points_, value_type* out_samples_, const std::size_t count_)
+		{
+			return Sample(points_, out_samples_, count_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Parallel equivalent of Sample, dividing the provided points into tasks which are executed by the provided thread_pool_. </para>
+		/// <para> The calling thread will contribute to executing tasks, and this function will not return until all of its tasks have been completed. </para>
+		/// <para> Output is bit-identical to that of Sample with the same arguments. </para>
+		/// <para>
+		///		The generator and sample_processor_ are copied for every task. Any state that the processor changes when invoked will not be reflected
+		///		in the passed sample_processor_, unless it is a non-const mergeable processor (see EmuMath::TMP::is_mergeable_noise_sample_processor),
+		///		in which case the results of every task are merged into it in task order.
+		/// </para>
+		/// <para> If the sample processor throws within any task, the first such exception is rethrown once all tasks have finished, as with Sample. </para>
+		/// </summary>
+		/// <param name="thread_pool_">Thread Pool to queue sampling tasks in. Its func_type must be constructible from a lambda taking no arguments and returning void.</param>
+		/// <param name="points_">Pointers to the coordinates of all points in each dimension, in XYZ order. Each must point to at least count_ values.</param>
+		/// <param name="out_samples_">Pointer to a buffer which can contain at least count_ samples.</param>
+		/// <param name="count_">Number of points to evaluate.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of samples.</param>
+		/// <returns>True if all points were evaluated; otherwise false, which will be the case if count_ is not 0 and any of the provided pointers are null.</returns>
+		template<class SampleProcessor_, class PoolFunc_>
+		inline bool SampleParallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const coordinate_arrays_type& points_,
+			value_type* out_samples_,
+			const std::size_t count_,
+			SampleProcessor_&& sample_processor_
+		) const
+		{
+			if (!_valid_arrays(points_, out_samples_, count_))
+			{
+				return false;
+			}
+
+			_do_sampling_parallel<typename std::remove_cvref<SampleProcessor_>::type>(thread_pool_, points_, out_samples_, count_, sample_processor_);
+			return true;
+		}
+		template<class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, class PoolFunc_>
+		inline bool SampleParallel(EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_, const coordinate_arrays_type& points_, value_type* out_samples_, const std::size_t count_) const
+		{
+			return SampleParallel(thread_pool_, points_, out_samples_, count_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Parallel equivalent of Sample, using a temporary Thread Pool so that sampling is performed by num_threads_ threads in total. </para>
+		/// <para> The calling thread counts as one of these threads. If num_threads_ is 1 or less, this is equivalent to sampling with a copy of this sampler. </para>
+		/// <para>
+		///		Each call creates a Thread Pool of num_threads_ - 1 Worker Threads and joins them before returning, which may cost more than parallelism saves for small batches of points.
+		///		Where sampling is performed repeatedly, use the overloads taking a persistent Thread Pool instead.
+		/// </para>
+		/// </summary>
+		/// <param name="num_threads_">Total number of threads to sample noise with, including the calling thread.</param>
+		/// <param name="points_">Pointers to the coordinates of all points in each dimension, in XYZ order. Each must point to at least count_ values.</param>
+		/// <param name="out_samples_">Pointer to a buffer which can contain at least count_ samples.</param>
+		/// <param name="count_">Number of points to evaluate.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of samples.</param>
+		/// <returns>True if all points were evaluated; otherwise false, which will be the case if count_ is not 0 and any of the provided pointers are null.</returns>
+		template<class SampleProcessor_>
+		inline bool SampleParallel
+		(
+			const std::size_t num_threads_,
+			const coordinate_arrays_type& points_,
+			value_type* out_samples_,
+			const std::size_t count_,
+			SampleProcessor_&& sample_processor_
+		) const
+		{
+			if (num_threads_ <= 1)
+			{
+				return this_type(*this).Sample(points_, out_samples_, count_, std::forward<SampleProcessor_>(sample_processor_));
+			}
+			else
+			{
+				EmuThreads::BasicThreadPool<EmuThreads::InlineTask<void()>> thread_pool_(num_threads_ - 1);
+				return SampleParallel(thread_pool_, points_, out_samples_, count_, std::forward<SampleProcessor_>(sample_processor_));
+			}
+		}
+		template<class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool SampleParallel(const std::size_t num_threads_, const coordinate_arrays_type& points_, value_type* out_samples_, const std::size_t count_) const
+		{
+			return SampleParallel(num_threads_, points_, out_samples_, count_, SampleProcessor_());
+		}
+#pragma endregion
+
+	private:
+		generator_type generator;
+
+		[[nodiscard]] static inline fractal_info_type _make_fractal_info(const options_type& options_)
+		{
+			if (options_.use_fractal_noise)
+			{
+				return options_.fractal_noise_info;
+			}
+			else
+			{
+				const auto& fractal_info_ = options_.fractal_noise_info;
+				return fractal_info_type(1, fractal_info_.GetLacunarity(), fractal_info_.GetGain());
+			}
+		}
+
+		[[nodiscard]] static inline bool _valid_arrays(const coordinate_arrays_type& points_, const value_type* out_samples_, const std::size_t count_)
+		{
+			if (count_ == 0)
+			{
+				return true;
+			}
+			return out_samples_ != nullptr && std::none_of(points_.begin(), points_.end(), [](const value_type* ptr_) { return ptr_ == nullptr; });
+		}
+
+		/// <summary>
+		/// <para> Creates a mask of which the first num_active_ elements have all bits set, and all others are 0. num_active_ must be less than num_elements_per_batch. </para>
+		/// <para> Only used for registers with native masked loads and stores. </para>
+		/// </summary>
+		[[nodiscard]] static inline auto _make_tail_mask(const std::size_t num_active_)
+		{
+			if constexpr (std::is_same_v<register_type, EmuSIMD::f32x4>)
+			{
+				return _mm_cmpgt_epi32(_mm_set1_epi32(static_cast<int>(num_active_)), _mm_setr_epi32(0, 1, 2, 3));
+			}
+			else if constexpr (std::is_same_v<register_type, EmuSIMD::f32x8>)
+			{
+				return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(num_active_)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+			}
+			else if constexpr (std::is_same_v<register_type, EmuSIMD::f64x2>)
+			{
+				return _mm_cmpgt_epi64(_mm_set1_epi64x(static_cast<long long>(num_active_)), _mm_set_epi64x(1, 0));
+			}
+			else
+			{
+				return _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<long long>(num_active_)), _mm256_setr_epi64x(0, 1, 2, 3));
+			}
+		}
+
+		static constexpr bool _has_native_masks = EmuCore::TMP::is_any_comparison_true
+		<
+			std::is_same,
+			register_type,
+			EmuSIMD::f32x4,
+			EmuSIMD::f32x8,
+			EmuSIMD::f64x2,
+			EmuSIMD::f64x4
+		>::value;
+
+		/// <summary> Loads the first num_active_ elements from in_, with all other elements set to 0. No memory beyond the active elements is accessed. </summary>
+		template<class Mask_>
+		[[nodiscard]] static inline register_type _load_partial(const value_type* in_, [[maybe_unused]] const Mask_& mask_, [[maybe_unused]] const std::size_t num_active_)
+		{
+			if constexpr (std::is_same_v<register_type, EmuSIMD::f32x4>)
+			{
+				return _mm_maskload_ps(in_, mask_);
+			}
+			else if constexpr (std::is_same_v<register_type, EmuSIMD::f32x8>)
+			{
+				return _mm256_maskload_ps(in_, mask_);
+			}
+			else if constexpr (std::is_same_v<register_type, EmuSIMD::f64x2>)
+			{
+				return _mm_maskload_pd(in_, mask_);
+			}
+			else if constexpr (std::is_same_v<register_type, EmuSIMD::f64x4>)
+			{
+				return _mm256_maskload_pd(in_, mask_);
+			}
+			else
+			{
+				value_type lanes_[num_elements_per_batch] = {};
+				std::copy(in_, in_ + num_active_, lanes_);
+				return EmuSIMD::load<register_type>(lanes_);
+			}
+		}
+
+		/// <summary> Stores the first num_active_ elements of samples_ to out_. No memory beyond the active elements is accessed. </summary>
+		template<class Mask_>
+		static inline void _store_partial(register_type samples_, value_type* out_, [[maybe_unused]] const Mask_& mask_, [[maybe_unused]] const std::size_t num_active_)
+		{
+			if constexpr (std::is_same_v<register_type, EmuSIMD::f32x4>)
+			{
+				_mm_maskstore_ps(out_, mask_, samples_);
+			}
+			else if constexpr (std::is_same_v<register_type, EmuSIMD::f32x8>)
+			{
+				_mm256_maskstore_ps(out_, mask_, samples_);
+			}
+			else if constexpr (std::is_same_v<register_type, EmuSIMD::f64x2>)
+			{
+				_mm_maskstore_pd(out_, mask_, samples_);
+			}
+			else if constexpr (std::is_same_v<register_type, EmuSIMD::f64x4>)
+			{
+				_mm256_maskstore_pd(out_, mask_, samples_);
+			}
+			else
+			{
+				value_type lanes_[num_elements_per_batch] = {};
+				EmuSIMD::store(samples_, lanes_);
+				std::copy(lanes_, lanes_ + num_active_, out_);
+			}
+		}
+
+		template<class Loader_>
+		[[nodiscard]] static inline register_type _invoke_generator(generator_type& generator_, const Loader_& load_dimension_)
+		{
+			if constexpr (num_dimensions == 3)
+			{
+				return generator_(load_dimension_(0), load_dimension_(1), load_dimension_(2));
+			}
+			else if constexpr (num_dimensions == 2)
+			{
+				return generator_(load_dimension_(0), load_dimension_(1));
+			}
+			else
+			{
+				return generator_(load_dimension_(0));
+			}
+		}
+
+		/// <summary> Evaluates points [begin_, end_) with the provided generator and processor. Only the final batch of the range may be partial. </summary>
+		template<class SampleProcessor_>
+		static inline void _sample_range
+		(
+			generator_type& generator_,
+			SampleProcessor_& sample_processor_,
+			const coordinate_arrays_type& points_,
+			value_type* out_samples_,
+			std::size_t begin_,
+			const std::size_t end_
+		)
+		{
+			const std::size_t end_full_batches_ = end_ - ((end_ - begin_) % num_elements_per_batch);
+			for (; begin_ < end_full_batches_; begin_ += num_elements_per_batch)
+			{
+				const register_type samples_ = sample_processor_
+				(
+					_invoke_generator(generator_, [&points_, begin_](const std::size_t dimension_) { return EmuSIMD::load<register_type>(points_[dimension_] + begin_); })
+				);
+				EmuSIMD::store(samples_, out_samples_ + begin_);
+			}
+
+			if (begin_ < end_)
+			{
+				const std::size_t num_active_ = end_ - begin_;
+				const auto mask_ = [num_active_]()
+				{
+					if constexpr (_has_native_masks)
+					{
+						return _make_tail_mask(num_active_);
+					}
+					else
+					{
+						return num_active_;
+					}
+				}();
+
+				const register_type generated_ = _invoke_generator
+				(
+					generator_,
+					[&points_, &mask_, begin_, num_active_](const std::size_t dimension_) { return _load_partial(points_[dimension_] + begin_, mask_, num_active_); }
+				);
+
+				if constexpr (std::is_invocable_v<SampleProcessor_&, register_type, std::size_t>)
+				{
+					_store_partial(sample_processor_(generated_, num_active_), out_samples_ + begin_, mask_, num_active_);
+				}
+				else
+				{
+					_store_partial(sample_processor_(generated_), out_samples_ + begin_, mask_, num_active_);
+				}
+			}
+		}
+
+		/// <summary>
+		/// <para> Parallel counterpart to _sample_range over all points, splitting them into tasks of whole batches so that only the final task has a partial batch. </para>
+		/// <para> Tasks are run by _underlying_noise_parallel::run_sample_processor_tasks, which merges mergeable processors in task order and rethrows the first exception of any task. </para>
+		/// </summary>
+		template<class SampleProcessor_, class PoolFunc_, class SampleProcessorArg_>
+		inline void _do_sampling_parallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const coordinate_arrays_type& points_,
+			value_type* out_samples_,
+			const std::size_t count_,
+			SampleProcessorArg_& sample_processor_
+		) const
+		{
+			const std::size_t num_batches_ = (count_ + num_elements_per_batch - 1) / num_elements_per_batch;
+			const std::size_t target_num_tasks_ = (thread_pool_.num_worker_threads + 1) * _parallel_tasks_per_thread;
+			const std::size_t min_batches_per_task_ = (_min_points_per_task + num_elements_per_batch - 1) / num_elements_per_batch;
+			const std::size_t batches_per_task_ = std::max((num_batches_ + target_num_tasks_ - 1) / target_num_tasks_, min_batches_per_task_);
+			const std::size_t num_tasks_ = (num_batches_ + batches_per_task_ - 1) / batches_per_task_;
+
+			auto sample_task_ = [this, &points_, out_samples_, batches_per_task_, count_](const std::size_t task_index_, SampleProcessor_& task_sample_processor_)
+			{
+				const std::size_t begin_ = task_index_ * batches_per_task_ * num_elements_per_batch;
+				const std::size_t end_ = std::min(begin_ + (batches_per_task_ * num_elements_per_batch), count_);
+				generator_type task_generator_(generator);
+				_sample_range(task_generator_, task_sample_processor_, points_, out_samples_, begin_, end_);
+			};
+			EmuMath::_underlying_noise_parallel::run_sample_processor_tasks<SampleProcessor_>(thread_pool_, num_tasks_, sample_processor_, sample_task_);
+		}
+	};
+}
+
+#endif
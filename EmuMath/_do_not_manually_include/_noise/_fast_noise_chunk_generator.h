@@ -0,0 +1,343 @@
+#ifndef EMU_MATH_FAST_NOISE_CHUNK_GENERATOR_H_INC_
+#define EMU_MATH_FAST_NOISE_CHUNK_GENERATOR_H_INC_ 1
+
+#include "_fast_noise_sample_processors.h"
+#include "_fast_noise_functors.h"
+#include "_noise_table_options.h"
+#include "_noise_table_storage.h"
+#include "_noise_tmp.h"
+#include "../../../EmuSIMD/SIMDHelpers.h"
+#include "../../../EmuCore/TMPHelpers/TypeComparators.h"
+#include "../../../EmuCore/TMPHelpers/Values.h"
+#include <cstdint>
+#include <type_traits>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> Generator used to fill caller-provided buffers with chunks of SIMD-optimised noise, where each chunk is identified by integer chunk coordinates. </para>
+	/// <para>
+	///		Permutations and the underlying generator are created once upon construction, and reused for every generated chunk.
+	///		As generation modifies the generator's scratch state, a separate copy of this generator should be used by each thread generating chunks.
+	/// </para>
+	/// <para>
+	///		Construction options describe the chunk at coordinates 0: table_resolution is the size of every chunk, start_point is the point of the sample at global index 0,
+	///		and the calculated step is the distance between neighbouring samples. Other chunks tile infinitely from chunk 0 in every direction.
+	/// </para>
+	/// <para>
+	///		Points are calculated from each sample's global index rather than accumulated, so the value of a sample depends only on its global index.
+	///		This guarantees seamless values across chunk borders.
+	/// </para>
+	/// <para>
+	///		Each point is calculated in double precision from its 64-bit global index, and only then converted to value_type, so the indices of distinct samples are never rounded to the same value.
+	///		With 32-bit registers, points far from the origin are still limited by float precision; a 64-bit register (e.g. f64x4) may be used for 3D noise at large world coordinates.
+	/// </para>
+	/// <para>
+	///		Samples are output contiguously in the same order as a FLAT FastNoiseTable with the same MajorDimensionIndex_:
+	///		alphabetical order excluding the major dimension, which is always innermost (i.e. X-major is output YZX, Y-major output XZY, Z-major output XYZ).
+	/// </para>
+	/// </summary>
+	template<std::size_t NumDimensions_, EmuMath::NoiseType NoiseType_, EmuConcepts::KnownSIMD SIMDRegister_ = EmuSIMD::f32x4, std::size_t MajorDimensionIndex_ = NumDimensions_ - 1>
+	class FastNoiseChunkGenerator
+	{
+	public:
+		static_assert(EmuMath::TMP::assert_valid_noise_dimensions<NumDimensions_>(), "Provided invalid NumDimensions_ value to instantiate an EmuMath::FastNoiseChunkGenerator template.");
+		static_assert
+		(
+			EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>,
+			"Provided an invalid SIMDRegister_ to instantiate an EmuMath::FastNoiseChunkGenerator template. The register must be a floating-point SIMD register."
+		);
+		static_assert
+		(
+			MajorDimensionIndex_ < NumDimensions_,
+			"Provided an invalid MajorDimensionIndex_ value to instantiate an EmuMath::FastNoiseChunkGenerator template. The provided value must be less than NumDimensions_."
+		);
+
+		static constexpr std::size_t num_dimensions = NumDimensions_;
+		static constexpr std::size_t major_dimension = MajorDimensionIndex_;
+		static constexpr EmuMath::NoiseType noise_type = NoiseType_;
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		static constexpr std::size_t per_element_width = EmuSIMD::TMP::floating_point_register_element_width_v<register_type>;
+		/// <summary> Float if register_type contains 32-bit elements, otherwise double. </summary>
+		using value_type = std::conditional_t<per_element_width == 32, float, double>;
+		using this_type = FastNoiseChunkGenerator<NumDimensions_, NoiseType_, SIMDRegister_, MajorDimensionIndex_>;
+		using options_type = EmuMath::NoiseTableOptions<num_dimensions, value_type>;
+		using chunk_size_type = EmuMath::Vector<num_dimensions, std::size_t>;
+		using chunk_coordinate_type = EmuMath::Vector<num_dimensions, std::int64_t>;
+		using generator_type = EmuMath::Functors::fractal_noise_wrapper<EmuMath::fast_noise_gen_functor<num_dimensions, noise_type, register_type>, register_type>;
+
+		static constexpr std::size_t num_elements_per_batch = EmuSIMD::TMP::simd_register_width_v<register_type> / per_element_width;
+
+	private:
+		/// <summary> Chunks are output in the same order as FastNoiseTable storage. </summary>
+		using _layout = EmuMath::TMP::_noise_table_layout<num_dimensions, major_dimension>;
+		/// <summary> Dimension iterated by the outermost layer of output. Follows the alphabetical-excluding-major output order. </summary>
+		static constexpr std::size_t _outer_dimension = _layout::outer_dimension;
+		/// <summary> Dimension iterated by the middle layer of output. Only meaningful for 3-dimensional chunks. </summary>
+		static constexpr std::size_t _middle_dimension = _layout::middle_dimension;
+
+	public:
+#pragma region CONSTRUCTORS
+		/// <summary>
+		/// <para> Creates a chunk generator from options describing the chunk at coordinates 0. </para>
+		/// <para> If options_.use_fractal_noise is false, the generator is created with a single octave, which produces the same results as non-fractal noise. </para>
+		/// </summary>
+		/// <param name="options_">Options describing the chunk at coordinates 0.</param>
+		explicit FastNoiseChunkGenerator(const options_type& options_) :
+			generator(options_.freq, options_.permutation_info.MakePermutations(), _make_fractal_info(options_)),
+			chunk_size(options_.table_resolution),
+			start_point(options_.start_point),
+			step(options_.MakeStep())
+		{
+		}
+
+		FastNoiseChunkGenerator(const this_type& to_copy_) = default;
+		FastNoiseChunkGenerator(this_type&& to_move_) noexcept = default;
+		this_type& operator=(const this_type& rhs_) = default;
+		this_type& operator=(this_type&& rhs_) noexcept = default;
+#pragma endregion
+
+#pragma region ACCESS
+		/// <summary> Returns the number of samples in each dimension of every chunk. </summary>
+		[[nodiscard]] inline const chunk_size_type& size() const
+		{
+			return chunk_size;
+		}
+
+		/// <summary> Returns the total number of samples in every chunk; buffers passed to GenerateChunk must be able to contain at least this many samples. </summary>
+		[[nodiscard]] inline std::size_t samples_per_chunk() const
+		{
+			std::size_t total_ = 1;
+			for (std::size_t i = 0; i < num_dimensions; ++i)
+			{
+				total_ *= chunk_size[i];
+			}
+			return total_;
+		}
+
+		/// <summary> Calculates the index within an output buffer of the sample at the provided local coordinates within a chunk. </summary>
+		/// <param name="local_coords_">Coordinates of the sample within its chunk, in XYZ order.</param>
+		/// <returns>Index of the sample within a buffer filled by GenerateChunk.</returns>
+		[[nodiscard]] inline std::size_t local_sample_index(const chunk_size_type& local_coords_) const
+		{
+			return _layout::flat_index(chunk_size, local_coords_);
+		}
+#pragma endregion
+
+#pragma region GENERATION
+		/// <summary>
+		/// <para> Fills the provided buffer with the samples of the chunk at the provided chunk coordinates. </para>
+		/// <para> The buffer does not need to be aligned, but alignment to at least the width of register_type is recommended for best performance. </para>
+		/// </summary>
+		/// <param name="chunk_coords_">Integer coordinates of the chunk to generate, in units of chunks.</param>
+		/// <param name="out_samples_">Pointer to a buffer which can contain at least samples_per_chunk() samples.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of samples.</param>
+		/// <returns>True if the chunk was successfully generated; otherwise false, which will be the case if any dimension of the chunk size is 0.</returns>
+		template<class SampleProcessor_>
+		inline bool GenerateChunk(const chunk_coordinate_type& chunk_coords_, value_type* out_samples_, SampleProcessor_&& sample_processor_)
+		{
+			if (chunk_size.CmpAnyEqual(std::size_t(0)))
+			{
+				return false;
+			}
+
+			auto& sample_processor_ref_ = EmuCore::TMP::lval_ref_cast<SampleProcessor_>(std::forward<SampleProcessor_>(sample_processor_));
+			const std::size_t size_major_ = chunk_size.template at<major_dimension>();
+			const std::int64_t first_major_ = _first_global_index<major_dimension>(chunk_coords_);
+			if constexpr (num_dimensions == 1)
+			{
+				_generate_major_run(sample_processor_ref_, out_samples_, first_major_, size_major_, register_type(), register_type());
+			}
+			else
+			{
+				const std::size_t size_outer_ = chunk_size.template at<_outer_dimension>();
+				const std::int64_t first_outer_ = _first_global_index<_outer_dimension>(chunk_coords_);
+				for (std::size_t outer_index_ = 0; outer_index_ < size_outer_; ++outer_index_)
+				{
+					const register_type points_outer_ = EmuSIMD::set1<register_type>(_make_point<_outer_dimension>(first_outer_ + static_cast<std::int64_t>(outer_index_)));
+					if constexpr (num_dimensions == 3)
+					{
+						const std::size_t size_middle_ = chunk_size.template at<_middle_dimension>();
+						const std::int64_t first_middle_ = _first_global_index<_middle_dimension>(chunk_coords_);
+						for (std::size_t middle_index_ = 0; middle_index_ < size_middle_; ++middle_index_)
+						{
+							const register_type points_middle_ = EmuSIMD::set1<register_type>(_make_point<_middle_dimension>(first_middle_ + static_cast<std::int64_t>(middle_index_)));
+							_generate_major_run(sample_processor_ref_, out_samples_, first_major_, size_major_, points_outer_, points_middle_);
+							out_samples_ += size_major_;
+						}
+					}
+					else
+					{
+						_generate_major_run(sample_processor_ref_, out_samples_, first_major_, size_major_, points_outer_, register_type());
+						out_samples_ += size_major_;
+					}
+				}
+			}
+			return true;
+		}
+		template<class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateChunk(const chunk_coordinate_type& chunk_coords_, value_type* out_samples_)
+		{
+			return GenerateChunk(chunk_coords_, out_samples_, SampleProcessor_());
+		}
+#pragma endregion
+
+	private:
+		generator_type generator;
+		chunk_size_type chunk_size;
+		EmuMath::Vector<num_dimensions, value_type> start_point;
+		EmuMath::Vector<num_dimensions, value_type> step;
+
+		[[nodiscard]] static inline typename options_type::fractal_info_type _make_fractal_info(const options_type& options_)
+		{
+			if (options_.use_fractal_noise)
+			{
+				return options_.fractal_noise_info;
+			}
+			else
+			{
+				const auto& fractal_info_ = options_.fractal_noise_info;
+				return typename options_type::fractal_info_type(1, fractal_info_.GetLacunarity(), fractal_info_.GetGain());
+			}
+		}
+
+		template<std::size_t Dimension_>
+		[[nodiscard]] inline std::int64_t _first_global_index(const chunk_coordinate_type& chunk_coords_) const
+		{
+			return chunk_coords_.template at<Dimension_>() * static_cast<std::int64_t>(chunk_size.template at<Dimension_>());
+		}
+
+		/// <summary>
+		/// <para> Calculates the point of the sample at the provided global index in the provided dimension. </para>
+		/// <para> Calculated in double precision before conversion to value_type, as global indices past 2^24 cannot be represented exactly by float. </para>
+		/// </summary>
+		template<std::size_t Dimension_>
+		[[nodiscard]] inline value_type _make_point(const std::int64_t global_index_) const
+		{
+			const double start_ = static_cast<double>(start_point.template at<Dimension_>());
+			const double step_ = static_cast<double>(step.template at<Dimension_>());
+			return static_cast<value_type>(start_ + (step_ * static_cast<double>(global_index_)));
+		}
+
+		/// <summary> Creates a register of the points of num_elements_per_batch consecutive samples along the major dimension, starting at global index first_major_. </summary>
+		[[nodiscard]] inline register_type _make_major_points(const std::int64_t first_major_) const
+		{
+			alignas(register_type) value_type points_[num_elements_per_batch];
+			for (std::size_t i = 0; i < num_elements_per_batch; ++i)
+			{
+				points_[i] = _make_point<major_dimension>(first_major_ + static_cast<std::int64_t>(i));
+			}
+			return EmuSIMD::load<register_type>(points_);
+		}
+
+		[[nodiscard]] inline register_type _invoke_generator
+		(
+			register_type points_major_,
+			register_type points_outer_,
+			register_type points_middle_
+		)
+		{
+			// Points are always passed to the generator in XYZ order, regardless of the order in which they are output
+			if constexpr (num_dimensions == 3)
+			{
+				if constexpr (major_dimension == 0)
+				{
+					return generator(points_major_, points_outer_, points_middle_);
+				}
+				else if constexpr (major_dimension == 1)
+				{
+					return generator(points_outer_, points_major_, points_middle_);
+				}
+				else
+				{
+					return generator(points_outer_, points_middle_, points_major_);
+				}
+			}
+			else if constexpr (num_dimensions == 2)
+			{
+				if constexpr (major_dimension == 0)
+				{
+					return generator(points_major_, points_outer_);
+				}
+				else
+				{
+					return generator(points_outer_, points_major_);
+				}
+			}
+			else
+			{
+				return generator(points_major_);
+			}
+		}
+
+		template<class SampleProcessor_>
+		[[nodiscard]] inline register_type _generate_batch
+		(
+			SampleProcessor_& sample_processor_,
+			register_type points_major_,
+			register_type points_outer_,
+			register_type points_middle_
+		)
+		{
+			return sample_processor_(_invoke_generator(points_major_, points_outer_, points_middle_));
+		}
+
+		/// <summary> Generates a batch of which only the first num_valid_elements_ will be output, passing that count to the processor if it may be invoked with it. </summary>
+		template<class SampleProcessor_>
+		[[nodiscard]] inline register_type _generate_partial_batch
+		(
+			SampleProcessor_& sample_processor_,
+			register_type points_major_,
+			register_type points_outer_,
+			register_type points_middle_,
+			const std::size_t num_valid_elements_
+		)
+		{
+			if constexpr (std::is_invocable_v<SampleProcessor_&, register_type, std::size_t>)
+			{
+				return sample_processor_(_invoke_generator(points_major_, points_outer_, points_middle_), num_valid_elements_);
+			}
+			else
+			{
+				return sample_processor_(_invoke_generator(points_major_, points_outer_, points_middle_));
+			}
+		}
+
+		/// <summary> Generates a contiguous run of size_major_ samples along the major dimension, starting with the sample at global major index first_major_. </summary>
+		template<class SampleProcessor_>
+		inline void _generate_major_run
+		(
+			SampleProcessor_& sample_processor_,
+			value_type* out_run_,
+			const std::int64_t first_major_,
+			const std::size_t size_major_,
+			register_type points_outer_,
+			register_type points_middle_
+		)
+		{
+			const std::size_t end_store_batch_ = size_major_ - (size_major_ % num_elements_per_batch);
+			std::size_t i_ = 0;
+			for (; i_ < end_store_batch_; i_ += num_elements_per_batch)
+			{
+				const register_type points_major_ = _make_major_points(first_major_ + static_cast<std::int64_t>(i_));
+				EmuSIMD::store(_generate_batch(sample_processor_, points_major_, points_outer_, points_middle_), out_run_ + i_);
+			}
+
+			if (i_ < size_major_)
+			{
+				value_type calculated_values_[num_elements_per_batch] = {};
+				EmuSIMD::store
+				(
+					_generate_partial_batch(sample_processor_, _make_major_points(first_major_ + static_cast<std::int64_t>(i_)), points_outer_, points_middle_, size_major_ - i_),
+					calculated_values_
+				);
+				for (std::size_t index_ = 0; i_ < size_major_; ++i_, ++index_)
+				{
+					out_run_[i_] = calculated_values_[index_];
+				}
+			}
+		}
+	};
+}
+
+#endif
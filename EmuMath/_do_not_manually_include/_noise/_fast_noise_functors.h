@@ -4,14 +4,16 @@
 #include "_noise_gen_functors/_simd_noise_gen_1d.h"
 #include "_noise_gen_functors/_simd_noise_gen_2d.h"
 #include "_noise_gen_functors/_simd_noise_gen_3d.h"
+#include "_noise_gen_functors/_simd_noise_gen_4d.h"
 #include "_noise_gen_functors/_simd_fractal_noise_wrapper.h"
+#include "_noise_gen_functors/_simd_domain_warp_wrapper.h"
 
 namespace EmuMath::Functors
 {
 	template<std::size_t Dimensions_, EmuMath::NoiseType NoiseType_, typename Register_ = __m128>
 	struct find_fast_noise_functor
 	{
-		static_assert(Dimensions_ >= 1 && Dimensions_ <= 3, "Attempted to use EmuMath::Functors::find_fast_noise_functor, but provided an invalid number of dimensions.");
+		static_assert(Dimensions_ >= 1 && Dimensions_ <= 4, "Attempted to use EmuMath::Functors::find_fast_noise_functor, but provided an invalid number of dimensions.");
 		static_assert(EmuMath::Validity::assert_valid_noise_type<NoiseType_>(), "Provided an invalid EmuMath::NoiseType to EmuMath::Functors::find_noise_functor.");
 
 		using type = std::conditional_t
@@ -26,7 +28,12 @@ namespace EmuMath::Functors
 				<
 					Dimensions_ == 3,
 					EmuMath::Functors::make_fast_noise_3d<NoiseType_, Register_>,
-					void
+					std::conditional_t
+					<
+						Dimensions_ == 4,
+						EmuMath::Functors::make_fast_noise_4d<NoiseType_, Register_>,
+						void
+					>
 				>
 			>
 		>;
@@ -0,0 +1,145 @@
+#ifndef EMU_MATH_FAST_NOISE_PARALLEL_H_INC_
+#define EMU_MATH_FAST_NOISE_PARALLEL_H_INC_ 1
+
+#include "_noise_tmp.h"
+#include "../../../EmuThreads/BasicThreadPool.h"
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace EmuMath::_underlying_noise_parallel
+{
+	/// <summary>
+	/// <para> Queues num_tasks_ tasks in the provided thread_pool_, invoking task_func_ with each task's index and its own copy of the provided sample_processor_. </para>
+	/// <para>
+	///		The calling thread helps execute the pool's queue until every task queued by this call has finished, and no longer,
+	///		so that calls on a pool shared with other producers are not held up by unrelated work.
+	/// </para>
+	/// <para>
+	///		If the sample processor is mergeable and not const, each task works on its own reset copy, and the results of all tasks are merged into it
+	///		in task order once they have all completed. This keeps merged results deterministic regardless of which threads execute each task.
+	/// </para>
+	/// <para> If any task throws, the first such exception is rethrown once all tasks have finished, and no results are merged. </para>
+	/// </summary>
+	/// <param name="thread_pool_">Thread Pool to queue tasks in. Its func_type must be constructible from a lambda taking no arguments and returning void.</param>
+	/// <param name="num_tasks_">Number of tasks to queue.</param>
+	/// <param name="sample_processor_">Processor that each task copies, and that mergeable results are merged into.</param>
+	/// <param name="task_func_">Function invoked as task_func_(task_index_, task_sample_processor_) by each task. May be invoked concurrently from multiple threads.</param>
+	template<class SampleProcessor_, class PoolFunc_, class SampleProcessorArg_, class TaskFunc_>
+	inline void run_sample_processor_tasks
+	(
+		EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+		const std::size_t num_tasks_,
+		SampleProcessorArg_& sample_processor_,
+		TaskFunc_& task_func_
+	)
+	{
+		using future_type = typename EmuThreads::BasicThreadPool<PoolFunc_>::future_type;
+		constexpr bool merge_task_results_ =
+		(
+			EmuMath::TMP::is_mergeable_noise_sample_processor_v<SampleProcessor_> &&
+			!std::is_const_v<SampleProcessorArg_>
+		);
+
+		std::vector<SampleProcessor_> task_results_;
+		if constexpr (merge_task_results_)
+		{
+			task_results_.reserve(num_tasks_);
+			for (std::size_t task_index_ = 0; task_index_ < num_tasks_; ++task_index_)
+			{
+				task_results_.push_back(static_cast<const SampleProcessor_&>(sample_processor_));
+				task_results_.back().Reset();
+			}
+		}
+
+		std::vector<future_type> task_futures_;
+		task_futures_.reserve(num_tasks_);
+		std::atomic<std::size_t> num_finished_tasks_(0);
+		std::exception_ptr task_exception_ = nullptr;
+		try
+		{
+			for (std::size_t task_index_ = 0; task_index_ < num_tasks_; ++task_index_)
+			{
+				task_futures_.emplace_back
+				(
+					thread_pool_.template AddTaskToQueue<true>
+					(
+						[&sample_processor_, &task_results_, &task_func_, &num_finished_tasks_, task_index_]()
+						{
+							try
+							{
+								if constexpr (merge_task_results_)
+								{
+									task_func_(task_index_, task_results_[task_index_]);
+								}
+								else
+								{
+									SampleProcessor_ task_sample_processor_(static_cast<const SampleProcessor_&>(sample_processor_));
+									task_func_(task_index_, task_sample_processor_);
+								}
+							}
+							catch (...)
+							{
+								num_finished_tasks_.fetch_add(1, std::memory_order_acq_rel);
+								throw;
+							}
+
+							// Must be the final access to this call's state, as the calling thread may return as soon as it observes the last increment
+							num_finished_tasks_.fetch_add(1, std::memory_order_acq_rel);
+						}
+					)
+				);
+			}
+		}
+		catch (...)
+		{
+			// Tasks that were already queued reference this function's locals, so they are still awaited below
+			task_exception_ = std::current_exception();
+		}
+
+		// Help with the pool's queue only until our own tasks have finished, rather than until the (possibly shared) pool is drained
+		const std::size_t num_queued_tasks_ = task_futures_.size();
+		auto all_finished_ = [&num_finished_tasks_, num_queued_tasks_]() { return num_finished_tasks_.load(std::memory_order_acquire) == num_queued_tasks_; };
+		while (!all_finished_())
+		{
+			if (!thread_pool_.UseThisThreadForCurrentQueue(all_finished_) && !all_finished_())
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		// Every task has finished its work, so these only wait for each result to be published before collecting exceptions
+		for (auto& task_future_ : task_futures_)
+		{
+			try
+			{
+				task_future_.get();
+			}
+			catch (...)
+			{
+				if (!task_exception_)
+				{
+					task_exception_ = std::current_exception();
+				}
+			}
+		}
+
+		if (task_exception_)
+		{
+			std::rethrow_exception(task_exception_);
+		}
+
+		if constexpr (merge_task_results_)
+		{
+			for (const auto& task_result_ : task_results_)
+			{
+				sample_processor_.Merge(task_result_);
+			}
+		}
+	}
+}
+
+#endif
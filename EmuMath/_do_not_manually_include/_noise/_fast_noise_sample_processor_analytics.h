@@ -0,0 +1,416 @@
+#ifndef EMU_MATH_FAST_NOISE_SAMPLE_PROCESSOR_ANALYTICS_H_INC_
+#define EMU_MATH_FAST_NOISE_SAMPLE_PROCESSOR_ANALYTICS_H_INC_ 1
+
+#include "../../../EmuSIMD/SIMDHelpers.h"
+#include "../../../EmuCore/TMPHelpers/TypeComparators.h"
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace EmuMath::Functors
+{
+	namespace _underlying_fast_analytics
+	{
+		template<class Register_>
+		using value_type = std::conditional_t
+		<
+			EmuCore::TMP::is_any_comparison_true<std::is_same, Register_, EmuSIMD::f32x4, EmuSIMD::f32x8, EmuSIMD::f32x16>::value,
+			float,
+			double
+		>;
+
+		template<class Register_>
+		static constexpr std::size_t num_elements = EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type<Register_>) * 8);
+
+		/// <summary> Creates a mask register where only the first num_valid_elements_ elements are set. </summary>
+		template<class Register_>
+		[[nodiscard]] inline Register_ valid_mask(const std::size_t num_valid_elements_)
+		{
+			return EmuSIMD::cmplt
+			(
+				EmuSIMD::setr_incrementing<Register_, 0>(),
+				EmuSIMD::set1<Register_>(static_cast<value_type<Register_>>(num_valid_elements_))
+			);
+		}
+
+		/// <summary>
+		/// <para> Running per-element sum of registers, using Kahan compensation to limit the error accumulated when summing large tables in single precision. </para>
+		/// <para> The compensated total of each element is equal to sum_register - compensation_register. </para>
+		/// </summary>
+		template<class Register_>
+		struct compensated_sum
+		{
+			compensated_sum() :
+				sum_register(EmuSIMD::setzero<Register_>()),
+				compensation_register(EmuSIMD::setzero<Register_>())
+			{
+			}
+
+			inline void Reset()
+			{
+				sum_register = EmuSIMD::setzero<Register_>();
+				compensation_register = EmuSIMD::setzero<Register_>();
+			}
+
+			inline void Add(Register_ values_)
+			{
+				Register_ compensated_values_ = EmuSIMD::sub(values_, compensation_register);
+				Register_ new_sum_ = EmuSIMD::add(sum_register, compensated_values_);
+				compensation_register = EmuSIMD::sub(EmuSIMD::sub(new_sum_, sum_register), compensated_values_);
+				sum_register = new_sum_;
+			}
+
+			inline void Merge(const compensated_sum& other_)
+			{
+				Add(other_.sum_register);
+				compensation_register = EmuSIMD::add(compensation_register, other_.compensation_register);
+			}
+
+			/// <summary> Reduces all elements to a single total. Elements are combined in double precision. </summary>
+			[[nodiscard]] inline double Total() const
+			{
+				value_type<Register_> sums_[num_elements<Register_>] = {};
+				value_type<Register_> compensations_[num_elements<Register_>] = {};
+				EmuSIMD::store(sum_register, sums_);
+				EmuSIMD::store(compensation_register, compensations_);
+
+				double total_ = 0.0;
+				for (std::size_t i_ = 0; i_ < num_elements<Register_>; ++i_)
+				{
+					total_ += static_cast<double>(sums_[i_]) - static_cast<double>(compensations_[i_]);
+				}
+				return total_;
+			}
+
+			Register_ sum_register;
+			Register_ compensation_register;
+		};
+	}
+
+	/// <summary>
+	/// <para> SIMD analytic functor for tracking a minimum value. Minimums are tracked per register element, and only reduced to a single value when read. </para>
+	/// <para> May be used as an analytic of noise_sample_processor_with_analytics, and merged with other instances to combine per-thread results. </para>
+	/// </summary>
+	template<EmuConcepts::KnownSIMD SIMDRegister_>
+	requires(EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>)
+	struct fast_analytic_track_min
+	{
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		using value_type = _underlying_fast_analytics::value_type<register_type>;
+		static constexpr std::size_t num_elements = _underlying_fast_analytics::num_elements<register_type>;
+		static constexpr value_type _reset_value = std::numeric_limits<value_type>::max();
+
+		fast_analytic_track_min() : min_register(EmuSIMD::set1<register_type>(_reset_value))
+		{
+		}
+
+		inline void Reset()
+		{
+			min_register = EmuSIMD::set1<register_type>(_reset_value);
+		}
+
+		inline void operator()(register_type samples_)
+		{
+			min_register = EmuSIMD::min(min_register, samples_);
+		}
+
+		/// <summary> Tracks only the first num_valid_elements_ elements of samples_. </summary>
+		inline void operator()(register_type samples_, const std::size_t num_valid_elements_)
+		{
+			const register_type mask_ = _underlying_fast_analytics::valid_mask<register_type>(num_valid_elements_);
+			min_register = EmuSIMD::min(min_register, EmuSIMD::blendv(EmuSIMD::set1<register_type>(_reset_value), samples_, mask_));
+		}
+
+		inline void Merge(const fast_analytic_track_min& other_)
+		{
+			min_register = EmuSIMD::min(min_register, other_.min_register);
+		}
+
+		/// <returns>Minimum value tracked by this analytic, or _reset_value if nothing has been tracked.</returns>
+		[[nodiscard]] inline value_type MinValue() const
+		{
+			value_type elements_[num_elements] = {};
+			EmuSIMD::store(min_register, elements_);
+
+			value_type min_value_ = elements_[0];
+			for (std::size_t i_ = 1; i_ < num_elements; ++i_)
+			{
+				if (elements_[i_] < min_value_)
+				{
+					min_value_ = elements_[i_];
+				}
+			}
+			return min_value_;
+		}
+
+		register_type min_register;
+	};
+
+	/// <summary>
+	/// <para> SIMD analytic functor for tracking a maximum value. Maximums are tracked per register element, and only reduced to a single value when read. </para>
+	/// <para> May be used as an analytic of noise_sample_processor_with_analytics, and merged with other instances to combine per-thread results. </para>
+	/// </summary>
+	template<EmuConcepts::KnownSIMD SIMDRegister_>
+	requires(EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>)
+	struct fast_analytic_track_max
+	{
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		using value_type = _underlying_fast_analytics::value_type<register_type>;
+		static constexpr std::size_t num_elements = _underlying_fast_analytics::num_elements<register_type>;
+		static constexpr value_type _reset_value = std::numeric_limits<value_type>::lowest();
+
+		fast_analytic_track_max() : max_register(EmuSIMD::set1<register_type>(_reset_value))
+		{
+		}
+
+		inline void Reset()
+		{
+			max_register = EmuSIMD::set1<register_type>(_reset_value);
+		}
+
+		inline void operator()(register_type samples_)
+		{
+			max_register = EmuSIMD::max(max_register, samples_);
+		}
+
+		/// <summary> Tracks only the first num_valid_elements_ elements of samples_. </summary>
+		inline void operator()(register_type samples_, const std::size_t num_valid_elements_)
+		{
+			const register_type mask_ = _underlying_fast_analytics::valid_mask<register_type>(num_valid_elements_);
+			max_register = EmuSIMD::max(max_register, EmuSIMD::blendv(EmuSIMD::set1<register_type>(_reset_value), samples_, mask_));
+		}
+
+		inline void Merge(const fast_analytic_track_max& other_)
+		{
+			max_register = EmuSIMD::max(max_register, other_.max_register);
+		}
+
+		/// <returns>Maximum value tracked by this analytic, or _reset_value if nothing has been tracked.</returns>
+		[[nodiscard]] inline value_type MaxValue() const
+		{
+			value_type elements_[num_elements] = {};
+			EmuSIMD::store(max_register, elements_);
+
+			value_type max_value_ = elements_[0];
+			for (std::size_t i_ = 1; i_ < num_elements; ++i_)
+			{
+				if (elements_[i_] > max_value_)
+				{
+					max_value_ = elements_[i_];
+				}
+			}
+			return max_value_;
+		}
+
+		register_type max_register;
+	};
+
+	/// <summary>
+	/// <para> SIMD analytic functor for tracking the sum and number of samples. Sums are compensated, and only reduced to a single value when read. </para>
+	/// <para> May be used as an analytic of noise_sample_processor_with_analytics, and merged with other instances to combine per-thread results. </para>
+	/// </summary>
+	template<EmuConcepts::KnownSIMD SIMDRegister_>
+	requires(EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>)
+	struct fast_analytic_sum
+	{
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		using value_type = _underlying_fast_analytics::value_type<register_type>;
+		static constexpr std::size_t num_elements = _underlying_fast_analytics::num_elements<register_type>;
+
+		fast_analytic_sum() : sum(), count(0)
+		{
+		}
+
+		inline void Reset()
+		{
+			sum.Reset();
+			count = 0;
+		}
+
+		inline void operator()(register_type samples_)
+		{
+			sum.Add(samples_);
+			count += num_elements;
+		}
+
+		/// <summary> Sums only the first num_valid_elements_ elements of samples_. </summary>
+		inline void operator()(register_type samples_, const std::size_t num_valid_elements_)
+		{
+			const register_type mask_ = _underlying_fast_analytics::valid_mask<register_type>(num_valid_elements_);
+			sum.Add(EmuSIMD::bitwise_and(samples_, mask_));
+			count += num_valid_elements_;
+		}
+
+		inline void Merge(const fast_analytic_sum& other_)
+		{
+			sum.Merge(other_.sum);
+			count += other_.count;
+		}
+
+		[[nodiscard]] inline value_type Sum() const
+		{
+			return static_cast<value_type>(sum.Total());
+		}
+
+		/// <returns>Mean of all samples summed by this analytic, or 0 if no samples have been summed.</returns>
+		[[nodiscard]] inline value_type Mean() const
+		{
+			return count == 0 ? value_type(0) : static_cast<value_type>(sum.Total() / static_cast<double>(count));
+		}
+
+		_underlying_fast_analytics::compensated_sum<register_type> sum;
+		std::size_t count;
+	};
+
+	/// <summary>
+	/// <para> SIMD analytic functor for tracking the sum of squared samples, and number of samples. Sums are compensated, and only reduced to a single value when read. </para>
+	/// <para> Combined with fast_analytic_sum, this allows the variance of samples to be calculated without an additional pass over them. </para>
+	/// </summary>
+	template<EmuConcepts::KnownSIMD SIMDRegister_>
+	requires(EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>)
+	struct fast_analytic_sum_of_squares
+	{
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		using value_type = _underlying_fast_analytics::value_type<register_type>;
+		static constexpr std::size_t num_elements = _underlying_fast_analytics::num_elements<register_type>;
+
+		fast_analytic_sum_of_squares() : sum_of_squares(), count(0)
+		{
+		}
+
+		inline void Reset()
+		{
+			sum_of_squares.Reset();
+			count = 0;
+		}
+
+		inline void operator()(register_type samples_)
+		{
+			sum_of_squares.Add(EmuSIMD::mul_all(samples_, samples_));
+			count += num_elements;
+		}
+
+		/// <summary> Sums the squares of only the first num_valid_elements_ elements of samples_. </summary>
+		inline void operator()(register_type samples_, const std::size_t num_valid_elements_)
+		{
+			const register_type mask_ = _underlying_fast_analytics::valid_mask<register_type>(num_valid_elements_);
+			samples_ = EmuSIMD::bitwise_and(samples_, mask_);
+			sum_of_squares.Add(EmuSIMD::mul_all(samples_, samples_));
+			count += num_valid_elements_;
+		}
+
+		inline void Merge(const fast_analytic_sum_of_squares& other_)
+		{
+			sum_of_squares.Merge(other_.sum_of_squares);
+			count += other_.count;
+		}
+
+		[[nodiscard]] inline value_type SumOfSquares() const
+		{
+			return static_cast<value_type>(sum_of_squares.Total());
+		}
+
+		/// <summary> Calculates the variance of all tracked samples, using their mean as calculated by a fast_analytic_sum which tracked the same samples. </summary>
+		/// <returns>Population variance of all tracked samples, or 0 if no samples have been tracked.</returns>
+		[[nodiscard]] inline value_type Variance(const value_type mean_) const
+		{
+			if (count == 0)
+			{
+				return value_type(0);
+			}
+			else
+			{
+				const double mean_double_ = static_cast<double>(mean_);
+				const double variance_ = (sum_of_squares.Total() / static_cast<double>(count)) - (mean_double_ * mean_double_);
+				return variance_ <= 0.0 ? value_type(0) : static_cast<value_type>(variance_);
+			}
+		}
+
+		_underlying_fast_analytics::compensated_sum<register_type> sum_of_squares;
+		std::size_t count;
+	};
+
+	/// <summary>
+	/// <para> SIMD analytic functor for counting samples into NumBins_ bins of equal width, spanning the range [range_min, range_max). </para>
+	/// <para> Bin indices are calculated for a full register at once. Samples outside of the range are counted in the nearest bin at the end of the range. </para>
+	/// <para> May be used as an analytic of noise_sample_processor_with_analytics, and merged with other instances to combine per-thread results. </para>
+	/// </summary>
+	template<EmuConcepts::KnownSIMD SIMDRegister_, std::size_t NumBins_>
+	requires(EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_> && NumBins_ > 0)
+	struct fast_analytic_histogram
+	{
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		using value_type = _underlying_fast_analytics::value_type<register_type>;
+		using bin_array = std::array<std::size_t, NumBins_>;
+		static constexpr std::size_t num_elements = _underlying_fast_analytics::num_elements<register_type>;
+		static constexpr std::size_t num_bins = NumBins_;
+
+		/// <summary> Creates a histogram spanning the range [0, 1), which is the output range of normalised noise. </summary>
+		fast_analytic_histogram() : fast_analytic_histogram(value_type(0), value_type(1))
+		{
+		}
+		fast_analytic_histogram(const value_type range_min_, const value_type range_max_) :
+			range_min(range_min_),
+			range_max(range_max_),
+			range_min_register(EmuSIMD::set1<register_type>(range_min_)),
+			bin_scale_register(EmuSIMD::set1<register_type>(static_cast<value_type>(num_bins) / (range_max_ - range_min_))),
+			max_bin_register(EmuSIMD::set1<register_type>(static_cast<value_type>(num_bins - 1))),
+			bins()
+		{
+		}
+
+		inline void Reset()
+		{
+			bins.fill(0);
+		}
+
+		inline void operator()(register_type samples_)
+		{
+			_count_bins(samples_, num_elements);
+		}
+
+		/// <summary> Counts only the first num_valid_elements_ elements of samples_. </summary>
+		inline void operator()(register_type samples_, const std::size_t num_valid_elements_)
+		{
+			_count_bins(samples_, num_valid_elements_);
+		}
+
+		inline void Merge(const fast_analytic_histogram& other_)
+		{
+			for (std::size_t i_ = 0; i_ < num_bins; ++i_)
+			{
+				bins[i_] += other_.bins[i_];
+			}
+		}
+
+		/// <returns>Inclusive lower bound of values counted into the bin at the provided index.</returns>
+		[[nodiscard]] inline value_type BinMin(const std::size_t bin_index_) const
+		{
+			return range_min + ((range_max - range_min) * static_cast<value_type>(bin_index_)) / static_cast<value_type>(num_bins);
+		}
+
+		value_type range_min;
+		value_type range_max;
+		register_type range_min_register;
+		register_type bin_scale_register;
+		register_type max_bin_register;
+		bin_array bins;
+
+	private:
+		inline void _count_bins(register_type samples_, const std::size_t num_valid_elements_)
+		{
+			register_type bin_indices_ = EmuSIMD::mul_all(EmuSIMD::sub(samples_, range_min_register), bin_scale_register);
+			bin_indices_ = EmuSIMD::floor(EmuSIMD::clamp(bin_indices_, EmuSIMD::setzero<register_type>(), max_bin_register));
+
+			value_type bin_index_elements_[num_elements] = {};
+			EmuSIMD::store(bin_indices_, bin_index_elements_);
+			for (std::size_t i_ = 0; i_ < num_valid_elements_; ++i_)
+			{
+				++bins[static_cast<std::size_t>(bin_index_elements_[i_])];
+			}
+		}
+	};
+}
+
+#endif
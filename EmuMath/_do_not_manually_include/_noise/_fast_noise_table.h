@@ -3,14 +3,25 @@
 
 #include "_fast_noise_sample_processors.h"
 #include "_fast_noise_functors.h"
+#include "_fast_noise_parallel.h"
 #include "_noise_table_options.h"
+#include "_noise_table_export.h"
+#include "_noise_table_storage.h"
 #include "_noise_tmp.h"
+#include "_noise_info/_domain_warp_info.h"
 #include "../../../EmuSIMD/SIMDHelpers.h"
 #include "../../../EmuCore/TMPHelpers/TypeComparators.h"
 #include "../../../EmuCore/TMPHelpers/TypeConvertors.h"
 #include "../../../EmuCore/TMPHelpers/Values.h"
+#include "../../../EmuThreads/BasicThreadPool.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <future>
 #include <ostream>
 #include <sstream>
+#include <type_traits>
 #include <vector>
 
 namespace EmuMath
@@ -23,8 +34,23 @@ namespace EmuMath
 	///		(as they will be separated to allow better access to large tables). 
 	/// </para>
 	/// <para> It is recommended to use a MajorDimensionIndex_ that best suits the largest dimension in which noise will be generated (e.g. Y (1) for a 256x2048 table). </para>
+	/// <para>
+	///		StorageMode_ determines how samples are stored. FLAT storage keeps all samples in a single 64-byte-aligned allocation with dense strides,
+	///		following the same layer order as NESTED storage.
+	/// </para>
+	/// <para>
+	///		SampleTypeFP_ is the type of samples and coordinates, and must be float or double. 
+	///		Double tables are generated with 64-bit floating-point registers, avoiding the precision loss of 32-bit coordinates far from the origin.
+	/// </para>
+	/// <para> Double tables are currently only available for 3 dimensions, as 64-bit noise generation is only implemented for 3-dimensional noise. </para>
 	/// </summary>
-	template<std::size_t NumDimensions_, std::size_t MajorDimensionIndex_ = NumDimensions_ - 1>
+	template
+	<
+		std::size_t NumDimensions_,
+		std::size_t MajorDimensionIndex_ = NumDimensions_ - 1,
+		EmuMath::NoiseTableStorageMode StorageMode_ = EmuMath::NoiseTableStorageMode::DEFAULT,
+		typename SampleTypeFP_ = float
+	>
 	class FastNoiseTable
 	{
 	public:
@@ -34,15 +60,28 @@ namespace EmuMath
 			MajorDimensionIndex_ < NumDimensions_,
 			"Provided an invalid MajorDimensionIndex_ value to instantiate an EmuMath::FastNoiseTable template. The provided value must be less than NumDimensions_."
 		);
+		static_assert
+		(
+			std::is_same_v<SampleTypeFP_, float> || std::is_same_v<SampleTypeFP_, double>,
+			"Provided an invalid SampleTypeFP_ value to instantiate an EmuMath::FastNoiseTable template. Samples must be float or double."
+		);
+		static_assert
+		(
+			std::is_same_v<SampleTypeFP_, float> || NumDimensions_ == 3,
+			"Provided an invalid SampleTypeFP_ value to instantiate an EmuMath::FastNoiseTable template. Double samples are only available for 3-dimensional tables."
+		);
 
 		static constexpr std::size_t num_dimensions = NumDimensions_;
 		static constexpr std::size_t major_dimension = MajorDimensionIndex_;
 		static constexpr std::size_t default_register_width = 128;
-		using value_type = float;
-		using this_type = FastNoiseTable<NumDimensions_, MajorDimensionIndex_>;
+		static constexpr EmuMath::NoiseTableStorageMode storage_mode = StorageMode_;
+		static constexpr bool is_flat = storage_mode == EmuMath::NoiseTableStorageMode::FLAT;
+		using value_type = SampleTypeFP_;
+		using this_type = FastNoiseTable<NumDimensions_, MajorDimensionIndex_, StorageMode_, SampleTypeFP_>;
 		using options_type = EmuMath::NoiseTableOptions<NumDimensions_, value_type>;
+		using warp_info_type = EmuMath::Info::DomainWarpInfo<value_type>;
 		using coordinate_type = EmuMath::Vector<num_dimensions, std::size_t>;
-		using default_simd_register_type = EmuSIMD::f32x4;
+		using default_simd_register_type = typename std::conditional<std::is_same_v<value_type, double>, EmuSIMD::f64x2, EmuSIMD::f32x4>::type;
 
 		template<std::size_t Size_, typename T_>
 		[[nodiscard]] static inline coordinate_type make_coords_from_vector(const EmuMath::Vector<Size_, T_>& vector_)
@@ -104,8 +143,16 @@ namespace EmuMath
 		}
 
 	private:
-		/// <summary>table_storage will be a Dimensions_-dimensional vector of value_types.</summary>
-		using table_storage = EmuMath::TMP::_full_noise_table_storage<num_dimensions, value_type>;
+		/// <summary>table_storage will be a Dimensions_-dimensional vector of value_types, or a single flat allocation of value_types if this table is flat.</summary>
+		using table_storage = EmuMath::TMP::_noise_table_storage<num_dimensions, value_type, storage_mode>;
+
+		using _layout = EmuMath::TMP::_noise_table_layout<num_dimensions, major_dimension>;
+		/// <summary> Dimension iterated by the outermost layer of storage. Follows the alphabetical-excluding-major storage order. </summary>
+		static constexpr std::size_t _outer_dimension = _layout::outer_dimension;
+		/// <summary> Dimension iterated by the middle layer of storage. Only meaningful for 3-dimensional tables. </summary>
+		static constexpr std::size_t _middle_dimension = _layout::middle_dimension;
+		/// <summary> Number of tasks to aim for per thread when generating in parallel, allowing faster threads to pick up slack. </summary>
+		static constexpr std::size_t _parallel_tasks_per_thread = 4;
 
 		template<std::size_t Unused_>
 		[[nodiscard]] static constexpr inline bool _can_do_1d_only_funcs()
@@ -131,22 +178,22 @@ namespace EmuMath
 		{
 		}
 
-		FastNoiseTable(const FastNoiseTable<NumDimensions_, MajorDimensionIndex_>& to_copy_) : samples(to_copy_.samples), table_size(to_copy_.table_size)
+		FastNoiseTable(const this_type& to_copy_) : samples(to_copy_.samples), table_size(to_copy_.table_size)
 		{
 		}
 
-		FastNoiseTable(FastNoiseTable<NumDimensions_, MajorDimensionIndex_>&& to_move_) noexcept : samples(std::move(to_move_.samples)), table_size(std::move(to_move_.table_size))
+		FastNoiseTable(this_type&& to_move_) noexcept : samples(std::move(to_move_.samples)), table_size(std::move(to_move_.table_size))
 		{
 		}
 
-		FastNoiseTable<NumDimensions_, MajorDimensionIndex_>& operator=(const FastNoiseTable<NumDimensions_, MajorDimensionIndex_>& rhs_)
+		this_type& operator=(const this_type& rhs_)
 		{
 			this->samples = rhs_.samples;
 			this->table_size = rhs_.table_size;
 			return *this;
 		}
 
-		FastNoiseTable<NumDimensions_, MajorDimensionIndex_>& operator=(FastNoiseTable<NumDimensions_, MajorDimensionIndex_>&& rhs_) noexcept
+		this_type& operator=(this_type&& rhs_) noexcept
 		{
 			this->samples = std::move(rhs_.samples);
 			this->table_size = std::move(rhs_.table_size);
@@ -235,6 +282,90 @@ namespace EmuMath
 			}
 		}
 
+		/// <summary>
+		/// <para> Provides constant access to the contiguous samples of this table. This method is only available for tables using FLAT storage. </para>
+		/// <para>
+		///		Samples are stored in alphabetical order excluding the major dimension, which is always innermost
+		///		(i.e. X-major is stored YZX, Y-major stored XZY, Z-major stored XYZ). Strides are dense, based on the table's current size.
+		/// </para>
+		/// </summary>
+		/// <returns>Pointer to the first sample of this table, aligned to a 64-byte boundary.</returns>
+		[[nodiscard]] inline const value_type* data() const
+		{
+			if constexpr (is_flat)
+			{
+				return samples.data();
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<std::size_t, num_dimensions>(), "Attempted to access the contiguous data of an EmuMath::FastNoiseTable which does not use FLAT storage.");
+				return nullptr;
+			}
+		}
+
+#pragma region EXPORT
+		/// <summary>
+		/// <para> Writes all samples of this table to the provided binary stream as raw 32-bit floats in native byte order, without any header. </para>
+		/// <para>
+		///		Samples are written with X varying fastest, followed by Y and then Z, regardless of this table's major dimension.
+		///		Rows which are contiguous in storage are written straight from it; others are transposed in small bands.
+		/// </para>
+		/// </summary>
+		/// <param name="str_">Binary stream to write samples to.</param>
+		/// <returns>Reference to the passed stream.</returns>
+		inline std::ostream& WriteRawFloat32(std::ostream& str_) const
+		{
+			return EmuMath::_underlying_noise_export::write_raw_float32(str_, [this](auto& row_func_) { _for_each_export_row(row_func_); });
+		}
+
+		/// <summary>
+		/// <para> Writes this table to the provided binary stream as a 16-bit binary PGM (P5) image. This method is only available for 2-dimensional tables. </para>
+		/// <para> Each row of the image contains samples of increasing X, with rows written in order of increasing Y. </para>
+		/// <para> Samples are quantised so that min_ maps to 0 and max_ maps to 65535, with samples outside of this range clamped. </para>
+		/// </summary>
+		/// <param name="str_">Binary stream to write the image to.</param>
+		/// <param name="min_">Sample value to output as black.</param>
+		/// <param name="max_">Sample value to output as white.</param>
+		/// <returns>Reference to the passed stream.</returns>
+		template<std::size_t Unused_ = 0, typename OnlyAvailableFor2Dimensional_ = std::enable_if_t<_can_do_2d_only_funcs<Unused_>()>>
+		inline std::ostream& WritePGM16(std::ostream& str_, const value_type min_ = value_type(0), const value_type max_ = value_type(1)) const
+		{
+			return EmuMath::_underlying_noise_export::write_pgm16
+			(
+				str_,
+				table_size.template at<0>(),
+				table_size.template at<1>(),
+				min_,
+				max_,
+				[this](auto& row_func_) { _for_each_export_row(row_func_); }
+			);
+		}
+
+		/// <summary>
+		/// <para> Quantises this table to 8-bit grayscale, invoking row_func_ for every row. This method is only available for 2-dimensional tables. </para>
+		/// <para>
+		///		row_func_ is invoked with a pointer to the row's samples as std::uint8_t, and the number of samples in the row.
+		///		Rows match PNG's 8-bit grayscale format without a filter byte, so they may be passed straight to row-based PNG encoders.
+		/// </para>
+		/// <para> Each row contains samples of increasing X, with rows provided in order of increasing Y. The quantised row is only valid during the call. </para>
+		/// </summary>
+		/// <param name="row_func_">Function to invoke with every quantised row.</param>
+		/// <param name="min_">Sample value to output as 0.</param>
+		/// <param name="max_">Sample value to output as 255.</param>
+		template<class RowFunc_, std::size_t Unused_ = 0, typename OnlyAvailableFor2Dimensional_ = std::enable_if_t<_can_do_2d_only_funcs<Unused_>()>>
+		inline void ForEachGrayscale8Row(RowFunc_&& row_func_, const value_type min_ = value_type(0), const value_type max_ = value_type(1)) const
+		{
+			EmuMath::_underlying_noise_export::for_each_grayscale8_row
+			(
+				table_size.template at<0>(),
+				min_,
+				max_,
+				[this](auto& export_row_func_) { _for_each_export_row(export_row_func_); },
+				row_func_
+			);
+		}
+#pragma endregion
+
 #pragma region GENERATION
 		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_>
 		inline bool GenerateNoise(const options_type& options_, SampleProcessor_&& sample_processor_)
@@ -300,303 +431,1494 @@ namespace EmuMath
 		{
 			return GenerateNoise<NoiseType_>(options_, SampleProcessor_());
 		}
-#pragma endregion
-
-	private:
-		table_storage samples;
-		coordinate_type table_size;
 
-		template<class Generator_, class SampleProcessor_, class OutLayer_, class Register_>
-		inline void _finish_major_segment_partial
+		/// <summary>
+		/// <para> Regenerates only the samples within the axis-aligned box [region_begin_, region_end_) of this table, leaving all other samples untouched. </para>
+		/// <para>
+		///		This table must already be sized to the table_resolution of the provided options_, such as by a previous call to GenerateNoise.
+		///		The table is never resized, so the cost of regeneration is proportional to the size of the region rather than the size of the table.
+		/// </para>
+		/// <para>
+		///		Points within the region are calculated from the start point and step of the provided options_ in the same way as full generation,
+		///		so regenerated samples are bit-identical to those that GenerateNoise would produce with the same arguments.
+		/// </para>
+		/// <para> The sample_processor_ is only invoked for samples within the region. </para>
+		/// </summary>
+		/// <param name="options_">Options to use for generating noise. Its table_resolution must match the current size of this table.</param>
+		/// <param name="region_begin_">Inclusive coordinates of the first sample to regenerate.</param>
+		/// <param name="region_end_">Exclusive coordinates at which to stop regenerating samples. Each coordinate may be at most the table's size in that dimension.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of samples.</param>
+		/// <returns>True if the region was valid and successfully regenerated; otherwise false, in which case this table is unmodified.</returns>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_>
+		inline bool GenerateNoiseRegion
 		(
-			Generator_& generator_,
-			SampleProcessor_& sample_processor_,
-			OutLayer_& out_layer_,
-			Register_ points_x_,
-			Register_ points_y_,
-			Register_ points_z_,
-			std::size_t i_,
-			const std::size_t end_
+			const options_type& options_,
+			const coordinate_type& region_begin_,
+			const coordinate_type& region_end_,
+			SampleProcessor_&& sample_processor_
 		)
 		{
-			if (i_ < end_)
+			using sample_processor_no_ref = typename std::remove_reference<SampleProcessor_>::type;
+			using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+
+			if (_valid_region(options_.table_resolution, region_begin_, region_end_))
 			{
-				Register_ sample_batch_ = sample_processor_(generator_(points_x_, points_y_, points_z_));
-				if ((i_ + 1) == end_)
-				{
-					out_layer_[i_] = EmuSIMD::get_index<0, value_type>(sample_batch_);
-				}
-				else
-				{
-					value_type calculated_values_[EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8)] = {};
-					EmuSIMD::store(sample_batch_, calculated_values_);
-					for (std::size_t index_ = 0; i_ < end_; ++i_, ++index_)
+				_with_generator<register_type, EmuMath::fast_noise_gen_functor<num_dimensions, NoiseType_, register_type>>
+				(
+					options_.freq,
+					options_.use_fractal_noise,
+					options_.permutation_info,
+					options_.fractal_noise_info,
+					[&](auto&& generator_)
 					{
-						out_layer_[i_] = calculated_values_[index_];
+						_do_region_generation<register_type, typename std::remove_cvref<decltype(generator_)>::type&, sample_processor_no_ref&>
+						(
+							generator_,
+							sample_processor_,
+							options_.start_point,
+							options_.MakeStep(),
+							region_begin_,
+							region_end_
+						);
 					}
-				}
+				);
+				return true;
+			}
+			else
+			{
+				return false;
 			}
 		}
-		template<class Generator_, class SampleProcessor_, class OutLayer_, class Register_>
-		inline void _finish_major_segment_partial
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_>
+		inline bool GenerateNoiseRegion
 		(
-			Generator_& generator_,
-			SampleProcessor_& sample_processor_,
-			OutLayer_& out_layer_,
-			Register_ points_x_,
-			Register_ points_y_,
-			std::size_t i_,
-			const std::size_t end_
+			const options_type& options_,
+			const coordinate_type& region_begin_,
+			const coordinate_type& region_end_,
+			SampleProcessor_&& sample_processor_
 		)
 		{
-			if (i_ < end_)
+			return GenerateNoiseRegion<default_simd_register_type, NoiseType_>(options_, region_begin_, region_end_, std::forward<SampleProcessor_>(sample_processor_));
+		}
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateNoiseRegion(const options_type& options_, const coordinate_type& region_begin_, const coordinate_type& region_end_)
+		{
+			return GenerateNoiseRegion<SIMDRegister_, NoiseType_>(options_, region_begin_, region_end_, SampleProcessor_());
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateNoiseRegion(const options_type& options_, const coordinate_type& region_begin_, const coordinate_type& region_end_)
+		{
+			return GenerateNoiseRegion<NoiseType_>(options_, region_begin_, region_end_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Parallel equivalent of GenerateNoise, dividing generation of this table into tasks which are executed by the provided thread_pool_. </para>
+		/// <para> The calling thread will contribute to executing tasks, and this function will not return until all of its tasks have been completed. </para>
+		/// <para> Output is bit-identical to that of GenerateNoise with the same arguments. </para>
+		/// <para>
+		///		The sample_processor_ is copied for every task, so it must be copy-constructible. 
+		///		Any state that the processor changes when invoked will not be reflected in the passed sample_processor_,
+		///		unless it is a non-const mergeable processor (see EmuMath::TMP::is_mergeable_noise_sample_processor).
+		/// </para>
+		/// <para>
+		///		Mergeable processors are reset for each task, and the results of every task are merged into the passed sample_processor_ once generation completes.
+		///		This allows analytics such as EmuMath::Functors::fast_analytic_track_min to be gathered without an additional pass over the table.
+		/// </para>
+		/// <para> If the generator or sample processor throws within any task, the first such exception is rethrown once all tasks have finished, as with GenerateNoise. </para>
+		/// </summary>
+		/// <param name="thread_pool_">Thread Pool to queue generation tasks in. Its func_type must be constructible from a lambda taking no arguments and returning void.</param>
+		/// <param name="options_">Options to use for generating noise.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of samples.</param>
+		/// <returns>True if noise was successfully generated; otherwise false.</returns>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_, class PoolFunc_>
+		inline bool GenerateNoiseParallel(EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_, const options_type& options_, SampleProcessor_&& sample_processor_)
+		{
+			using sample_processor_no_ref = typename std::remove_cvref<SampleProcessor_>::type;
+			using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+
+			if (_valid_resolution(options_.table_resolution))
 			{
-				Register_ sample_batch_ = sample_processor_(generator_(points_x_, points_y_));
-				if ((i_ + 1) == end_)
-				{
-					out_layer_[i_] = EmuSIMD::get_index<0, value_type>(sample_batch_);
-				}
-				else
-				{
-					value_type calculated_values_[EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8)] = {};
-					EmuSIMD::store(sample_batch_, calculated_values_);
-					for (std::size_t index_ = 0; i_ < end_; ++i_, ++index_)
+				_do_resize(options_.table_resolution);
+				_with_generator<register_type, EmuMath::fast_noise_gen_functor<num_dimensions, NoiseType_, register_type>>
+				(
+					options_.freq,
+					options_.use_fractal_noise,
+					options_.permutation_info,
+					options_.fractal_noise_info,
+					[&](auto&& generator_)
 					{
-						out_layer_[i_] = calculated_values_[index_];
+						using generator_type = typename std::remove_cvref<decltype(generator_)>::type;
+						_do_generation_parallel<register_type, generator_type, sample_processor_no_ref>
+						(
+							thread_pool_,
+							generator_,
+							sample_processor_,
+							options_.start_point,
+							options_.MakeStep()
+						);
 					}
-				}
+				);
+				return true;
+			}
+			else
+			{
+				return false;
 			}
 		}
-		template<class Generator_, class SampleProcessor_, class OutLayer_, class Register_>
-		inline void _finish_major_segment_partial
-		(
-			Generator_& generator_,
-			SampleProcessor_& sample_processor_,
-			OutLayer_& out_layer_,
-			Register_ points_x_,
-			std::size_t i_,
-			const std::size_t end_
-		)
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_, class PoolFunc_>
+		inline bool GenerateNoiseParallel(EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_, const options_type& options_, SampleProcessor_&& sample_processor_)
 		{
-			if (i_ < end_)
+			return GenerateNoiseParallel<default_simd_register_type, NoiseType_>(thread_pool_, options_, std::forward<SampleProcessor_>(sample_processor_));
+		}
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, class PoolFunc_>
+		inline bool GenerateNoiseParallel(EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_, const options_type& options_)
+		{
+			return GenerateNoiseParallel<SIMDRegister_, NoiseType_>(thread_pool_, options_, SampleProcessor_());
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, class PoolFunc_>
+		inline bool GenerateNoiseParallel(EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_, const options_type& options_)
+		{
+			return GenerateNoiseParallel<NoiseType_>(thread_pool_, options_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Parallel equivalent of GenerateNoise, using a temporary Thread Pool so that generation is performed by num_threads_ threads in total. </para>
+		/// <para> The calling thread counts as one of these threads. If num_threads_ is 1 or less, this is equivalent to GenerateNoise. </para>
+		/// <para>
+		///		Each call creates a Thread Pool of num_threads_ - 1 Worker Threads and joins them before returning, which may cost more than parallelism saves for small or moderately sized tables.
+		///		Where generation is performed repeatedly, use the overloads taking a persistent Thread Pool instead.
+		/// </para>
+		/// </summary>
+		/// <param name="num_threads_">Total number of threads to generate noise with, including the calling thread.</param>
+		/// <param name="options_">Options to use for generating noise.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of samples.</param>
+		/// <returns>True if noise was successfully generated; otherwise false.</returns>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_>
+		inline bool GenerateNoiseParallel(const std::size_t num_threads_, const options_type& options_, SampleProcessor_&& sample_processor_)
+		{
+			if (num_threads_ <= 1)
 			{
-				Register_ sample_batch_ = sample_processor_(generator_(points_x_));
-				if ((i_ + 1) == end_)
-				{
-					out_layer_[i_] = EmuSIMD::get_index<0, value_type>(sample_batch_);
-				}
-				else
-				{
-					value_type calculated_values_[EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8)] = {};
-					EmuSIMD::store(sample_batch_, calculated_values_);
-					for (std::size_t index_ = 0; i_ < end_; ++i_, ++index_)
-					{
-						out_layer_[i_] = calculated_values_[index_];
-					}
-				}
+				return GenerateNoise<SIMDRegister_, NoiseType_>(options_, std::forward<SampleProcessor_>(sample_processor_));
+			}
+			else
+			{
+				EmuThreads::BasicThreadPool<EmuThreads::InlineTask<void()>> thread_pool_(num_threads_ - 1);
+				return GenerateNoiseParallel<SIMDRegister_, NoiseType_>(thread_pool_, options_, std::forward<SampleProcessor_>(sample_processor_));
 			}
 		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_>
+		inline bool GenerateNoiseParallel(const std::size_t num_threads_, const options_type& options_, SampleProcessor_&& sample_processor_)
+		{
+			return GenerateNoiseParallel<default_simd_register_type, NoiseType_>(num_threads_, options_, std::forward<SampleProcessor_>(sample_processor_));
+		}
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateNoiseParallel(const std::size_t num_threads_, const options_type& options_)
+		{
+			return GenerateNoiseParallel<SIMDRegister_, NoiseType_>(num_threads_, options_, SampleProcessor_());
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateNoiseParallel(const std::size_t num_threads_, const options_type& options_)
+		{
+			return GenerateNoiseParallel<NoiseType_>(num_threads_, options_, SampleProcessor_());
+		}
 
-		template<class Register_, class Generator_, class SampleProcessor_>
-		inline void _do_generation
-		(
-			Generator_ generator_,
-			SampleProcessor_ sample_processor_,
-			const EmuMath::Vector<num_dimensions, value_type> start_,
-			const EmuMath::Vector<num_dimensions, value_type> step_
-		)
+		/// <summary>
+		/// <para> Generates noise of the provided NoiseType_ at points that have been warped by noise of the provided WarpNoiseType_. </para>
+		/// <para>
+		///		Warp offsets are calculated for every batch of points as it is generated, so no intermediate tables are allocated
+		///		and the warped table is produced in a single pass. See EmuMath::Functors::fast_domain_warp_wrapper for how offsets are applied.
+		/// </para>
+		/// </summary>
+		/// <param name="options_">Options to use for generating noise. These describe the points and noise prior to warping.</param>
+		/// <param name="warp_info_">Information describing the noise used to warp points, and the amplitude of offsets.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of samples.</param>
+		/// <returns>True if noise was successfully generated; otherwise false.</returns>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, EmuMath::NoiseType WarpNoiseType_, class SampleProcessor_>
+		inline bool GenerateWarpedNoise(const options_type& options_, const warp_info_type& warp_info_, SampleProcessor_&& sample_processor_)
 		{
-			constexpr std::size_t num_elements_per_batch = EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8);
-			constexpr value_type num_elements_per_batch_value_cast = static_cast<value_type>(num_elements_per_batch);
+			using sample_processor_no_ref = typename std::remove_reference<SampleProcessor_>::type;
+			using register_type = typename std::remove_cvref<SIMDRegister_>::type;
 
-			if constexpr (num_dimensions == 3)
+			if (_valid_resolution(options_.table_resolution))
 			{
-				std::size_t end_x_ = table_size.template at<0>();
-				std::size_t end_y_ = table_size.template at<1>();
-				std::size_t end_z_ = table_size.template at<2>();
-				std::size_t end_store_batch_ = table_size.template at<major_dimension>();
-				end_store_batch_ -= end_store_batch_ % num_elements_per_batch;
-
-
-				Register_ points_x_ = EmuSIMD::set1<Register_>(start_.template at<0>());
-				Register_ points_y_ = EmuSIMD::set1<Register_>(start_.template at<1>());
-				Register_ points_z_ = EmuSIMD::set1<Register_>(start_.template at<2>());
-				Register_ step_x_ = EmuSIMD::set1<Register_>(step_.template at<0>());
-				Register_ step_y_ = EmuSIMD::set1<Register_>(step_.template at<1>());
-				Register_ step_z_ = EmuSIMD::set1<Register_>(step_.template at<2>());
-
-				if constexpr (major_dimension == 0)
-				{
-					Register_ start_x_ = EmuSIMD::add(points_x_, EmuSIMD::mul_all(step_x_, EmuSIMD::setr_incrementing<Register_, 0>()));
-					Register_ start_z_ = points_z_;
-					step_x_ = EmuSIMD::mul_all(step_x_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
-
-					for (std::size_t y = 0; y < end_y_; ++y)
-					{
-						auto& layer_0_ = samples[y];
-						points_z_ = start_z_;
-
-						for (std::size_t z = 0; z < end_z_; ++z)
-						{
-							auto& layer_1_ = layer_0_[z];
-							std::size_t x = 0;
-							points_x_ = start_x_;
-
-							for (; x < end_store_batch_; x += num_elements_per_batch)
-							{
-								EmuSIMD::store(sample_processor_(generator_(points_x_, points_y_, points_z_)), &(layer_1_[x]));
-								points_x_ = EmuSIMD::add(points_x_, step_x_);
-							}
-							_finish_major_segment_partial(generator_, sample_processor_, layer_1_, points_x_, points_y_, points_z_, x, end_x_);
-							points_z_ = EmuSIMD::add(points_z_, step_z_);
-						}
-						points_y_ = EmuSIMD::add(points_y_, step_y_);
-					}
-				}
-				else if constexpr (major_dimension == 1)
-				{
-					Register_ start_y_ = EmuSIMD::add(points_y_, EmuSIMD::mul_all(step_y_, EmuSIMD::setr_incrementing<Register_, 0>()));
-					Register_ start_z_ = points_z_;
-					step_y_ = EmuSIMD::mul_all(step_y_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
-
-					for (std::size_t x = 0; x < end_x_; ++x)
-					{
-						auto& layer_0_ = samples[x];
-						points_z_ = start_z_;
-
-						for (std::size_t z = 0; z < end_z_; ++z)
-						{
-							auto& layer_1_ = layer_0_[z];
-							std::size_t y = 0;
-							points_y_ = start_y_;
-
-							for (; y < end_store_batch_; y += num_elements_per_batch)
-							{
-								EmuSIMD::store(sample_processor_(generator_(points_x_, points_y_, points_z_)), &(layer_1_[y]));
-								points_y_ = EmuSIMD::add(points_y_, step_y_);
-							}
-							_finish_major_segment_partial(generator_, sample_processor_, layer_1_, points_x_, points_y_, points_z_, y, end_y_);
-							points_z_ = EmuSIMD::add(points_z_, step_z_);
-						}
-						points_x_ = EmuSIMD::add(points_x_, step_x_);
-					}
-				}
-				else
-				{
-					Register_ start_y_ = points_y_;
-					Register_ start_z_ = EmuSIMD::add(points_z_, EmuSIMD::mul_all(step_z_, EmuSIMD::setr_incrementing<Register_, 0>()));
-					step_z_ = EmuSIMD::mul_all(step_z_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
+				_do_resize(options_.table_resolution);
 
-					for (std::size_t x = 0; x < end_x_; ++x)
+				sample_processor_no_ref& sample_processor_ref_ = EmuCore::TMP::lval_ref_cast<SampleProcessor_>(std::forward<SampleProcessor_>(sample_processor_));
+				_with_warped_generator<register_type, NoiseType_, WarpNoiseType_>
+				(
+					options_,
+					warp_info_,
+					[&](auto&& generator_)
 					{
-						auto& layer_0_ = samples[x];
-						points_y_ = start_y_;
-
-						for (std::size_t y = 0; y < end_y_; ++y)
-						{
-							auto& layer_1_ = layer_0_[y];
-							std::size_t z = 0;
-							points_z_ = start_z_;
-
-							for (; z < end_store_batch_; z += num_elements_per_batch)
-							{
-								EmuSIMD::store(sample_processor_(generator_(points_x_, points_y_, points_z_)), &(layer_1_[z]));
-								points_z_ = EmuSIMD::add(points_z_, step_z_);
-							}
-							_finish_major_segment_partial(generator_, sample_processor_, layer_1_, points_x_, points_y_, points_z_, z, end_z_);
-							points_y_ = EmuSIMD::add(points_y_, step_y_);
-						}
-						points_x_ = EmuSIMD::add(points_x_, step_x_);
+						using generator_type = typename std::remove_cvref<decltype(generator_)>::type;
+						_do_generation<register_type, generator_type, sample_processor_no_ref&>
+						(
+							std::move(generator_),
+							sample_processor_ref_,
+							options_.start_point,
+							options_.MakeStep()
+						);
 					}
-				}
+				);
+				return true;
 			}
-			else if constexpr (num_dimensions == 2)
+			else
 			{
-				std::size_t end_x_ = table_size.template at<0>();
-				std::size_t end_y_ = table_size.template at<1>();
-				std::size_t end_store_batch_ = table_size.template at<major_dimension>();
-				end_store_batch_ -= end_store_batch_ % num_elements_per_batch;
+				return false;
+			}
+		}
+		template<EmuMath::NoiseType NoiseType_, EmuMath::NoiseType WarpNoiseType_, class SampleProcessor_>
+		inline bool GenerateWarpedNoise(const options_type& options_, const warp_info_type& warp_info_, SampleProcessor_&& sample_processor_)
+		{
+			return GenerateWarpedNoise<default_simd_register_type, NoiseType_, WarpNoiseType_>(options_, warp_info_, std::forward<SampleProcessor_>(sample_processor_));
+		}
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, EmuMath::NoiseType WarpNoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateWarpedNoise(const options_type& options_, const warp_info_type& warp_info_)
+		{
+			return GenerateWarpedNoise<SIMDRegister_, NoiseType_, WarpNoiseType_>(options_, warp_info_, SampleProcessor_());
+		}
+		template<EmuMath::NoiseType NoiseType_, EmuMath::NoiseType WarpNoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateWarpedNoise(const options_type& options_, const warp_info_type& warp_info_)
+		{
+			return GenerateWarpedNoise<NoiseType_, WarpNoiseType_>(options_, warp_info_, SampleProcessor_());
+		}
 
+		/// <summary>
+		/// <para> Parallel equivalent of GenerateWarpedNoise, dividing generation of this table into tasks which are executed by the provided thread_pool_. </para>
+		/// <para> Output is bit-identical to that of GenerateWarpedNoise with the same arguments. The same requirements as GenerateNoiseParallel apply. </para>
+		/// </summary>
+		/// <param name="thread_pool_">Thread Pool to queue generation tasks in. Its func_type must be constructible from a lambda taking no arguments and returning void.</param>
+		/// <param name="options_">Options to use for generating noise. These describe the points and noise prior to warping.</param>
+		/// <param name="warp_info_">Information describing the noise used to warp points, and the amplitude of offsets.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of samples.</param>
+		/// <returns>True if noise was successfully generated; otherwise false.</returns>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, EmuMath::NoiseType WarpNoiseType_, class SampleProcessor_, class PoolFunc_>
+		inline bool GenerateWarpedNoiseParallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const options_type& options_,
+			const warp_info_type& warp_info_,
+			SampleProcessor_&& sample_processor_
+		)
+		{
+			using sample_processor_no_ref = typename std::remove_cvref<SampleProcessor_>::type;
+			using register_type = typename std::remove_cvref<SIMDRegister_>::type;
 
-				Register_ points_x_ = EmuSIMD::set1<Register_>(start_.template at<0>());
-				Register_ points_y_ = EmuSIMD::set1<Register_>(start_.template at<1>());
-				Register_ step_x_ = EmuSIMD::set1<Register_>(step_.template at<0>());
-				Register_ step_y_ = EmuSIMD::set1<Register_>(step_.template at<1>());
+			if (_valid_resolution(options_.table_resolution))
+			{
+				_do_resize(options_.table_resolution);
 
-				if constexpr (major_dimension == 0)
-				{
-					Register_ start_x_ = EmuSIMD::add(points_x_, EmuSIMD::mul_all(step_x_, EmuSIMD::setr_incrementing<Register_, 0>()));
-					step_x_ = EmuSIMD::mul_all(step_x_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
-					for (std::size_t y = 0; y < end_y_; ++y)
-					{
-						auto& layer_ = samples[y];
-						std::size_t x = 0;
-						points_x_ = start_x_;
-						for (; x < end_store_batch_; x += num_elements_per_batch)
-						{
-							EmuSIMD::store(sample_processor_(generator_(points_x_, points_y_)), &(layer_[x]));
-							points_x_ = EmuSIMD::add(points_x_, step_x_);
-						}
-						_finish_major_segment_partial(generator_, sample_processor_, layer_, points_x_, points_y_, x, end_x_);
-						points_y_ = EmuSIMD::add(points_y_, step_y_);
-					}
-				}
-				else
-				{
-					Register_ start_y_ = EmuSIMD::add(points_y_, EmuSIMD::mul_all(step_y_, EmuSIMD::setr_incrementing<Register_, 0>()));
-					step_y_ = EmuSIMD::mul_all(step_y_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
-					for (std::size_t x = 0; x < end_x_; ++x)
+				_with_warped_generator<register_type, NoiseType_, WarpNoiseType_>
+				(
+					options_,
+					warp_info_,
+					[&](auto&& generator_)
 					{
-						auto& layer_ = samples[x];
-						std::size_t y = 0;
-						points_y_ = start_y_;
-						for (; y < end_store_batch_; y += num_elements_per_batch)
-						{
-							EmuSIMD::store(sample_processor_(generator_(points_x_, points_y_)), &(layer_[y]));
-							points_y_ = EmuSIMD::add(points_y_, step_y_);
-						}
-						_finish_major_segment_partial(generator_, sample_processor_, layer_, points_x_, points_y_, y, end_y_);
-						points_x_ = EmuSIMD::add(points_x_, step_x_);
+						using generator_type = typename std::remove_cvref<decltype(generator_)>::type;
+						_do_generation_parallel<register_type, generator_type, sample_processor_no_ref>
+						(
+							thread_pool_,
+							generator_,
+							sample_processor_,
+							options_.start_point,
+							options_.MakeStep()
+						);
 					}
-				}
-			}
-			else if constexpr (num_dimensions == 1)
-			{
-				std::size_t end_ = table_size.template at<0>();
-				std::size_t end_store_batch_ = table_size.template at<0>();
-				end_store_batch_ -= end_store_batch_ % num_elements_per_batch;
-
-
-				Register_ points_simd_ = EmuSIMD::set1<Register_>(start_.template at<0>());
-				Register_ step_simd_ = EmuSIMD::set1<Register_>(step_.template at<0>());
-				points_simd_ = EmuSIMD::add(points_simd_, EmuSIMD::mul_all(step_simd_, EmuSIMD::setr_incrementing<Register_, 0>()));
-				step_simd_ = EmuSIMD::mul_all(step_simd_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
-
-				std::size_t i = 0;
-				for (; i < end_store_batch_; i += num_elements_per_batch)
-				{
-					EmuSIMD::store(sample_processor_(generator_(points_simd_)), &(samples[i]));
-					points_simd_ = EmuSIMD::add(points_simd_, step_simd_);
-				}
-				_finish_major_segment_partial(generator_, sample_processor_, samples, points_simd_, i, end_);
+				);
+				return true;
 			}
 			else
 			{
-				static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to generate an impossibly-dimensioned EmuMath::FastNoiseTable.");
+				return false;
 			}
 		}
-
-		[[nodiscard]] static constexpr inline bool _valid_resolution(const EmuMath::Vector<num_dimensions, std::size_t>& new_size_)
+		template<EmuMath::NoiseType NoiseType_, EmuMath::NoiseType WarpNoiseType_, class SampleProcessor_, class PoolFunc_>
+		inline bool GenerateWarpedNoiseParallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const options_type& options_,
+			const warp_info_type& warp_info_,
+			SampleProcessor_&& sample_processor_
+		)
 		{
-			return !new_size_.CmpAnyEqual(std::size_t(0));
+			return GenerateWarpedNoiseParallel<default_simd_register_type, NoiseType_, WarpNoiseType_>(thread_pool_, options_, warp_info_, std::forward<SampleProcessor_>(sample_processor_));
+		}
+		template
+		<
+			EmuConcepts::KnownSIMD SIMDRegister_,
+			EmuMath::NoiseType NoiseType_,
+			EmuMath::NoiseType WarpNoiseType_,
+			class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default,
+			class PoolFunc_
+		>
+		inline bool GenerateWarpedNoiseParallel(EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_, const options_type& options_, const warp_info_type& warp_info_)
+		{
+			return GenerateWarpedNoiseParallel<SIMDRegister_, NoiseType_, WarpNoiseType_>(thread_pool_, options_, warp_info_, SampleProcessor_());
+		}
+		template<EmuMath::NoiseType NoiseType_, EmuMath::NoiseType WarpNoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, class PoolFunc_>
+		inline bool GenerateWarpedNoiseParallel(EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_, const options_type& options_, const warp_info_type& warp_info_)
+		{
+			return GenerateWarpedNoiseParallel<NoiseType_, WarpNoiseType_>(thread_pool_, options_, warp_info_, SampleProcessor_());
 		}
 
-		void _do_resize(const coordinate_type& new_size_)
+		/// <summary>
+		/// <para> Parallel equivalent of GenerateWarpedNoise, using a temporary Thread Pool so that generation is performed by num_threads_ threads in total. </para>
+		/// <para> The calling thread counts as one of these threads. If num_threads_ is 1 or less, this is equivalent to GenerateWarpedNoise. </para>
+		/// <para>
+		///		Each call creates a Thread Pool of num_threads_ - 1 Worker Threads and joins them before returning, which may cost more than parallelism saves for small or moderately sized tables.
+		///		Where generation is performed repeatedly, use the overloads taking a persistent Thread Pool instead.
+		/// </para>
+		/// </summary>
+		/// <param name="num_threads_">Total number of threads to generate noise with, including the calling thread.</param>
+		/// <param name="options_">Options to use for generating noise. These describe the points and noise prior to warping.</param>
+		/// <param name="warp_info_">Information describing the noise used to warp points, and the amplitude of offsets.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of samples.</param>
+		/// <returns>True if noise was successfully generated; otherwise false.</returns>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, EmuMath::NoiseType WarpNoiseType_, class SampleProcessor_>
+		inline bool GenerateWarpedNoiseParallel(const std::size_t num_threads_, const options_type& options_, const warp_info_type& warp_info_, SampleProcessor_&& sample_processor_)
 		{
-			// We only do a resize if the new size is greater than what we currently have
-			// --- This avoids a clear when resizing to something smaller, unlike the normal NoiseTable
-			// --- This pertains to the "fast" aims of this noise table
-			if (new_size_.CmpAnyGreater(table_size))
+			if (num_threads_ <= 1)
+			{
+				return GenerateWarpedNoise<SIMDRegister_, NoiseType_, WarpNoiseType_>(options_, warp_info_, std::forward<SampleProcessor_>(sample_processor_));
+			}
+			else
+			{
+				EmuThreads::BasicThreadPool<EmuThreads::InlineTask<void()>> thread_pool_(num_threads_ - 1);
+				return GenerateWarpedNoiseParallel<SIMDRegister_, NoiseType_, WarpNoiseType_>(thread_pool_, options_, warp_info_, std::forward<SampleProcessor_>(sample_processor_));
+			}
+		}
+		template<EmuMath::NoiseType NoiseType_, EmuMath::NoiseType WarpNoiseType_, class SampleProcessor_>
+		inline bool GenerateWarpedNoiseParallel(const std::size_t num_threads_, const options_type& options_, const warp_info_type& warp_info_, SampleProcessor_&& sample_processor_)
+		{
+			return GenerateWarpedNoiseParallel<default_simd_register_type, NoiseType_, WarpNoiseType_>(num_threads_, options_, warp_info_, std::forward<SampleProcessor_>(sample_processor_));
+		}
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, EmuMath::NoiseType WarpNoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateWarpedNoiseParallel(const std::size_t num_threads_, const options_type& options_, const warp_info_type& warp_info_)
+		{
+			return GenerateWarpedNoiseParallel<SIMDRegister_, NoiseType_, WarpNoiseType_>(num_threads_, options_, warp_info_, SampleProcessor_());
+		}
+		template<EmuMath::NoiseType NoiseType_, EmuMath::NoiseType WarpNoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateWarpedNoiseParallel(const std::size_t num_threads_, const options_type& options_, const warp_info_type& warp_info_)
+		{
+			return GenerateWarpedNoiseParallel<NoiseType_, WarpNoiseType_>(num_threads_, options_, warp_info_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Generates a 3D slice of 4D noise of the provided NoiseType_, sampling every point of this table at the W-coordinate time_. </para>
+		/// <para> Generating consecutive times produces smoothly animated noise, without the repetition that scrolling 3D noise along an axis shows. </para>
+		/// <para>
+		///		If loop_period_ is greater than 0, noise loops seamlessly every time time_ advances by loop_period_. Each octave's lattice along W is rounded
+		///		to a whole number of cells within the period (see EmuMath::Functors::make_fast_noise_4d), so the period does not need to suit the frequency.
+		/// </para>
+		/// <para> This is only available for 3-dimensional tables, and NoiseTypes with 4D implementations (VALUE, VALUE_SMOOTH, and PERLIN). </para>
+		/// </summary>
+		/// <param name="options_">Options to use for generating noise. Frequency and fractal octaves apply to time_ in the same way as to points.</param>
+		/// <param name="time_">W-coordinate to sample 4D noise at.</param>
+		/// <param name="loop_period_">Period of time_ after which noise loops. If this is less than or equal to 0, noise does not loop.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of samples.</param>
+		/// <returns>True if noise was successfully generated; otherwise false.</returns>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_>
+		inline bool GenerateNoiseAtTime(const options_type& options_, value_type time_, value_type loop_period_, SampleProcessor_&& sample_processor_)
+		{
+			static_assert(num_dimensions == 3, "Attempted to generate a time slice of 4D noise via an EmuMath::FastNoiseTable that is not 3-dimensional.");
+			using sample_processor_no_ref = typename std::remove_reference<SampleProcessor_>::type;
+			using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+
+			if (_valid_resolution(options_.table_resolution))
+			{
+				_do_resize(options_.table_resolution);
+
+				sample_processor_no_ref& sample_processor_ref_ = EmuCore::TMP::lval_ref_cast<SampleProcessor_>(std::forward<SampleProcessor_>(sample_processor_));
+				_with_time_slice_generator<register_type, NoiseType_>
+				(
+					options_,
+					time_,
+					loop_period_,
+					[&](auto&& generator_)
+					{
+						using generator_type = typename std::remove_cvref<decltype(generator_)>::type;
+						_do_generation<register_type, generator_type, sample_processor_no_ref&>
+						(
+							std::move(generator_),
+							sample_processor_ref_,
+							options_.start_point,
+							options_.MakeStep()
+						);
+					}
+				);
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_>
+		inline bool GenerateNoiseAtTime(const options_type& options_, value_type time_, value_type loop_period_, SampleProcessor_&& sample_processor_)
+		{
+			return GenerateNoiseAtTime<default_simd_register_type, NoiseType_>(options_, time_, loop_period_, std::forward<SampleProcessor_>(sample_processor_));
+		}
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateNoiseAtTime(const options_type& options_, value_type time_, value_type loop_period_ = value_type(0))
+		{
+			return GenerateNoiseAtTime<SIMDRegister_, NoiseType_>(options_, time_, loop_period_, SampleProcessor_());
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateNoiseAtTime(const options_type& options_, value_type time_, value_type loop_period_ = value_type(0))
+		{
+			return GenerateNoiseAtTime<NoiseType_>(options_, time_, loop_period_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Parallel equivalent of GenerateNoiseAtTime, dividing generation of this table into tasks which are executed by the provided thread_pool_. </para>
+		/// <para> Output is bit-identical to that of GenerateNoiseAtTime with the same arguments. The same requirements as GenerateNoiseParallel apply. </para>
+		/// </summary>
+		/// <param name="thread_pool_">Thread Pool to queue generation tasks in. Its func_type must be constructible from a lambda taking no arguments and returning void.</param>
+		/// <param name="options_">Options to use for generating noise. Frequency and fractal octaves apply to time_ in the same way as to points.</param>
+		/// <param name="time_">W-coordinate to sample 4D noise at.</param>
+		/// <param name="loop_period_">Period of time_ after which noise loops. If this is less than or equal to 0, noise does not loop.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of samples.</param>
+		/// <returns>True if noise was successfully generated; otherwise false.</returns>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_, class PoolFunc_>
+		inline bool GenerateNoiseAtTimeParallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const options_type& options_,
+			value_type time_,
+			value_type loop_period_,
+			SampleProcessor_&& sample_processor_
+		)
+		{
+			static_assert(num_dimensions == 3, "Attempted to generate a time slice of 4D noise via an EmuMath::FastNoiseTable that is not 3-dimensional.");
+			using sample_processor_no_ref = typename std::remove_cvref<SampleProcessor_>::type;
+			using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+
+			if (_valid_resolution(options_.table_resolution))
+			{
+				_do_resize(options_.table_resolution);
+
+				_with_time_slice_generator<register_type, NoiseType_>
+				(
+					options_,
+					time_,
+					loop_period_,
+					[&](auto&& generator_)
+					{
+						using generator_type = typename std::remove_cvref<decltype(generator_)>::type;
+						_do_generation_parallel<register_type, generator_type, sample_processor_no_ref>
+						(
+							thread_pool_,
+							generator_,
+							sample_processor_,
+							options_.start_point,
+							options_.MakeStep()
+						);
+					}
+				);
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_, class PoolFunc_>
+		inline bool GenerateNoiseAtTimeParallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const options_type& options_,
+			value_type time_,
+			value_type loop_period_,
+			SampleProcessor_&& sample_processor_
+		)
+		{
+			return GenerateNoiseAtTimeParallel<default_simd_register_type, NoiseType_>(thread_pool_, options_, time_, loop_period_, std::forward<SampleProcessor_>(sample_processor_));
+		}
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, class PoolFunc_>
+		inline bool GenerateNoiseAtTimeParallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const options_type& options_,
+			value_type time_,
+			value_type loop_period_ = value_type(0)
+		)
+		{
+			return GenerateNoiseAtTimeParallel<SIMDRegister_, NoiseType_>(thread_pool_, options_, time_, loop_period_, SampleProcessor_());
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, class PoolFunc_>
+		inline bool GenerateNoiseAtTimeParallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const options_type& options_,
+			value_type time_,
+			value_type loop_period_ = value_type(0)
+		)
+		{
+			return GenerateNoiseAtTimeParallel<NoiseType_>(thread_pool_, options_, time_, loop_period_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Generates noise for this table alongside its analytical gradient, filling this table and the 3 provided gradient tables in a single pass. </para>
+		/// <para> This is only available for 3-dimensional tables, and NoiseTypes which support analytical derivatives (currently only PERLIN). </para>
+		/// <para>
+		///		Each gradient table is resized to match this table, and will contain the derivative of noise along its respective axis for every sample.
+		///		Derivatives are with respect to the points that noise is sampled at, so account for both the table's frequency and any fractal octaves.
+		/// </para>
+		/// <para> 
+		///		The sample_processor_ is only applied to values. Derivatives are output as generated, so any scaling applied to values by the processor 
+		///		should be applied to gradients by the caller if they are expected to match.
+		/// </para>
+		/// <para> Gradient tables must be distinct from each other and from this table. </para>
+		/// </summary>
+		/// <param name="options_">Options to use for generating noise.</param>
+		/// <param name="out_gradient_x_">Table to output derivatives along the X-axis to.</param>
+		/// <param name="out_gradient_y_">Table to output derivatives along the Y-axis to.</param>
+		/// <param name="out_gradient_z_">Table to output derivatives along the Z-axis to.</param>
+		/// <param name="sample_processor_">Processor to use for every generated batch of values.</param>
+		/// <returns>True if noise was successfully generated; otherwise false.</returns>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_>
+		inline bool GenerateNoiseWithGradient
+		(
+			const options_type& options_,
+			this_type& out_gradient_x_,
+			this_type& out_gradient_y_,
+			this_type& out_gradient_z_,
+			SampleProcessor_&& sample_processor_
+		)
+		{
+			static_assert(num_dimensions == 3, "Attempted to generate noise alongside its gradient via an EmuMath::FastNoiseTable that is not 3-dimensional.");
+			using sample_processor_no_ref = typename std::remove_reference<SampleProcessor_>::type;
+			using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+			using underlying_noise_gen_functor = EmuMath::Functors::make_fast_noise_3d_derivatives<NoiseType_, register_type>;
+
+			if (_valid_resolution(options_.table_resolution))
+			{
+				_do_resize_with_gradients(options_.table_resolution, out_gradient_x_, out_gradient_y_, out_gradient_z_);
+
+				sample_processor_no_ref& sample_processor_ref_ = EmuCore::TMP::lval_ref_cast<SampleProcessor_>(std::forward<SampleProcessor_>(sample_processor_));
+				_with_generator<register_type, underlying_noise_gen_functor>
+				(
+					options_.freq,
+					options_.use_fractal_noise,
+					options_.permutation_info,
+					options_.fractal_noise_info,
+					[&](auto&& generator_)
+					{
+						using generator_type = typename std::remove_cvref<decltype(generator_)>::type;
+						_do_generation<register_type, generator_type, sample_processor_no_ref&>
+						(
+							std::move(generator_),
+							sample_processor_ref_,
+							options_.start_point,
+							options_.MakeStep(),
+							_gradient_tables{ &out_gradient_x_, &out_gradient_y_, &out_gradient_z_ }
+						);
+					}
+				);
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_>
+		inline bool GenerateNoiseWithGradient
+		(
+			const options_type& options_,
+			this_type& out_gradient_x_,
+			this_type& out_gradient_y_,
+			this_type& out_gradient_z_,
+			SampleProcessor_&& sample_processor_
+		)
+		{
+			return GenerateNoiseWithGradient<default_simd_register_type, NoiseType_>
+			(
+				options_,
+				out_gradient_x_,
+				out_gradient_y_,
+				out_gradient_z_,
+				std::forward<SampleProcessor_>(sample_processor_)
+			);
+		}
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateNoiseWithGradient(const options_type& options_, this_type& out_gradient_x_, this_type& out_gradient_y_, this_type& out_gradient_z_)
+		{
+			return GenerateNoiseWithGradient<SIMDRegister_, NoiseType_>(options_, out_gradient_x_, out_gradient_y_, out_gradient_z_, SampleProcessor_());
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateNoiseWithGradient(const options_type& options_, this_type& out_gradient_x_, this_type& out_gradient_y_, this_type& out_gradient_z_)
+		{
+			return GenerateNoiseWithGradient<NoiseType_>(options_, out_gradient_x_, out_gradient_y_, out_gradient_z_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Parallel equivalent of GenerateNoiseWithGradient, dividing generation of this table and its gradient tables into tasks which are executed by the provided thread_pool_. </para>
+		/// <para> The calling thread will contribute to executing tasks, and this function will not return until all of its tasks have been completed. </para>
+		/// <para> Output is bit-identical to that of GenerateNoiseWithGradient with the same arguments. </para>
+		/// </summary>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_, class PoolFunc_>
+		inline bool GenerateNoiseWithGradientParallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const options_type& options_,
+			this_type& out_gradient_x_,
+			this_type& out_gradient_y_,
+			this_type& out_gradient_z_,
+			SampleProcessor_&& sample_processor_
+		)
+		{
+			static_assert(num_dimensions == 3, "Attempted to generate noise alongside its gradient via an EmuMath::FastNoiseTable that is not 3-dimensional.");
+			using sample_processor_no_ref = typename std::remove_cvref<SampleProcessor_>::type;
+			using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+			using underlying_noise_gen_functor = EmuMath::Functors::make_fast_noise_3d_derivatives<NoiseType_, register_type>;
+
+			if (_valid_resolution(options_.table_resolution))
+			{
+				_do_resize_with_gradients(options_.table_resolution, out_gradient_x_, out_gradient_y_, out_gradient_z_);
+
+				_with_generator<register_type, underlying_noise_gen_functor>
+				(
+					options_.freq,
+					options_.use_fractal_noise,
+					options_.permutation_info,
+					options_.fractal_noise_info,
+					[&](auto&& generator_)
+					{
+						using generator_type = typename std::remove_cvref<decltype(generator_)>::type;
+						_do_generation_parallel<register_type, generator_type, sample_processor_no_ref>
+						(
+							thread_pool_,
+							generator_,
+							sample_processor_,
+							options_.start_point,
+							options_.MakeStep(),
+							_gradient_tables{ &out_gradient_x_, &out_gradient_y_, &out_gradient_z_ }
+						);
+					}
+				);
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_, class PoolFunc_>
+		inline bool GenerateNoiseWithGradientParallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const options_type& options_,
+			this_type& out_gradient_x_,
+			this_type& out_gradient_y_,
+			this_type& out_gradient_z_,
+			SampleProcessor_&& sample_processor_
+		)
+		{
+			return GenerateNoiseWithGradientParallel<default_simd_register_type, NoiseType_>
+			(
+				thread_pool_,
+				options_,
+				out_gradient_x_,
+				out_gradient_y_,
+				out_gradient_z_,
+				std::forward<SampleProcessor_>(sample_processor_)
+			);
+		}
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, class PoolFunc_>
+		inline bool GenerateNoiseWithGradientParallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const options_type& options_,
+			this_type& out_gradient_x_,
+			this_type& out_gradient_y_,
+			this_type& out_gradient_z_
+		)
+		{
+			return GenerateNoiseWithGradientParallel<SIMDRegister_, NoiseType_>(thread_pool_, options_, out_gradient_x_, out_gradient_y_, out_gradient_z_, SampleProcessor_());
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, class PoolFunc_>
+		inline bool GenerateNoiseWithGradientParallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const options_type& options_,
+			this_type& out_gradient_x_,
+			this_type& out_gradient_y_,
+			this_type& out_gradient_z_
+		)
+		{
+			return GenerateNoiseWithGradientParallel<NoiseType_>(thread_pool_, options_, out_gradient_x_, out_gradient_y_, out_gradient_z_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Parallel equivalent of GenerateNoiseWithGradient, using a temporary Thread Pool so that generation is performed by num_threads_ threads in total. </para>
+		/// <para> The calling thread counts as one of these threads. If num_threads_ is 1 or less, this is equivalent to GenerateNoiseWithGradient. </para>
+		/// <para>
+		///		Each call creates a Thread Pool of num_threads_ - 1 Worker Threads and joins them before returning, which may cost more than parallelism saves for small or moderately sized tables.
+		///		Where generation is performed repeatedly, use the overloads taking a persistent Thread Pool instead.
+		/// </para>
+		/// </summary>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_>
+		inline bool GenerateNoiseWithGradientParallel
+		(
+			const std::size_t num_threads_,
+			const options_type& options_,
+			this_type& out_gradient_x_,
+			this_type& out_gradient_y_,
+			this_type& out_gradient_z_,
+			SampleProcessor_&& sample_processor_
+		)
+		{
+			if (num_threads_ <= 1)
+			{
+				return GenerateNoiseWithGradient<SIMDRegister_, NoiseType_>
+				(
+					options_,
+					out_gradient_x_,
+					out_gradient_y_,
+					out_gradient_z_,
+					std::forward<SampleProcessor_>(sample_processor_)
+				);
+			}
+			else
+			{
+				EmuThreads::BasicThreadPool<EmuThreads::InlineTask<void()>> thread_pool_(num_threads_ - 1);
+				return GenerateNoiseWithGradientParallel<SIMDRegister_, NoiseType_>
+				(
+					thread_pool_,
+					options_,
+					out_gradient_x_,
+					out_gradient_y_,
+					out_gradient_z_,
+					std::forward<SampleProcessor_>(sample_processor_)
+				);
+			}
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_>
+		inline bool GenerateNoiseWithGradientParallel
+		(
+			const std::size_t num_threads_,
+			const options_type& options_,
+			this_type& out_gradient_x_,
+			this_type& out_gradient_y_,
+			this_type& out_gradient_z_,
+			SampleProcessor_&& sample_processor_
+		)
+		{
+			return GenerateNoiseWithGradientParallel<default_simd_register_type, NoiseType_>
+			(
+				num_threads_,
+				options_,
+				out_gradient_x_,
+				out_gradient_y_,
+				out_gradient_z_,
+				std::forward<SampleProcessor_>(sample_processor_)
+			);
+		}
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateNoiseWithGradientParallel
+		(
+			const std::size_t num_threads_,
+			const options_type& options_,
+			this_type& out_gradient_x_,
+			this_type& out_gradient_y_,
+			this_type& out_gradient_z_
+		)
+		{
+			return GenerateNoiseWithGradientParallel<SIMDRegister_, NoiseType_>(num_threads_, options_, out_gradient_x_, out_gradient_y_, out_gradient_z_, SampleProcessor_());
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
+		inline bool GenerateNoiseWithGradientParallel
+		(
+			const std::size_t num_threads_,
+			const options_type& options_,
+			this_type& out_gradient_x_,
+			this_type& out_gradient_y_,
+			this_type& out_gradient_z_
+		)
+		{
+			return GenerateNoiseWithGradientParallel<NoiseType_>(num_threads_, options_, out_gradient_x_, out_gradient_y_, out_gradient_z_, SampleProcessor_());
+		}
+#pragma endregion
+
+	private:
+		table_storage samples;
+		coordinate_type table_size;
+
+		template<class Register_>
+		struct _generation_registers
+		{
+			Register_ start_outer;
+			Register_ step_outer;
+			Register_ start_middle;
+			Register_ step_middle;
+			Register_ start_major;
+			Register_ step_major;
+		};
+
+		/// <summary> Tables to output the derivatives of generated noise to, along the X, Y, and Z axes respectively. </summary>
+		struct _gradient_tables
+		{
+			this_type* x;
+			this_type* y;
+			this_type* z;
+		};
+
+		/// <summary> Major runs of this table and its gradient tables which share the same outer and middle indices. </summary>
+		struct _gradient_major_runs
+		{
+			value_type* values;
+			value_type* x;
+			value_type* y;
+			value_type* z;
+		};
+
+		template<class Register_>
+		[[nodiscard]] static inline _generation_registers<Register_> _make_generation_registers
+		(
+			const EmuMath::Vector<num_dimensions, value_type>& start_,
+			const EmuMath::Vector<num_dimensions, value_type>& step_
+		)
+		{
+			static_assert
+			(
+				EmuSIMD::TMP::floating_point_register_element_width_v<Register_> == (sizeof(value_type) * 8),
+				"Attempted to generate samples for an EmuMath::FastNoiseTable using a SIMD register whose elements do not match the table's value_type."
+			);
+			constexpr std::size_t num_elements_per_batch = EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8);
+			constexpr value_type num_elements_per_batch_value_cast = static_cast<value_type>(num_elements_per_batch);
+
+			_generation_registers<Register_> registers_ = {};
+			Register_ step_major_ = EmuSIMD::set1<Register_>(step_.template at<major_dimension>());
+			registers_.start_major = EmuSIMD::add
+			(
+				EmuSIMD::set1<Register_>(start_.template at<major_dimension>()),
+				EmuSIMD::mul_all(step_major_, EmuSIMD::setr_incrementing<Register_, 0>())
+			);
+			registers_.step_major = EmuSIMD::mul_all(step_major_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
+
+			if constexpr (num_dimensions >= 2)
+			{
+				registers_.start_outer = EmuSIMD::set1<Register_>(start_.template at<_outer_dimension>());
+				registers_.step_outer = EmuSIMD::set1<Register_>(step_.template at<_outer_dimension>());
+			}
+
+			if constexpr (num_dimensions == 3)
+			{
+				registers_.start_middle = EmuSIMD::set1<Register_>(start_.template at<_middle_dimension>());
+				registers_.step_middle = EmuSIMD::set1<Register_>(step_.template at<_middle_dimension>());
+			}
+			return registers_;
+		}
+
+		template<class Generator_, class Register_>
+		[[nodiscard]] static inline auto _invoke_generator
+		(
+			Generator_& generator_,
+			Register_ points_major_,
+			Register_ points_outer_,
+			Register_ points_middle_
+		)
+		{
+			// Points are always passed to the generator in XYZ order, regardless of the order in which they are iterated
+			if constexpr (num_dimensions == 3)
+			{
+				if constexpr (major_dimension == 0)
+				{
+					return generator_(points_major_, points_outer_, points_middle_);
+				}
+				else if constexpr (major_dimension == 1)
+				{
+					return generator_(points_outer_, points_major_, points_middle_);
+				}
+				else
+				{
+					return generator_(points_outer_, points_middle_, points_major_);
+				}
+			}
+			else if constexpr (num_dimensions == 2)
+			{
+				if constexpr (major_dimension == 0)
+				{
+					return generator_(points_major_, points_outer_);
+				}
+				else
+				{
+					return generator_(points_outer_, points_major_);
+				}
+			}
+			else
+			{
+				return generator_(points_major_);
+			}
+		}
+
+		template<class Generator_, class SampleProcessor_, class Register_>
+		[[nodiscard]] static inline auto _generate_batch
+		(
+			Generator_& generator_,
+			SampleProcessor_& sample_processor_,
+			Register_ points_major_,
+			Register_ points_outer_,
+			Register_ points_middle_
+		)
+		{
+			return _process_batch(sample_processor_, _invoke_generator(generator_, points_major_, points_outer_, points_middle_));
+		}
+
+		template<class Generator_, class SampleProcessor_, class OutLayer_, class Register_>
+		inline void _finish_major_segment_partial
+		(
+			Generator_& generator_,
+			SampleProcessor_& sample_processor_,
+			const OutLayer_& out_layer_,
+			Register_ points_major_,
+			Register_ points_outer_,
+			Register_ points_middle_,
+			std::size_t i_,
+			const std::size_t end_
+		)
+		{
+			if (i_ < end_)
+			{
+				_store_batch_partial
+				(
+					_process_partial_batch(sample_processor_, _invoke_generator(generator_, points_major_, points_outer_, points_middle_), end_ - i_),
+					out_layer_,
+					i_,
+					end_
+				);
+			}
+		}
+
+		template<class Register_>
+		static inline void _store_batch_partial(Register_ sample_batch_, value_type* out_layer_, std::size_t i_, const std::size_t end_)
+		{
+			if ((i_ + 1) == end_)
+			{
+				out_layer_[i_] = EmuSIMD::get_index<0, value_type>(sample_batch_);
+			}
+			else
+			{
+				value_type calculated_values_[EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8)] = {};
+				EmuSIMD::store(sample_batch_, calculated_values_);
+				for (std::size_t index_ = 0; i_ < end_; ++i_, ++index_)
+				{
+					out_layer_[i_] = calculated_values_[index_];
+				}
+			}
+		}
+		template<class Register_>
+		static inline void _store_batch_partial(const std::array<Register_, 4>& sample_batch_, const _gradient_major_runs& out_layer_, std::size_t i_, const std::size_t end_)
+		{
+			_store_batch_partial(sample_batch_[0], out_layer_.values, i_, end_);
+			_store_batch_partial(sample_batch_[1], out_layer_.x, i_, end_);
+			_store_batch_partial(sample_batch_[2], out_layer_.y, i_, end_);
+			_store_batch_partial(sample_batch_[3], out_layer_.z, i_, end_);
+		}
+
+		template<class Register_>
+		static inline void _store_batch(Register_ sample_batch_, value_type* out_layer_, const std::size_t i_)
+		{
+			EmuSIMD::store(sample_batch_, out_layer_ + i_);
+		}
+		template<class Register_>
+		static inline void _store_batch(const std::array<Register_, 4>& sample_batch_, const _gradient_major_runs& out_layer_, const std::size_t i_)
+		{
+			EmuSIMD::store(sample_batch_[0], out_layer_.values + i_);
+			EmuSIMD::store(sample_batch_[1], out_layer_.x + i_);
+			EmuSIMD::store(sample_batch_[2], out_layer_.y + i_);
+			EmuSIMD::store(sample_batch_[3], out_layer_.z + i_);
+		}
+
+		/// <summary> Applies the provided sample_processor_ to a generated batch. Batches containing derivatives only have their values processed. </summary>
+		template<class SampleProcessor_, class Register_>
+		[[nodiscard]] static inline Register_ _process_batch(SampleProcessor_& sample_processor_, Register_ sample_batch_)
+		{
+			return sample_processor_(sample_batch_);
+		}
+		template<class SampleProcessor_, class Register_>
+		[[nodiscard]] static inline std::array<Register_, 4> _process_batch(SampleProcessor_& sample_processor_, std::array<Register_, 4> sample_batch_)
+		{
+			sample_batch_[0] = sample_processor_(sample_batch_[0]);
+			return sample_batch_;
+		}
+
+		/// <summary>
+		/// <para> Applies the provided sample_processor_ to a generated batch of which only the first num_valid_elements_ will be stored. </para>
+		/// <para> Processors which may be invoked with the number of valid elements are passed it, so that analytics do not include samples outside of the table. </para>
+		/// </summary>
+		template<class SampleProcessor_, class Register_>
+		[[nodiscard]] static inline Register_ _process_partial_batch(SampleProcessor_& sample_processor_, Register_ sample_batch_, const std::size_t num_valid_elements_)
+		{
+			if constexpr (std::is_invocable_v<SampleProcessor_&, Register_, std::size_t>)
+			{
+				return sample_processor_(sample_batch_, num_valid_elements_);
+			}
+			else
+			{
+				return sample_processor_(sample_batch_);
+			}
+		}
+		template<class SampleProcessor_, class Register_>
+		[[nodiscard]] static inline std::array<Register_, 4> _process_partial_batch
+		(
+			SampleProcessor_& sample_processor_,
+			std::array<Register_, 4> sample_batch_,
+			const std::size_t num_valid_elements_
+		)
+		{
+			sample_batch_[0] = _process_partial_batch(sample_processor_, sample_batch_[0], num_valid_elements_);
+			return sample_batch_;
+		}
+
+		/// <summary>
+		/// <para> Generates the contiguous major-dimension samples in the range [begin_, end_) of the provided major run. </para>
+		/// <para> points_major_ is expected to contain the points for the sample at index begin_ and onwards. </para>
+		/// </summary>
+		template<class Generator_, class SampleProcessor_, class OutLayer_, class Register_>
+		inline void _generate_major_segment
+		(
+			Generator_& generator_,
+			SampleProcessor_& sample_processor_,
+			const OutLayer_& out_layer_,
+			Register_ points_major_,
+			Register_ step_major_,
+			Register_ points_outer_,
+			Register_ points_middle_,
+			std::size_t begin_,
+			const std::size_t end_
+		)
+		{
+			constexpr std::size_t num_elements_per_batch = EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8);
+			const std::size_t end_store_batch_ = end_ - ((end_ - begin_) % num_elements_per_batch);
+
+			for (; begin_ < end_store_batch_; begin_ += num_elements_per_batch)
+			{
+				_store_batch(_generate_batch(generator_, sample_processor_, points_major_, points_outer_, points_middle_), out_layer_, begin_);
+				points_major_ = EmuSIMD::add(points_major_, step_major_);
+			}
+			_finish_major_segment_partial(generator_, sample_processor_, out_layer_, points_major_, points_outer_, points_middle_, begin_, end_);
+		}
+
+		/// <summary> Generates all samples stored within the outermost storage layer at the provided index. Not used for 1-dimensional tables. </summary>
+		template<class Register_, class Generator_, class SampleProcessor_, class Outputs_>
+		inline void _generate_outer_layer
+		(
+			Generator_& generator_,
+			SampleProcessor_& sample_processor_,
+			const _generation_registers<Register_>& registers_,
+			const std::size_t outer_index_,
+			Register_ points_outer_,
+			const Outputs_& outputs_
+		)
+		{
+			const std::size_t end_major_ = table_size.template at<major_dimension>();
+
+			if constexpr (num_dimensions == 3)
+			{
+				const std::size_t end_middle_ = table_size.template at<_middle_dimension>();
+				Register_ points_middle_ = registers_.start_middle;
+				for (std::size_t middle_index_ = 0; middle_index_ < end_middle_; ++middle_index_)
+				{
+					_generate_major_segment
+					(
+						generator_,
+						sample_processor_,
+						_output_run(outputs_, outer_index_, middle_index_),
+						registers_.start_major,
+						registers_.step_major,
+						points_outer_,
+						points_middle_,
+						0,
+						end_major_
+					);
+					points_middle_ = EmuSIMD::add(points_middle_, registers_.step_middle);
+				}
+			}
+			else
+			{
+				_generate_major_segment
+				(
+					generator_,
+					sample_processor_,
+					_output_run(outputs_, outer_index_, 0),
+					registers_.start_major,
+					registers_.step_major,
+					points_outer_,
+					registers_.start_middle,
+					0,
+					end_major_
+				);
+			}
+		}
+
+		/// <summary>
+		/// <para> Invokes func_ with a temporary fractal or non-fractal generator of the provided NoiseType_, constructed from the provided arguments. </para>
+		/// <para> Any generator_constructor_args_ are passed on to construct the underlying noise generator. </para>
+		/// </summary>
+		template<class Register_, class UnderlyingNoiseGenFunctor_, class Func_, typename...GeneratorConstructorArgs_>
+		static inline void _with_generator
+		(
+			value_type freq_,
+			bool use_fractal_noise_,
+			const EmuMath::Info::NoisePermutationInfo& permutation_info_,
+			const typename options_type::fractal_info_type& fractal_noise_info_,
+			Func_&& func_,
+			GeneratorConstructorArgs_&&...generator_constructor_args_
+		)
+		{
+			using underlying_noise_gen_functor = UnderlyingNoiseGenFunctor_;
+			if (use_fractal_noise_)
+			{
+				using fractal_generator = EmuMath::Functors::fractal_noise_wrapper<underlying_noise_gen_functor, Register_>;
+				func_(fractal_generator(freq_, permutation_info_.MakePermutations(), fractal_noise_info_, generator_constructor_args_...));
+			}
+			else
+			{
+				using no_fractal_generator = EmuMath::Functors::no_fractal_noise_wrapper<underlying_noise_gen_functor, Register_>;
+				func_(no_fractal_generator(freq_, permutation_info_.MakePermutations(), generator_constructor_args_...));
+			}
+		}
+
+		/// <summary> Invokes func_ with a temporary fast_noise_time_slice_wrapper, sampling 4D noise described by options_ at the W-coordinate time_. </summary>
+		template<class Register_, EmuMath::NoiseType NoiseType_, class Func_>
+		static inline void _with_time_slice_generator(const options_type& options_, value_type time_, value_type loop_period_, Func_&& func_)
+		{
+			using underlying_noise_gen_functor = EmuMath::fast_noise_gen_functor<4, NoiseType_, Register_>;
+			_with_generator<Register_, underlying_noise_gen_functor>
+			(
+				options_.freq,
+				options_.use_fractal_noise,
+				options_.permutation_info,
+				options_.fractal_noise_info,
+				[&](auto&& generator_)
+				{
+					using time_slice_wrapper_type = EmuMath::Functors::fast_noise_time_slice_wrapper
+					<
+						typename std::remove_cvref<decltype(generator_)>::type,
+						Register_
+					>;
+					func_(time_slice_wrapper_type(std::move(generator_), time_));
+				},
+				static_cast<typename underlying_noise_gen_functor::scalar_fp>(loop_period_)
+			);
+		}
+
+		/// <summary> Invokes func_ with a temporary fast_domain_warp_wrapper, warping a generator described by options_ with a generator described by warp_info_. </summary>
+		template<class Register_, EmuMath::NoiseType NoiseType_, EmuMath::NoiseType WarpNoiseType_, class Func_>
+		static inline void _with_warped_generator(const options_type& options_, const warp_info_type& warp_info_, Func_&& func_)
+		{
+			_with_generator<Register_, EmuMath::fast_noise_gen_functor<num_dimensions, WarpNoiseType_, Register_>>
+			(
+				warp_info_.freq,
+				warp_info_.use_fractal_noise,
+				warp_info_.permutation_info,
+				warp_info_.fractal_noise_info,
+				[&](auto&& warp_generator_)
+				{
+					_with_generator<Register_, EmuMath::fast_noise_gen_functor<num_dimensions, NoiseType_, Register_>>
+					(
+						options_.freq,
+						options_.use_fractal_noise,
+						options_.permutation_info,
+						options_.fractal_noise_info,
+						[&](auto&& generator_)
+						{
+							using warp_wrapper_type = EmuMath::Functors::fast_domain_warp_wrapper
+							<
+								typename std::remove_cvref<decltype(generator_)>::type,
+								typename std::remove_cvref<decltype(warp_generator_)>::type,
+								Register_
+							>;
+							func_(warp_wrapper_type(std::move(generator_), std::move(warp_generator_), warp_info_.amplitude));
+						}
+					);
+				}
+			);
+		}
+
+		template<class Register_, class Generator_, class SampleProcessor_, class Outputs_ = std::nullptr_t>
+		inline void _do_generation
+		(
+			Generator_ generator_,
+			SampleProcessor_ sample_processor_,
+			const EmuMath::Vector<num_dimensions, value_type> start_,
+			const EmuMath::Vector<num_dimensions, value_type> step_,
+			const Outputs_ outputs_ = Outputs_()
+		)
+		{
+			const _generation_registers<Register_> registers_ = _make_generation_registers<Register_>(start_, step_);
+
+			if constexpr (num_dimensions == 1)
+			{
+				_generate_major_segment
+				(
+					generator_,
+					sample_processor_,
+					_output_run(outputs_, 0, 0),
+					registers_.start_major,
+					registers_.step_major,
+					registers_.start_outer,
+					registers_.start_middle,
+					0,
+					table_size.template at<0>()
+				);
+			}
+			else
+			{
+				const std::size_t end_outer_ = table_size.template at<_outer_dimension>();
+				Register_ points_outer_ = registers_.start_outer;
+				for (std::size_t outer_index_ = 0; outer_index_ < end_outer_; ++outer_index_)
+				{
+					_generate_outer_layer(generator_, sample_processor_, registers_, outer_index_, points_outer_, outputs_);
+					points_outer_ = EmuSIMD::add(points_outer_, registers_.step_outer);
+				}
+			}
+		}
+
+		/// <summary>
+		/// <para> Provides the points of the major batch beginning at the provided major index, matching the points that full generation uses for those samples. </para>
+		/// <para>
+		///		Each lane of full generation accumulates its own chain of major steps, so unaligned indices are produced by shifting lanes of the two
+		///		surrounding aligned batches rather than by multiplying the step, which would round differently.
+		/// </para>
+		/// </summary>
+		template<class Register_>
+		[[nodiscard]] static inline Register_ _major_points_at(const _generation_registers<Register_>& registers_, const std::size_t major_index_)
+		{
+			constexpr std::size_t num_elements_per_batch = EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8);
+			const std::size_t num_aligned_batches_ = major_index_ / num_elements_per_batch;
+			const std::size_t lane_offset_ = major_index_ % num_elements_per_batch;
+
+			Register_ points_major_ = registers_.start_major;
+			for (std::size_t i = 0; i < num_aligned_batches_; ++i)
+			{
+				points_major_ = EmuSIMD::add(points_major_, registers_.step_major);
+			}
+
+			if (lane_offset_ == 0)
+			{
+				return points_major_;
+			}
+			else
+			{
+				value_type lanes_[num_elements_per_batch * 2] = {};
+				EmuSIMD::store(points_major_, lanes_);
+				EmuSIMD::store(EmuSIMD::add(points_major_, registers_.step_major), lanes_ + num_elements_per_batch);
+				return EmuSIMD::load<Register_>(lanes_ + lane_offset_);
+			}
+		}
+
+		/// <summary> Accumulates the provided step onto start_ the provided number of times, matching the points that full generation reaches at that index. </summary>
+		template<class Register_>
+		[[nodiscard]] static inline Register_ _accumulate_points(Register_ start_, const Register_ step_, const std::size_t count_)
+		{
+			for (std::size_t i = 0; i < count_; ++i)
+			{
+				start_ = EmuSIMD::add(start_, step_);
+			}
+			return start_;
+		}
+
+		/// <summary> Counterpart to _do_generation which only generates samples within the box [begin_, end_), without resizing this table. </summary>
+		template<class Register_, class Generator_, class SampleProcessor_>
+		inline void _do_region_generation
+		(
+			Generator_ generator_,
+			SampleProcessor_ sample_processor_,
+			const EmuMath::Vector<num_dimensions, value_type> start_,
+			const EmuMath::Vector<num_dimensions, value_type> step_,
+			const coordinate_type& begin_,
+			const coordinate_type& end_
+		)
+		{
+			const _generation_registers<Register_> registers_ = _make_generation_registers<Register_>(start_, step_);
+			const std::size_t begin_major_ = begin_.template at<major_dimension>();
+			const std::size_t end_major_ = end_.template at<major_dimension>();
+			const Register_ points_major_ = _major_points_at(registers_, begin_major_);
+
+			if constexpr (num_dimensions == 1)
+			{
+				_generate_major_segment
+				(
+					generator_,
+					sample_processor_,
+					_output_run(nullptr, 0, 0),
+					points_major_,
+					registers_.step_major,
+					registers_.start_outer,
+					registers_.start_middle,
+					begin_major_,
+					end_major_
+				);
+			}
+			else
+			{
+				const std::size_t begin_outer_ = begin_.template at<_outer_dimension>();
+				const std::size_t end_outer_ = end_.template at<_outer_dimension>();
+				Register_ points_outer_ = _accumulate_points(registers_.start_outer, registers_.step_outer, begin_outer_);
+				for (std::size_t outer_index_ = begin_outer_; outer_index_ < end_outer_; ++outer_index_)
+				{
+					if constexpr (num_dimensions == 3)
+					{
+						const std::size_t begin_middle_ = begin_.template at<_middle_dimension>();
+						const std::size_t end_middle_ = end_.template at<_middle_dimension>();
+						Register_ points_middle_ = _accumulate_points(registers_.start_middle, registers_.step_middle, begin_middle_);
+						for (std::size_t middle_index_ = begin_middle_; middle_index_ < end_middle_; ++middle_index_)
+						{
+							_generate_major_segment
+							(
+								generator_,
+								sample_processor_,
+								_output_run(nullptr, outer_index_, middle_index_),
+								points_major_,
+								registers_.step_major,
+								points_outer_,
+								points_middle_,
+								begin_major_,
+								end_major_
+							);
+							points_middle_ = EmuSIMD::add(points_middle_, registers_.step_middle);
+						}
+					}
+					else
+					{
+						_generate_major_segment
+						(
+							generator_,
+							sample_processor_,
+							_output_run(nullptr, outer_index_, 0),
+							points_major_,
+							registers_.step_major,
+							points_outer_,
+							registers_.start_middle,
+							begin_major_,
+							end_major_
+						);
+					}
+					points_outer_ = EmuSIMD::add(points_outer_, registers_.step_outer);
+				}
+			}
+		}
+
+		/// <summary>
+		/// <para> Parallel counterpart to _do_generation, splitting generation into tasks of contiguous outer layers (or major batches for 1-dimensional tables). </para>
+		/// <para> The starting points of each task are accumulated in the same way as the serial loop, so output is bit-identical to _do_generation. </para>
+		/// <para> Each task works on its own copies of the generator and sample processor, as both may hold scratch state that is modified when invoked. </para>
+		/// <para> Tasks are run by _underlying_noise_parallel::run_sample_processor_tasks, which merges mergeable processors in task order and rethrows the first exception of any task. </para>
+		/// </summary>
+		template<class Register_, class Generator_, class SampleProcessor_, class PoolFunc_, class SampleProcessorArg_, class Outputs_ = std::nullptr_t>
+		inline void _do_generation_parallel
+		(
+			EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+			const Generator_& generator_,
+			SampleProcessorArg_& sample_processor_,
+			const EmuMath::Vector<num_dimensions, value_type> start_,
+			const EmuMath::Vector<num_dimensions, value_type> step_,
+			const Outputs_ outputs_ = Outputs_()
+		)
+		{
+			constexpr std::size_t num_elements_per_batch = EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8);
+
+			const _generation_registers<Register_> registers_ = _make_generation_registers<Register_>(start_, step_);
+			std::size_t num_units_ = 0;
+			Register_ unit_points_ = registers_.start_outer;
+			Register_ unit_step_ = registers_.step_outer;
+			if constexpr (num_dimensions == 1)
+			{
+				num_units_ = (table_size.template at<0>() + num_elements_per_batch - 1) / num_elements_per_batch;
+				unit_points_ = registers_.start_major;
+				unit_step_ = registers_.step_major;
+			}
+			else
+			{
+				num_units_ = table_size.template at<_outer_dimension>();
+			}
+
+			const std::size_t target_num_tasks_ = (thread_pool_.num_worker_threads + 1) * _parallel_tasks_per_thread;
+			const std::size_t units_per_task_ = (num_units_ + target_num_tasks_ - 1) / target_num_tasks_;
+
+			// Accumulated rather than calculated via multiplication, as the latter may produce different results to the serial loop
+			std::vector<Register_> task_start_points_;
+			task_start_points_.reserve((num_units_ + units_per_task_ - 1) / units_per_task_);
+			for (std::size_t unit_ = 0; unit_ < num_units_; ++unit_)
+			{
+				if ((unit_ % units_per_task_) == 0)
+				{
+					task_start_points_.push_back(unit_points_);
+				}
+				unit_points_ = EmuSIMD::add(unit_points_, unit_step_);
+			}
+
+			auto generate_task_ = [&](const std::size_t task_index_, SampleProcessor_& task_sample_processor_)
+			{
+				const std::size_t begin_ = task_index_ * units_per_task_;
+				const std::size_t end_ = std::min(begin_ + units_per_task_, num_units_);
+				Generator_ task_generator_(generator_);
+				Register_ task_points_ = task_start_points_[task_index_];
+				if constexpr (num_dimensions == 1)
+				{
+					_generate_major_segment
+					(
+						task_generator_,
+						task_sample_processor_,
+						_output_run(outputs_, 0, 0),
+						task_points_,
+						registers_.step_major,
+						registers_.start_outer,
+						registers_.start_middle,
+						begin_ * num_elements_per_batch,
+						std::min(end_ * num_elements_per_batch, table_size.template at<0>())
+					);
+				}
+				else
+				{
+					for (std::size_t outer_index_ = begin_; outer_index_ < end_; ++outer_index_)
+					{
+						_generate_outer_layer(task_generator_, task_sample_processor_, registers_, outer_index_, task_points_, outputs_);
+						task_points_ = EmuSIMD::add(task_points_, registers_.step_outer);
+					}
+				}
+			};
+			EmuMath::_underlying_noise_parallel::run_sample_processor_tasks<SampleProcessor_>(thread_pool_, task_start_points_.size(), sample_processor_, generate_task_);
+		}
+
+		[[nodiscard]] static constexpr inline bool _valid_resolution(const EmuMath::Vector<num_dimensions, std::size_t>& new_size_)
+		{
+			return !new_size_.CmpAnyEqual(std::size_t(0));
+		}
+
+		/// <summary> Determines if the box [begin_, end_) may be regenerated, requiring this table to currently be sized to the provided table_resolution_. </summary>
+		[[nodiscard]] inline bool _valid_region(const coordinate_type& table_resolution_, const coordinate_type& begin_, const coordinate_type& end_) const
+		{
+			for (std::size_t i = 0; i < num_dimensions; ++i)
+			{
+				const std::size_t size_ = table_size.at(i);
+				if (size_ != table_resolution_.at(i) || begin_.at(i) > end_.at(i) || end_.at(i) > size_)
+				{
+					return false;
+				}
+			}
+			return _valid_resolution(table_size);
+		}
+
+		void _do_resize(const coordinate_type& new_size_)
+		{
+			// We only do a resize if the new size is greater than what we currently have
+			// --- This avoids a clear when resizing to something smaller, unlike the normal NoiseTable
+			// --- This pertains to the "fast" aims of this noise table
+			if constexpr (is_flat)
+			{
+				// Flat storage only reallocates when it lacks the capacity for the new size, so strides can always be kept dense
+				std::size_t total_size_ = 1;
+				for (std::size_t i = 0; i < num_dimensions; ++i)
+				{
+					total_size_ *= new_size_[i];
+				}
+				samples.resize(total_size_);
+			}
+			else if (new_size_.CmpAnyGreater(table_size))
 			{
 				if constexpr (num_dimensions == 1)
 				{
@@ -672,9 +1994,122 @@ namespace EmuMath
 			table_size = new_size_;
 		}
 
+		/// <summary>
+		/// <para> Invokes row_func_ with every row of this table in X-fastest order, as a pointer to 32-bit floats and the width of the row. </para>
+		/// <para> X-major rows are passed straight from storage. Other layouts are transposed or gathered into a scratch row first. </para>
+		/// </summary>
+		template<class RowFunc_>
+		inline void _for_each_export_row(RowFunc_& row_func_) const
+		{
+			std::vector<float> scratch_;
+			const std::size_t width_ = table_size.template at<0>();
+			if constexpr (num_dimensions == 1)
+			{
+				EmuMath::_underlying_noise_export::emit_row(_major_run(0, 0), width_, row_func_, scratch_);
+			}
+			else
+			{
+				const std::size_t height_ = table_size.template at<1>();
+				std::size_t depth_ = 1;
+				if constexpr (num_dimensions == 3)
+				{
+					depth_ = table_size.template at<2>();
+				}
+
+				for (std::size_t z_ = 0; z_ < depth_; ++z_)
+				{
+					if constexpr (major_dimension == 0)
+					{
+						// X-major storage is YX or YZX, so every row is a contiguous major run
+						for (std::size_t y_ = 0; y_ < height_; ++y_)
+						{
+							EmuMath::_underlying_noise_export::emit_row(_major_run(y_, z_), width_, row_func_, scratch_);
+						}
+					}
+					else if constexpr (major_dimension == 1)
+					{
+						// Y-major storage is XY or XZY, so every column of this Z-slice is a contiguous major run
+						auto column_func_ = [this, z_](const std::size_t x_) { return _major_run(x_, z_); };
+						EmuMath::_underlying_noise_export::emit_transposed_rows(width_, height_, column_func_, row_func_, scratch_);
+					}
+					else
+					{
+						// Z-major storage is XYZ, so samples of a Z-slice are one per major run
+						for (std::size_t y_ = 0; y_ < height_; ++y_)
+						{
+							auto element_func_ = [this, y_, z_](const std::size_t x_) { return _major_run(x_, y_)[z_]; };
+							EmuMath::_underlying_noise_export::emit_gathered_row(width_, element_func_, row_func_, scratch_);
+						}
+					}
+				}
+			}
+		}
+
+		void _do_resize_with_gradients(const coordinate_type& new_size_, this_type& gradient_x_, this_type& gradient_y_, this_type& gradient_z_)
+		{
+			_do_resize(new_size_);
+			gradient_x_._do_resize(new_size_);
+			gradient_y_._do_resize(new_size_);
+			gradient_z_._do_resize(new_size_);
+		}
+
+		/// <summary>
+		/// <para> Provides a pointer to the first sample in the contiguous run of major-dimension samples at the provided outer and middle storage indices. </para>
+		/// <para> The outer index is ignored for 1-dimensional tables, and the middle index is ignored for tables of fewer than 3 dimensions. </para>
+		/// </summary>
+		[[nodiscard]] inline value_type* _major_run(const std::size_t outer_index_, const std::size_t middle_index_)
+		{
+			if constexpr (is_flat)
+			{
+				return samples.data() + _flat_index(outer_index_, middle_index_, 0);
+			}
+			else if constexpr (num_dimensions == 1)
+			{
+				return samples.data();
+			}
+			else if constexpr (num_dimensions == 2)
+			{
+				return samples[outer_index_].data();
+			}
+			else
+			{
+				return samples[outer_index_][middle_index_].data();
+			}
+		}
+
+		[[nodiscard]] inline const value_type* _major_run(const std::size_t outer_index_, const std::size_t middle_index_) const
+		{
+			return const_cast<this_type*>(this)->_major_run(outer_index_, middle_index_);
+		}
+
+		[[nodiscard]] inline value_type* _output_run(std::nullptr_t, const std::size_t outer_index_, const std::size_t middle_index_)
+		{
+			return _major_run(outer_index_, middle_index_);
+		}
+		[[nodiscard]] inline _gradient_major_runs _output_run(const _gradient_tables& gradient_tables_, const std::size_t outer_index_, const std::size_t middle_index_)
+		{
+			return _gradient_major_runs
+			{
+				_major_run(outer_index_, middle_index_),
+				gradient_tables_.x->_major_run(outer_index_, middle_index_),
+				gradient_tables_.y->_major_run(outer_index_, middle_index_),
+				gradient_tables_.z->_major_run(outer_index_, middle_index_)
+			};
+		}
+
+		/// <summary> Calculates the index of a sample within flat storage, using dense strides based on this table's current size. </summary>
+		[[nodiscard]] inline std::size_t _flat_index(const std::size_t outer_index_, const std::size_t middle_index_, const std::size_t major_index_) const
+		{
+			return _layout::flat_index(table_size, outer_index_, middle_index_, major_index_);
+		}
+
 		[[nodiscard]] value_type& _get_index(const coordinate_type& coords_)
 		{
-			if constexpr (NumDimensions_ == 1)
+			if constexpr (is_flat)
+			{
+				return samples[_layout::flat_index(table_size, coords_)];
+			}
+			else if constexpr (NumDimensions_ == 1)
 			{
 				// Only 1 dimension, so only 1 major.
 				return samples[coords_.template at<0>()];
@@ -0,0 +1,573 @@
+#ifndef EMU_MATH_FAST_NOISE_TABLE_CACHE_H_INC_
+#define EMU_MATH_FAST_NOISE_TABLE_CACHE_H_INC_ 1
+
+#include "_fast_noise_table.h"
+#include "_noise_table_options.h"
+#include "_noise_table_storage.h"
+#include "_noise_tmp.h"
+#include "_noise_info/_noise_type.h"
+#include "../../../EmuCore/FileHelpers/MappedFile.h"
+#include "../../../EmuSIMD/SIMDHelpers.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace EmuMath::_underlying_noise_cache
+{
+	/// <summary> Version of the cache file format and key layout. Must be incremented whenever either changes, or generated output changes for the same options. </summary>
+	static constexpr std::uint32_t format_version = 2;
+	/// <summary> Written to file headers in native byte order, so that files written on a machine of different endianness are rejected. </summary>
+	static constexpr std::uint32_t byte_order_mark = 0x01020304;
+	/// <summary> Alignment of samples within cache files. Mappings are page-aligned, so samples are aligned to this boundary in memory as well. </summary>
+	static constexpr std::size_t sample_alignment = 64;
+	static constexpr char magic[8] = { 'E', 'M', 'U', 'N', 'O', 'I', 'S', 'E' };
+	static constexpr const char* file_extension = ".emunoise";
+
+	struct file_header
+	{
+		char magic[8];
+		std::uint32_t format_version;
+		std::uint32_t byte_order_mark;
+		std::uint64_t key;
+		/// <summary> Number of canonical key bytes stored directly after this header, compared on load so that hash collisions are never mistaken for hits. </summary>
+		std::uint64_t key_bytes_size;
+		/// <summary> Offset of the first sample from the start of the file. </summary>
+		std::uint64_t data_offset;
+		std::uint64_t num_samples;
+	};
+
+	/// <summary> Builds the canonical byte representation of noise table options from which cache keys are hashed. </summary>
+	class key_builder
+	{
+	public:
+		template<typename T_>
+		inline void Append(const T_ value_)
+		{
+			static_assert(std::is_trivially_copyable_v<T_>, "Attempted to append a non-trivially-copyable value to a noise table cache key.");
+			const auto* value_bytes_ = reinterpret_cast<const unsigned char*>(&value_);
+			bytes.insert(bytes.end(), value_bytes_, value_bytes_ + sizeof(T_));
+		}
+
+		/// <summary> Appends a floating-point value, treating -0 and 0 as the same value since they produce the same samples. </summary>
+		template<typename FP_>
+		inline void AppendFloat(const FP_ value_)
+		{
+			static_assert(std::is_floating_point_v<FP_>, "Attempted to append a non-floating-point value to a noise table cache key as a float.");
+			Append<FP_>(value_ + FP_(0));
+		}
+
+		template<std::size_t NumDimensions_, typename FP_, std::size_t...Indices_>
+		inline void AppendOptions(const EmuMath::NoiseTableOptions<NumDimensions_, FP_>& options_, std::index_sequence<Indices_...>)
+		{
+			// Options with the same resulting step are equivalent regardless of step_mode, so only the step is used
+			const auto step_ = options_.MakeStep();
+			(Append<std::uint64_t>(static_cast<std::uint64_t>(options_.table_resolution.template at<Indices_>())), ...);
+			(AppendFloat(options_.start_point.template at<Indices_>()), ...);
+			(AppendFloat(step_.template at<Indices_>()), ...);
+			AppendFloat(options_.freq);
+
+			Append<std::uint8_t>(options_.use_fractal_noise ? 1 : 0);
+			if (options_.use_fractal_noise)
+			{
+				Append<std::uint64_t>(static_cast<std::uint64_t>(options_.fractal_noise_info.GetOctaves()));
+				AppendFloat(options_.fractal_noise_info.GetLacunarity());
+				AppendFloat(options_.fractal_noise_info.GetGain());
+			}
+
+			// Only the seed used by the validated shuffle mode affects permutations
+			const auto& permutation_info_ = options_.permutation_info;
+			const auto shuffle_mode_ = EmuMath::Info::validate_noise_permutation_shuffle_mode(permutation_info_.shuffle_mode);
+			Append<std::uint64_t>(static_cast<std::uint64_t>(permutation_info_.TargetCountToPowerOf2()));
+			Append<std::uint8_t>(static_cast<std::uint8_t>(shuffle_mode_));
+			switch (shuffle_mode_)
+			{
+				case EmuMath::Info::NoisePermutationShuffleMode::SEED_32:
+					Append(permutation_info_.seed_32);
+					break;
+				case EmuMath::Info::NoisePermutationShuffleMode::SEED_64:
+					Append(permutation_info_.seed_64);
+					break;
+				default:
+					Append<std::uint8_t>(permutation_info_.bool_input ? 1 : 0);
+					break;
+			}
+			Append<std::uint64_t>(static_cast<std::uint64_t>(permutation_info_.TilePeriodToPowerOf2()));
+		}
+
+		/// <summary> 64-bit FNV-1a hash of all bytes appended so far. </summary>
+		[[nodiscard]] inline std::uint64_t Hash() const
+		{
+			std::uint64_t hash_ = 0xCBF29CE484222325ULL;
+			for (const unsigned char byte_ : bytes)
+			{
+				hash_ = (hash_ ^ byte_) * 0x100000001B3ULL;
+			}
+			return hash_;
+		}
+
+		std::vector<unsigned char> bytes;
+	};
+
+	[[nodiscard]] constexpr inline std::size_t align_up(const std::size_t value_, const std::size_t alignment_)
+	{
+		return ((value_ + alignment_ - 1) / alignment_) * alignment_;
+	}
+}
+
+namespace EmuMath
+{
+	template<typename SampleTypeFP_>
+	class FastNoiseTableCache;
+
+	/// <summary>
+	/// <para> Read-only view of FastNoiseTable samples memory-mapped from a file written by an EmuMath::FastNoiseTableCache. </para>
+	/// <para>
+	///		Samples are stored in the same order as a FastNoiseTable using FLAT storage with the same dimensions and major dimension,
+	///		and are accessed in the same way. Pages are loaded on demand and shared by all processes viewing the same cache file.
+	/// </para>
+	/// <para> Views are move-only. A default-constructed or moved-from view is empty. </para>
+	/// <para> SampleTypeFP_ is the type of the viewed samples, and must match the SampleTypeFP_ of the FastNoiseTableCache which provided the view. </para>
+	/// </summary>
+	template<std::size_t NumDimensions_, std::size_t MajorDimensionIndex_ = NumDimensions_ - 1, typename SampleTypeFP_ = float>
+	class FastNoiseTableView
+	{
+	public:
+		using table_type = EmuMath::FastNoiseTable<NumDimensions_, MajorDimensionIndex_, EmuMath::NoiseTableStorageMode::FLAT, SampleTypeFP_>;
+		static constexpr std::size_t num_dimensions = table_type::num_dimensions;
+		static constexpr std::size_t major_dimension = table_type::major_dimension;
+		using value_type = typename table_type::value_type;
+		using this_type = FastNoiseTableView<NumDimensions_, MajorDimensionIndex_, SampleTypeFP_>;
+		using coordinate_type = typename table_type::coordinate_type;
+
+	private:
+		template<typename>
+		friend class FastNoiseTableCache;
+
+		using _layout = EmuMath::TMP::_noise_table_layout<num_dimensions, major_dimension>;
+
+		template<std::size_t Unused_>
+		[[nodiscard]] static constexpr inline bool _can_do_1d_only_funcs()
+		{
+			return Unused_ >= 0 && num_dimensions == 1;
+		}
+
+		template<std::size_t Unused_>
+		[[nodiscard]] static constexpr inline bool _can_do_2d_only_funcs()
+		{
+			return Unused_ >= 0 && num_dimensions == 2;
+		}
+
+		template<std::size_t Unused_>
+		[[nodiscard]] static constexpr inline bool _can_do_3d_only_funcs()
+		{
+			return Unused_ >= 0 && num_dimensions == 3;
+		}
+
+		FastNoiseTableView(EmuCore::FileHelpers::ReadOnlyMappedFile&& mapping_, const value_type* samples_, const coordinate_type& table_size_) :
+			mapping(std::move(mapping_)),
+			samples(samples_),
+			table_size(table_size_)
+		{
+		}
+
+	public:
+#pragma region CONSTRUCTORS
+		FastNoiseTableView() : mapping(), samples(nullptr), table_size()
+		{
+		}
+
+		FastNoiseTableView(const this_type&) = delete;
+
+		FastNoiseTableView(this_type&& to_move_) noexcept : mapping(std::move(to_move_.mapping)), samples(to_move_.samples), table_size(to_move_.table_size)
+		{
+			to_move_.samples = nullptr;
+			to_move_.table_size = coordinate_type();
+		}
+
+		this_type& operator=(const this_type&) = delete;
+
+		this_type& operator=(this_type&& rhs_) noexcept
+		{
+			if (this != &rhs_)
+			{
+				mapping = std::move(rhs_.mapping);
+				samples = rhs_.samples;
+				table_size = rhs_.table_size;
+				rhs_.samples = nullptr;
+				rhs_.table_size = coordinate_type();
+			}
+			return *this;
+		}
+#pragma endregion
+
+#pragma region RANDOM_ACCESS
+		template<std::size_t Unused_ = 0, typename OnlyAvailableFor1Dimensional_ = std::enable_if_t<_can_do_1d_only_funcs<Unused_>()>>
+		[[nodiscard]] inline value_type at(std::size_t x_) const
+		{
+			return samples[x_];
+		}
+		template<std::size_t Unused_ = 0, typename OnlyAvailableFor2Dimensional_ = std::enable_if_t<_can_do_2d_only_funcs<Unused_>()>>
+		[[nodiscard]] inline value_type at(std::size_t x_, std::size_t y_) const
+		{
+			return _get_index(coordinate_type(x_, y_));
+		}
+		template<std::size_t Unused_ = 0, typename OnlyAvailableFor3Dimensional_ = std::enable_if_t<_can_do_3d_only_funcs<Unused_>()>>
+		[[nodiscard]] inline value_type at(std::size_t x_, std::size_t y_, std::size_t z_) const
+		{
+			return _get_index(coordinate_type(x_, y_, z_));
+		}
+
+		template<std::size_t Size_>
+		[[nodiscard]] inline value_type at(const EmuMath::Vector<Size_, std::size_t> coords_) const
+		{
+			if constexpr (Size_ == num_dimensions)
+			{
+				return _get_index(coords_);
+			}
+			else
+			{
+				return _get_index(table_type::make_coords_from_vector(coords_));
+			}
+		}
+
+		template<std::size_t Unused_ = 0, typename OnlyAvailableFor1Dimensional_ = std::enable_if_t<_can_do_1d_only_funcs<Unused_>()>>
+		[[nodiscard]] inline value_type operator[](std::size_t x_) const
+		{
+			return at(x_);
+		}
+		template<std::size_t Size_>
+		[[nodiscard]] inline value_type operator[](const EmuMath::Vector<Size_, std::size_t> coords_) const
+		{
+			return at(coords_);
+		}
+
+		template<std::size_t Unused_ = 0, typename OnlyAvailableFor1Dimensional_ = std::enable_if_t<_can_do_1d_only_funcs<Unused_>()>>
+		[[nodiscard]] inline value_type operator()(std::size_t x_) const
+		{
+			return at(x_);
+		}
+		template<std::size_t Unused_ = 0, typename OnlyAvailableFor2Dimensional_ = std::enable_if_t<_can_do_2d_only_funcs<Unused_>()>>
+		[[nodiscard]] inline value_type operator()(std::size_t x_, std::size_t y_) const
+		{
+			return at(x_, y_);
+		}
+		template<std::size_t Unused_ = 0, typename OnlyAvailableFor3Dimensional_ = std::enable_if_t<_can_do_3d_only_funcs<Unused_>()>>
+		[[nodiscard]] inline value_type operator()(std::size_t x_, std::size_t y_, std::size_t z_) const
+		{
+			return at(x_, y_, z_);
+		}
+		template<std::size_t Size_>
+		[[nodiscard]] inline value_type operator()(const EmuMath::Vector<Size_, std::size_t> coords_) const
+		{
+			return at(coords_);
+		}
+#pragma endregion
+
+		[[nodiscard]] inline coordinate_type size() const
+		{
+			return table_size;
+		}
+		template<std::size_t Index_>
+		[[nodiscard]] inline std::size_t size() const
+		{
+			if constexpr (Index_ < num_dimensions)
+			{
+				return table_size.template at<Index_>();
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<std::size_t, Index_>(), "Provided an invalid index to EmuMath::FastNoiseTableView::size. The provided Index_ must be less than the number of dimensions the view covers.");
+			}
+		}
+
+		/// <summary> Returns true if this view does not map any samples. </summary>
+		[[nodiscard]] inline bool empty() const
+		{
+			return !mapping.IsOpen();
+		}
+
+		/// <summary>
+		/// <para> Provides constant access to the contiguous samples of this view, in the same order as FastNoiseTable::data for FLAT storage. </para>
+		/// </summary>
+		/// <returns>Pointer to the first sample of this view, aligned to a 64-byte boundary. Null if this view is empty.</returns>
+		[[nodiscard]] inline const value_type* data() const
+		{
+			return samples;
+		}
+
+	private:
+		[[nodiscard]] inline value_type _get_index(const coordinate_type& coords_) const
+		{
+			return samples[_layout::flat_index(table_size, coords_)];
+		}
+
+		EmuCore::FileHelpers::ReadOnlyMappedFile mapping;
+		const value_type* samples;
+		coordinate_type table_size;
+	};
+
+	/// <summary>
+	/// <para> Disk-backed cache of generated FastNoiseTable samples, keyed by a content hash of the options, noise type and SIMD register used to generate them. </para>
+	/// <para>
+	///		Previously generated tables are memory-mapped read-only rather than regenerated, so a cold start only needs to page samples in,
+	///		and several processes on one machine share the same physical pages.
+	/// </para>
+	/// <para>
+	///		Files are written to a temporary path and renamed into place, so concurrent processes never observe partially written tables.
+	///		Files with a mismatched header, key or size are treated as misses and regenerated.
+	/// </para>
+	/// <para> Tables are generated with the default sample processor. Cache files are native to the machine's byte order and are not portable. </para>
+	/// <para> SampleTypeFP_ is the type of cached samples and of the options they are generated from, and must be a valid FastNoiseTable SampleTypeFP_. </para>
+	/// </summary>
+	template<typename SampleTypeFP_ = float>
+	class FastNoiseTableCache
+	{
+	public:
+		using value_type = SampleTypeFP_;
+		using this_type = FastNoiseTableCache<SampleTypeFP_>;
+		template<std::size_t NumDimensions_, std::size_t MajorDimensionIndex_ = NumDimensions_ - 1>
+		using view_type = EmuMath::FastNoiseTableView<NumDimensions_, MajorDimensionIndex_, value_type>;
+		/// <summary> Register used to generate tables when one is not explicitly provided. </summary>
+		using default_simd_register_type = typename std::conditional<std::is_same_v<value_type, double>, EmuSIMD::f64x2, EmuSIMD::f32x4>::type;
+
+		static_assert
+		(
+			std::is_same_v<value_type, float> || std::is_same_v<value_type, double>,
+			"Provided an invalid SampleTypeFP_ value to instantiate an EmuMath::FastNoiseTableCache template. Samples must be float or double."
+		);
+
+		explicit FastNoiseTableCache(std::filesystem::path directory_) : directory(std::move(directory_))
+		{
+		}
+
+		[[nodiscard]] inline const std::filesystem::path& Directory() const
+		{
+			return directory;
+		}
+
+		/// <summary>
+		/// <para> Calculates the key identifying a table generated with the provided options, noise type and register, stored with the provided major dimension. </para>
+		/// <para> Options producing identical samples produce the same key, such as an end point and a step which result in the same step. </para>
+		/// </summary>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, std::size_t NumDimensions_, std::size_t MajorDimensionIndex_ = NumDimensions_ - 1>
+		[[nodiscard]] static inline std::uint64_t MakeKey(const EmuMath::NoiseTableOptions<NumDimensions_, value_type>& options_)
+		{
+			return _make_key_builder<SIMDRegister_, NoiseType_, NumDimensions_, MajorDimensionIndex_>(options_).Hash();
+		}
+
+		/// <summary> Path of the cache file for the table identified by the provided arguments, in the same manner as MakeKey. </summary>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, std::size_t NumDimensions_, std::size_t MajorDimensionIndex_ = NumDimensions_ - 1>
+		[[nodiscard]] inline std::filesystem::path MakePath(const EmuMath::NoiseTableOptions<NumDimensions_, value_type>& options_) const
+		{
+			return _make_path(MakeKey<SIMDRegister_, NoiseType_, NumDimensions_, MajorDimensionIndex_>(options_));
+		}
+
+		/// <summary>
+		/// <para> Maps a previously cached table generated with the provided options, noise type and register, without generating it on a miss. </para>
+		/// </summary>
+		/// <returns>View of the cached table, or an empty view if no valid cached table exists.</returns>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, std::size_t NumDimensions_, std::size_t MajorDimensionIndex_ = NumDimensions_ - 1>
+		[[nodiscard]] inline view_type<NumDimensions_, MajorDimensionIndex_> TryLoad(const EmuMath::NoiseTableOptions<NumDimensions_, value_type>& options_) const
+		{
+			const auto key_ = _make_key_builder<SIMDRegister_, NoiseType_, NumDimensions_, MajorDimensionIndex_>(options_);
+			return _load<NumDimensions_, MajorDimensionIndex_>(key_, options_.table_resolution);
+		}
+		template<EmuMath::NoiseType NoiseType_, std::size_t NumDimensions_, std::size_t MajorDimensionIndex_ = NumDimensions_ - 1>
+		[[nodiscard]] inline view_type<NumDimensions_, MajorDimensionIndex_> TryLoad(const EmuMath::NoiseTableOptions<NumDimensions_, value_type>& options_) const
+		{
+			return TryLoad<default_simd_register_type, NoiseType_, NumDimensions_, MajorDimensionIndex_>(options_);
+		}
+
+		/// <summary>
+		/// <para> Maps the cached table generated with the provided options, noise type and register, generating and caching it first on a miss. </para>
+		/// <para> On a miss, generation is performed by num_threads_ threads in the same manner as FastNoiseTable::GenerateNoiseParallel. </para>
+		/// </summary>
+		/// <param name="options_">Options to generate the table with.</param>
+		/// <param name="num_threads_">Total number of threads to generate the table with on a miss, including the calling thread.</param>
+		/// <returns>View of the cached table, or an empty view if the table could not be generated or written to the cache directory.</returns>
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, std::size_t NumDimensions_, std::size_t MajorDimensionIndex_ = NumDimensions_ - 1>
+		[[nodiscard]] inline view_type<NumDimensions_, MajorDimensionIndex_> GetOrGenerate
+		(
+			const EmuMath::NoiseTableOptions<NumDimensions_, value_type>& options_,
+			const std::size_t num_threads_ = 1
+		) const
+		{
+			const auto key_ = _make_key_builder<SIMDRegister_, NoiseType_, NumDimensions_, MajorDimensionIndex_>(options_);
+			auto view_ = _load<NumDimensions_, MajorDimensionIndex_>(key_, options_.table_resolution);
+			if (!view_.empty())
+			{
+				return view_;
+			}
+
+			using table_type = typename view_type<NumDimensions_, MajorDimensionIndex_>::table_type;
+			table_type table_;
+			if (!table_.template GenerateNoiseParallel<SIMDRegister_, NoiseType_>(num_threads_, options_))
+			{
+				return view_;
+			}
+
+			std::size_t num_samples_ = 1;
+			for (std::size_t i = 0; i < NumDimensions_; ++i)
+			{
+				num_samples_ *= table_.size().at(i);
+			}
+
+			if (_write(key_, table_.data(), num_samples_))
+			{
+				view_ = _load<NumDimensions_, MajorDimensionIndex_>(key_, options_.table_resolution);
+			}
+			return view_;
+		}
+		template<EmuMath::NoiseType NoiseType_, std::size_t NumDimensions_, std::size_t MajorDimensionIndex_ = NumDimensions_ - 1>
+		[[nodiscard]] inline view_type<NumDimensions_, MajorDimensionIndex_> GetOrGenerate
+		(
+			const EmuMath::NoiseTableOptions<NumDimensions_, value_type>& options_,
+			const std::size_t num_threads_ = 1
+		) const
+		{
+			return GetOrGenerate<default_simd_register_type, NoiseType_, NumDimensions_, MajorDimensionIndex_>(options_, num_threads_);
+		}
+
+	private:
+		template<EmuConcepts::KnownSIMD SIMDRegister_, EmuMath::NoiseType NoiseType_, std::size_t NumDimensions_, std::size_t MajorDimensionIndex_>
+		[[nodiscard]] static inline EmuMath::_underlying_noise_cache::key_builder _make_key_builder(const EmuMath::NoiseTableOptions<NumDimensions_, value_type>& options_)
+		{
+			using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+			EmuMath::_underlying_noise_cache::key_builder key_;
+			key_.Append<std::uint32_t>(EmuMath::_underlying_noise_cache::format_version);
+			key_.Append<std::uint32_t>(static_cast<std::uint32_t>(NumDimensions_));
+			key_.Append<std::uint32_t>(static_cast<std::uint32_t>(MajorDimensionIndex_));
+			key_.Append<std::uint8_t>(static_cast<std::uint8_t>(NoiseType_));
+			key_.Append<std::uint32_t>(static_cast<std::uint32_t>(EmuSIMD::TMP::simd_register_width_v<register_type>));
+			key_.Append<std::uint32_t>(static_cast<std::uint32_t>(sizeof(value_type)));
+			key_.AppendOptions(options_, std::make_index_sequence<NumDimensions_>());
+			return key_;
+		}
+
+		[[nodiscard]] inline std::filesystem::path _make_path(const std::uint64_t key_) const
+		{
+			constexpr char hex_digits_[] = "0123456789abcdef";
+			std::string filename_(16, '0');
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				filename_[15 - i] = hex_digits_[(key_ >> (i * 4)) & 0xF];
+			}
+			return directory / (filename_ + EmuMath::_underlying_noise_cache::file_extension);
+		}
+
+		template<std::size_t NumDimensions_, std::size_t MajorDimensionIndex_>
+		[[nodiscard]] inline view_type<NumDimensions_, MajorDimensionIndex_> _load
+		(
+			const EmuMath::_underlying_noise_cache::key_builder& key_,
+			const EmuMath::Vector<NumDimensions_, std::size_t>& table_resolution_
+		) const
+		{
+			using loaded_view_type = view_type<NumDimensions_, MajorDimensionIndex_>;
+			using header_type = EmuMath::_underlying_noise_cache::file_header;
+
+			EmuCore::FileHelpers::ReadOnlyMappedFile mapping_(_make_path(key_.Hash()));
+			if (!mapping_.IsOpen() || mapping_.size() < sizeof(header_type))
+			{
+				return loaded_view_type();
+			}
+
+			const auto* file_bytes_ = static_cast<const unsigned char*>(mapping_.data());
+			header_type header_;
+			std::memcpy(&header_, file_bytes_, sizeof(header_type));
+
+			std::size_t num_samples_ = 1;
+			for (std::size_t i = 0; i < NumDimensions_; ++i)
+			{
+				num_samples_ *= table_resolution_.at(i);
+			}
+
+			const std::size_t key_end_ = sizeof(header_type) + key_.bytes.size();
+			const bool valid_ =
+			(
+				std::memcmp(header_.magic, EmuMath::_underlying_noise_cache::magic, sizeof(header_.magic)) == 0 &&
+				header_.format_version == EmuMath::_underlying_noise_cache::format_version &&
+				header_.byte_order_mark == EmuMath::_underlying_noise_cache::byte_order_mark &&
+				header_.key == key_.Hash() &&
+				header_.key_bytes_size == key_.bytes.size() &&
+				header_.num_samples == num_samples_ &&
+				header_.data_offset == EmuMath::_underlying_noise_cache::align_up(key_end_, EmuMath::_underlying_noise_cache::sample_alignment) &&
+				mapping_.size() == header_.data_offset + (num_samples_ * sizeof(value_type)) &&
+				std::memcmp(file_bytes_ + sizeof(header_type), key_.bytes.data(), key_.bytes.size()) == 0
+			);
+			if (!valid_)
+			{
+				return loaded_view_type();
+			}
+
+			const auto* samples_ = reinterpret_cast<const value_type*>(file_bytes_ + header_.data_offset);
+			return loaded_view_type(std::move(mapping_), samples_, table_resolution_);
+		}
+
+		[[nodiscard]] inline bool _write(const EmuMath::_underlying_noise_cache::key_builder& key_, const value_type* samples_, const std::size_t num_samples_) const
+		{
+			using header_type = EmuMath::_underlying_noise_cache::file_header;
+
+			std::error_code error_;
+			std::filesystem::create_directories(directory, error_);
+			if (error_)
+			{
+				return false;
+			}
+
+			header_type header_ = {};
+			std::memcpy(header_.magic, EmuMath::_underlying_noise_cache::magic, sizeof(header_.magic));
+			header_.format_version = EmuMath::_underlying_noise_cache::format_version;
+			header_.byte_order_mark = EmuMath::_underlying_noise_cache::byte_order_mark;
+			header_.key = key_.Hash();
+			header_.key_bytes_size = key_.bytes.size();
+			header_.data_offset = EmuMath::_underlying_noise_cache::align_up(sizeof(header_type) + key_.bytes.size(), EmuMath::_underlying_noise_cache::sample_alignment);
+			header_.num_samples = num_samples_;
+
+			// Unique temporary name so that processes generating the same table concurrently never write to the same file
+			const std::filesystem::path final_path_ = _make_path(header_.key);
+			std::filesystem::path temp_path_ = final_path_;
+			temp_path_ += "." + std::to_string(std::random_device()()) + ".tmp";
+
+			{
+				std::ofstream out_(temp_path_, std::ios::binary | std::ios::trunc);
+				if (!out_)
+				{
+					return false;
+				}
+
+				const std::vector<char> padding_(static_cast<std::size_t>(header_.data_offset) - (sizeof(header_type) + key_.bytes.size()), 0);
+				out_.write(reinterpret_cast<const char*>(&header_), sizeof(header_type));
+				out_.write(reinterpret_cast<const char*>(key_.bytes.data()), static_cast<std::streamsize>(key_.bytes.size()));
+				out_.write(padding_.data(), static_cast<std::streamsize>(padding_.size()));
+				out_.write(reinterpret_cast<const char*>(samples_), static_cast<std::streamsize>(num_samples_ * sizeof(value_type)));
+				if (!out_.flush())
+				{
+					out_.close();
+					std::filesystem::remove(temp_path_, error_);
+					return false;
+				}
+			}
+
+			// Renaming may fail if another process has the existing file mapped; its table is equivalent, so the newly written one is discarded
+			std::filesystem::rename(temp_path_, final_path_, error_);
+			if (error_)
+			{
+				std::filesystem::remove(temp_path_, error_);
+				return std::filesystem::exists(final_path_, error_);
+			}
+			return true;
+		}
+
+		std::filesystem::path directory;
+	};
+}
+
+#endif
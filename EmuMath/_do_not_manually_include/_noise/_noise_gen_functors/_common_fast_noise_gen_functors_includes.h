@@ -5,6 +5,16 @@
 #include "../../../../EmuSIMD/SIMDHelpers.h"
 #include "../../../../EmuCore/TMPHelpers/Values.h"
 #include <array>
+#include <cstdint>
+
+/// <summary>
+/// <para> Preprocessor flag indicating if fast noise generators perform permutation lookups via SIMD gathers where supported. </para>
+/// <para> If this is false, permutations are always looked up via the scalar fallback, which stores indices and hashes one element at a time. </para>
+/// <para> Gathers are only used for registers of 32-bit floating-point elements. Output is identical regardless of this flag. </para>
+/// </summary>
+#ifndef EMU_MATH_FAST_NOISE_USE_GATHER
+#define EMU_MATH_FAST_NOISE_USE_GATHER (true)
+#endif
 
 namespace EmuMath::Functors::_underlying_noise_gen
 {
@@ -186,6 +196,325 @@ namespace EmuMath::Functors::_underlying_noise_gen
 		register_type six;
 		register_type ten;
 	};
+
+	/// <summary> Register equivalent of smooth_t_derivative, calculating the derivative of _fast_smooth_t with respect to each element of t_. </summary>
+	template<class Register_>
+	struct _fast_smooth_t_derivative
+	{
+		using register_type = Register_;
+
+		inline _fast_smooth_t_derivative() :
+			thirty(EmuSIMD::set1<register_type>(30.0f)),
+			sixty(EmuSIMD::set1<register_type>(60.0f))
+		{
+		}
+
+		[[nodiscard]] inline register_type operator()(register_type t_) const
+		{
+			register_type result_ = EmuSIMD::fmsub(t_, thirty, sixty);
+			result_ = EmuSIMD::fmadd(t_, result_, thirty);
+			return EmuSIMD::mul_all(EmuSIMD::mul_all(t_, t_), result_);
+		}
+
+		register_type thirty;
+		register_type sixty;
+	};
+
+	/// <summary>
+	/// <para> Calculates the dot product of each element's 3D perlin gradient with the provided offsets. </para>
+	/// <para> Equivalent to `dot_with_scalar(perlin_gradients<3, T>::values[hash_ & mask], x_, y_, z_)` for each element, without storing hashes to look up gradients. </para>
+	/// <para> Every 3D perlin gradient is the signed sum of two offsets, so the offsets are selected via comparisons and negated via their sign bits. </para>
+	/// </summary>
+	/// <param name="hash_">Integral register of permutation hashes, of the same element width as the floating-point offsets.</param>
+	/// <param name="x_">X-offsets from the lattice points that hash_ was produced for.</param>
+	/// <param name="y_">Y-offsets from the lattice points that hash_ was produced for.</param>
+	/// <param name="z_">Z-offsets from the lattice points that hash_ was produced for.</param>
+	/// <returns>Register containing the dot product of each element's gradient and offsets.</returns>
+	template<class Register_, class IntRegister_>
+	[[nodiscard]] inline Register_ _fast_perlin_gradient_dot_3d(IntRegister_ hash_, Register_ x_, Register_ y_, Register_ z_)
+	{
+		constexpr std::size_t per_element_width = EmuSIMD::TMP::determine_register_per_element_width<Register_>();
+		constexpr bool is_signed = true;
+
+		hash_ = EmuSIMD::bitwise_and(hash_, EmuSIMD::set1<IntRegister_, per_element_width>(static_cast<std::int32_t>(perlin_gradients<3, float>::mask)));
+		Register_ hash_fp_ = EmuSIMD::convert<Register_, per_element_width, is_signed, per_element_width, is_signed>(hash_);
+		Register_ lt_4_ = EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<Register_>(4.0f));
+		Register_ lt_8_ = EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<Register_>(8.0f));
+		Register_ lt_12_ = EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<Register_>(12.0f));
+		Register_ lt_14_ = EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<Register_>(14.0f));
+
+		// First offset: X for 0:7 and 12:13, Y for 8:11, Z for 14:15
+		Register_ u_ = EmuSIMD::blendv<per_element_width>(y_, x_, EmuSIMD::bitwise_or(lt_8_, EmuSIMD::bitwise_andnot(lt_12_, lt_14_)));
+		u_ = EmuSIMD::blendv<per_element_width>(z_, u_, lt_14_);
+
+		// Second offset: Y for 0:3 and 12:15, Z for 4:11
+		Register_ v_ = EmuSIMD::blendv<per_element_width>(y_, z_, EmuSIMD::bitwise_andnot(lt_4_, lt_12_));
+
+		// Bit 0 negates the first offset and bit 1 negates the second, by moving each into its offset's sign bit
+		Register_ u_sign_ = EmuSIMD::cast<Register_>(EmuSIMD::shift_left<per_element_width - 1, per_element_width>(hash_));
+		Register_ v_sign_ = EmuSIMD::cast<Register_>
+		(
+			EmuSIMD::shift_left<per_element_width - 2, per_element_width>(EmuSIMD::bitwise_and(hash_, EmuSIMD::set1<IntRegister_, per_element_width>(2)))
+		);
+		return EmuSIMD::add(EmuSIMD::bitwise_xor(u_, u_sign_), EmuSIMD::bitwise_xor(v_, v_sign_));
+	}
+
+	/// <summary>
+	/// <para> Outputs the components of each element's 3D perlin gradient, equivalent to `perlin_gradients<3, T>::values[hash_ & mask]` for each element. </para>
+	/// <para> Components are selected via the same comparisons as _fast_perlin_gradient_dot_3d, for use where gradients are needed beyond a single dot product. </para>
+	/// </summary>
+	/// <param name="hash_">Integral register of permutation hashes, of the same element width as the output registers.</param>
+	/// <param name="out_x_">Register to output the X-component of each element's gradient to.</param>
+	/// <param name="out_y_">Register to output the Y-component of each element's gradient to.</param>
+	/// <param name="out_z_">Register to output the Z-component of each element's gradient to.</param>
+	template<class Register_, class IntRegister_>
+	inline void _fast_perlin_gradient_3d(IntRegister_ hash_, Register_& out_x_, Register_& out_y_, Register_& out_z_)
+	{
+		constexpr std::size_t per_element_width = EmuSIMD::TMP::determine_register_per_element_width<Register_>();
+		constexpr bool is_signed = true;
+
+		hash_ = EmuSIMD::bitwise_and(hash_, EmuSIMD::set1<IntRegister_, per_element_width>(static_cast<std::int32_t>(perlin_gradients<3, float>::mask)));
+		Register_ hash_fp_ = EmuSIMD::convert<Register_, per_element_width, is_signed, per_element_width, is_signed>(hash_);
+		Register_ lt_4_ = EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<Register_>(4.0f));
+		Register_ lt_8_ = EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<Register_>(8.0f));
+		Register_ lt_12_ = EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<Register_>(12.0f));
+		Register_ lt_14_ = EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<Register_>(14.0f));
+
+		// Signed unit magnitudes of the first and second offsets, negated by bits 0 and 1 respectively
+		Register_ one_ = EmuSIMD::set1<Register_>(1.0f);
+		Register_ u_ = EmuSIMD::bitwise_xor(one_, EmuSIMD::cast<Register_>(EmuSIMD::shift_left<per_element_width - 1, per_element_width>(hash_)));
+		Register_ v_ = EmuSIMD::bitwise_xor
+		(
+			one_,
+			EmuSIMD::cast<Register_>
+			(
+				EmuSIMD::shift_left<per_element_width - 2, per_element_width>(EmuSIMD::bitwise_and(hash_, EmuSIMD::set1<IntRegister_, per_element_width>(2)))
+			)
+		);
+
+		// First offset: X for 0:7 and 12:13, Y for 8:11, Z for 14:15
+		// Second offset: Y for 0:3 and 12:15, Z for 4:11
+		Register_ v_is_z_ = EmuSIMD::bitwise_andnot(lt_4_, lt_12_);
+		out_x_ = EmuSIMD::bitwise_and(EmuSIMD::bitwise_or(lt_8_, EmuSIMD::bitwise_andnot(lt_12_, lt_14_)), u_);
+		out_y_ = EmuSIMD::bitwise_or(EmuSIMD::bitwise_and(EmuSIMD::bitwise_andnot(lt_8_, lt_12_), u_), EmuSIMD::bitwise_andnot(v_is_z_, v_));
+		out_z_ = EmuSIMD::bitwise_or(EmuSIMD::bitwise_andnot(lt_14_, u_), EmuSIMD::bitwise_and(v_is_z_, v_));
+	}
+
+	/// <summary>
+	/// <para> Calculates the dot product of each element's 4D perlin gradient with the provided offsets. </para>
+	/// <para> Equivalent to `dot_with_scalar(perlin_gradients<4, T>::values[hash_ & mask], x_, y_, z_, w_)` for each element, without storing hashes to look up gradients. </para>
+	/// <para> Every 4D perlin gradient is the signed sum of three offsets, so the offsets are selected via comparisons and negated via their sign bits. </para>
+	/// </summary>
+	/// <param name="hash_">Integral register of permutation hashes, of the same element width as the floating-point offsets.</param>
+	/// <param name="x_">X-offsets from the lattice points that hash_ was produced for.</param>
+	/// <param name="y_">Y-offsets from the lattice points that hash_ was produced for.</param>
+	/// <param name="z_">Z-offsets from the lattice points that hash_ was produced for.</param>
+	/// <param name="w_">W-offsets from the lattice points that hash_ was produced for.</param>
+	/// <returns>Register containing the dot product of each element's gradient and offsets.</returns>
+	template<class Register_, class IntRegister_>
+	[[nodiscard]] inline Register_ _fast_perlin_gradient_dot_4d(IntRegister_ hash_, Register_ x_, Register_ y_, Register_ z_, Register_ w_)
+	{
+		constexpr std::size_t per_element_width = EmuSIMD::TMP::determine_register_per_element_width<Register_>();
+		constexpr bool is_signed = true;
+
+		hash_ = EmuSIMD::bitwise_and(hash_, EmuSIMD::set1<IntRegister_, per_element_width>(static_cast<std::int32_t>(perlin_gradients<4, float>::mask)));
+		Register_ hash_fp_ = EmuSIMD::convert<Register_, per_element_width, is_signed, per_element_width, is_signed>(hash_);
+
+		// Each group of 8 hashes zeroes one component, so the remaining components shift down by one offset once the zeroed component is passed
+		// --- First offset: Y for 0:7, otherwise X
+		// --- Second offset: Z for 0:15, otherwise Y
+		// --- Third offset: W for 0:23, otherwise Z
+		Register_ u_ = EmuSIMD::blendv<per_element_width>(x_, y_, EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<Register_>(8.0f)));
+		Register_ v_ = EmuSIMD::blendv<per_element_width>(y_, z_, EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<Register_>(16.0f)));
+		Register_ t_ = EmuSIMD::blendv<per_element_width>(z_, w_, EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<Register_>(24.0f)));
+
+		// Bits 0, 1, and 2 negate the first, second, and third offsets respectively, by moving each into its offset's sign bit
+		Register_ u_sign_ = EmuSIMD::cast<Register_>(EmuSIMD::shift_left<per_element_width - 1, per_element_width>(hash_));
+		Register_ v_sign_ = EmuSIMD::cast<Register_>
+		(
+			EmuSIMD::shift_left<per_element_width - 2, per_element_width>(EmuSIMD::bitwise_and(hash_, EmuSIMD::set1<IntRegister_, per_element_width>(2)))
+		);
+		Register_ t_sign_ = EmuSIMD::cast<Register_>
+		(
+			EmuSIMD::shift_left<per_element_width - 3, per_element_width>(EmuSIMD::bitwise_and(hash_, EmuSIMD::set1<IntRegister_, per_element_width>(4)))
+		);
+		return EmuSIMD::add
+		(
+			EmuSIMD::add(EmuSIMD::bitwise_xor(u_, u_sign_), EmuSIMD::bitwise_xor(v_, v_sign_)),
+			EmuSIMD::bitwise_xor(t_, t_sign_)
+		);
+	}
+
+	/// <summary> Boolean indicating if fast noise generators for the provided floating-point register perform permutation lookups via _fast_gather_permutations. </summary>
+	template<class FloatRegister_>
+	static constexpr bool _fast_gather_supported_v = 
+	(
+		(EMU_MATH_FAST_NOISE_USE_GATHER) &&
+		(sizeof(EmuMath::NoisePermutationValue) == 4 || EmuMath::NoisePermutations::num_padding_items >= ((4 / sizeof(EmuMath::NoisePermutationValue)) - 1)) &&
+		EmuCore::TMP::is_any_comparison_true<std::is_same, typename std::remove_cvref<FloatRegister_>::type, EmuSIMD::f32x4, EmuSIMD::f32x8>::value
+	);
+
+	/// <summary>
+	/// <para> Gathers the permutation at each index contained in the provided register of 32-bit indices. </para>
+	/// <para> 256-bit registers use a hardware gather. 128-bit registers use an emulated gather, as hardware 4-element gathers are rarely faster. </para>
+	/// <para>
+	///		Hardware gathers of narrow permutations read a full 32-bit value starting at each item and mask off the excess bits,
+	///		relying on the trailing padding of doubled NoisePermutations to keep reads of the final items in bounds.
+	/// </para>
+	/// </summary>
+	/// <param name="permutations_">Permutations to look up values from. Every index must be a valid index within this sequence's stored items.</param>
+	/// <param name="indices_">Register of 32-bit indices to gather permutations for.</param>
+	/// <returns>Register of 32-bit integers containing the permutation at the index in the respective element of indices_.</returns>
+	template<class IntRegister_>
+	[[nodiscard]] inline IntRegister_ _fast_gather_permutations(const EmuMath::NoisePermutations& permutations_, IntRegister_ indices_)
+	{
+		constexpr int value_size = static_cast<int>(sizeof(EmuMath::NoisePermutationValue));
+		const EmuMath::NoisePermutationValue* table_ = permutations_.data();
+		if constexpr (std::is_same_v<IntRegister_, EmuSIMD::i32x8>)
+		{
+#if EMU_SIMD_USE_256_REGISTERS
+			EmuSIMD::i32x8 gathered_ = _mm256_i32gather_epi32(reinterpret_cast<const int*>(table_), indices_, value_size);
+			if constexpr (value_size < 4)
+			{
+				constexpr std::int32_t value_mask = static_cast<std::int32_t>((std::uint32_t(1) << (value_size * 8)) - 1);
+				gathered_ = EmuSIMD::bitwise_and(gathered_, EmuSIMD::set1<EmuSIMD::i32x8, 32>(value_mask));
+			}
+			return gathered_;
+#else
+			std::int32_t indices_array_[8];
+			EmuSIMD::store(indices_, indices_array_);
+			return EmuSIMD::setr<EmuSIMD::i32x8, 32>
+			(
+				static_cast<std::int32_t>(table_[indices_array_[0]]), static_cast<std::int32_t>(table_[indices_array_[1]]),
+				static_cast<std::int32_t>(table_[indices_array_[2]]), static_cast<std::int32_t>(table_[indices_array_[3]]),
+				static_cast<std::int32_t>(table_[indices_array_[4]]), static_cast<std::int32_t>(table_[indices_array_[5]]),
+				static_cast<std::int32_t>(table_[indices_array_[6]]), static_cast<std::int32_t>(table_[indices_array_[7]])
+			);
+#endif
+		}
+		else if constexpr (std::is_same_v<IntRegister_, EmuSIMD::i32x4>)
+		{
+			std::int32_t indices_array_[4];
+			EmuSIMD::store(indices_, indices_array_);
+			return EmuSIMD::setr<EmuSIMD::i32x4, 32>
+			(
+				static_cast<std::int32_t>(table_[indices_array_[0]]), static_cast<std::int32_t>(table_[indices_array_[1]]),
+				static_cast<std::int32_t>(table_[indices_array_[2]]), static_cast<std::int32_t>(table_[indices_array_[3]])
+			);
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<IntRegister_>(), "Attempted to gather noise permutations with an unsupported integral register. Only 128-bit and 256-bit registers of 32-bit integers are supported.");
+		}
+	}
+
+	/// <summary>
+	/// <para> Performs a single nested step of the permutation hash for every element: `permutations_[hash_ + index_]`. </para>
+	/// <para> No masking is required as NoisePermutations are stored doubled, and both hash_ and index_ are expected to be in the range 0:permutations_.size(). </para>
+	/// </summary>
+	/// <param name="permutations_">Permutations to look up values from.</param>
+	/// <param name="hash_">Result of the previous hash step.</param>
+	/// <param name="index_">Lattice index to offset the previous hash by.</param>
+	/// <returns>Register of 32-bit integers containing the next step of the permutation hash for each element.</returns>
+	template<class IntRegister_>
+	[[nodiscard]] inline IntRegister_ _fast_permutation_hash_step(const EmuMath::NoisePermutations& permutations_, IntRegister_ hash_, IntRegister_ index_)
+	{
+		return _fast_gather_permutations(permutations_, EmuSIMD::add<32>(hash_, index_));
+	}
+
+	/// <summary>
+	/// <para> Looks up the permutation at each index contained in the provided integral register, via _fast_gather_permutations where supported. </para>
+	/// <para> Where gathers are not supported, indices are stored and looked up one element at a time. </para>
+	/// </summary>
+	/// <param name="permutations_">Permutations to look up values from. Every index must be a valid index within this sequence's stored items.</param>
+	/// <param name="indices_">Register of indices to look up permutations for.</param>
+	/// <returns>Integral register containing the permutation at the index in the respective element of indices_.</returns>
+	template<class FloatRegister_, class IntRegister_>
+	[[nodiscard]] inline IntRegister_ _fast_lookup_permutations(const EmuMath::NoisePermutations& permutations_, IntRegister_ indices_)
+	{
+		if constexpr (_fast_gather_supported_v<FloatRegister_>)
+		{
+			return _fast_gather_permutations(permutations_, indices_);
+		}
+		else
+		{
+			using scalar_int = typename std::conditional<EmuSIMD::TMP::determine_register_per_element_width<FloatRegister_>() == 32, std::int32_t, std::int64_t>::type;
+			constexpr std::size_t num_elements = EmuSIMD::TMP::determine_register_element_count<FloatRegister_>();
+
+			scalar_int indices_array_[num_elements];
+			EmuSIMD::store(indices_, indices_array_);
+			for (std::size_t i = 0; i < num_elements; ++i)
+			{
+				indices_array_[i] = static_cast<scalar_int>(permutations_[static_cast<std::size_t>(indices_array_[i])]);
+			}
+			return EmuSIMD::load<IntRegister_>(indices_array_);
+		}
+	}
+
+	/// <summary>
+	/// <para> Calculates the distance of the provided offsets from a cellular noise feature point for every element, using the provided CellularNoiseDistance metric. </para>
+	/// <para> Euclidean distances are output squared, and should be passed to _fast_cellular_noise_finish once the nearest feature points have been found. </para>
+	/// </summary>
+	template<EmuMath::CellularNoiseDistance Distance_, class Register_, class...Offsets_>
+	[[nodiscard]] inline Register_ _fast_cellular_distance(Register_ offset_0_, Offsets_...offsets_)
+	{
+		if constexpr (Distance_ == EmuMath::CellularNoiseDistance::EUCLIDEAN)
+		{
+			Register_ result_ = EmuSIMD::mul_all(offset_0_, offset_0_);
+			((result_ = EmuSIMD::fmadd(offsets_, offsets_, result_)), ...);
+			return result_;
+		}
+		else if constexpr (Distance_ == EmuMath::CellularNoiseDistance::MANHATTAN)
+		{
+			Register_ result_ = EmuSIMD::abs(offset_0_);
+			((result_ = EmuSIMD::add(result_, EmuSIMD::abs(offsets_))), ...);
+			return result_;
+		}
+		else
+		{
+			Register_ result_ = EmuSIMD::abs(offset_0_);
+			((result_ = EmuSIMD::max(result_, EmuSIMD::abs(offsets_))), ...);
+			return result_;
+		}
+	}
+
+	/// <summary> Updates the provided nearest (f1_) and second-nearest (f2_) cellular noise distances of every element with newly found distances, without branching. </summary>
+	template<class Register_>
+	inline void _fast_cellular_reduce(Register_& f1_, Register_& f2_, Register_ distance_)
+	{
+		f2_ = EmuSIMD::min(f2_, EmuSIMD::max(f1_, distance_));
+		f1_ = EmuSIMD::min(f1_, distance_);
+	}
+
+	/// <summary> Produces the final output of cellular noise from the nearest (f1_) and second-nearest (f2_) distances found via _fast_cellular_distance. </summary>
+	template<EmuMath::CellularNoiseOutput Output_, EmuMath::CellularNoiseDistance Distance_, class Register_>
+	[[nodiscard]] inline Register_ _fast_cellular_noise_finish(Register_ f1_, Register_ f2_)
+	{
+		if constexpr (Distance_ == EmuMath::CellularNoiseDistance::EUCLIDEAN)
+		{
+			if constexpr (Output_ != EmuMath::CellularNoiseOutput::F2)
+			{
+				f1_ = EmuSIMD::sqrt(f1_);
+			}
+			if constexpr (Output_ != EmuMath::CellularNoiseOutput::F1)
+			{
+				f2_ = EmuSIMD::sqrt(f2_);
+			}
+		}
+
+		if constexpr (Output_ == EmuMath::CellularNoiseOutput::F1)
+		{
+			return f1_;
+		}
+		else if constexpr (Output_ == EmuMath::CellularNoiseOutput::F2)
+		{
+			return f2_;
+		}
+		else
+		{
+			return EmuSIMD::sub(f2_, f1_);
+		}
+	}
 }
 
 #endif
@@ -8,6 +8,7 @@
 #include "../../../../EmuCore/Functors/Arithmetic.h"
 #include "../../../../EmuCore/TMPHelpers/TypeComparators.h"
 #include "../../../../EmuCore/TMPHelpers/Values.h"
+#include <limits>
 
 namespace EmuMath::Functors::_underlying_noise_gen
 {
@@ -124,6 +125,175 @@ namespace EmuMath::Functors::_underlying_noise_gen
 		}
 	};
 
+	/// <summary>
+	/// <para> Gradients used for 4-dimensional perlin noise: the 32 vectors with one zeroed component and remaining components of magnitude 1. </para>
+	/// <para> Each group of 8 indices zeroes the same component, in the order X, Y, Z, W. Bits 0, 1, and 2 negate the first, second, and third remaining components. </para>
+	/// </summary>
+	template<typename T_>
+	struct perlin_gradients<4, T_>
+	{
+		using gradient_type = EmuMath::Vector<4, T_>;
+		static constexpr std::size_t num_gradients = 32;
+		static constexpr std::size_t mask = 31;
+		static constexpr gradient_type values[num_gradients] =
+		{
+			gradient_type(0, 1, 1, 1),
+			gradient_type(0, -1, 1, 1),
+			gradient_type(0, 1, -1, 1),
+			gradient_type(0, -1, -1, 1),
+			gradient_type(0, 1, 1, -1),
+			gradient_type(0, -1, 1, -1),
+			gradient_type(0, 1, -1, -1),
+			gradient_type(0, -1, -1, -1),
+			gradient_type(1, 0, 1, 1),
+			gradient_type(-1, 0, 1, 1),
+			gradient_type(1, 0, -1, 1),
+			gradient_type(-1, 0, -1, 1),
+			gradient_type(1, 0, 1, -1),
+			gradient_type(-1, 0, 1, -1),
+			gradient_type(1, 0, -1, -1),
+			gradient_type(-1, 0, -1, -1),
+			gradient_type(1, 1, 0, 1),
+			gradient_type(-1, 1, 0, 1),
+			gradient_type(1, -1, 0, 1),
+			gradient_type(-1, -1, 0, 1),
+			gradient_type(1, 1, 0, -1),
+			gradient_type(-1, 1, 0, -1),
+			gradient_type(1, -1, 0, -1),
+			gradient_type(-1, -1, 0, -1),
+			gradient_type(1, 1, 1, 0),
+			gradient_type(-1, 1, 1, 0),
+			gradient_type(1, -1, 1, 0),
+			gradient_type(-1, -1, 1, 0),
+			gradient_type(1, 1, -1, 0),
+			gradient_type(-1, 1, -1, 0),
+			gradient_type(1, -1, -1, 0),
+			gradient_type(-1, -1, -1, 0)
+		};
+
+		template<std::size_t Index_>
+		[[nodiscard]] static constexpr inline const gradient_type& at()
+		{
+			if constexpr (Index_ < num_gradients)
+			{
+				return values[Index_];
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<std::size_t, Index_>(), "Attempted to retrieve a 4D perlin noise gradient via compile-time index, but the provided Index_ was not in the valid range. The valid range is 0:31 (inclusive).");
+			}
+		}
+
+		constexpr perlin_gradients()
+		{
+		}
+	};
+
+	/// <summary>
+	/// <para> Constants used to generate simplex noise of the provided number of dimensions. </para>
+	/// <para> skew: Factor to multiply the sum of a point's coordinates by to skew it onto the hypercube lattice. </para>
+	/// <para> unskew: Factor to multiply the sum of a lattice point's coordinates by to unskew it back into simplex space. </para>
+	/// <para> falloff: Squared radius of each corner's influence. 0.5 keeps influence within neighbouring simplices, so no discontinuities are produced. </para>
+	/// <para> output_scale: Factor applied to the sum of corner contributions so that output targets the range -1:1. </para>
+	/// </summary>
+	template<std::size_t Dimensions_, typename T_>
+	struct simplex_constants
+	{
+		constexpr simplex_constants()
+		{
+			static_assert(EmuCore::TMP::get_false<T_>(), "Attempted to construct an unspecialised simplex_constants instance.");
+		}
+	};
+	template<typename T_>
+	struct simplex_constants<2, T_>
+	{
+		// (sqrt(3) - 1) / 2
+		static constexpr T_ skew = T_(0.36602540378443864676);
+		// (3 - sqrt(3)) / 6
+		static constexpr T_ unskew = T_(0.21132486540518711775);
+		static constexpr T_ falloff = T_(0.5);
+		static constexpr T_ output_scale = T_(99.2);
+	};
+	template<typename T_>
+	struct simplex_constants<3, T_>
+	{
+		static constexpr T_ skew = T_(1) / T_(3);
+		static constexpr T_ unskew = T_(1) / T_(6);
+		static constexpr T_ falloff = T_(0.5);
+		static constexpr T_ output_scale = T_(76.88);
+	};
+
+	/// <summary>
+	/// <para> Calculates the distance of the provided offsets from a cellular noise feature point, using the provided CellularNoiseDistance metric. </para>
+	/// <para> Euclidean distances are output squared, and should be passed to cellular_noise_finish once the nearest feature points have been found. </para>
+	/// </summary>
+	template<EmuMath::CellularNoiseDistance Distance_, typename T_, typename...Offsets_>
+	[[nodiscard]] constexpr inline T_ cellular_distance(T_ offset_0_, Offsets_...offsets_)
+	{
+		if constexpr (Distance_ == EmuMath::CellularNoiseDistance::EUCLIDEAN)
+		{
+			return ((offset_0_ * offset_0_) + ... + (offsets_ * offsets_));
+		}
+		else if constexpr (Distance_ == EmuMath::CellularNoiseDistance::MANHATTAN)
+		{
+			EmuCore::do_abs<T_> abs_ = EmuCore::do_abs<T_>();
+			return (abs_(offset_0_) + ... + abs_(offsets_));
+		}
+		else
+		{
+			EmuCore::do_abs<T_> abs_ = EmuCore::do_abs<T_>();
+			T_ result_ = abs_(offset_0_);
+			((result_ = (abs_(offsets_) > result_) ? abs_(offsets_) : result_), ...);
+			return result_;
+		}
+	}
+
+	/// <summary> Updates the provided nearest (f1_) and second-nearest (f2_) cellular noise distances with a newly found distance_. </summary>
+	template<typename T_>
+	constexpr inline void cellular_reduce(T_& f1_, T_& f2_, T_ distance_)
+	{
+		if (distance_ < f1_)
+		{
+			f2_ = f1_;
+			f1_ = distance_;
+		}
+		else if (distance_ < f2_)
+		{
+			f2_ = distance_;
+		}
+	}
+
+	/// <summary> Produces the final output of cellular noise from the nearest (f1_) and second-nearest (f2_) distances found via cellular_distance. </summary>
+	template<EmuMath::CellularNoiseOutput Output_, EmuMath::CellularNoiseDistance Distance_, typename T_>
+	[[nodiscard]] inline T_ cellular_noise_finish(T_ f1_, T_ f2_)
+	{
+		if constexpr (Distance_ == EmuMath::CellularNoiseDistance::EUCLIDEAN)
+		{
+			EmuCore::do_sqrt<T_> sqrt_ = EmuCore::do_sqrt<T_>();
+			if constexpr (Output_ != EmuMath::CellularNoiseOutput::F2)
+			{
+				f1_ = sqrt_(f1_);
+			}
+			if constexpr (Output_ != EmuMath::CellularNoiseOutput::F1)
+			{
+				f2_ = sqrt_(f2_);
+			}
+		}
+
+		if constexpr (Output_ == EmuMath::CellularNoiseOutput::F1)
+		{
+			return f1_;
+		}
+		else if constexpr (Output_ == EmuMath::CellularNoiseOutput::F2)
+		{
+			return f2_;
+		}
+		else
+		{
+			return f2_ - f1_;
+		}
+	}
+
 	/// <summary>Function applied to t_ to smooth it for smooth noise generation algorithms defined in EmuMath. </summary>
 	/// <returns>Smoothed float t_, resulting from 6(t^5) - 15(t^4) + 10(t^3) (where t^x == t to the power of x).</returns>
 	template<typename T_>
@@ -132,6 +302,14 @@ namespace EmuMath::Functors::_underlying_noise_gen
 		return t_ * t_ * t_ * (t_ * (t_ * T_(6) - T_(15)) + T_(10));
 	}
 
+	/// <summary>Derivative of smooth_t with respect to t_, for use in noise generation algorithms which output analytical derivatives.</summary>
+	/// <returns>Derivative of smooth_t at t_, resulting from 30(t^4) - 60(t^3) + 30(t^2) (where t^x == t to the power of x).</returns>
+	template<typename T_>
+	constexpr inline T_ smooth_t_derivative(T_ t_)
+	{
+		return t_ * t_ * (t_ * (t_ * T_(30) - T_(60)) + T_(30));
+	}
+
 	/// <summary>Function to perform a dot product with an EmuMath vector using precalculated values outside of a vector without needing to construct one.</summary>
 	/// <param name="vec_">Vector to form a dot product with.</param>
 	/// <param name="x_">X-component of a theoretical vector to form a dot product with.</param>
@@ -153,6 +331,18 @@ namespace EmuMath::Functors::_underlying_noise_gen
 	{
 		return ((vector_.template at<0>()) * x_) + ((vector_.template at<1>()) * y_) + ((vector_.template at<2>()) * z_);
 	}
+	/// <summary>Function to perform a dot product with an EmuMath vector using precalculated values outside of a vector without needing to construct one.</summary>
+	/// <param name="vec_">Vector to form a dot product with.</param>
+	/// <param name="x_">X-component of a theoretical vector to form a dot product with.</param>
+	/// <param name="y_">Y-component of a theoretical vector to form a dot product with.</param>
+	/// <param name="z_">Z-component of a theoretical vector to form a dot product with.</param>
+	/// <param name="w_">W-component of a theoretical vector to form a dot product with.</param>
+	/// <returns>Dot product of the passed vector and scalar values.</returns>
+	template<typename T_>
+	constexpr inline T_ dot_with_scalar(const EmuMath::Vector<4, T_>& vector_, T_ x_, T_ y_, T_ z_, T_ w_)
+	{
+		return ((vector_.template at<0>()) * x_) + ((vector_.template at<1>()) * y_) + ((vector_.template at<2>()) * z_) + ((vector_.template at<3>()) * w_);
+	}
 }
 
 #endif
@@ -38,7 +38,7 @@ namespace EmuMath::Functors
 		}
 
 		template<typename Point_>
-		constexpr inline value_type operator()(const Point_& point_)
+		constexpr inline auto operator()(const Point_& point_)
 		{
 			return generator(point_, freq, permutations);
 		}
@@ -85,11 +85,18 @@ namespace EmuMath::Functors
 		{
 		}
 
+		/// <summary>
+		/// <para> Accumulates all octaves of noise at the provided point. </para>
+		/// <para>
+		///		Generators outputting derivatives alongside values (such as make_noise_3d_derivatives) have all outputs accumulated in the same way.
+		///		As each octave's derivatives are already scaled by its frequency, this applies the chain rule to the accumulated derivatives.
+		/// </para>
+		/// </summary>
 		template<typename Point_>
-		constexpr inline value_type operator()(const Point_& point_)
+		constexpr inline auto operator()(const Point_& point_)
 		{
 			value_type freq_ = freq;
-			value_type result_ = generator(point_, freq_, permutations);
+			auto result_ = generator(point_, freq_, permutations);
 			value_type range_ = value_type(1);
 			value_type amplitude_ = value_type(1);
 			value_type lacunarity_ = fractal_info.GetLacunarity();
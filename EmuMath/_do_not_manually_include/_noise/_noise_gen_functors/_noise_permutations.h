@@ -2,12 +2,20 @@
 #define EMU_MATH_NOISE_PERMUTATIONS_H_INC_ 1
 
 #include "../../../Random.h"
+#include <cstdint>
 
 namespace EmuMath
 {
-	using NoisePermutationValue = std::size_t;
-	/// <summary> Integer sequence used as noise permutations for default-defined EmuMath noise generation functors. </summary>
-	using NoisePermutations = EmuMath::ShuffledIntSequence<NoisePermutationValue>;
+	/// <summary>
+	/// <para> Type of value stored in noise permutations. </para>
+	/// <para> 16-bit to keep permutation tables small enough to remain resident in L1 cache, while allowing up to 65536 permutations. </para>
+	/// </summary>
+	using NoisePermutationValue = std::uint16_t;
+	/// <summary>
+	/// <para> Integer sequence used as noise permutations for default-defined EmuMath noise generation functors. </para>
+	/// <para> Permutations are stored doubled, so nested hashes of the form `perms[perms[x] + y]` do not need to mask their indices. </para>
+	/// </summary>
+	using NoisePermutations = EmuMath::ShuffledIntSequence<NoisePermutationValue, true>;
 }
 
 #endif
@@ -34,10 +34,10 @@ namespace EmuMath::Functors
 		}
 		[[nodiscard]] inline FP_ operator()(value_type point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
 		{
-			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			std::size_t mask_ = permutations_.HighestStoredValue();
 			point_ *= freq_;
 
-			EmuMath::NoisePermutationValue i_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_)) & mask_;
+			std::size_t i_ = static_cast<std::size_t>(floor_(point_)) & mask_;
 			return permutations_[i_] * (value_type(1) / mask_);
 		}
 		template<std::size_t Size_, typename T_>
@@ -61,13 +61,13 @@ namespace EmuMath::Functors
 		}
 		inline value_type operator()(value_type point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
 		{
-			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			std::size_t mask_ = permutations_.HighestStoredValue();
 			point_ *= freq_;
 
-			EmuMath::NoisePermutationValue i_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_));
+			std::size_t i_0_ = static_cast<std::size_t>(floor_(point_));
 			value_type t_ = EmuMath::Functors::_underlying_noise_gen::smooth_t(point_ - i_0_);
 			i_0_ &= mask_;
-			EmuMath::NoisePermutationValue i_1_ = (i_0_ + 1) & mask_;
+			std::size_t i_1_ = (i_0_ + 1) & mask_;
 
 			value_type perm_0_ = static_cast<value_type>(permutations_[i_0_]);
 			value_type perm_1_ = static_cast<value_type>(permutations_[i_1_]);
@@ -91,7 +91,7 @@ namespace EmuMath::Functors
 
 		static constexpr std::size_t _num_gradients = 2;
 		static constexpr gradient_type _gradients[_num_gradients] = { gradient_type(1), gradient_type(-1) };
-		static constexpr EmuMath::NoisePermutationValue _gradient_mask = 1;
+		static constexpr std::size_t _gradient_mask = 1;
 
 		EmuCore::do_lerp<value_type, value_type, value_type> lerp_;
 		EmuCore::do_floor<value_type> floor_;
@@ -100,13 +100,13 @@ namespace EmuMath::Functors
 		}
 		inline value_type operator()(value_type point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
 		{
-			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			std::size_t mask_ = permutations_.HighestStoredValue();
 			point_ *= freq_;
-			EmuMath::NoisePermutationValue i_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_));
+			std::size_t i_0_ = static_cast<std::size_t>(floor_(point_));
 			value_type t_0_ = point_ - static_cast<value_type>(i_0_);
 			value_type t_1_ = t_0_ - value_type(1);
 			i_0_ &= mask_;
-			EmuMath::NoisePermutationValue i_1_ = (i_0_ + 1) & mask_;
+			std::size_t i_1_ = (i_0_ + 1) & mask_;
 
 			gradient_type gradient_0_ = _gradients[permutations_[i_0_] & _gradient_mask];
 			gradient_type gradient_1_ = _gradients[permutations_[i_1_] & _gradient_mask];
@@ -30,13 +30,13 @@ namespace EmuMath::Functors
 		}
 		inline value_type operator()(EmuMath::Vector<2, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
 		{
-			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			std::size_t mask_ = permutations_.HighestStoredValue();
 			point_ *= freq_;
 
-			EmuMath::NoisePermutationValue ix_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<0>())) & mask_;
-			EmuMath::NoisePermutationValue iy_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<1>())) & mask_;
+			std::size_t ix_ = static_cast<std::size_t>(floor_(point_.template at<0>())) & mask_;
+			std::size_t iy_ = static_cast<std::size_t>(floor_(point_.template at<1>())) & mask_;
 
-			return permutations_[(static_cast<std::size_t>(permutations_[ix_]) + iy_) & mask_] * (value_type(1) / mask_);
+			return permutations_[static_cast<std::size_t>(permutations_[ix_]) + iy_] * (value_type(1) / mask_);
 		}
 		template<std::size_t Size_, typename T_, typename OnlyNonV2f = std::enable_if_t<Size_ != 2 || !std::is_same_v<value_type, T_>>>
 		inline value_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
@@ -60,27 +60,27 @@ namespace EmuMath::Functors
 		}
 		[[nodiscard]] inline value_type operator()(EmuMath::Vector<2, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
 		{
-			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			std::size_t mask_ = permutations_.HighestStoredValue();
 			point_ *= freq_;
 
-			EmuMath::NoisePermutationValue ix_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<0>()));
-			EmuMath::NoisePermutationValue iy_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<1>()));
+			std::size_t ix_0_ = static_cast<std::size_t>(floor_(point_.template at<0>()));
+			std::size_t iy_0_ = static_cast<std::size_t>(floor_(point_.template at<1>()));
 
 			value_type tx = point_.template at<0>() - ix_0_;
 			value_type ty = point_.template at<1>() - iy_0_;
 			ix_0_ &= mask_;
 			iy_0_ &= mask_;
-			EmuMath::NoisePermutationValue ix_1_ = (ix_0_ + 1) & mask_;
-			EmuMath::NoisePermutationValue iy_1_ = (iy_0_ + 1) & mask_;
+			std::size_t ix_1_ = (ix_0_ + 1) & mask_;
+			std::size_t iy_1_ = (iy_0_ + 1) & mask_;
 
 			// Prepare permutations for interpolation
-			EmuMath::NoisePermutationValue perm_0_ = permutations_[ix_0_];
-			EmuMath::NoisePermutationValue perm_1_ = permutations_[ix_1_];
+			std::size_t perm_0_ = permutations_[ix_0_];
+			std::size_t perm_1_ = permutations_[ix_1_];
 			
-			value_type perm_00_ = static_cast<value_type>(permutations_[(perm_0_ + iy_0_) & mask_]);
-			value_type perm_01_ = static_cast<value_type>(permutations_[(perm_0_ + iy_1_) & mask_]);
-			value_type perm_10_ = static_cast<value_type>(permutations_[(perm_1_ + iy_0_) & mask_]);
-			value_type perm_11_ = static_cast<value_type>(permutations_[(perm_1_ + iy_1_) & mask_]);
+			value_type perm_00_ = static_cast<value_type>(permutations_[perm_0_ + iy_0_]);
+			value_type perm_01_ = static_cast<value_type>(permutations_[perm_0_ + iy_1_]);
+			value_type perm_10_ = static_cast<value_type>(permutations_[perm_1_ + iy_0_]);
+			value_type perm_11_ = static_cast<value_type>(permutations_[perm_1_ + iy_1_]);
 
 			tx = EmuMath::Functors::_underlying_noise_gen::smooth_t(tx);
 			ty = EmuMath::Functors::_underlying_noise_gen::smooth_t(ty);
@@ -115,26 +115,26 @@ namespace EmuMath::Functors
 		}
 		[[nodiscard]] inline value_type operator()(EmuMath::Vector<2, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
 		{
-			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			std::size_t mask_ = permutations_.HighestStoredValue();
 			point_ *= freq_;
-			EmuMath::NoisePermutationValue ix_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<0>()));
-			EmuMath::NoisePermutationValue iy_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<1>()));
+			std::size_t ix_0_ = static_cast<std::size_t>(floor_(point_.template at<0>()));
+			std::size_t iy_0_ = static_cast<std::size_t>(floor_(point_.template at<1>()));
 			value_type tx_0_ = point_.template at<0>() - ix_0_;
 			value_type ty_0_ = point_.template at<1>() - iy_0_;
 			value_type tx_1_ = tx_0_ - value_type(1);
 			value_type ty_1_ = ty_0_ - value_type(1);
 			ix_0_ &= mask_;
 			iy_0_ &= mask_;
-			EmuMath::NoisePermutationValue ix_1_ = (ix_0_ + 1) & mask_;
-			EmuMath::NoisePermutationValue iy_1_ = (iy_0_ + 1) & mask_;
+			std::size_t ix_1_ = (ix_0_ + 1) & mask_;
+			std::size_t iy_1_ = (iy_0_ + 1) & mask_;
 			
-			// Forced store as size_t so we can handle width changes if EmuMath::NoisePermutationValue is not size_t width
+			// Forced store as size_t so we can handle width changes if std::size_t is not size_t width
 			std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_]);
 			std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_]);
-			gradient_type gradient_00_ = gradients::values[permutations_[(perm_0_ + iy_0_) & mask_] & gradients::mask];
-			gradient_type gradient_01_ = gradients::values[permutations_[(perm_0_ + iy_1_) & mask_] & gradients::mask];
-			gradient_type gradient_10_ = gradients::values[permutations_[(perm_1_ + iy_0_) & mask_] & gradients::mask];
-			gradient_type gradient_11_ = gradients::values[permutations_[(perm_1_ + iy_1_) & mask_] & gradients::mask];
+			gradient_type gradient_00_ = gradients::values[permutations_[perm_0_ + iy_0_] & gradients::mask];
+			gradient_type gradient_01_ = gradients::values[permutations_[perm_0_ + iy_1_] & gradients::mask];
+			gradient_type gradient_10_ = gradients::values[permutations_[perm_1_ + iy_0_] & gradients::mask];
+			gradient_type gradient_11_ = gradients::values[permutations_[perm_1_ + iy_1_] & gradients::mask];
 
 			value_type val_00_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradient_00_, tx_0_, ty_0_);
 			value_type val_01_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradient_01_, tx_0_, ty_1_);
@@ -151,6 +151,142 @@ namespace EmuMath::Functors
 			return operator()(EmuMath::Vector<2, value_type>(point_), freq_, permutations_);
 		}
 	};
+
+	/// <summary>
+	/// <para> Functor to produce 2-dimensional simplex noise. Produced noise targets the range -1:1. </para>
+	/// <para> Each sample sums the contributions of the 3 corners of its containing triangle, instead of interpolating between the 4 corners of its containing square. </para>
+	/// </summary>
+	template<typename FP_>
+	struct make_noise_2d<EmuMath::NoiseType::SIMPLEX, FP_>
+	{
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_2d; the type must be a floating point.");
+		using value_type = FP_;
+		using gradients = EmuMath::Functors::_underlying_noise_gen::perlin_gradients<2, FP_>;
+		using constants = EmuMath::Functors::_underlying_noise_gen::simplex_constants<2, FP_>;
+
+		EmuCore::do_floor<value_type> floor_;
+		constexpr make_noise_2d() : floor_()
+		{
+		}
+		[[nodiscard]] inline value_type operator()(EmuMath::Vector<2, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			std::size_t mask_ = permutations_.HighestStoredValue();
+			point_ *= freq_;
+
+			// Skew the point to find the origin of its containing square, then unskew that origin to find the point's offset from the first simplex corner
+			value_type skew_ = (point_.template at<0>() + point_.template at<1>()) * constants::skew;
+			value_type cell_x_ = floor_(point_.template at<0>() + skew_);
+			value_type cell_y_ = floor_(point_.template at<1>() + skew_);
+			value_type unskew_ = (cell_x_ + cell_y_) * constants::unskew;
+			value_type x_0_ = point_.template at<0>() - (cell_x_ - unskew_);
+			value_type y_0_ = point_.template at<1>() - (cell_y_ - unskew_);
+
+			// The second corner steps along the axis of the greater offset
+			std::size_t ix_1_ = static_cast<std::size_t>(x_0_ >= y_0_);
+			std::size_t iy_1_ = 1 - ix_1_;
+			value_type x_1_ = x_0_ - static_cast<value_type>(ix_1_) + constants::unskew;
+			value_type y_1_ = y_0_ - static_cast<value_type>(iy_1_) + constants::unskew;
+			value_type x_2_ = x_0_ + ((value_type(2) * constants::unskew) - value_type(1));
+			value_type y_2_ = y_0_ + ((value_type(2) * constants::unskew) - value_type(1));
+
+			std::size_t ix_0_ = static_cast<std::size_t>(cell_x_) & mask_;
+			std::size_t iy_0_ = static_cast<std::size_t>(cell_y_) & mask_;
+			ix_1_ = (ix_0_ + ix_1_) & mask_;
+			iy_1_ = (iy_0_ + iy_1_) & mask_;
+			std::size_t ix_2_ = (ix_0_ + 1) & mask_;
+			std::size_t iy_2_ = (iy_0_ + 1) & mask_;
+
+			// Forced store as size_t so we can handle width changes if EmuMath::NoisePermutationValue is not size_t width
+			std::size_t hash_0_ = static_cast<std::size_t>(permutations_[static_cast<std::size_t>(permutations_[ix_0_]) + iy_0_]);
+			std::size_t hash_1_ = static_cast<std::size_t>(permutations_[static_cast<std::size_t>(permutations_[ix_1_]) + iy_1_]);
+			std::size_t hash_2_ = static_cast<std::size_t>(permutations_[static_cast<std::size_t>(permutations_[ix_2_]) + iy_2_]);
+
+			value_type result_ = _corner_contribution(hash_0_, x_0_, y_0_);
+			result_ += _corner_contribution(hash_1_, x_1_, y_1_);
+			result_ += _corner_contribution(hash_2_, x_2_, y_2_);
+			return result_ * constants::output_scale;
+		}
+		template<std::size_t Size_, typename T_, typename OnlyNonV2f = std::enable_if_t<Size_ != 2 || !std::is_same_v<value_type, T_>>>
+		[[nodiscard]] inline value_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			return operator()(EmuMath::Vector<2, value_type>(point_), freq_, permutations_);
+		}
+
+	private:
+		[[nodiscard]] static inline value_type _corner_contribution(std::size_t hash_, value_type x_, value_type y_)
+		{
+			value_type t_ = constants::falloff - (x_ * x_) - (y_ * y_);
+			if (t_ <= value_type(0))
+			{
+				return value_type(0);
+			}
+			t_ *= t_;
+			return t_ * t_ * EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[hash_ & gradients::mask], x_, y_);
+		}
+	};
+
+	/// <summary>
+	/// <para> Functor to produce 2-dimensional cellular (Worley) noise, using the CellularNoiseOutput and CellularNoiseDistance of the provided cellular NoiseType. </para>
+	/// <para> Every lattice cell contains one feature point, offset from the cell's origin along each axis by `permutations[hash + axis] / permutations.size()`. </para>
+	/// <para> Produced noise is a distance in frequency-scaled lattice units, and is not remapped. Euclidean F1 outputs are typically within the range 0:1. </para>
+	/// </summary>
+	template<EmuMath::NoiseType NoiseType_, typename FP_>
+	requires(EmuMath::is_cellular_noise_type(NoiseType_))
+	struct make_noise_2d<NoiseType_, FP_>
+	{
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_2d; the type must be a floating point.");
+		using value_type = FP_;
+		static constexpr EmuMath::CellularNoiseOutput output = EmuMath::cellular_noise_output(NoiseType_);
+		static constexpr EmuMath::CellularNoiseDistance distance = EmuMath::cellular_noise_distance(NoiseType_);
+
+		EmuCore::do_floor<value_type> floor_;
+		constexpr make_noise_2d() : floor_()
+		{
+		}
+		[[nodiscard]] inline value_type operator()(EmuMath::Vector<2, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			std::size_t mask_ = permutations_.HighestStoredValue();
+			value_type jitter_scale_ = value_type(1) / static_cast<value_type>(mask_ + 1);
+			point_ *= freq_;
+
+			value_type cell_x_ = floor_(point_.template at<0>());
+			value_type cell_y_ = floor_(point_.template at<1>());
+			value_type x_ = point_.template at<0>() - cell_x_;
+			value_type y_ = point_.template at<1>() - cell_y_;
+			std::size_t ix_ = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(cell_x_));
+			std::size_t iy_ = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(cell_y_));
+
+			// Search the 3x3 block of cells around the point; adding mask_ steps back one cell, as permutation counts are powers of 2
+			value_type f1_ = std::numeric_limits<value_type>::max();
+			value_type f2_ = std::numeric_limits<value_type>::max();
+			for (std::size_t cx_ = 0; cx_ < 3; ++cx_)
+			{
+				std::size_t perm_x_ = static_cast<std::size_t>(permutations_[(ix_ + mask_ + cx_) & mask_]);
+				value_type offset_x_ = static_cast<value_type>(cx_) - value_type(1) - x_;
+				for (std::size_t cy_ = 0; cy_ < 3; ++cy_)
+				{
+					std::size_t hash_ = static_cast<std::size_t>(permutations_[perm_x_ + ((iy_ + mask_ + cy_) & mask_)]);
+					value_type offset_y_ = static_cast<value_type>(cy_) - value_type(1) - y_;
+					EmuMath::Functors::_underlying_noise_gen::cellular_reduce
+					(
+						f1_,
+						f2_,
+						EmuMath::Functors::_underlying_noise_gen::cellular_distance<distance>
+						(
+							offset_x_ + (static_cast<value_type>(permutations_[hash_]) * jitter_scale_),
+							offset_y_ + (static_cast<value_type>(permutations_[hash_ + 1]) * jitter_scale_)
+						)
+					);
+				}
+			}
+			return EmuMath::Functors::_underlying_noise_gen::cellular_noise_finish<output, distance>(f1_, f2_);
+		}
+		template<std::size_t Size_, typename T_, typename OnlyNonV2f = std::enable_if_t<Size_ != 2 || !std::is_same_v<value_type, T_>>>
+		[[nodiscard]] inline value_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			return operator()(EmuMath::Vector<2, value_type>(point_), freq_, permutations_);
+		}
+	};
 }
 
 #endif
@@ -3,6 +3,7 @@
 
 #include "_common_noise_gen_functor_includes.h"
 #include "../../../../EmuCore/TMPHelpers/Values.h"
+#include <cstdint>
 
 namespace EmuMath::Functors
 {
@@ -29,18 +30,18 @@ namespace EmuMath::Functors
 		}
 		[[nodiscard]] inline value_type operator()(EmuMath::Vector<3, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
 		{
-			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			std::size_t mask_ = permutations_.HighestStoredValue();
 			point_ *= freq_;
-			EmuMath::NoisePermutationValue ix_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<0>()));
-			EmuMath::NoisePermutationValue iy_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<1>()));
-			EmuMath::NoisePermutationValue iz_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<2>()));
+			std::size_t ix_ = static_cast<std::size_t>(floor_(point_.template at<0>()));
+			std::size_t iy_ = static_cast<std::size_t>(floor_(point_.template at<1>()));
+			std::size_t iz_ = static_cast<std::size_t>(floor_(point_.template at<2>()));
 			ix_ &= mask_;
 			iy_ &= mask_;
 			iz_ &= mask_;
 
-			// Forced store as size_t so we can handle width changes if EmuMath::NoisePermutationValue is of different width
+			// Forced store as size_t so we can handle width changes if std::size_t is of different width
 			std::size_t perm_x_ = static_cast<std::size_t>(permutations_[ix_]);
-			std::size_t perm_xyz_ = (static_cast<std::size_t>(permutations_[(perm_x_ + iy_) & mask_]) + iz_) & mask_;
+			std::size_t perm_xyz_ = static_cast<std::size_t>(permutations_[perm_x_ + iy_]) + iz_;
 			return permutations_[perm_xyz_] * (value_type(1) / mask_);
 		}
 		template<std::size_t Size_, typename T_, typename OnlyNonV3f = std::enable_if_t<Size_ != 3 || !std::is_same_v<value_type, T_>>>
@@ -63,12 +64,12 @@ namespace EmuMath::Functors
 		}
 		[[nodiscard]] inline value_type operator()(EmuMath::Vector<3, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
 		{
-			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			std::size_t mask_ = permutations_.HighestStoredValue();
 			point_ *= freq_;
 
-			EmuMath::NoisePermutationValue ix_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<0>()));
-			EmuMath::NoisePermutationValue iy_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<1>()));
-			EmuMath::NoisePermutationValue iz_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<2>()));
+			std::size_t ix_0_ = static_cast<std::size_t>(floor_(point_.template at<0>()));
+			std::size_t iy_0_ = static_cast<std::size_t>(floor_(point_.template at<1>()));
+			std::size_t iz_0_ = static_cast<std::size_t>(floor_(point_.template at<2>()));
 
 			value_type tx = EmuMath::Functors::_underlying_noise_gen::smooth_t(point_.template at<0>() - static_cast<value_type>(ix_0_));
 			value_type ty = EmuMath::Functors::_underlying_noise_gen::smooth_t(point_.template at<1>() - static_cast<value_type>(iy_0_));
@@ -77,28 +78,28 @@ namespace EmuMath::Functors
 			ix_0_ &= mask_;
 			iy_0_ &= mask_;
 			iz_0_ &= mask_;
-			EmuMath::NoisePermutationValue ix_1_ = (ix_0_ + 1) & mask_;
-			EmuMath::NoisePermutationValue iy_1_ = (iy_0_ + 1) & mask_;
-			EmuMath::NoisePermutationValue iz_1_ = (iz_0_ + 1) & mask_;
+			std::size_t ix_1_ = (ix_0_ + 1) & mask_;
+			std::size_t iy_1_ = (iy_0_ + 1) & mask_;
+			std::size_t iz_1_ = (iz_0_ + 1) & mask_;
 
 
-			// Forced store as size_t so we can handle width changes if EmuMath::NoisePermutationValue is not size_t width
+			// Forced store as size_t so we can handle width changes if std::size_t is not size_t width
 			std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_]);
 			std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_]);
 
-			std::size_t perm_00_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_0_) & mask_]);
-			std::size_t perm_01_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_1_) & mask_]);
-			std::size_t perm_10_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_0_) & mask_]);
-			std::size_t perm_11_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_1_) & mask_]);
+			std::size_t perm_00_ = static_cast<std::size_t>(permutations_[perm_0_ + iy_0_]);
+			std::size_t perm_01_ = static_cast<std::size_t>(permutations_[perm_0_ + iy_1_]);
+			std::size_t perm_10_ = static_cast<std::size_t>(permutations_[perm_1_ + iy_0_]);
+			std::size_t perm_11_ = static_cast<std::size_t>(permutations_[perm_1_ + iy_1_]);
 
-			value_type perm_000_ = static_cast<value_type>(permutations_[(perm_00_ + iz_0_) & mask_]);
-			value_type perm_001_ = static_cast<value_type>(permutations_[(perm_00_ + iz_1_) & mask_]);
-			value_type perm_010_ = static_cast<value_type>(permutations_[(perm_01_ + iz_0_) & mask_]);
-			value_type perm_011_ = static_cast<value_type>(permutations_[(perm_01_ + iz_1_) & mask_]);
-			value_type perm_100_ = static_cast<value_type>(permutations_[(perm_10_ + iz_0_) & mask_]);
-			value_type perm_101_ = static_cast<value_type>(permutations_[(perm_10_ + iz_1_) & mask_]);
-			value_type perm_110_ = static_cast<value_type>(permutations_[(perm_11_ + iz_0_) & mask_]);
-			value_type perm_111_ = static_cast<value_type>(permutations_[(perm_11_ + iz_1_) & mask_]);
+			value_type perm_000_ = static_cast<value_type>(permutations_[perm_00_ + iz_0_]);
+			value_type perm_001_ = static_cast<value_type>(permutations_[perm_00_ + iz_1_]);
+			value_type perm_010_ = static_cast<value_type>(permutations_[perm_01_ + iz_0_]);
+			value_type perm_011_ = static_cast<value_type>(permutations_[perm_01_ + iz_1_]);
+			value_type perm_100_ = static_cast<value_type>(permutations_[perm_10_ + iz_0_]);
+			value_type perm_101_ = static_cast<value_type>(permutations_[perm_10_ + iz_1_]);
+			value_type perm_110_ = static_cast<value_type>(permutations_[perm_11_ + iz_0_]);
+			value_type perm_111_ = static_cast<value_type>(permutations_[perm_11_ + iz_1_]);
 
 			return lerp_
 			(
@@ -132,12 +133,12 @@ namespace EmuMath::Functors
 		}
 		[[nodiscard]] inline value_type operator()(EmuMath::Vector<3, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
 		{
-			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			std::size_t mask_ = permutations_.HighestStoredValue();
 			point_ *= freq_;
 
-			EmuMath::NoisePermutationValue ix_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<0>()));
-			EmuMath::NoisePermutationValue iy_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<1>()));
-			EmuMath::NoisePermutationValue iz_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.template at<2>()));
+			std::size_t ix_0_ = static_cast<std::size_t>(floor_(point_.template at<0>()));
+			std::size_t iy_0_ = static_cast<std::size_t>(floor_(point_.template at<1>()));
+			std::size_t iz_0_ = static_cast<std::size_t>(floor_(point_.template at<2>()));
 
 			value_type tx_0_ = point_.template at<0>() - ix_0_;
 			value_type ty_0_ = point_.template at<1>() - iy_0_;
@@ -149,28 +150,28 @@ namespace EmuMath::Functors
 			ix_0_ &= mask_;
 			iy_0_ &= mask_;
 			iz_0_ &= mask_;
-			EmuMath::NoisePermutationValue ix_1_ = (ix_0_ + 1) & mask_;
-			EmuMath::NoisePermutationValue iy_1_ = (iy_0_ + 1) & mask_;
-			EmuMath::NoisePermutationValue iz_1_ = (iz_0_ + 1) & mask_;
+			std::size_t ix_1_ = (ix_0_ + 1) & mask_;
+			std::size_t iy_1_ = (iy_0_ + 1) & mask_;
+			std::size_t iz_1_ = (iz_0_ + 1) & mask_;
 
 
-			// Forced store as size_t so we can handle width changes if EmuMath::NoisePermutationValue is not size_t width
+			// Forced store as size_t so we can handle width changes if std::size_t is not size_t width
 			std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_]);
 			std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_]);
 
-			std::size_t perm_00_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_0_) & mask_]);
-			std::size_t perm_01_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_1_) & mask_]);
-			std::size_t perm_10_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_0_) & mask_]);
-			std::size_t perm_11_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_1_) & mask_]);
+			std::size_t perm_00_ = static_cast<std::size_t>(permutations_[perm_0_ + iy_0_]);
+			std::size_t perm_01_ = static_cast<std::size_t>(permutations_[perm_0_ + iy_1_]);
+			std::size_t perm_10_ = static_cast<std::size_t>(permutations_[perm_1_ + iy_0_]);
+			std::size_t perm_11_ = static_cast<std::size_t>(permutations_[perm_1_ + iy_1_]);
 
-			std::size_t perm_000_ = static_cast<std::size_t>(permutations_[(perm_00_ + iz_0_) & mask_]);
-			std::size_t perm_001_ = static_cast<std::size_t>(permutations_[(perm_00_ + iz_1_) & mask_]);
-			std::size_t perm_010_ = static_cast<std::size_t>(permutations_[(perm_01_ + iz_0_) & mask_]);
-			std::size_t perm_011_ = static_cast<std::size_t>(permutations_[(perm_01_ + iz_1_) & mask_]);
-			std::size_t perm_100_ = static_cast<std::size_t>(permutations_[(perm_10_ + iz_0_) & mask_]);
-			std::size_t perm_101_ = static_cast<std::size_t>(permutations_[(perm_10_ + iz_1_) & mask_]);
-			std::size_t perm_110_ = static_cast<std::size_t>(permutations_[(perm_11_ + iz_0_) & mask_]);
-			std::size_t perm_111_ = static_cast<std::size_t>(permutations_[(perm_11_ + iz_1_) & mask_]);
+			std::size_t perm_000_ = static_cast<std::size_t>(permutations_[perm_00_ + iz_0_]);
+			std::size_t perm_001_ = static_cast<std::size_t>(permutations_[perm_00_ + iz_1_]);
+			std::size_t perm_010_ = static_cast<std::size_t>(permutations_[perm_01_ + iz_0_]);
+			std::size_t perm_011_ = static_cast<std::size_t>(permutations_[perm_01_ + iz_1_]);
+			std::size_t perm_100_ = static_cast<std::size_t>(permutations_[perm_10_ + iz_0_]);
+			std::size_t perm_101_ = static_cast<std::size_t>(permutations_[perm_10_ + iz_1_]);
+			std::size_t perm_110_ = static_cast<std::size_t>(permutations_[perm_11_ + iz_0_]);
+			std::size_t perm_111_ = static_cast<std::size_t>(permutations_[perm_11_ + iz_1_]);
 
 			value_type val_000_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[perm_000_ & gradients::mask], tx_0_, ty_0_, tz_0_);
 			value_type val_001_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[perm_001_ & gradients::mask], tx_0_, ty_0_, tz_1_);
@@ -198,6 +199,318 @@ namespace EmuMath::Functors
 			return operator()(EmuMath::Vector<3, value_type>(point_), freq_, permutations_);
 		}
 	};
+
+	/// <summary>
+	/// <para> Functor to produce 3-dimensional simplex noise. Produced noise targets the range -1:1. </para>
+	/// <para> Each sample sums the contributions of the 4 corners of its containing tetrahedron, instead of interpolating between the 8 corners of its containing cube. </para>
+	/// </summary>
+	template<typename FP_>
+	struct make_noise_3d<EmuMath::NoiseType::SIMPLEX, FP_>
+	{
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_3d; the type must be a floating point.");
+		using value_type = FP_;
+
+		using gradients = EmuMath::Functors::_underlying_noise_gen::perlin_gradients<3, value_type>;
+		using constants = EmuMath::Functors::_underlying_noise_gen::simplex_constants<3, value_type>;
+
+		EmuCore::do_floor<value_type> floor_;
+		constexpr make_noise_3d() : floor_()
+		{
+		}
+		[[nodiscard]] inline value_type operator()(EmuMath::Vector<3, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			std::size_t mask_ = permutations_.HighestStoredValue();
+			point_ *= freq_;
+
+			// Skew the point to find the origin of its containing cube, then unskew that origin to find the point's offset from the first simplex corner
+			value_type skew_ = (point_.template at<0>() + point_.template at<1>() + point_.template at<2>()) * constants::skew;
+			value_type cell_x_ = floor_(point_.template at<0>() + skew_);
+			value_type cell_y_ = floor_(point_.template at<1>() + skew_);
+			value_type cell_z_ = floor_(point_.template at<2>() + skew_);
+			value_type unskew_ = (cell_x_ + cell_y_ + cell_z_) * constants::unskew;
+			value_type x_0_ = point_.template at<0>() - (cell_x_ - unskew_);
+			value_type y_0_ = point_.template at<1>() - (cell_y_ - unskew_);
+			value_type z_0_ = point_.template at<2>() - (cell_z_ - unskew_);
+
+			// Rank offsets to find the containing tetrahedron
+			// --- The second corner steps along the greatest offset's axis; the third steps along all but the smallest offset's axis
+			const bool x_ge_y_ = x_0_ >= y_0_;
+			const bool y_ge_z_ = y_0_ >= z_0_;
+			const bool x_ge_z_ = x_0_ >= z_0_;
+			std::size_t ix_1_ = static_cast<std::size_t>(x_ge_y_ && x_ge_z_);
+			std::size_t iy_1_ = static_cast<std::size_t>(!x_ge_y_ && y_ge_z_);
+			std::size_t iz_1_ = static_cast<std::size_t>(!(x_ge_z_ || y_ge_z_));
+			std::size_t ix_2_ = static_cast<std::size_t>(x_ge_y_ || x_ge_z_);
+			std::size_t iy_2_ = static_cast<std::size_t>(!x_ge_y_ || y_ge_z_);
+			std::size_t iz_2_ = static_cast<std::size_t>(!(x_ge_z_ && y_ge_z_));
+
+			value_type x_1_ = x_0_ - static_cast<value_type>(ix_1_) + constants::unskew;
+			value_type y_1_ = y_0_ - static_cast<value_type>(iy_1_) + constants::unskew;
+			value_type z_1_ = z_0_ - static_cast<value_type>(iz_1_) + constants::unskew;
+			value_type x_2_ = x_0_ - static_cast<value_type>(ix_2_) + (value_type(2) * constants::unskew);
+			value_type y_2_ = y_0_ - static_cast<value_type>(iy_2_) + (value_type(2) * constants::unskew);
+			value_type z_2_ = z_0_ - static_cast<value_type>(iz_2_) + (value_type(2) * constants::unskew);
+			value_type x_3_ = x_0_ + ((value_type(3) * constants::unskew) - value_type(1));
+			value_type y_3_ = y_0_ + ((value_type(3) * constants::unskew) - value_type(1));
+			value_type z_3_ = z_0_ + ((value_type(3) * constants::unskew) - value_type(1));
+
+			std::size_t ix_0_ = static_cast<std::size_t>(cell_x_) & mask_;
+			std::size_t iy_0_ = static_cast<std::size_t>(cell_y_) & mask_;
+			std::size_t iz_0_ = static_cast<std::size_t>(cell_z_) & mask_;
+			ix_1_ = (ix_0_ + ix_1_) & mask_;
+			iy_1_ = (iy_0_ + iy_1_) & mask_;
+			iz_1_ = (iz_0_ + iz_1_) & mask_;
+			ix_2_ = (ix_0_ + ix_2_) & mask_;
+			iy_2_ = (iy_0_ + iy_2_) & mask_;
+			iz_2_ = (iz_0_ + iz_2_) & mask_;
+			std::size_t ix_3_ = (ix_0_ + 1) & mask_;
+			std::size_t iy_3_ = (iy_0_ + 1) & mask_;
+			std::size_t iz_3_ = (iz_0_ + 1) & mask_;
+
+			value_type result_ = _corner_contribution(_hash(permutations_, ix_0_, iy_0_, iz_0_), x_0_, y_0_, z_0_);
+			result_ += _corner_contribution(_hash(permutations_, ix_1_, iy_1_, iz_1_), x_1_, y_1_, z_1_);
+			result_ += _corner_contribution(_hash(permutations_, ix_2_, iy_2_, iz_2_), x_2_, y_2_, z_2_);
+			result_ += _corner_contribution(_hash(permutations_, ix_3_, iy_3_, iz_3_), x_3_, y_3_, z_3_);
+			return result_ * constants::output_scale;
+		}
+		template<std::size_t Size_, typename T_, typename OnlyNonV3f = std::enable_if_t<Size_ != 3 || !std::is_same_v<value_type, T_>>>
+		[[nodiscard]] inline value_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			return operator()(EmuMath::Vector<3, value_type>(point_), freq_, permutations_);
+		}
+
+	private:
+		[[nodiscard]] static inline std::size_t _hash(const EmuMath::NoisePermutations& permutations_, std::size_t ix_, std::size_t iy_, std::size_t iz_)
+		{
+			// Forced store as size_t so we can handle width changes if EmuMath::NoisePermutationValue is not size_t width
+			std::size_t perm_x_ = static_cast<std::size_t>(permutations_[ix_]);
+			std::size_t perm_xy_ = static_cast<std::size_t>(permutations_[perm_x_ + iy_]);
+			return static_cast<std::size_t>(permutations_[perm_xy_ + iz_]);
+		}
+
+		[[nodiscard]] static inline value_type _corner_contribution(std::size_t hash_, value_type x_, value_type y_, value_type z_)
+		{
+			value_type t_ = constants::falloff - (x_ * x_) - (y_ * y_) - (z_ * z_);
+			if (t_ <= value_type(0))
+			{
+				return value_type(0);
+			}
+			t_ *= t_;
+			return t_ * t_ * EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[hash_ & gradients::mask], x_, y_, z_);
+		}
+	};
+
+	/// <summary>
+	/// <para> Functor to produce 3-dimensional cellular (Worley) noise, using the CellularNoiseOutput and CellularNoiseDistance of the provided cellular NoiseType. </para>
+	/// <para> Every lattice cell contains one feature point, offset from the cell's origin along each axis by `permutations[hash + axis] / permutations.size()`. </para>
+	/// <para> Produced noise is a distance in frequency-scaled lattice units, and is not remapped. Euclidean F1 outputs are typically within the range 0:1. </para>
+	/// </summary>
+	template<EmuMath::NoiseType NoiseType_, typename FP_>
+	requires(EmuMath::is_cellular_noise_type(NoiseType_))
+	struct make_noise_3d<NoiseType_, FP_>
+	{
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_3d; the type must be a floating point.");
+		using value_type = FP_;
+		static constexpr EmuMath::CellularNoiseOutput output = EmuMath::cellular_noise_output(NoiseType_);
+		static constexpr EmuMath::CellularNoiseDistance distance = EmuMath::cellular_noise_distance(NoiseType_);
+
+		EmuCore::do_floor<value_type> floor_;
+		constexpr make_noise_3d() : floor_()
+		{
+		}
+		[[nodiscard]] inline value_type operator()(EmuMath::Vector<3, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			std::size_t mask_ = permutations_.HighestStoredValue();
+			value_type jitter_scale_ = value_type(1) / static_cast<value_type>(mask_ + 1);
+			point_ *= freq_;
+
+			value_type cell_x_ = floor_(point_.template at<0>());
+			value_type cell_y_ = floor_(point_.template at<1>());
+			value_type cell_z_ = floor_(point_.template at<2>());
+			value_type x_ = point_.template at<0>() - cell_x_;
+			value_type y_ = point_.template at<1>() - cell_y_;
+			value_type z_ = point_.template at<2>() - cell_z_;
+			std::size_t ix_ = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(cell_x_));
+			std::size_t iy_ = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(cell_y_));
+			std::size_t iz_ = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(cell_z_));
+
+			// Search the 3x3x3 block of cells around the point; adding mask_ steps back one cell, as permutation counts are powers of 2
+			value_type f1_ = std::numeric_limits<value_type>::max();
+			value_type f2_ = std::numeric_limits<value_type>::max();
+			for (std::size_t cx_ = 0; cx_ < 3; ++cx_)
+			{
+				std::size_t perm_x_ = static_cast<std::size_t>(permutations_[(ix_ + mask_ + cx_) & mask_]);
+				value_type offset_x_ = static_cast<value_type>(cx_) - value_type(1) - x_;
+				for (std::size_t cy_ = 0; cy_ < 3; ++cy_)
+				{
+					std::size_t perm_xy_ = static_cast<std::size_t>(permutations_[perm_x_ + ((iy_ + mask_ + cy_) & mask_)]);
+					value_type offset_y_ = static_cast<value_type>(cy_) - value_type(1) - y_;
+					for (std::size_t cz_ = 0; cz_ < 3; ++cz_)
+					{
+						std::size_t hash_ = static_cast<std::size_t>(permutations_[perm_xy_ + ((iz_ + mask_ + cz_) & mask_)]);
+						value_type offset_z_ = static_cast<value_type>(cz_) - value_type(1) - z_;
+						EmuMath::Functors::_underlying_noise_gen::cellular_reduce
+						(
+							f1_,
+							f2_,
+							EmuMath::Functors::_underlying_noise_gen::cellular_distance<distance>
+							(
+								offset_x_ + (static_cast<value_type>(permutations_[hash_]) * jitter_scale_),
+								offset_y_ + (static_cast<value_type>(permutations_[hash_ + 1]) * jitter_scale_),
+								offset_z_ + (static_cast<value_type>(permutations_[hash_ + 2]) * jitter_scale_)
+							)
+						);
+					}
+				}
+			}
+			return EmuMath::Functors::_underlying_noise_gen::cellular_noise_finish<output, distance>(f1_, f2_);
+		}
+		template<std::size_t Size_, typename T_, typename OnlyNonV3f = std::enable_if_t<Size_ != 3 || !std::is_same_v<value_type, T_>>>
+		[[nodiscard]] inline value_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			return operator()(EmuMath::Vector<3, value_type>(point_), freq_, permutations_);
+		}
+	};
+
+	template<EmuMath::NoiseType NoiseType_, typename FP_ = float>
+	struct make_noise_3d_derivatives
+	{
+		static_assert(EmuMath::Validity::assert_valid_noise_type<NoiseType_>(), "Invalid NoiseType_ argument provided to EmuMath::Functors::make_noise_3d_derivatives.");
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_3d_derivatives; the type must be a floating point.");
+		constexpr make_noise_3d_derivatives()
+		{
+			static_assert(EmuCore::TMP::get_false<FP_>(), "Attempted to construct a make_noise_3d_derivatives instance for a NoiseType that does not support analytical derivatives.");
+		}
+	};
+
+	/// <summary>
+	/// <para> Functor to produce 3-dimensional smooth perlin noise alongside its analytical derivatives, from a single evaluation. </para>
+	/// <para>
+	///		Outputs are in the form { value, d/dx, d/dy, d/dz }, where value matches that produced by the SIMD PERLIN generators at any point,
+	///		and that produced by make_noise_3d for PERLIN noise at non-negative points.
+	/// </para>
+	/// <para> Derivatives are with respect to the input point before it is scaled by freq_, and as such are scaled by freq_ themselves. </para>
+	/// </summary>
+	template<typename FP_>
+	struct make_noise_3d_derivatives<EmuMath::NoiseType::PERLIN, FP_>
+	{
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_3d_derivatives; the type must be a floating point.");
+		using value_type = FP_;
+		using output_type = EmuMath::Vector<4, value_type>;
+
+		using gradients = EmuMath::Functors::_underlying_noise_gen::perlin_gradients<3, value_type>;
+
+		EmuCore::do_lerp<value_type, value_type, value_type> lerp_;
+		EmuCore::do_floor<value_type> floor_;
+		constexpr make_noise_3d_derivatives() : lerp_(), floor_()
+		{
+		}
+		[[nodiscard]] inline output_type operator()(EmuMath::Vector<3, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			std::size_t mask_ = permutations_.HighestStoredValue();
+			point_ *= freq_;
+
+			const value_type floor_x_ = floor_(point_.template at<0>());
+			const value_type floor_y_ = floor_(point_.template at<1>());
+			const value_type floor_z_ = floor_(point_.template at<2>());
+
+			value_type tx_0_ = point_.template at<0>() - floor_x_;
+			value_type ty_0_ = point_.template at<1>() - floor_y_;
+			value_type tz_0_ = point_.template at<2>() - floor_z_;
+			value_type tx_1_ = tx_0_ - value_type(1);
+			value_type ty_1_ = ty_0_ - value_type(1);
+			value_type tz_1_ = tz_0_ - value_type(1);
+
+			// Cast via a signed integer so that negative cells wrap in the same way as the SIMD generators' integral masking
+			std::size_t ix_0_ = static_cast<std::size_t>(static_cast<std::int64_t>(floor_x_)) & mask_;
+			std::size_t iy_0_ = static_cast<std::size_t>(static_cast<std::int64_t>(floor_y_)) & mask_;
+			std::size_t iz_0_ = static_cast<std::size_t>(static_cast<std::int64_t>(floor_z_)) & mask_;
+			std::size_t ix_1_ = (ix_0_ + 1) & mask_;
+			std::size_t iy_1_ = (iy_0_ + 1) & mask_;
+			std::size_t iz_1_ = (iz_0_ + 1) & mask_;
+
+			// Forced store as size_t so we can handle width changes if std::size_t is not size_t width
+			std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_]);
+			std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_]);
+
+			std::size_t perm_00_ = static_cast<std::size_t>(permutations_[perm_0_ + iy_0_]);
+			std::size_t perm_01_ = static_cast<std::size_t>(permutations_[perm_0_ + iy_1_]);
+			std::size_t perm_10_ = static_cast<std::size_t>(permutations_[perm_1_ + iy_0_]);
+			std::size_t perm_11_ = static_cast<std::size_t>(permutations_[perm_1_ + iy_1_]);
+
+			const typename gradients::gradient_type& grad_000_ = gradients::values[static_cast<std::size_t>(permutations_[perm_00_ + iz_0_]) & gradients::mask];
+			const typename gradients::gradient_type& grad_001_ = gradients::values[static_cast<std::size_t>(permutations_[perm_00_ + iz_1_]) & gradients::mask];
+			const typename gradients::gradient_type& grad_010_ = gradients::values[static_cast<std::size_t>(permutations_[perm_01_ + iz_0_]) & gradients::mask];
+			const typename gradients::gradient_type& grad_011_ = gradients::values[static_cast<std::size_t>(permutations_[perm_01_ + iz_1_]) & gradients::mask];
+			const typename gradients::gradient_type& grad_100_ = gradients::values[static_cast<std::size_t>(permutations_[perm_10_ + iz_0_]) & gradients::mask];
+			const typename gradients::gradient_type& grad_101_ = gradients::values[static_cast<std::size_t>(permutations_[perm_10_ + iz_1_]) & gradients::mask];
+			const typename gradients::gradient_type& grad_110_ = gradients::values[static_cast<std::size_t>(permutations_[perm_11_ + iz_0_]) & gradients::mask];
+			const typename gradients::gradient_type& grad_111_ = gradients::values[static_cast<std::size_t>(permutations_[perm_11_ + iz_1_]) & gradients::mask];
+
+			value_type val_000_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(grad_000_, tx_0_, ty_0_, tz_0_);
+			value_type val_001_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(grad_001_, tx_0_, ty_0_, tz_1_);
+			value_type val_010_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(grad_010_, tx_0_, ty_1_, tz_0_);
+			value_type val_011_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(grad_011_, tx_0_, ty_1_, tz_1_);
+			value_type val_100_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(grad_100_, tx_1_, ty_0_, tz_0_);
+			value_type val_101_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(grad_101_, tx_1_, ty_0_, tz_1_);
+			value_type val_110_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(grad_110_, tx_1_, ty_1_, tz_0_);
+			value_type val_111_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(grad_111_, tx_1_, ty_1_, tz_1_);
+
+			value_type tx = EmuMath::Functors::_underlying_noise_gen::smooth_t(tx_0_);
+			value_type ty = EmuMath::Functors::_underlying_noise_gen::smooth_t(ty_0_);
+			value_type tz = EmuMath::Functors::_underlying_noise_gen::smooth_t(tz_0_);
+			value_type dtx = EmuMath::Functors::_underlying_noise_gen::smooth_t_derivative(tx_0_);
+			value_type dty = EmuMath::Functors::_underlying_noise_gen::smooth_t_derivative(ty_0_);
+			value_type dtz = EmuMath::Functors::_underlying_noise_gen::smooth_t_derivative(tz_0_);
+
+			value_type value_ = lerp_
+			(
+				lerp_(lerp_(val_000_, val_100_, tx), lerp_(val_010_, val_110_, tx), ty),
+				lerp_(lerp_(val_001_, val_101_, tx), lerp_(val_011_, val_111_, tx), ty),
+				tz
+			);
+
+			// Each derivative is the interpolated gradient along its axis, plus the change in interpolated values along that axis scaled by the derivative of its weighting
+			value_type dx_ = _interpolate_axis<0>(grad_000_, grad_001_, grad_010_, grad_011_, grad_100_, grad_101_, grad_110_, grad_111_, tx, ty, tz);
+			value_type dy_ = _interpolate_axis<1>(grad_000_, grad_001_, grad_010_, grad_011_, grad_100_, grad_101_, grad_110_, grad_111_, tx, ty, tz);
+			value_type dz_ = _interpolate_axis<2>(grad_000_, grad_001_, grad_010_, grad_011_, grad_100_, grad_101_, grad_110_, grad_111_, tx, ty, tz);
+			dx_ += dtx * lerp_(lerp_(val_100_ - val_000_, val_110_ - val_010_, ty), lerp_(val_101_ - val_001_, val_111_ - val_011_, ty), tz);
+			dy_ += dty * lerp_(lerp_(val_010_ - val_000_, val_110_ - val_100_, tx), lerp_(val_011_ - val_001_, val_111_ - val_101_, tx), tz);
+			dz_ += dtz * lerp_(lerp_(val_001_ - val_000_, val_101_ - val_100_, tx), lerp_(val_011_ - val_010_, val_111_ - val_110_, tx), ty);
+
+			return output_type(value_, dx_ * freq_, dy_ * freq_, dz_ * freq_);
+		}
+		template<std::size_t Size_, typename T_, typename OnlyNonV3f = std::enable_if_t<Size_ != 3 || !std::is_same_v<value_type, T_>>>
+		[[nodiscard]] inline output_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			return operator()(EmuMath::Vector<3, value_type>(point_), freq_, permutations_);
+		}
+
+	private:
+		template<std::size_t Axis_>
+		[[nodiscard]] inline value_type _interpolate_axis
+		(
+			const typename gradients::gradient_type& grad_000_,
+			const typename gradients::gradient_type& grad_001_,
+			const typename gradients::gradient_type& grad_010_,
+			const typename gradients::gradient_type& grad_011_,
+			const typename gradients::gradient_type& grad_100_,
+			const typename gradients::gradient_type& grad_101_,
+			const typename gradients::gradient_type& grad_110_,
+			const typename gradients::gradient_type& grad_111_,
+			value_type tx,
+			value_type ty,
+			value_type tz
+		) const
+		{
+			return lerp_
+			(
+				lerp_(lerp_(grad_000_.template at<Axis_>(), grad_100_.template at<Axis_>(), tx), lerp_(grad_010_.template at<Axis_>(), grad_110_.template at<Axis_>(), tx), ty),
+				lerp_(lerp_(grad_001_.template at<Axis_>(), grad_101_.template at<Axis_>(), tx), lerp_(grad_011_.template at<Axis_>(), grad_111_.template at<Axis_>(), tx), ty),
+				tz
+			);
+		}
+	};
 }
 
 #endif
@@ -0,0 +1,302 @@
+#ifndef EMU_MATH_NOISE_GEN_FUNCTOR_4D_H_INC_
+#define EMU_MATH_NOISE_GEN_FUNCTOR_4D_H_INC_ 1
+
+#include "_common_noise_gen_functor_includes.h"
+#include "../../../../EmuCore/TMPHelpers/Values.h"
+#include <cstdint>
+#include <utility>
+
+namespace EmuMath::Functors::_underlying_noise_gen
+{
+	/// <summary>
+	/// <para> Lattice cells of the W-axis of 4D noise, which may optionally loop after a given period so that W can be used as looping time. </para>
+	/// <para>
+	///		When looping, the period is rounded to a whole number of lattice cells at each frequency (at least 1), and W is scaled to fit that number of cells
+	///		within the period. This makes every octave loop seamlessly regardless of its frequency, at the cost of W frequencies differing slightly from freq.
+	/// </para>
+	/// </summary>
+	template<typename T_>
+	struct noise_4d_w_axis
+	{
+		/// <summary> W-coordinate of the sample within the lattice, before being floored. </summary>
+		T_ lattice_w;
+		/// <summary> Floored lattice_w, wrapped into the range 0:period when looping. </summary>
+		T_ cell_0;
+		/// <summary> Cell after cell_0, wrapped into the range 0:period when looping. </summary>
+		T_ cell_1;
+
+		/// <summary> Calculates the W-axis cells of a sample. </summary>
+		/// <param name="w_">W-coordinate to sample, before being scaled by frequency.</param>
+		/// <param name="freq_">Frequency that the sample is being generated at.</param>
+		/// <param name="period_">Period of W after which noise loops. If this is less than or equal to 0, noise does not loop.</param>
+		constexpr noise_4d_w_axis(T_ w_, T_ freq_, T_ period_) : lattice_w(), cell_0(), cell_1()
+		{
+			EmuCore::do_floor<T_> floor_;
+			if (period_ > T_(0))
+			{
+				T_ lattice_period_ = floor_(period_ * freq_ + T_(0.5));
+				lattice_period_ = lattice_period_ < T_(1) ? T_(1) : lattice_period_;
+				lattice_w = w_ * (lattice_period_ / period_);
+
+				T_ floor_w_ = floor_(lattice_w);
+				cell_0 = floor_w_ - (floor_(floor_w_ / lattice_period_) * lattice_period_);
+				cell_0 = cell_0 < T_(0) ? cell_0 + lattice_period_ : (cell_0 >= lattice_period_ ? cell_0 - lattice_period_ : cell_0);
+				cell_1 = cell_0 + T_(1);
+				cell_1 = cell_1 >= lattice_period_ ? cell_1 - lattice_period_ : cell_1;
+
+				// Offset lattice_w so that subtracting cell_0 produces the sample's offset from its cell
+				lattice_w = cell_0 + (lattice_w - floor_w_);
+			}
+			else
+			{
+				lattice_w = w_ * freq_;
+				cell_0 = floor_(lattice_w);
+				cell_1 = cell_0 + T_(1);
+			}
+		}
+	};
+
+	/// <summary> Converts a floored lattice coordinate into an index of NoisePermutations, wrapping negative cells in the same way as SIMD conversions. </summary>
+	template<typename T_>
+	[[nodiscard]] constexpr inline std::size_t noise_4d_cell_index(T_ cell_, std::size_t mask_)
+	{
+		return static_cast<std::size_t>(static_cast<std::int64_t>(cell_)) & mask_;
+	}
+
+	/// <summary> Interpolates the 16 corners of a 4D lattice cell, indexed as XYZW bits where X is the most significant, along W, then Z, then Y, then X. </summary>
+	template<typename T_, class Lerp_>
+	[[nodiscard]] constexpr inline T_ noise_4d_interpolate_corners(const Lerp_& lerp_, const T_(&corners_)[16], T_ tx_, T_ ty_, T_ tz_, T_ tw_)
+	{
+		T_ along_w_[8];
+		for (std::size_t i = 0; i < 8; ++i)
+		{
+			along_w_[i] = lerp_(corners_[i * 2], corners_[i * 2 + 1], tw_);
+		}
+		T_ along_z_[4];
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			along_z_[i] = lerp_(along_w_[i * 2], along_w_[i * 2 + 1], tz_);
+		}
+		return lerp_(lerp_(along_z_[0], along_z_[1], ty_), lerp_(along_z_[2], along_z_[3], ty_), tx_);
+	}
+}
+
+namespace EmuMath::Functors
+{
+	/// <summary>
+	/// <para> Functor to produce 4-dimensional noise, most commonly used to animate 3D noise by treating W as time. </para>
+	/// <para> A W-period may be provided on construction, in which case noise loops seamlessly every time W advances by that period. </para>
+	/// </summary>
+	template<EmuMath::NoiseType NoiseType_, typename FP_ = float>
+	struct make_noise_4d
+	{
+		static_assert(EmuMath::Validity::assert_valid_noise_type<NoiseType_>(), "Invalid NoiseType_ argument provided to EmuMath::Functors::make_noise_4d.");
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_4d; the type must be a floating point.");
+		constexpr make_noise_4d()
+		{
+			static_assert(EmuCore::TMP::get_false<FP_>(), "Attempted to construct a make_noise_4d instance for a NoiseType that has not been implemented.");
+		}
+	};
+
+	template<typename FP_>
+	struct make_noise_4d<EmuMath::NoiseType::VALUE, FP_>
+	{
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_4d; the type must be a floating point.");
+		using value_type = FP_;
+
+		EmuCore::do_floor<value_type> floor_;
+		value_type w_period;
+		constexpr make_noise_4d(value_type w_period_ = value_type(0)) : floor_(), w_period(w_period_)
+		{
+		}
+		[[nodiscard]] inline value_type operator()(EmuMath::Vector<4, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			std::size_t mask_ = permutations_.HighestStoredValue();
+			_underlying_noise_gen::noise_4d_w_axis<value_type> w_axis_(point_.template at<3>(), freq_, w_period);
+			std::size_t ix_ = _underlying_noise_gen::noise_4d_cell_index(floor_(point_.template at<0>() * freq_), mask_);
+			std::size_t iy_ = _underlying_noise_gen::noise_4d_cell_index(floor_(point_.template at<1>() * freq_), mask_);
+			std::size_t iz_ = _underlying_noise_gen::noise_4d_cell_index(floor_(point_.template at<2>() * freq_), mask_);
+			std::size_t iw_ = _underlying_noise_gen::noise_4d_cell_index(w_axis_.cell_0, mask_);
+
+			// Forced store as size_t so we can handle width changes if std::size_t is of different width
+			std::size_t perm_x_ = static_cast<std::size_t>(permutations_[ix_]);
+			std::size_t perm_xy_ = static_cast<std::size_t>(permutations_[perm_x_ + iy_]);
+			std::size_t perm_xyzw_ = static_cast<std::size_t>(permutations_[perm_xy_ + iz_]) + iw_;
+			return permutations_[perm_xyzw_] * (value_type(1) / mask_);
+		}
+		template<std::size_t Size_, typename T_, typename OnlyNonV4f = std::enable_if_t<Size_ != 4 || !std::is_same_v<value_type, T_>>>
+		[[nodiscard]] inline value_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			return operator()(EmuMath::Vector<4, value_type>(point_), freq_, permutations_);
+		}
+	};
+
+	template<typename FP_>
+	struct make_noise_4d<EmuMath::NoiseType::VALUE_SMOOTH, FP_>
+	{
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_4d; the type must be a floating point.");
+		using value_type = FP_;
+
+		EmuCore::do_lerp<value_type, value_type, value_type> lerp_;
+		EmuCore::do_floor<value_type> floor_;
+		value_type w_period;
+		constexpr make_noise_4d(value_type w_period_ = value_type(0)) : lerp_(), floor_(), w_period(w_period_)
+		{
+		}
+		[[nodiscard]] inline value_type operator()(EmuMath::Vector<4, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			std::size_t mask_ = permutations_.HighestStoredValue();
+			_underlying_noise_gen::noise_4d_w_axis<value_type> w_axis_(point_.template at<3>(), freq_, w_period);
+			value_type x_ = point_.template at<0>() * freq_;
+			value_type y_ = point_.template at<1>() * freq_;
+			value_type z_ = point_.template at<2>() * freq_;
+			value_type floor_x_ = floor_(x_);
+			value_type floor_y_ = floor_(y_);
+			value_type floor_z_ = floor_(z_);
+
+			value_type t_[4] =
+			{
+				EmuMath::Functors::_underlying_noise_gen::smooth_t(x_ - floor_x_),
+				EmuMath::Functors::_underlying_noise_gen::smooth_t(y_ - floor_y_),
+				EmuMath::Functors::_underlying_noise_gen::smooth_t(z_ - floor_z_),
+				EmuMath::Functors::_underlying_noise_gen::smooth_t(w_axis_.lattice_w - w_axis_.cell_0)
+			};
+
+			std::size_t ix_0_ = _underlying_noise_gen::noise_4d_cell_index(floor_x_, mask_);
+			std::size_t iy_0_ = _underlying_noise_gen::noise_4d_cell_index(floor_y_, mask_);
+			std::size_t iz_0_ = _underlying_noise_gen::noise_4d_cell_index(floor_z_, mask_);
+			std::size_t indices_[4][2] =
+			{
+				{ ix_0_, (ix_0_ + 1) & mask_ },
+				{ iy_0_, (iy_0_ + 1) & mask_ },
+				{ iz_0_, (iz_0_ + 1) & mask_ },
+				{ _underlying_noise_gen::noise_4d_cell_index(w_axis_.cell_0, mask_), _underlying_noise_gen::noise_4d_cell_index(w_axis_.cell_1, mask_) }
+			};
+
+			// Corners are indexed as XYZW bits, where X is the most significant (e.g. [12] is 1100)
+			value_type corners_[16];
+			for (std::size_t corner_ = 0; corner_ < 16; ++corner_)
+			{
+				std::size_t perm_ = static_cast<std::size_t>(permutations_[indices_[0][(corner_ >> 3) & 1]]);
+				perm_ = static_cast<std::size_t>(permutations_[perm_ + indices_[1][(corner_ >> 2) & 1]]);
+				perm_ = static_cast<std::size_t>(permutations_[perm_ + indices_[2][(corner_ >> 1) & 1]]);
+				corners_[corner_] = static_cast<value_type>(permutations_[perm_ + indices_[3][corner_ & 1]]);
+			}
+			return _underlying_noise_gen::noise_4d_interpolate_corners(lerp_, corners_, t_[0], t_[1], t_[2], t_[3]) * (value_type(1) / mask_);
+		}
+		template<std::size_t Size_, typename T_, typename OnlyNonV4f = std::enable_if_t<Size_ != 4 || !std::is_same_v<value_type, T_>>>
+		[[nodiscard]] inline value_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			return operator()(EmuMath::Vector<4, value_type>(point_), freq_, permutations_);
+		}
+	};
+
+	/// <summary> Functor to produce 4-dimensional smooth perlin noise. Produced noise targets the range -1:1. </summary>
+	template<typename FP_>
+	struct make_noise_4d<EmuMath::NoiseType::PERLIN, FP_>
+	{
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_4d; the type must be a floating point.");
+		using value_type = FP_;
+
+		using gradients = EmuMath::Functors::_underlying_noise_gen::perlin_gradients<4, value_type>;
+
+		EmuCore::do_lerp<value_type, value_type, value_type> lerp_;
+		EmuCore::do_floor<value_type> floor_;
+		value_type w_period;
+		constexpr make_noise_4d(value_type w_period_ = value_type(0)) : lerp_(), floor_(), w_period(w_period_)
+		{
+		}
+		[[nodiscard]] inline value_type operator()(EmuMath::Vector<4, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			std::size_t mask_ = permutations_.HighestStoredValue();
+			_underlying_noise_gen::noise_4d_w_axis<value_type> w_axis_(point_.template at<3>(), freq_, w_period);
+			value_type x_ = point_.template at<0>() * freq_;
+			value_type y_ = point_.template at<1>() * freq_;
+			value_type z_ = point_.template at<2>() * freq_;
+			value_type floor_x_ = floor_(x_);
+			value_type floor_y_ = floor_(y_);
+			value_type floor_z_ = floor_(z_);
+
+			// Offsets from the lower ([n][0]) and upper ([n][1]) cell on each axis
+			value_type offsets_[4][2];
+			offsets_[0][0] = x_ - floor_x_;
+			offsets_[1][0] = y_ - floor_y_;
+			offsets_[2][0] = z_ - floor_z_;
+			offsets_[3][0] = w_axis_.lattice_w - w_axis_.cell_0;
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				offsets_[i][1] = offsets_[i][0] - value_type(1);
+			}
+
+			std::size_t ix_0_ = _underlying_noise_gen::noise_4d_cell_index(floor_x_, mask_);
+			std::size_t iy_0_ = _underlying_noise_gen::noise_4d_cell_index(floor_y_, mask_);
+			std::size_t iz_0_ = _underlying_noise_gen::noise_4d_cell_index(floor_z_, mask_);
+			std::size_t indices_[4][2] =
+			{
+				{ ix_0_, (ix_0_ + 1) & mask_ },
+				{ iy_0_, (iy_0_ + 1) & mask_ },
+				{ iz_0_, (iz_0_ + 1) & mask_ },
+				{ _underlying_noise_gen::noise_4d_cell_index(w_axis_.cell_0, mask_), _underlying_noise_gen::noise_4d_cell_index(w_axis_.cell_1, mask_) }
+			};
+
+			// Corners are indexed as XYZW bits, where X is the most significant (e.g. [12] is 1100)
+			value_type corners_[16];
+			for (std::size_t corner_ = 0; corner_ < 16; ++corner_)
+			{
+				const std::size_t bx_ = (corner_ >> 3) & 1;
+				const std::size_t by_ = (corner_ >> 2) & 1;
+				const std::size_t bz_ = (corner_ >> 1) & 1;
+				const std::size_t bw_ = corner_ & 1;
+				std::size_t perm_ = static_cast<std::size_t>(permutations_[indices_[0][bx_]]);
+				perm_ = static_cast<std::size_t>(permutations_[perm_ + indices_[1][by_]]);
+				perm_ = static_cast<std::size_t>(permutations_[perm_ + indices_[2][bz_]]);
+				perm_ = static_cast<std::size_t>(permutations_[perm_ + indices_[3][bw_]]);
+				corners_[corner_] = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar
+				(
+					gradients::values[perm_ & gradients::mask],
+					offsets_[0][bx_],
+					offsets_[1][by_],
+					offsets_[2][bz_],
+					offsets_[3][bw_]
+				);
+			}
+
+			value_type tx = EmuMath::Functors::_underlying_noise_gen::smooth_t(offsets_[0][0]);
+			value_type ty = EmuMath::Functors::_underlying_noise_gen::smooth_t(offsets_[1][0]);
+			value_type tz = EmuMath::Functors::_underlying_noise_gen::smooth_t(offsets_[2][0]);
+			value_type tw = EmuMath::Functors::_underlying_noise_gen::smooth_t(offsets_[3][0]);
+
+			return _underlying_noise_gen::noise_4d_interpolate_corners(lerp_, corners_, tx, ty, tz, tw);
+		}
+		template<std::size_t Size_, typename T_, typename OnlyNonV4f = std::enable_if_t<Size_ != 4 || !std::is_same_v<value_type, T_>>>
+		[[nodiscard]] inline value_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			return operator()(EmuMath::Vector<4, value_type>(point_), freq_, permutations_);
+		}
+	};
+
+	/// <summary>
+	/// <para> Generator which samples a 3D slice of 4D noise at a fixed W, allowing 4D generators to be used wherever 3D points are sampled, such as in 3D NoiseTables. </para>
+	/// <para> The wrapped generator must be invocable with a 4D point, such as fractal_noise_wrapper or no_fractal_noise_wrapper of a make_noise_4d generator. </para>
+	/// </summary>
+	template<class Generator_, typename FP_>
+	struct noise_time_slice_wrapper
+	{
+		using generator_type = Generator_;
+		using value_type = FP_;
+
+		constexpr noise_time_slice_wrapper(generator_type generator_, value_type time_) : generator(std::move(generator_)), time(time_)
+		{
+		}
+
+		[[nodiscard]] constexpr inline auto operator()(const EmuMath::Vector<3, value_type>& point_)
+		{
+			return generator(EmuMath::Vector<4, value_type>(point_.template at<0>(), point_.template at<1>(), point_.template at<2>(), time));
+		}
+
+		generator_type generator;
+		value_type time;
+	};
+}
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef EMU_MATH_FAST_DOMAIN_WARP_WRAPPER_H_INC_
+#define EMU_MATH_FAST_DOMAIN_WARP_WRAPPER_H_INC_ 1
+
+#include "../../../../EmuSIMD/SIMDHelpers.h"
+#include "../../../../EmuCore/TMPHelpers/TypeComparators.h"
+#include "../../../../EmuCore/TMPHelpers/Values.h"
+#include <type_traits>
+#include <utility>
+
+namespace EmuMath::Functors
+{
+	/// <summary>
+	/// <para> Generator which warps the points of every batch by offsets produced by a secondary warp generator, before passing them to its main generator. </para>
+	/// <para> Both generators must be invocable with only coordinate registers, such as fractal_noise_wrapper and no_fractal_noise_wrapper. </para>
+	/// <para>
+	///		Each axis is offset by warp noise multiplied by amplitude. Every axis samples the same warp generator, with the points for Y and Z shifted by
+	///		warp_axis_shifts so that axes are not warped identically. No intermediate samples are stored; warping and generation happen in the same pass.
+	/// </para>
+	/// </summary>
+	template<class Generator_, class WarpGenerator_, EmuConcepts::KnownSIMD SIMDRegister_>
+	requires(EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>)
+	struct fast_domain_warp_wrapper
+	{
+	public:
+		using generator_type = Generator_;
+		using warp_generator_type = WarpGenerator_;
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		/// <summary> Float if __m128, __m256, or __m512 is the register type. Otherwise double, due to implied __m128d, __m256d, or __m512d. </summary>
+		using value_type = std::conditional_t
+		<
+			EmuCore::TMP::is_any_comparison_true<std::is_same, register_type, EmuSIMD::f32x4, EmuSIMD::f32x8, EmuSIMD::f32x16>::value,
+			float,
+			double
+		>;
+
+		/// <summary> Amount that the points used to sample warp noise are shifted by on every axis when calculating the X, Y, and Z offsets respectively. </summary>
+		static constexpr value_type warp_axis_shifts[3] = { value_type(0), value_type(19.1), value_type(47.3) };
+
+		inline fast_domain_warp_wrapper(generator_type generator_, warp_generator_type warp_generator_, value_type amplitude_) :
+			generator(std::move(generator_)),
+			warp_generator(std::move(warp_generator_)),
+			amplitude(EmuSIMD::set1<register_type>(amplitude_)),
+			shift_y(EmuSIMD::set1<register_type>(warp_axis_shifts[1])),
+			shift_z(EmuSIMD::set1<register_type>(warp_axis_shifts[2]))
+		{
+		}
+
+		[[nodiscard]] inline register_type operator()(register_type points_x_, register_type points_y_, register_type points_z_)
+		{
+			register_type warped_x_ = EmuSIMD::fmadd(warp_generator(points_x_, points_y_, points_z_), amplitude, points_x_);
+			register_type warped_y_ = EmuSIMD::fmadd
+			(
+				warp_generator(EmuSIMD::add(points_x_, shift_y), EmuSIMD::add(points_y_, shift_y), EmuSIMD::add(points_z_, shift_y)),
+				amplitude,
+				points_y_
+			);
+			register_type warped_z_ = EmuSIMD::fmadd
+			(
+				warp_generator(EmuSIMD::add(points_x_, shift_z), EmuSIMD::add(points_y_, shift_z), EmuSIMD::add(points_z_, shift_z)),
+				amplitude,
+				points_z_
+			);
+			return generator(warped_x_, warped_y_, warped_z_);
+		}
+		[[nodiscard]] inline register_type operator()(register_type points_x_, register_type points_y_)
+		{
+			register_type warped_x_ = EmuSIMD::fmadd(warp_generator(points_x_, points_y_), amplitude, points_x_);
+			register_type warped_y_ = EmuSIMD::fmadd(warp_generator(EmuSIMD::add(points_x_, shift_y), EmuSIMD::add(points_y_, shift_y)), amplitude, points_y_);
+			return generator(warped_x_, warped_y_);
+		}
+		[[nodiscard]] inline register_type operator()(register_type points_x_)
+		{
+			return generator(EmuSIMD::fmadd(warp_generator(points_x_), amplitude, points_x_));
+		}
+
+		generator_type generator;
+		warp_generator_type warp_generator;
+		register_type amplitude;
+		register_type shift_y;
+		register_type shift_z;
+	};
+}
+
+#endif
@@ -3,9 +3,72 @@
 
 #include "_fractal_noise_wrapper.h"
 #include "../../../../EmuSIMD/SIMDHelpers.h"
+#include <array>
+#include <utility>
+#include <vector>
 
 namespace EmuMath::Functors
 {
+	/// <summary>
+	/// <para> Table of the per-octave frequencies and amplitudes used by fast fractal noise, alongside the total range that accumulated octaves are divided by. </para>
+	/// <para> 
+	///		Values are calculated via the same operations, in the same order, as accumulating them for every batch, so results are identical. 
+	///		A single table may be shared by any number of fractal noise wrappers using the same frequency and fractal info.
+	/// </para>
+	/// </summary>
+	template<class Register_>
+	struct fast_fractal_octave_table
+	{
+	public:
+		using register_type = EmuCore::TMP::remove_ref_cv_t<Register_>;
+		/// <summary> Float if __m128, __m256, or __m512 is the register type. Otherwise double, due to implied __m128d, __m256d, or __m512d. </summary>
+		using value_type = std::conditional_t
+		<
+			EmuCore::TMP::is_any_comparison_true<std::is_same, register_type, EmuSIMD::f32x4, EmuSIMD::f32x8, EmuSIMD::f32x16>::value,
+			float,
+			double
+		>;
+		using fractal_info_type = EmuMath::Info::FractalNoiseInfo<value_type>;
+
+		inline fast_fractal_octave_table(value_type freq_, const fractal_info_type& fractal_info_) :
+			freqs(),
+			amplitudes(),
+			range(EmuSIMD::set1<register_type>(1))
+		{
+			const std::size_t num_octaves_ = fractal_info_.GetOctaves();
+			freqs.reserve(num_octaves_);
+			amplitudes.reserve(num_octaves_);
+
+			const register_type lacunarity_ = EmuSIMD::set1<register_type>(fractal_info_.GetLacunarity());
+			const register_type gain_ = EmuSIMD::set1<register_type>(fractal_info_.GetGain());
+			register_type active_freq_ = EmuSIMD::set1<register_type>(freq_);
+			register_type amplitude_ = range;
+			freqs.push_back(active_freq_);
+			amplitudes.push_back(amplitude_);
+			for (std::size_t octave_ = 1; octave_ < num_octaves_; ++octave_)
+			{
+				active_freq_ = EmuSIMD::mul_all(active_freq_, lacunarity_);
+				amplitude_ = EmuSIMD::mul_all(amplitude_, gain_);
+				range = EmuSIMD::add(range, amplitude_);
+				freqs.push_back(active_freq_);
+				amplitudes.push_back(amplitude_);
+			}
+		}
+
+		/// <summary> Number of octaves contained in this table. This will always be at least 1. </summary>
+		[[nodiscard]] inline std::size_t size() const
+		{
+			return freqs.size();
+		}
+
+		/// <summary> Frequency to generate each octave at. </summary>
+		std::vector<register_type> freqs;
+		/// <summary> Amplitude to multiply each octave by before accumulation. The first octave always has an amplitude of 1, and is not multiplied. </summary>
+		std::vector<register_type> amplitudes;
+		/// <summary> Sum of all amplitudes, which accumulated octaves are divided by. Only used when there are at least 2 octaves. </summary>
+		register_type range;
+	};
+
 	namespace _underlying_implementations
 	{
 		template<class PerIterationGenerator_, class Register_>
@@ -13,16 +76,16 @@ namespace EmuMath::Functors
 		{
 		public:
 			using generator_type = PerIterationGenerator_;
-			using register_type = EmuCore::TMP::remove_ref_cv_t<Register_>;
+			using octave_table_type = EmuMath::Functors::fast_fractal_octave_table<Register_>;
+			using register_type = typename octave_table_type::register_type;
 			using integral_register_type = typename EmuSIMD::TMP::register_as_integral<register_type>::type;
-			/// <summary> Float if __m128, __m256, or __m512 is the register type. Otherwise double, due to implied __m128d, __m256d, or __m512d. </summary>
-			using value_type = std::conditional_t
-			<
-				EmuCore::TMP::is_any_comparison_true<std::is_same, register_type, EmuSIMD::f32x4, EmuSIMD::f32x8, EmuSIMD::f32x16>::value,
-				float,
-				double
-			>;
-			using fractal_info_type = EmuMath::Info::FractalNoiseInfo<value_type>;
+			using value_type = typename octave_table_type::value_type;
+			using fractal_info_type = typename octave_table_type::fractal_info_type;
+			/// <summary> Type output by generators producing noise alongside its derivatives, in the order { value, d/dx, d/dy, d/dz }. </summary>
+			using derivatives_type = std::array<register_type, 4>;
+			static constexpr std::size_t per_element_width = EmuSIMD::TMP::floating_point_register_element_width_v<register_type>;
+			/// <summary> Scalar type of permutation masks, matching the width of each element so that masks may be applied to converted coordinates. </summary>
+			using scalar_int_type = std::conditional_t<per_element_width == 32, std::int32_t, std::int64_t>;
 
 			static_assert
 			(
@@ -38,13 +101,7 @@ namespace EmuMath::Functors
 				const fractal_info_type& fractal_info_,
 				GeneratorConstructorArgs_&&...generator_constructor_args_
 			) :
-				starting_freq_simd(EmuSIMD::set1<register_type>(freq_)),
-				lacunarity_simd(EmuSIMD::set1<register_type>(fractal_info_.GetLacunarity())),
-				gain_simd(EmuSIMD::set1<register_type>(fractal_info_.GetGain())),
-				permutation_mask_simd(EmuSIMD::set1<integral_register_type>(permutations_.HighestStoredValue())),
-				fractal_info(fractal_info_),
-				permutations(permutations_),
-				generator(generator_constructor_args_...)
+				_fast_fractal_noise_wrapper(octave_table_type(freq_, fractal_info_), permutations_, generator_constructor_args_...)
 			{
 			}
 			template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<generator_type, GeneratorConstructorArgs_...>>>
@@ -55,17 +112,61 @@ namespace EmuMath::Functors
 				const fractal_info_type& fractal_info_,
 				GeneratorConstructorArgs_&&...generator_constructor_args_
 			) :
-				starting_freq_simd(EmuSIMD::set1<register_type>(freq_)),
-				lacunarity_simd(EmuSIMD::set1<register_type>(fractal_info_.GetLacunarity())),
-				gain_simd(EmuSIMD::set1<register_type>(fractal_info_.GetGain())),
-				permutation_mask_simd(EmuSIMD::set1<integral_register_type>(permutations_.HighestStoredValue())),
-				fractal_info(fractal_info_),
+				_fast_fractal_noise_wrapper(octave_table_type(freq_, fractal_info_), std::move(permutations_), generator_constructor_args_...)
+			{
+			}
+			template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<generator_type, GeneratorConstructorArgs_...>>>
+			inline _fast_fractal_noise_wrapper
+			(
+				octave_table_type octave_table_,
+				const EmuMath::NoisePermutations& permutations_,
+				GeneratorConstructorArgs_&&...generator_constructor_args_
+			) :
+				permutation_mask_simd(EmuSIMD::set1<integral_register_type, per_element_width>(static_cast<scalar_int_type>(permutations_.HighestStoredValue()))),
+				octave_table(std::move(octave_table_)),
 				permutations(permutations_),
 				generator(generator_constructor_args_...)
 			{
 			}
+			template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<generator_type, GeneratorConstructorArgs_...>>>
+			inline _fast_fractal_noise_wrapper
+			(
+				octave_table_type octave_table_,
+				EmuMath::NoisePermutations&& permutations_,
+				GeneratorConstructorArgs_&&...generator_constructor_args_
+			) :
+				permutation_mask_simd(EmuSIMD::set1<integral_register_type, per_element_width>(static_cast<scalar_int_type>(permutations_.HighestStoredValue()))),
+				octave_table(std::move(octave_table_)),
+				permutations(std::move(permutations_)),
+				generator(generator_constructor_args_...)
+			{
+			}
 
-			[[nodiscard]] constexpr inline register_type operator()(register_type points_x_, register_type points_y_, register_type points_z_)
+			[[nodiscard]] constexpr inline register_type operator()(register_type points_x_, register_type points_y_, register_type points_z_, register_type points_w_)
+			{
+				constexpr bool is_valid_for_4d = std::is_invocable_r_v
+				<
+					register_type,
+					generator_type,
+					register_type, register_type, register_type, register_type, register_type, integral_register_type, EmuMath::NoisePermutations
+				>;
+				if constexpr (is_valid_for_4d)
+				{
+					return _accumulate_octaves
+					(
+						[&](register_type freq_) { return generator(points_x_, points_y_, points_z_, points_w_, freq_, permutation_mask_simd, permutations); }
+					);
+				}
+				else
+				{
+					static_assert
+					(
+						EmuCore::TMP::get_false<generator_type>(),
+						"Invalid generator type provided for a fast_fractal_noise_wrapper when invoked with 4 coordinate registers. The generator must return the provided register type, and take the following type arguments: register_type, register_type, register_type, register_type, register_type, integral_register_type, EmuMath::NoisePermutations, interpreted as: `points_x`, `points_y`, `points_z`, `points_w`, `freq`, `permutation_mask`, `permutations`"
+					);
+				}
+			}
+			[[nodiscard]] constexpr inline auto operator()(register_type points_x_, register_type points_y_, register_type points_z_)
 			{
 				constexpr bool is_valid_for_3d = std::is_invocable_r_v
 				<
@@ -73,41 +174,25 @@ namespace EmuMath::Functors
 					generator_type,
 					register_type, register_type, register_type, register_type, integral_register_type, EmuMath::NoisePermutations
 				>;
-				if constexpr (is_valid_for_3d)
+				constexpr bool is_valid_for_3d_derivatives = std::is_invocable_r_v
+				<
+					derivatives_type,
+					generator_type,
+					register_type, register_type, register_type, register_type, integral_register_type, EmuMath::NoisePermutations
+				>;
+				if constexpr (is_valid_for_3d || is_valid_for_3d_derivatives)
 				{
-					std::size_t end_ = fractal_info.GetOctaves();
-					if (1 < end_)
-					{
-						std::size_t octave_ = 1;
-						register_type range_ = EmuSIMD::set1<register_type>(1);
-						register_type amplitude_ = range_;
-						register_type active_freq_ = starting_freq_simd;
-						register_type result_ = generator(points_x_, points_y_, points_z_, active_freq_, permutation_mask_simd, permutations);
-						do
-						{
-							active_freq_ = EmuSIMD::mul_all(active_freq_, lacunarity_simd);
-							amplitude_ = EmuSIMD::mul_all(amplitude_, gain_simd);
-							range_ = EmuSIMD::add(range_, amplitude_);
-							result_ = EmuSIMD::add
-							(
-								result_,
-								EmuSIMD::mul_all(generator(points_x_, points_y_, points_z_, active_freq_, permutation_mask_simd, permutations), amplitude_)
-							);
-							++octave_;
-						} while (octave_ < end_);
-						return EmuSIMD::div(result_, range_);
-					}
-					else
-					{
-						return generator(points_x_, points_y_, points_z_, starting_freq_simd, permutation_mask_simd, permutations);
-					}
+					return _accumulate_octaves
+					(
+						[&](register_type freq_) { return generator(points_x_, points_y_, points_z_, freq_, permutation_mask_simd, permutations); }
+					);
 				}
 				else
 				{
 					static_assert
 					(
 						EmuCore::TMP::get_false<generator_type>(),
-						"Invalid generator type provided for a fast_fractal_noise_wrapper when invoked with 3 coordinate registers. The generator must return the provided register type, and take the following type arguments: register_type, register_type, register_type, register_type, integral_register_type, EmuMath::NoisePermutations, interpreted as: `points_x`, `points_y`, `points_z`, `freq`, `permutation_mask`, `permutations`"
+						"Invalid generator type provided for a fast_fractal_noise_wrapper when invoked with 3 coordinate registers. The generator must return the provided register type (or a std::array of 4 such registers for derivatives), and take the following type arguments: register_type, register_type, register_type, register_type, integral_register_type, EmuMath::NoisePermutations, interpreted as: `points_x`, `points_y`, `points_z`, `freq`, `permutation_mask`, `permutations`"
 					);
 				}
 			}
@@ -121,32 +206,10 @@ namespace EmuMath::Functors
 				>;
 				if constexpr (is_valid_for_2d)
 				{
-					std::size_t end_ = fractal_info.GetOctaves();
-					if (1 < end_)
-					{
-						std::size_t octave_ = 1;
-						register_type range_ = EmuSIMD::set1<register_type>(1);
-						register_type amplitude_ = range_;
-						register_type active_freq_ = starting_freq_simd;
-						register_type result_ = generator(points_x_, points_y_, active_freq_, permutation_mask_simd, permutations);
-						do
-						{
-							active_freq_ = EmuSIMD::mul_all(active_freq_, lacunarity_simd);
-							amplitude_ = EmuSIMD::mul_all(amplitude_, gain_simd);
-							range_ = EmuSIMD::add(range_, amplitude_);
-							result_ = EmuSIMD::add
-							(
-								result_,
-								EmuSIMD::mul_all(generator(points_x_, points_y_, active_freq_, permutation_mask_simd, permutations), amplitude_)
-							);
-							++octave_;
-						} while (octave_ < end_);
-						return EmuSIMD::div(result_, range_);
-					}
-					else
-					{
-						return generator(points_x_, points_y_, starting_freq_simd, permutation_mask_simd, permutations);
-					}
+					return _accumulate_octaves
+					(
+						[&](register_type freq_) { return generator(points_x_, points_y_, freq_, permutation_mask_simd, permutations); }
+					);
 				}
 				else
 				{
@@ -167,32 +230,10 @@ namespace EmuMath::Functors
 				>;
 				if constexpr (is_valid_for_1d)
 				{
-					std::size_t end_ = fractal_info.GetOctaves();
-					if (1 < end_)
-					{
-						std::size_t octave_ = 1;
-						register_type range_ = EmuSIMD::set1<register_type>(1);
-						register_type amplitude_ = range_;
-						register_type active_freq_ = starting_freq_simd;
-						register_type result_ = generator(points_x_, active_freq_, permutation_mask_simd, permutations);
-						do
-						{
-							active_freq_ = EmuSIMD::mul_all(active_freq_, lacunarity_simd);
-							amplitude_ = EmuSIMD::mul_all(amplitude_, gain_simd);
-							range_ = EmuSIMD::add(range_, amplitude_);
-							result_ = EmuSIMD::add
-							(
-								result_,
-								EmuSIMD::mul_all(generator(points_x_, active_freq_, permutation_mask_simd, permutations), amplitude_)
-							);
-							++octave_;
-						} while (octave_ < end_);
-						return EmuSIMD::div(result_, range_);
-					}
-					else
-					{
-						return generator(points_x_, starting_freq_simd, permutation_mask_simd, permutations);
-					}
+					return _accumulate_octaves
+					(
+						[&](register_type freq_) { return generator(points_x_, freq_, permutation_mask_simd, permutations); }
+					);
 				}
 				else
 				{
@@ -204,45 +245,115 @@ namespace EmuMath::Functors
 				}
 			}
 
+			[[nodiscard]] inline const octave_table_type& get_octave_table() const
+			{
+				return octave_table;
+			}
+
 		private:
-			register_type starting_freq_simd;
-			register_type lacunarity_simd;
-			register_type gain_simd;
+			/// <summary>
+			/// <para> Generates and accumulates all octaves of a single batch of points, using the provided function to generate a single octave at a given frequency. </para>
+			/// <para> 
+			///		Octaves after the first are generated in independent pairs before either is accumulated,
+			///		allowing the lookups and hashing of both octaves to be interleaved to hide their latency.
+			///		Accumulation order is unchanged, so results are identical to accumulating each octave as it is generated.
+			/// </para>
+			/// <para>
+			///		Octaves may output derivatives_type, in which case every output is accumulated in the same way as values.
+			///		As each octave's derivatives are already scaled by its frequency, this applies the chain rule to the accumulated derivatives.
+			/// </para>
+			/// </summary>
+			template<class GenerateOctave_>
+			[[nodiscard]] inline auto _accumulate_octaves(GenerateOctave_ generate_octave_) const
+			{
+				const std::size_t num_octaves_ = octave_table.size();
+				const register_type* freqs_ = octave_table.freqs.data();
+				const register_type* amplitudes_ = octave_table.amplitudes.data();
+
+				auto result_ = generate_octave_(freqs_[0]);
+				if (1 < num_octaves_)
+				{
+					std::size_t octave_ = 1;
+					for (const std::size_t end_pairs_ = num_octaves_ - ((num_octaves_ - 1) % 2); octave_ < end_pairs_; octave_ += 2)
+					{
+						auto octave_0_ = generate_octave_(freqs_[octave_]);
+						auto octave_1_ = generate_octave_(freqs_[octave_ + 1]);
+						_accumulate_octave(result_, octave_0_, amplitudes_[octave_]);
+						_accumulate_octave(result_, octave_1_, amplitudes_[octave_ + 1]);
+					}
+
+					if (octave_ < num_octaves_)
+					{
+						_accumulate_octave(result_, generate_octave_(freqs_[octave_]), amplitudes_[octave_]);
+					}
+					_divide_by_range(result_);
+				}
+				return result_;
+			}
+
+			static inline void _accumulate_octave(register_type& result_, register_type octave_, register_type amplitude_)
+			{
+				result_ = EmuSIMD::add(result_, EmuSIMD::mul_all(octave_, amplitude_));
+			}
+			static inline void _accumulate_octave(derivatives_type& result_, const derivatives_type& octave_, register_type amplitude_)
+			{
+				for (std::size_t i = 0; i < 4; ++i)
+				{
+					result_[i] = EmuSIMD::add(result_[i], EmuSIMD::mul_all(octave_[i], amplitude_));
+				}
+			}
+
+			inline void _divide_by_range(register_type& result_) const
+			{
+				result_ = EmuSIMD::div(result_, octave_table.range);
+			}
+			inline void _divide_by_range(derivatives_type& result_) const
+			{
+				for (std::size_t i = 0; i < 4; ++i)
+				{
+					result_[i] = EmuSIMD::div(result_[i], octave_table.range);
+				}
+			}
+
 			integral_register_type permutation_mask_simd;
-			fractal_info_type fractal_info;
+			octave_table_type octave_table;
 			EmuMath::NoisePermutations permutations;
 			generator_type generator;
 		};
 	}
 
 
-	template<class PerIterationGenerator_, EmuConcepts::KnownSIMD SIMD32>
-		requires((EmuSIMD::TMP::is_floating_point_simd_register_v<SIMD32>) && (EmuSIMD::TMP::floating_point_register_element_width_v<SIMD32> == 32))
-	struct no_fractal_noise_wrapper<PerIterationGenerator_, SIMD32>
+	template<class PerIterationGenerator_, EmuConcepts::KnownSIMD SIMDRegister_>
+	requires((EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>))
+	struct no_fractal_noise_wrapper<PerIterationGenerator_, SIMDRegister_>
 	{
 		using generator_type = PerIterationGenerator_;
-		using value_type = typename std::remove_cvref<SIMD32>::type;
+		using value_type = typename std::remove_cvref<SIMDRegister_>::type;
 		using integer_type = typename EmuSIMD::TMP::register_as_integral<value_type>::type;
 		using register_arg_type = typename EmuSIMD::TMP::register_as_arg_type<value_type>::type;
-		static constexpr std::size_t per_element_width = 32;
+		static constexpr std::size_t per_element_width = EmuSIMD::TMP::floating_point_register_element_width_v<value_type>;
+		/// <summary> Scalar type of frequencies passed on construction. Float for 32-bit elements, otherwise double. </summary>
+		using scalar_type = std::conditional_t<per_element_width == 32, float, double>;
+		/// <summary> Scalar type of permutation masks, matching the width of each element so that masks may be applied to converted coordinates. </summary>
+		using scalar_int_type = std::conditional_t<per_element_width == 32, std::int32_t, std::int64_t>;
 
 		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<generator_type, GeneratorConstructorArgs_...>>>
 		no_fractal_noise_wrapper
 		(
-			float freq_,
+			scalar_type freq_,
 			const EmuMath::NoisePermutations& permutations_,
 			GeneratorConstructorArgs_&&...generator_constructor_args_
 		) :
-			freq(_mm_set1_ps(freq_)),
+			freq(EmuSIMD::set1<value_type, per_element_width>(freq_)),
 			permutations(permutations_),
 			generator(generator_constructor_args_...)
 		{
-			permutations_mask_128 = _mm_set1_epi32(static_cast<std::int32_t>(permutations.HighestStoredValue()));
+			permutations_mask_128 = EmuSIMD::set1<integer_type, per_element_width>(static_cast<scalar_int_type>(permutations.HighestStoredValue()));
 		}
 		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<generator_type, GeneratorConstructorArgs_...>>>
 		no_fractal_noise_wrapper
 		(
-			float freq_,
+			scalar_type freq_,
 			EmuMath::NoisePermutations&& permutations_,
 			GeneratorConstructorArgs_&&...generator_constructor_args_
 		) :
@@ -250,10 +361,31 @@ namespace EmuMath::Functors
 			permutations(permutations_),
 			generator(generator_constructor_args_...)
 		{
-			permutations_mask_128 = EmuSIMD::set1<integer_type, per_element_width>(static_cast<std::int32_t>(permutations.HighestStoredValue()));
+			permutations_mask_128 = EmuSIMD::set1<integer_type, per_element_width>(static_cast<scalar_int_type>(permutations.HighestStoredValue()));
 		}
 
-		[[nodiscard]] inline value_type operator()(register_arg_type points_x_, register_arg_type points_y_, register_arg_type points_z_)
+		[[nodiscard]] inline value_type operator()(register_arg_type points_x_, register_arg_type points_y_, register_arg_type points_z_, register_arg_type points_w_)
+		{
+			constexpr bool is_valid_for_4d = std::is_invocable_r_v
+			<
+				value_type,
+				generator_type,
+				value_type, value_type, value_type, value_type, value_type, integer_type, EmuMath::NoisePermutations
+			>;
+			if constexpr (is_valid_for_4d)
+			{
+				return generator(points_x_, points_y_, points_z_, points_w_, freq, permutations_mask_128, permutations);
+			}
+			else
+			{
+				static_assert
+				(
+					EmuCore::TMP::get_false<generator_type>(),
+					"Invalid generator type provided for a no_fractal_noise_wrapper when invoked with 4 coordinate registers. The generator must return the provided register type, and take the following type arguments: register_type, register_type, register_type, register_type, register_type, integral_register_type, EmuMath::NoisePermutations, interpreted as: `points_x`, `points_y`, `points_z`, `points_w`, `freq`, `permutation_mask`, `permutations`"
+				);
+			}
+		}
+		[[nodiscard]] inline auto operator()(register_arg_type points_x_, register_arg_type points_y_, register_arg_type points_z_)
 		{
 			constexpr bool is_valid_for_3d = std::is_invocable_r_v
 			<
@@ -261,7 +393,13 @@ namespace EmuMath::Functors
 				generator_type,
 				value_type, value_type, value_type, value_type, integer_type, EmuMath::NoisePermutations
 			>;
-			if constexpr (is_valid_for_3d)
+			constexpr bool is_valid_for_3d_derivatives = std::is_invocable_r_v
+			<
+				std::array<value_type, 4>,
+				generator_type,
+				value_type, value_type, value_type, value_type, integer_type, EmuMath::NoisePermutations
+			>;
+			if constexpr (is_valid_for_3d || is_valid_for_3d_derivatives)
 			{
 				return generator(points_x_, points_y_, points_z_, freq, permutations_mask_128, permutations);
 			}
@@ -270,7 +408,7 @@ namespace EmuMath::Functors
 				static_assert
 				(
 					EmuCore::TMP::get_false<generator_type>(),
-					"Invalid generator type provided for a no_fractal_noise_wrapper taking __m128 values when invoked with 3 coordinate registers. The generator must return the __m128 type, and take the following type arguments: __m128, __m128, __m128, __m128, __m128i, EmuMath::NoisePermutations, interpreted as: `points_x`, `points_y`, `points_z`, `freq`, `permutation_mask`, `permutations`"
+					"Invalid generator type provided for a no_fractal_noise_wrapper taking __m128 values when invoked with 3 coordinate registers. The generator must return the __m128 type (or a std::array of 4 __m128 for derivatives), and take the following type arguments: __m128, __m128, __m128, __m128, __m128i, EmuMath::NoisePermutations, interpreted as: `points_x`, `points_y`, `points_z`, `freq`, `permutation_mask`, `permutations`"
 				);
 			}
 		}
@@ -349,7 +487,25 @@ namespace EmuMath::Functors
 			EmuMath::NoisePermutations&& permutations_,
 			const typename parent_type::fractal_info_type& fractal_info_,
 			GeneratorConstructorArgs_&&...generator_constructor_args_
-		) : parent_type(freq_, permutations_, fractal_info_, generator_constructor_args_...)
+		) : parent_type(freq_, std::move(permutations_), fractal_info_, generator_constructor_args_...)
+		{
+		}
+		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<typename parent_type::generator_type, GeneratorConstructorArgs_...>>>
+		inline fractal_noise_wrapper
+		(
+			typename parent_type::octave_table_type octave_table_,
+			const EmuMath::NoisePermutations& permutations_,
+			GeneratorConstructorArgs_&&...generator_constructor_args_
+		) : parent_type(std::move(octave_table_), permutations_, generator_constructor_args_...)
+		{
+		}
+		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<typename parent_type::generator_type, GeneratorConstructorArgs_...>>>
+		inline fractal_noise_wrapper
+		(
+			typename parent_type::octave_table_type octave_table_,
+			EmuMath::NoisePermutations&& permutations_,
+			GeneratorConstructorArgs_&&...generator_constructor_args_
+		) : parent_type(std::move(octave_table_), std::move(permutations_), generator_constructor_args_...)
 		{
 		}
 	};
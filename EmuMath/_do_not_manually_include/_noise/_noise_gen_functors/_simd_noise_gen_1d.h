@@ -47,9 +47,18 @@ namespace EmuMath::Functors
 		)
 		{
 			points_x_ = EmuSIMD::floor(EmuSIMD::mul_all(points_x_, freq_));
-			int i_[4];
-			EmuSIMD::store(EmuSIMD::bitwise_and(_mm_cvtps_epi32(points_x_), permutations_mask_128_), i_);
-			__m128 perms_ = EmuSIMD::set<__m128>(permutations_[i_[3]], permutations_[i_[2]], permutations_[i_[1]], permutations_[i_[0]]);
+			__m128i i_128_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(points_x_), permutations_mask_128_);
+			__m128 perms_;
+			if constexpr (_underlying_noise_gen::_fast_gather_supported_v<__m128>)
+			{
+				perms_ = _mm_cvtepi32_ps(_underlying_noise_gen::_fast_gather_permutations(permutations_, i_128_));
+			}
+			else
+			{
+				int i_[4];
+				EmuSIMD::store(i_128_, i_);
+				perms_ = EmuSIMD::set<__m128>(permutations_[i_[3]], permutations_[i_[2]], permutations_[i_[1]], permutations_[i_[0]]);
+			}
 			return EmuSIMD::div(perms_, _mm_cvtepi32_ps(permutations_mask_128_));
 		}
 	};
@@ -75,20 +84,32 @@ namespace EmuMath::Functors
 			t_ = EmuSIMD::sub(points_x_, t_);
 			__m128i i1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(i0_128_, EmuSIMD::set1<__m128i, 32>(1)), permutations_mask_128_);
 
-			int i0_[4];
-			int i1_[4];
-			EmuSIMD::store(i0_128_, i0_);
-			EmuSIMD::store(i1_128_, i1_);
-
-			float perms_0_[4];
-			float perms_1_[4];
-			for (std::size_t i = 0; i < 4; ++i)
+			__m128 perms_0_128_;
+			__m128 perms_1_128_;
+			if constexpr (_underlying_noise_gen::_fast_gather_supported_v<__m128>)
 			{
-				perms_0_[i] = static_cast<float>(permutations_[i0_[i]]);
-				perms_1_[i] = static_cast<float>(permutations_[i1_[i]]);
+				perms_0_128_ = _mm_cvtepi32_ps(_underlying_noise_gen::_fast_gather_permutations(permutations_, i0_128_));
+				perms_1_128_ = _mm_cvtepi32_ps(_underlying_noise_gen::_fast_gather_permutations(permutations_, i1_128_));
+			}
+			else
+			{
+				int i0_[4];
+				int i1_[4];
+				EmuSIMD::store(i0_128_, i0_);
+				EmuSIMD::store(i1_128_, i1_);
+
+				float perms_0_[4];
+				float perms_1_[4];
+				for (std::size_t i = 0; i < 4; ++i)
+				{
+					perms_0_[i] = static_cast<float>(permutations_[i0_[i]]);
+					perms_1_[i] = static_cast<float>(permutations_[i1_[i]]);
+				}
+				perms_0_128_ = EmuSIMD::load<__m128>(perms_0_);
+				perms_1_128_ = EmuSIMD::load<__m128>(perms_1_);
 			}
 
-			__m128 lerped_ = EmuSIMD::fused_lerp(EmuSIMD::load<__m128>(perms_0_), EmuSIMD::load<__m128>(perms_1_), smooth_t(t_));
+			__m128 lerped_ = EmuSIMD::fused_lerp(perms_0_128_, perms_1_128_, smooth_t(t_));
 			return EmuSIMD::div(lerped_, _mm_cvtepi32_ps(permutations_mask_128_));
 		}
 
@@ -124,17 +145,25 @@ namespace EmuMath::Functors
 
 			// Finish indices
 			__m128i i1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(i0_128_, _mm_cvtps_epi32(one_)), permutations_mask_128_);
-			int i0_[4];
-			int i1_[4];
-			EmuSIMD::store(i0_128_, i0_);
-			EmuSIMD::store(i1_128_, i1_);
-
-			std::size_t perms_0_[4];
-			std::size_t perms_1_[4];
-			for (std::size_t i = 0; i < 4; ++i)
+			int perms_0_[4];
+			int perms_1_[4];
+			if constexpr (_underlying_noise_gen::_fast_gather_supported_v<__m128>)
+			{
+				__m128i gradients_mask_ = EmuSIMD::set1<__m128i, 32>(static_cast<std::int32_t>(gradients::mask));
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_gather_permutations(permutations_, i0_128_), gradients_mask_), perms_0_);
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_gather_permutations(permutations_, i1_128_), gradients_mask_), perms_1_);
+			}
+			else
 			{
-				perms_0_[i] = permutations_[i0_[i]] & gradients::mask;
-				perms_1_[i] = permutations_[i1_[i]] & gradients::mask;
+				int i0_[4];
+				int i1_[4];
+				EmuSIMD::store(i0_128_, i0_);
+				EmuSIMD::store(i1_128_, i1_);
+				for (std::size_t i = 0; i < 4; ++i)
+				{
+					perms_0_[i] = static_cast<int>(permutations_[i0_[i]] & gradients::mask);
+					perms_1_[i] = static_cast<int>(permutations_[i1_[i]] & gradients::mask);
+				}
 			}
 
 			__m128 gradients_0_ = gradients::init_registers(perms_0_[0], perms_0_[1], perms_0_[2], perms_0_[3]);
@@ -56,18 +56,28 @@ namespace EmuMath::Functors
 
 			__m128i ix_128_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(points_x_), permutations_mask_128_);
 			__m128i iy_128_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(points_y_), permutations_mask_128_);
-			int ix_[4];
-			int iy_[4];
-			EmuSIMD::store(iy_128_, iy_);
-			EmuSIMD::store(ix_128_, ix_);
-			float perms_[4];
-			std::size_t mask_ = static_cast<std::size_t>(permutations_.HighestStoredValue());
-
-			for (std::size_t i = 0; i < 4; ++i)
+			__m128 perms_128_;
+			if constexpr (_underlying_noise_gen::_fast_gather_supported_v<__m128>)
 			{
-				perms_[i] = static_cast<float>(permutations_[(static_cast<std::size_t>(permutations_[ix_[i]]) + iy_[i]) & mask_]);
+				__m128i perms_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_128_);
+				perms_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perms_, iy_128_);
+				perms_128_ = _mm_cvtepi32_ps(perms_);
 			}
-			return EmuSIMD::div(EmuSIMD::load<__m128>(perms_), _mm_cvtepi32_ps(permutations_mask_128_));
+			else
+			{
+				int ix_[4];
+				int iy_[4];
+				EmuSIMD::store(iy_128_, iy_);
+				EmuSIMD::store(ix_128_, ix_);
+				float perms_[4];
+
+				for (std::size_t i = 0; i < 4; ++i)
+				{
+					perms_[i] = static_cast<float>(permutations_[static_cast<std::size_t>(permutations_[ix_[i]]) + iy_[i]]);
+				}
+				perms_128_ = EmuSIMD::load<__m128>(perms_);
+			}
+			return EmuSIMD::div(perms_128_, _mm_cvtepi32_ps(permutations_mask_128_));
 		}
 	};
 
@@ -104,33 +114,50 @@ namespace EmuMath::Functors
 			__m128i ix_1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(ix_0_128_, one_128i_), permutations_mask_128_);
 			__m128i iy_1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(iy_0_128_, one_128i_), permutations_mask_128_);
 
-			int ix_0_[4];
-			int ix_1_[4];
-			int iy_0_[4];
-			int iy_1_[4];
-			EmuSIMD::store(ix_0_128_, ix_0_);
-			EmuSIMD::store(ix_1_128_, ix_1_);
-			EmuSIMD::store(iy_0_128_, iy_0_);
-			EmuSIMD::store(iy_1_128_, iy_1_);
-
-			float perms_00_[4];
-			float perms_01_[4];
-			float perms_10_[4];
-			float perms_11_[4];
-			std::size_t mask_ = static_cast<std::size_t>(permutations_.HighestStoredValue());
-			for (std::size_t i = 0; i < 4; ++i)
+			__m128 perms_00_, perms_01_, perms_10_, perms_11_;
+			if constexpr (_underlying_noise_gen::_fast_gather_supported_v<__m128>)
 			{
-				std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_[i]]);
-				std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_[i]]);
+				__m128i perm_0_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_0_128_);
+				__m128i perm_1_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_1_128_);
 
-				perms_00_[i] = static_cast<float>(permutations_[(perm_0_ + iy_0_[i]) & mask_]);
-				perms_01_[i] = static_cast<float>(permutations_[(perm_0_ + iy_1_[i]) & mask_]);
-				perms_10_[i] = static_cast<float>(permutations_[(perm_1_ + iy_0_[i]) & mask_]);
-				perms_11_[i] = static_cast<float>(permutations_[(perm_1_ + iy_1_[i]) & mask_]);
+				perms_00_ = _mm_cvtepi32_ps(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_0_, iy_0_128_));
+				perms_01_ = _mm_cvtepi32_ps(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_0_, iy_1_128_));
+				perms_10_ = _mm_cvtepi32_ps(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_1_, iy_0_128_));
+				perms_11_ = _mm_cvtepi32_ps(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_1_, iy_1_128_));
+			}
+			else
+			{
+				int ix_0_[4];
+				int ix_1_[4];
+				int iy_0_[4];
+				int iy_1_[4];
+				EmuSIMD::store(ix_0_128_, ix_0_);
+				EmuSIMD::store(ix_1_128_, ix_1_);
+				EmuSIMD::store(iy_0_128_, iy_0_);
+				EmuSIMD::store(iy_1_128_, iy_1_);
+
+				float perms_00_fp_[4];
+				float perms_01_fp_[4];
+				float perms_10_fp_[4];
+				float perms_11_fp_[4];
+				for (std::size_t i = 0; i < 4; ++i)
+				{
+					std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_[i]]);
+					std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_[i]]);
+
+					perms_00_fp_[i] = static_cast<float>(permutations_[perm_0_ + iy_0_[i]]);
+					perms_01_fp_[i] = static_cast<float>(permutations_[perm_0_ + iy_1_[i]]);
+					perms_10_fp_[i] = static_cast<float>(permutations_[perm_1_ + iy_0_[i]]);
+					perms_11_fp_[i] = static_cast<float>(permutations_[perm_1_ + iy_1_[i]]);
+				}
+				perms_00_ = EmuSIMD::load<__m128>(perms_00_fp_);
+				perms_01_ = EmuSIMD::load<__m128>(perms_01_fp_);
+				perms_10_ = EmuSIMD::load<__m128>(perms_10_fp_);
+				perms_11_ = EmuSIMD::load<__m128>(perms_11_fp_);
 			}
 
-			__m128 lerp_0_ = EmuSIMD::fused_lerp(EmuSIMD::load<__m128>(perms_00_), EmuSIMD::load<__m128>(perms_10_), tx_);
-			__m128 lerp_1_ = EmuSIMD::fused_lerp(EmuSIMD::load<__m128>(perms_01_), EmuSIMD::load<__m128>(perms_11_), tx_);
+			__m128 lerp_0_ = EmuSIMD::fused_lerp(perms_00_, perms_10_, tx_);
+			__m128 lerp_1_ = EmuSIMD::fused_lerp(perms_01_, perms_11_, tx_);
 			return EmuSIMD::div(EmuSIMD::fused_lerp(lerp_0_, lerp_1_, ty_), _mm_cvtepi32_ps(permutations_mask_128_));
 		}
 
@@ -184,29 +211,40 @@ namespace EmuMath::Functors
 			iy_0_128_ = EmuSIMD::bitwise_and(iy_0_128_, permutations_mask_128_);
 			__m128i iy_1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(iy_0_128_, one_128i_), permutations_mask_128_);
 
-			int ix_0_[4];
-			int ix_1_[4];
-			int iy_0_[4];
-			int iy_1_[4];
-			EmuSIMD::store(ix_0_128_, ix_0_);
-			EmuSIMD::store(ix_1_128_, ix_1_);
-			EmuSIMD::store(iy_0_128_, iy_0_);
-			EmuSIMD::store(iy_1_128_, iy_1_);
-
-			std::size_t perms_00_[4];
-			std::size_t perms_01_[4];
-			std::size_t perms_10_[4];
-			std::size_t perms_11_[4];
-			std::size_t perm_mask_ = permutations_.HighestStoredValue();
-
-			for (std::size_t i = 0; i < 4; ++i)
+			int perms_00_[4];
+			int perms_01_[4];
+			int perms_10_[4];
+			int perms_11_[4];
+			if constexpr (_underlying_noise_gen::_fast_gather_supported_v<__m128>)
 			{
-				std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_[i]]);
-				std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_[i]]);
-				perms_00_[i] = permutations_[(perm_0_ + iy_0_[i]) & perm_mask_] & gradients::mask;
-				perms_01_[i] = permutations_[(perm_0_ + iy_1_[i]) & perm_mask_] & gradients::mask;
-				perms_10_[i] = permutations_[(perm_1_ + iy_0_[i]) & perm_mask_] & gradients::mask;
-				perms_11_[i] = permutations_[(perm_1_ + iy_1_[i]) & perm_mask_] & gradients::mask;
+				__m128i gradients_mask_ = EmuSIMD::set1<__m128i, 32>(static_cast<std::int32_t>(gradients::mask));
+				__m128i perm_0_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_0_128_);
+				__m128i perm_1_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_1_128_);
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_0_, iy_0_128_), gradients_mask_), perms_00_);
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_0_, iy_1_128_), gradients_mask_), perms_01_);
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_1_, iy_0_128_), gradients_mask_), perms_10_);
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_1_, iy_1_128_), gradients_mask_), perms_11_);
+			}
+			else
+			{
+				int ix_0_[4];
+				int ix_1_[4];
+				int iy_0_[4];
+				int iy_1_[4];
+				EmuSIMD::store(ix_0_128_, ix_0_);
+				EmuSIMD::store(ix_1_128_, ix_1_);
+				EmuSIMD::store(iy_0_128_, iy_0_);
+				EmuSIMD::store(iy_1_128_, iy_1_);
+
+				for (std::size_t i = 0; i < 4; ++i)
+				{
+					std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_[i]]);
+					std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_[i]]);
+					perms_00_[i] = static_cast<int>(permutations_[perm_0_ + iy_0_[i]] & gradients::mask);
+					perms_01_[i] = static_cast<int>(permutations_[perm_0_ + iy_1_[i]] & gradients::mask);
+					perms_10_[i] = static_cast<int>(permutations_[perm_1_ + iy_0_[i]] & gradients::mask);
+					perms_11_[i] = static_cast<int>(permutations_[perm_1_ + iy_1_[i]] & gradients::mask);
+				}
 			}
 
 			// 00
@@ -283,6 +321,266 @@ namespace EmuMath::Functors
 
 		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<__m128> smooth_t;
 	};
+
+	/// <summary>
+	/// <para> Functor to produce 2-dimensional simplex noise for every element of the provided registers. Produced noise targets the range -1:1. </para>
+	/// <para> Only the 3 corners of each point's containing triangle are hashed and evaluated, and every step is branchless across elements. </para>
+	/// </summary>
+	template<>
+	struct make_fast_noise_2d<EmuMath::NoiseType::SIMPLEX, __m128>
+	{
+		using gradients = EmuMath::Functors::_underlying_noise_gen::perlin_gradients<2, float>;
+		using constants = EmuMath::Functors::_underlying_noise_gen::simplex_constants<2, float>;
+
+		inline make_fast_noise_2d() :
+			skew(EmuSIMD::set1<__m128>(constants::skew)),
+			unskew(EmuSIMD::set1<__m128>(constants::unskew)),
+			unskew_2_minus_1(EmuSIMD::set1<__m128>((2.0f * constants::unskew) - 1.0f)),
+			falloff(EmuSIMD::set1<__m128>(constants::falloff)),
+			output_scale(EmuSIMD::set1<__m128>(constants::output_scale)),
+			diagonal(EmuSIMD::set1<__m128>(gradients::values[4].at<0>())),
+			one(EmuSIMD::set1<__m128>(1.0f))
+		{
+		}
+
+		[[nodiscard]] inline __m128 operator()
+		(
+			__m128 points_x_,
+			__m128 points_y_,
+			__m128 freq_,
+			__m128i permutations_mask_128_,
+			const EmuMath::NoisePermutations& permutations_
+		)
+		{
+			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
+			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
+
+			// Skew points to find the origins of their containing squares, then unskew those origins to find each point's offset from its first simplex corner
+			__m128 temp_ = EmuSIMD::mul_all(EmuSIMD::add(points_x_, points_y_), skew);
+			__m128 cell_x_ = EmuSIMD::floor(EmuSIMD::add(points_x_, temp_));
+			__m128 cell_y_ = EmuSIMD::floor(EmuSIMD::add(points_y_, temp_));
+			temp_ = EmuSIMD::mul_all(EmuSIMD::add(cell_x_, cell_y_), unskew);
+			__m128 x_0_ = EmuSIMD::sub(points_x_, EmuSIMD::sub(cell_x_, temp_));
+			__m128 y_0_ = EmuSIMD::sub(points_y_, EmuSIMD::sub(cell_y_, temp_));
+
+			// The second corner steps along the axis of the greater offset, producing steps of 1 or 0 by masking a register of 1s
+			__m128 x_ge_y_ = EmuSIMD::cmpge(x_0_, y_0_);
+			__m128 step_x_1_ = EmuSIMD::bitwise_and(x_ge_y_, one);
+			__m128 step_y_1_ = EmuSIMD::bitwise_andnot(x_ge_y_, one);
+
+			// Corner lattice indices
+			__m128i ix_0_128_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(cell_x_), permutations_mask_128_);
+			__m128i iy_0_128_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(cell_y_), permutations_mask_128_);
+			__m128i ix_1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(ix_0_128_, _mm_cvtps_epi32(step_x_1_)), permutations_mask_128_);
+			__m128i iy_1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(iy_0_128_, _mm_cvtps_epi32(step_y_1_)), permutations_mask_128_);
+			__m128i one_128i_ = EmuSIMD::set1<__m128i, 32>(1);
+			__m128i ix_2_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(ix_0_128_, one_128i_), permutations_mask_128_);
+			__m128i iy_2_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(iy_0_128_, one_128i_), permutations_mask_128_);
+
+			__m128i hash_0_, hash_1_, hash_2_;
+			if constexpr (_underlying_noise_gen::_fast_gather_supported_v<__m128>)
+			{
+				hash_0_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_0_128_), iy_0_128_);
+				hash_1_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_1_128_), iy_1_128_);
+				hash_2_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_2_128_), iy_2_128_);
+			}
+			else
+			{
+				int ix_0_[4];
+				int ix_1_[4];
+				int ix_2_[4];
+				int iy_0_[4];
+				int iy_1_[4];
+				int iy_2_[4];
+				EmuSIMD::store(ix_0_128_, ix_0_);
+				EmuSIMD::store(ix_1_128_, ix_1_);
+				EmuSIMD::store(ix_2_128_, ix_2_);
+				EmuSIMD::store(iy_0_128_, iy_0_);
+				EmuSIMD::store(iy_1_128_, iy_1_);
+				EmuSIMD::store(iy_2_128_, iy_2_);
+
+				int perms_0_[4];
+				int perms_1_[4];
+				int perms_2_[4];
+				for (std::size_t i = 0; i < 4; ++i)
+				{
+					perms_0_[i] = static_cast<int>(permutations_[static_cast<std::size_t>(permutations_[ix_0_[i]]) + iy_0_[i]]);
+					perms_1_[i] = static_cast<int>(permutations_[static_cast<std::size_t>(permutations_[ix_1_[i]]) + iy_1_[i]]);
+					perms_2_[i] = static_cast<int>(permutations_[static_cast<std::size_t>(permutations_[ix_2_[i]]) + iy_2_[i]]);
+				}
+				hash_0_ = EmuSIMD::load<__m128i>(perms_0_);
+				hash_1_ = EmuSIMD::load<__m128i>(perms_1_);
+				hash_2_ = EmuSIMD::load<__m128i>(perms_2_);
+			}
+
+			// Sum contributions of all corners
+			__m128 result_ = _corner_contribution(hash_0_, x_0_, y_0_);
+			result_ = EmuSIMD::add
+			(
+				result_,
+				_corner_contribution(hash_1_, EmuSIMD::add(EmuSIMD::sub(x_0_, step_x_1_), unskew), EmuSIMD::add(EmuSIMD::sub(y_0_, step_y_1_), unskew))
+			);
+			result_ = EmuSIMD::add
+			(
+				result_,
+				_corner_contribution(hash_2_, EmuSIMD::add(x_0_, unskew_2_minus_1), EmuSIMD::add(y_0_, unskew_2_minus_1))
+			);
+			return EmuSIMD::mul_all(result_, output_scale);
+		}
+
+	private:
+		[[nodiscard]] inline __m128 _corner_contribution(__m128i hash_, __m128 x_, __m128 y_) const
+		{
+			__m128 t_ = EmuSIMD::sub(falloff, EmuSIMD::mul_all(x_, x_));
+			t_ = EmuSIMD::sub(t_, EmuSIMD::mul_all(y_, y_));
+
+			// Corners beyond the falloff radius have no influence, so clamp t to 0 instead of branching
+			t_ = EmuSIMD::max(t_, EmuSIMD::setzero<__m128>());
+			t_ = EmuSIMD::mul_all(t_, t_);
+			t_ = EmuSIMD::mul_all(t_, t_);
+			return EmuSIMD::mul_all(t_, _gradient_dot(hash_, x_, y_));
+		}
+
+		/// <summary>
+		/// <para> Equivalent to `dot_with_scalar(gradients::values[hash_ & gradients::mask], x_, y_)` for each element, without storing hashes to look up gradients. </para>
+		/// <para> Gradients 0:3 are a single signed axis, and gradients 4:7 are the normalised signed sum of both axes. </para>
+		/// </summary>
+		[[nodiscard]] inline __m128 _gradient_dot(__m128i hash_, __m128 x_, __m128 y_) const
+		{
+			hash_ = EmuSIMD::bitwise_and(hash_, EmuSIMD::set1<__m128i, 32>(static_cast<std::int32_t>(gradients::mask)));
+			__m128 hash_fp_ = _mm_cvtepi32_ps(hash_);
+			__m128 lt_2_ = EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<__m128>(2.0f));
+			__m128 lt_4_ = EmuSIMD::cmplt(hash_fp_, EmuSIMD::set1<__m128>(4.0f));
+
+			// Bit 0 negates the first axis and bit 1 negates the second, by moving each into its offset's sign bit
+			__m128 sign_0_ = EmuSIMD::cast<__m128>(EmuSIMD::shift_left<31, 32>(hash_));
+			__m128 sign_1_ = EmuSIMD::cast<__m128>(EmuSIMD::shift_left<30, 32>(EmuSIMD::bitwise_and(hash_, EmuSIMD::set1<__m128i, 32>(2))));
+			__m128 signed_x_ = EmuSIMD::bitwise_xor(x_, sign_0_);
+
+			__m128 axis_ = EmuSIMD::blendv<32>(EmuSIMD::bitwise_xor(y_, sign_0_), signed_x_, lt_2_);
+			__m128 diagonal_ = EmuSIMD::mul_all(EmuSIMD::add(signed_x_, EmuSIMD::bitwise_xor(y_, sign_1_)), diagonal);
+			return EmuSIMD::blendv<32>(diagonal_, axis_, lt_4_);
+		}
+
+	public:
+		__m128 skew;
+		__m128 unskew;
+		__m128 unskew_2_minus_1;
+		__m128 falloff;
+		__m128 output_scale;
+		__m128 diagonal;
+		__m128 one;
+	};
+
+	/// <summary>
+	/// <para> Functor to produce 2-dimensional cellular (Worley) noise for every element of the provided registers. </para>
+	/// <para> Uses the CellularNoiseOutput and CellularNoiseDistance of the provided cellular NoiseType, and matches make_noise_2d for the same NoiseType. </para>
+	/// <para> All 9 cells neighbouring each point are evaluated, and nearest distances are reduced via min/max in registers so that every step is branchless across elements. </para>
+	/// <para> Produced noise is a distance in frequency-scaled lattice units, and is not remapped. Euclidean F1 outputs are typically within the range 0:1. </para>
+	/// </summary>
+	template<EmuMath::NoiseType NoiseType_, EmuConcepts::KnownSIMD SIMDRegister_>
+	requires(EmuMath::is_cellular_noise_type(NoiseType_) && EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>)
+	struct make_fast_noise_2d<NoiseType_, SIMDRegister_>
+	{
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		using int_register_type = typename EmuSIMD::TMP::register_as_integral<register_type>::type;
+		using scalar_fp = typename std::conditional
+		<
+			EmuCore::TMP::is_any_comparison_true<std::is_same, register_type, EmuSIMD::f32x4, EmuSIMD::f32x8, EmuSIMD::f32x16>::value,
+			float,
+			double
+		>::type;
+		static constexpr EmuMath::CellularNoiseOutput output = EmuMath::cellular_noise_output(NoiseType_);
+		static constexpr EmuMath::CellularNoiseDistance distance = EmuMath::cellular_noise_distance(NoiseType_);
+		static constexpr std::size_t per_element_width = EmuSIMD::TMP::determine_register_per_element_width<register_type>();
+		static constexpr bool is_signed = true;
+
+		inline make_fast_noise_2d() :
+			one(EmuSIMD::set1<register_type>(scalar_fp(1))),
+			max_distance(EmuSIMD::set1<register_type>(std::numeric_limits<scalar_fp>::max()))
+		{
+		}
+
+		[[nodiscard]] inline auto operator()
+		(
+			register_type points_x_,
+			register_type points_y_,
+			typename EmuSIMD::TMP::register_to_arg_type<register_type>::type freq_,
+			typename EmuSIMD::TMP::register_to_arg_type<int_register_type>::type permutations_mask_128_,
+			const EmuMath::NoisePermutations& permutations_
+		) -> register_type
+		{
+			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
+			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
+
+			register_type cell_x_ = EmuSIMD::floor(points_x_);
+			register_type cell_y_ = EmuSIMD::floor(points_y_);
+			int_register_type ix_ = EmuSIMD::bitwise_and(_to_int(cell_x_), permutations_mask_128_);
+			int_register_type iy_ = EmuSIMD::bitwise_and(_to_int(cell_y_), permutations_mask_128_);
+			register_type jitter_scale_ = EmuSIMD::div(one, EmuSIMD::add(_to_fp(permutations_mask_128_), one));
+
+			// Lattice indices and offsets of the 3 cells along each axis, from the cell before each point's cell to the cell after it
+			int_register_type one_i_ = _to_int(one);
+			int_register_type cells_x_[3] =
+			{
+				EmuSIMD::bitwise_and(EmuSIMD::sub<per_element_width>(ix_, one_i_), permutations_mask_128_),
+				ix_,
+				EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(ix_, one_i_), permutations_mask_128_)
+			};
+			int_register_type cells_y_[3] =
+			{
+				EmuSIMD::bitwise_and(EmuSIMD::sub<per_element_width>(iy_, one_i_), permutations_mask_128_),
+				iy_,
+				EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iy_, one_i_), permutations_mask_128_)
+			};
+			register_type offset_x_ = EmuSIMD::sub(cell_x_, points_x_);
+			register_type offset_y_ = EmuSIMD::sub(cell_y_, points_y_);
+			register_type offsets_x_[3] = { EmuSIMD::sub(offset_x_, one), offset_x_, EmuSIMD::add(offset_x_, one) };
+			register_type offsets_y_[3] = { EmuSIMD::sub(offset_y_, one), offset_y_, EmuSIMD::add(offset_y_, one) };
+
+			register_type f1_ = max_distance;
+			register_type f2_ = max_distance;
+			for (std::size_t cx_ = 0; cx_ < 3; ++cx_)
+			{
+				int_register_type perm_x_ = _lookup(permutations_, cells_x_[cx_]);
+				for (std::size_t cy_ = 0; cy_ < 3; ++cy_)
+				{
+					int_register_type hash_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perm_x_, cells_y_[cy_]));
+					_underlying_noise_gen::_fast_cellular_reduce
+					(
+						f1_,
+						f2_,
+						_underlying_noise_gen::_fast_cellular_distance<distance>
+						(
+							EmuSIMD::fmadd(_to_fp(_lookup(permutations_, hash_)), jitter_scale_, offsets_x_[cx_]),
+							EmuSIMD::fmadd(_to_fp(_lookup(permutations_, EmuSIMD::add<per_element_width>(hash_, one_i_))), jitter_scale_, offsets_y_[cy_])
+						)
+					);
+				}
+			}
+			return _underlying_noise_gen::_fast_cellular_noise_finish<output, distance>(f1_, f2_);
+		}
+
+	private:
+		[[nodiscard]] static inline int_register_type _to_int(typename EmuSIMD::TMP::register_as_arg_type<register_type>::type values_)
+		{
+			return EmuSIMD::convert<int_register_type, per_element_width, is_signed, per_element_width, is_signed>(values_);
+		}
+
+		[[nodiscard]] static inline register_type _to_fp(typename EmuSIMD::TMP::register_as_arg_type<int_register_type>::type values_)
+		{
+			return EmuSIMD::convert<register_type, per_element_width, is_signed, per_element_width, is_signed>(values_);
+		}
+
+		[[nodiscard]] static inline int_register_type _lookup(const EmuMath::NoisePermutations& permutations_, int_register_type indices_)
+		{
+			return _underlying_noise_gen::_fast_lookup_permutations<register_type>(permutations_, indices_);
+		}
+
+	public:
+		register_type one;
+		register_type max_distance;
+	};
 }
 
 
@@ -79,19 +79,33 @@ namespace EmuMath::Functors
 			int_register_type iy_128i_ = EmuSIMD::bitwise_and(EmuSIMD::convert<int_register_type, per_element_width, is_signed, per_element_width, is_signed>(points_y_), permutations_mask_128_);
 			int_register_type iz_128i_ = EmuSIMD::bitwise_and(EmuSIMD::convert<int_register_type, per_element_width, is_signed, per_element_width, is_signed>(points_z_), permutations_mask_128_);
 
-			EmuSIMD::store(iz_128i_, iz.data());
-			EmuSIMD::store(iy_128i_, iy.data());
-			EmuSIMD::store(ix_128i_, ix.data());
-
-			std::size_t mask_ = static_cast<std::size_t>(permutations_.HighestStoredValue());
-			for (std::size_t i = 0; i < num_elements_per_register; ++i)
+			if constexpr (_underlying_noise_gen::_fast_gather_supported_v<register_type>)
 			{
-				std::size_t perm_x_ = static_cast<std::size_t>(permutations_[ix[i]]);
-				std::size_t perm_xyz_ = (static_cast<std::size_t>(permutations_[(perm_x_ + iy[i]) & mask_]) + iz[i]) & mask_;
-				perms_fp[i] = static_cast<scalar_fp>(permutations_[perm_xyz_]);
+				int_register_type perms_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_128i_);
+				perms_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perms_, iy_128i_);
+				perms_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perms_, iz_128i_);
+
+				return EmuSIMD::div
+				(
+					EmuSIMD::convert<register_type, per_element_width, is_signed, per_element_width, is_signed>(perms_),
+					EmuSIMD::convert<register_type, per_element_width, is_signed, per_element_width, is_signed>(permutations_mask_128_)
+				);
+			}
+			else
+			{
+				EmuSIMD::store(iz_128i_, iz.data());
+				EmuSIMD::store(iy_128i_, iy.data());
+				EmuSIMD::store(ix_128i_, ix.data());
+
+				for (std::size_t i = 0; i < num_elements_per_register; ++i)
+				{
+					std::size_t perm_x_ = static_cast<std::size_t>(permutations_[ix[i]]);
+					std::size_t perm_xyz_ = static_cast<std::size_t>(permutations_[perm_x_ + iy[i]]) + iz[i];
+					perms_fp[i] = static_cast<scalar_fp>(permutations_[perm_xyz_]);
+				}
+
+				return EmuSIMD::div(EmuSIMD::load<register_type>(perms_fp.data()), EmuSIMD::convert<register_type, per_element_width, is_signed, per_element_width, is_signed>(permutations_mask_128_));
 			}
-
-			return EmuSIMD::div(EmuSIMD::load<register_type>(perms_fp.data()), EmuSIMD::convert<register_type, per_element_width, is_signed, per_element_width, is_signed>(permutations_mask_128_));
 		}
 
 	private:
@@ -163,58 +177,89 @@ namespace EmuMath::Functors
 			int_register_type iy_1_128i_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iy_0_128i_, one_128i_), permutations_mask_128_);
 			int_register_type ix_1_128i_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(ix_0_128i_, one_128i_), permutations_mask_128_);
 
-			// Store 0 indices
-			scalar_int ix_0_[num_elements_per_register];
-			scalar_int iy_0_[num_elements_per_register];
-			scalar_int iz_0_[num_elements_per_register];
-			EmuSIMD::store(ix_0_128i_, ix_0_);
-			EmuSIMD::store(iy_0_128i_, iy_0_);
-			EmuSIMD::store(iz_0_128i_, iz_0_);
-
-			// Store 1 indices
-			scalar_int ix_1_[num_elements_per_register];
-			scalar_int iy_1_[num_elements_per_register];
-			scalar_int iz_1_[num_elements_per_register];
-			EmuSIMD::store(ix_1_128i_, ix_1_);
-			EmuSIMD::store(iy_1_128i_, iy_1_);
-			EmuSIMD::store(iz_1_128i_, iz_1_);
-
-			scalar_fp perms_000_[num_elements_per_register];
-			scalar_fp perms_001_[num_elements_per_register];
-			scalar_fp perms_010_[num_elements_per_register];
-			scalar_fp perms_011_[num_elements_per_register];
-			scalar_fp perms_100_[num_elements_per_register];
-			scalar_fp perms_101_[num_elements_per_register];
-			scalar_fp perms_110_[num_elements_per_register];
-			scalar_fp perms_111_[num_elements_per_register];
-			std::size_t mask_ = permutations_.HighestStoredValue();
-
-			for (std::size_t i = 0; i < num_elements_per_register; ++i)
+			register_type perms_000_, perms_001_, perms_010_, perms_011_, perms_100_, perms_101_, perms_110_, perms_111_;
+			if constexpr (_underlying_noise_gen::_fast_gather_supported_v<register_type>)
 			{
-				// Forced store as size_t so we can handle width changes if EmuMath::NoisePermutationValue is not size_t width
-				std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_[i]]);
-				std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_[i]]);
-
-				std::size_t perm_00_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_0_[i]) & mask_]);
-				std::size_t perm_01_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_1_[i]) & mask_]);
-				std::size_t perm_10_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_0_[i]) & mask_]);
-				std::size_t perm_11_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_1_[i]) & mask_]);
-
-				perms_000_[i] = static_cast<scalar_fp>(permutations_[(perm_00_ + iz_0_[i]) & mask_]);
-				perms_001_[i] = static_cast<scalar_fp>(permutations_[(perm_00_ + iz_1_[i]) & mask_]);
-				perms_010_[i] = static_cast<scalar_fp>(permutations_[(perm_01_ + iz_0_[i]) & mask_]);
-				perms_011_[i] = static_cast<scalar_fp>(permutations_[(perm_01_ + iz_1_[i]) & mask_]);
-				perms_100_[i] = static_cast<scalar_fp>(permutations_[(perm_10_ + iz_0_[i]) & mask_]);
-				perms_101_[i] = static_cast<scalar_fp>(permutations_[(perm_10_ + iz_1_[i]) & mask_]);
-				perms_110_[i] = static_cast<scalar_fp>(permutations_[(perm_11_ + iz_0_[i]) & mask_]);
-				perms_111_[i] = static_cast<scalar_fp>(permutations_[(perm_11_ + iz_1_[i]) & mask_]);
+				int_register_type perm_0_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_0_128i_);
+				int_register_type perm_1_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_1_128i_);
+
+				int_register_type perm_00_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_0_, iy_0_128i_);
+				int_register_type perm_01_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_0_, iy_1_128i_);
+				int_register_type perm_10_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_1_, iy_0_128i_);
+				int_register_type perm_11_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_1_, iy_1_128i_);
+
+				perms_000_ = _to_fp(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_00_, iz_0_128i_));
+				perms_001_ = _to_fp(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_00_, iz_1_128i_));
+				perms_010_ = _to_fp(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_01_, iz_0_128i_));
+				perms_011_ = _to_fp(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_01_, iz_1_128i_));
+				perms_100_ = _to_fp(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_10_, iz_0_128i_));
+				perms_101_ = _to_fp(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_10_, iz_1_128i_));
+				perms_110_ = _to_fp(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_11_, iz_0_128i_));
+				perms_111_ = _to_fp(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_11_, iz_1_128i_));
+			}
+			else
+			{
+				// Store 0 indices
+				scalar_int ix_0_[num_elements_per_register];
+				scalar_int iy_0_[num_elements_per_register];
+				scalar_int iz_0_[num_elements_per_register];
+				EmuSIMD::store(ix_0_128i_, ix_0_);
+				EmuSIMD::store(iy_0_128i_, iy_0_);
+				EmuSIMD::store(iz_0_128i_, iz_0_);
+
+				// Store 1 indices
+				scalar_int ix_1_[num_elements_per_register];
+				scalar_int iy_1_[num_elements_per_register];
+				scalar_int iz_1_[num_elements_per_register];
+				EmuSIMD::store(ix_1_128i_, ix_1_);
+				EmuSIMD::store(iy_1_128i_, iy_1_);
+				EmuSIMD::store(iz_1_128i_, iz_1_);
+
+				scalar_fp perms_000_fp_[num_elements_per_register];
+				scalar_fp perms_001_fp_[num_elements_per_register];
+				scalar_fp perms_010_fp_[num_elements_per_register];
+				scalar_fp perms_011_fp_[num_elements_per_register];
+				scalar_fp perms_100_fp_[num_elements_per_register];
+				scalar_fp perms_101_fp_[num_elements_per_register];
+				scalar_fp perms_110_fp_[num_elements_per_register];
+				scalar_fp perms_111_fp_[num_elements_per_register];
+
+				for (std::size_t i = 0; i < num_elements_per_register; ++i)
+				{
+					// Forced store as size_t so we can handle width changes if EmuMath::NoisePermutationValue is not size_t width
+					std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_[i]]);
+					std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_[i]]);
+
+					std::size_t perm_00_ = static_cast<std::size_t>(permutations_[perm_0_ + iy_0_[i]]);
+					std::size_t perm_01_ = static_cast<std::size_t>(permutations_[perm_0_ + iy_1_[i]]);
+					std::size_t perm_10_ = static_cast<std::size_t>(permutations_[perm_1_ + iy_0_[i]]);
+					std::size_t perm_11_ = static_cast<std::size_t>(permutations_[perm_1_ + iy_1_[i]]);
+
+					perms_000_fp_[i] = static_cast<scalar_fp>(permutations_[perm_00_ + iz_0_[i]]);
+					perms_001_fp_[i] = static_cast<scalar_fp>(permutations_[perm_00_ + iz_1_[i]]);
+					perms_010_fp_[i] = static_cast<scalar_fp>(permutations_[perm_01_ + iz_0_[i]]);
+					perms_011_fp_[i] = static_cast<scalar_fp>(permutations_[perm_01_ + iz_1_[i]]);
+					perms_100_fp_[i] = static_cast<scalar_fp>(permutations_[perm_10_ + iz_0_[i]]);
+					perms_101_fp_[i] = static_cast<scalar_fp>(permutations_[perm_10_ + iz_1_[i]]);
+					perms_110_fp_[i] = static_cast<scalar_fp>(permutations_[perm_11_ + iz_0_[i]]);
+					perms_111_fp_[i] = static_cast<scalar_fp>(permutations_[perm_11_ + iz_1_[i]]);
+				}
+
+				perms_000_ = EmuSIMD::load<register_type>(perms_000_fp_);
+				perms_001_ = EmuSIMD::load<register_type>(perms_001_fp_);
+				perms_010_ = EmuSIMD::load<register_type>(perms_010_fp_);
+				perms_011_ = EmuSIMD::load<register_type>(perms_011_fp_);
+				perms_100_ = EmuSIMD::load<register_type>(perms_100_fp_);
+				perms_101_ = EmuSIMD::load<register_type>(perms_101_fp_);
+				perms_110_ = EmuSIMD::load<register_type>(perms_110_fp_);
+				perms_111_ = EmuSIMD::load<register_type>(perms_111_fp_);
 			}
 
 			// X-lerps
-			register_type lerp_0_ = EmuSIMD::fused_lerp(EmuSIMD::load<register_type>(perms_000_), EmuSIMD::load<register_type>(perms_100_), tx_);
-			register_type lerp_1_ = EmuSIMD::fused_lerp(EmuSIMD::load<register_type>(perms_010_), EmuSIMD::load<register_type>(perms_110_), tx_);
-			register_type lerp_2_ = EmuSIMD::fused_lerp(EmuSIMD::load<register_type>(perms_001_), EmuSIMD::load<register_type>(perms_101_), tx_);
-			register_type lerp_3_ = EmuSIMD::fused_lerp(EmuSIMD::load<register_type>(perms_011_), EmuSIMD::load<register_type>(perms_111_), tx_);
+			register_type lerp_0_ = EmuSIMD::fused_lerp(perms_000_, perms_100_, tx_);
+			register_type lerp_1_ = EmuSIMD::fused_lerp(perms_010_, perms_110_, tx_);
+			register_type lerp_2_ = EmuSIMD::fused_lerp(perms_001_, perms_101_, tx_);
+			register_type lerp_3_ = EmuSIMD::fused_lerp(perms_011_, perms_111_, tx_);
 
 			// Y-lerps
 			lerp_0_ = EmuSIMD::fused_lerp(lerp_0_, lerp_1_, ty_);
@@ -224,6 +269,13 @@ namespace EmuMath::Functors
 			return EmuSIMD::div(EmuSIMD::fused_lerp(lerp_0_, lerp_2_, tz_), EmuSIMD::convert<register_type, per_element_width, is_signed, per_element_width, is_signed>(permutations_mask_128_));
 		}
 
+	private:
+		[[nodiscard]] static inline register_type _to_fp(typename EmuSIMD::TMP::register_as_arg_type<int_register_type>::type perms_)
+		{
+			return EmuSIMD::convert<register_type, per_element_width, is_signed, per_element_width, is_signed>(perms_);
+		}
+
+	public:
 		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<register_type> smooth_t;
 	};
 
@@ -253,6 +305,14 @@ namespace EmuMath::Functors
 			iy_1(),
 			iz_0(),
 			iz_1(),
+			perm_000(),
+			perm_001(),
+			perm_010(),
+			perm_011(),
+			perm_100(),
+			perm_101(),
+			perm_110(),
+			perm_111(),
 			_gradients_128(gradients::template init_registers<_duplicate_gradient_index>())
 		{
 		}
@@ -303,22 +363,14 @@ namespace EmuMath::Functors
 			int_register_type iy_1_128_ = EmuSIMD::bitwise_and(permutations_mask_128_, EmuSIMD::add<per_element_width>(iy_0_128_, one_128i_));
 			int_register_type iz_1_128_ = EmuSIMD::bitwise_and(permutations_mask_128_, EmuSIMD::add<per_element_width>(iz_0_128_, one_128i_));
 
-			// Store last calculated values first for best chance at a cache hit
-			EmuSIMD::store(iz_1_128_, iz_1.data());
-			EmuSIMD::store(iz_0_128_, iz_0.data());
-
-			EmuSIMD::store(iy_1_128_, iy_1.data());
-			EmuSIMD::store(iy_0_128_, iy_0.data());
-
-			EmuSIMD::store(ix_1_128_, ix_1.data());
-			EmuSIMD::store(ix_0_128_, ix_0.data());
+			// Hash the permutations of all corners to find the index of the gradient used for each
+			_find_gradient_indices(permutations_, ix_0_128_, ix_1_128_, iy_0_128_, iy_1_128_, iz_0_128_, iz_1_128_);
 
 			// Find the gradients we'll be making use of in interpolations
 			// --- No benefit from manually inlining this part within the function in release, so best to just keep this function cleaner
 			register_type vals_000_, vals_001_, vals_010_, vals_011_, vals_100_, vals_101_, vals_110_, vals_111_;
 			_calculate_values_to_lerp
 			(
-				permutations_,
 				tx_0_128_,
 				ty_0_128_,
 				tz_0_128_,
@@ -356,9 +408,76 @@ namespace EmuMath::Functors
 		}
 
 	private:
-		inline void _calculate_values_to_lerp
+		inline void _find_gradient_indices
 		(
 			const EmuMath::NoisePermutations& permutations_,
+			int_register_type ix_0_,
+			int_register_type ix_1_,
+			int_register_type iy_0_,
+			int_register_type iy_1_,
+			int_register_type iz_0_,
+			int_register_type iz_1_
+		)
+		{
+			if constexpr (_underlying_noise_gen::_fast_gather_supported_v<register_type>)
+			{
+				int_register_type gradients_mask_ = EmuSIMD::set1<int_register_type, per_element_width>(static_cast<std::int32_t>(gradients::mask));
+				int_register_type perm_0_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_0_);
+				int_register_type perm_1_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_1_);
+
+				int_register_type perm_00_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_0_, iy_0_);
+				int_register_type perm_01_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_0_, iy_1_);
+				int_register_type perm_10_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_1_, iy_0_);
+				int_register_type perm_11_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_1_, iy_1_);
+
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_00_, iz_0_), gradients_mask_), perm_000.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_00_, iz_1_), gradients_mask_), perm_001.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_01_, iz_0_), gradients_mask_), perm_010.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_01_, iz_1_), gradients_mask_), perm_011.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_10_, iz_0_), gradients_mask_), perm_100.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_10_, iz_1_), gradients_mask_), perm_101.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_11_, iz_0_), gradients_mask_), perm_110.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_11_, iz_1_), gradients_mask_), perm_111.data());
+			}
+			else
+			{
+				// Store last calculated values first for best chance at a cache hit
+				EmuSIMD::store(iz_1_, iz_1.data());
+				EmuSIMD::store(iz_0_, iz_0.data());
+
+				EmuSIMD::store(iy_1_, iy_1.data());
+				EmuSIMD::store(iy_0_, iy_0.data());
+
+				EmuSIMD::store(ix_1_, ix_1.data());
+				EmuSIMD::store(ix_0_, ix_0.data());
+
+				std::size_t perm_0_, perm_1_, perm_00_, perm_01_, perm_10_, perm_11_;
+
+				// One permutation per value per item; since we're working with 4 outputs, this means we need to loop 4 times
+				for (std::size_t i = 0; i < num_elements_in_register; ++i)
+				{
+					perm_0_ = static_cast<std::size_t>(permutations_[ix_0[i]]);
+					perm_1_ = static_cast<std::size_t>(permutations_[ix_1[i]]);
+
+					perm_00_ = static_cast<std::size_t>(permutations_[perm_0_ + iy_0[i]]);
+					perm_01_ = static_cast<std::size_t>(permutations_[perm_0_ + iy_1[i]]);
+					perm_10_ = static_cast<std::size_t>(permutations_[perm_1_ + iy_0[i]]);
+					perm_11_ = static_cast<std::size_t>(permutations_[perm_1_ + iy_1[i]]);
+
+					perm_000[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_00_ + iz_0[i]]) & gradients::mask);
+					perm_001[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_00_ + iz_1[i]]) & gradients::mask);
+					perm_010[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_01_ + iz_0[i]]) & gradients::mask);
+					perm_011[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_01_ + iz_1[i]]) & gradients::mask);
+					perm_100[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_10_ + iz_0[i]]) & gradients::mask);
+					perm_101[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_10_ + iz_1[i]]) & gradients::mask);
+					perm_110[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_11_ + iz_0[i]]) & gradients::mask);
+					perm_111[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_11_ + iz_1[i]]) & gradients::mask);
+				}
+			}
+		}
+
+		inline void _calculate_values_to_lerp
+		(
 			typename EmuSIMD::TMP::register_as_arg_type<register_type>::type tx_0_,
 			typename EmuSIMD::TMP::register_as_arg_type<register_type>::type ty_0_,
 			typename EmuSIMD::TMP::register_as_arg_type<register_type>::type tz_0_,
@@ -375,45 +494,12 @@ namespace EmuMath::Functors
 			register_type& vals_111_
 		)
 		{
-			// Find our permutation values; all will be initialised in the upcoming loop
-			std::size_t perm_000_[num_elements_in_register];
-			std::size_t perm_001_[num_elements_in_register];
-			std::size_t perm_010_[num_elements_in_register];
-			std::size_t perm_011_[num_elements_in_register];
-			std::size_t perm_100_[num_elements_in_register];
-			std::size_t perm_101_[num_elements_in_register];
-			std::size_t perm_110_[num_elements_in_register];
-			std::size_t perm_111_[num_elements_in_register];
-			std::size_t perm_0_, perm_1_, perm_00_, perm_01_, perm_10_, perm_11_;
-			std::size_t mask_ = static_cast<std::size_t>(permutations_.HighestStoredValue());
-
-			// One permutation per value per item; since we're working with 4 outputs, this means we need to loop 4 times
-			for (std::size_t i = 0; i < num_elements_in_register; ++i)
-			{
-				perm_0_ = static_cast<std::size_t>(permutations_[ix_0[i]]);
-				perm_1_ = static_cast<std::size_t>(permutations_[ix_1[i]]);
-
-				perm_00_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_0[i]) & mask_]);
-				perm_01_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_1[i]) & mask_]);
-				perm_10_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_0[i]) & mask_]);
-				perm_11_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_1[i]) & mask_]);
-
-				perm_000_[i] = static_cast<std::size_t>(permutations_[(perm_00_ + iz_0[i]) & mask_]) & gradients::mask;
-				perm_001_[i] = static_cast<std::size_t>(permutations_[(perm_00_ + iz_1[i]) & mask_]) & gradients::mask;
-				perm_010_[i] = static_cast<std::size_t>(permutations_[(perm_01_ + iz_0[i]) & mask_]) & gradients::mask;
-				perm_011_[i] = static_cast<std::size_t>(permutations_[(perm_01_ + iz_1[i]) & mask_]) & gradients::mask;
-				perm_100_[i] = static_cast<std::size_t>(permutations_[(perm_10_ + iz_0[i]) & mask_]) & gradients::mask;
-				perm_101_[i] = static_cast<std::size_t>(permutations_[(perm_10_ + iz_1[i]) & mask_]) & gradients::mask;
-				perm_110_[i] = static_cast<std::size_t>(permutations_[(perm_11_ + iz_0[i]) & mask_]) & gradients::mask;
-				perm_111_[i] = static_cast<std::size_t>(permutations_[(perm_11_ + iz_1[i]) & mask_]) & gradients::mask;
-			}
-
 			// Use discovered permutations to form gradient dot products for our output values
 			// 000
-			register_type gradient_0_ = _gradients_128[perm_000_[0]];
-			register_type gradient_1_ = _gradients_128[perm_000_[1]];
-			register_type gradient_2_ = _gradients_128[perm_000_[2]];
-			register_type gradient_3_ = _gradients_128[perm_000_[3]];
+			register_type gradient_0_ = _gradients_128[perm_000[0]];
+			register_type gradient_1_ = _gradients_128[perm_000[1]];
+			register_type gradient_2_ = _gradients_128[perm_000[2]];
+			register_type gradient_3_ = _gradients_128[perm_000[3]];
 			
 			// X - Pre-store the Y components in the indices [1] and [3] from each temp shuffle
 			register_type temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -434,10 +520,10 @@ namespace EmuMath::Functors
 			
 			// ABOVE COMMENTS APPLY TO SUBSEQUENT OUTPUTS
 			// 001
-			gradient_0_ = _gradients_128[perm_001_[0]];
-			gradient_1_ = _gradients_128[perm_001_[1]];
-			gradient_2_ = _gradients_128[perm_001_[2]];
-			gradient_3_ = _gradients_128[perm_001_[3]];
+			gradient_0_ = _gradients_128[perm_001[0]];
+			gradient_1_ = _gradients_128[perm_001[1]];
+			gradient_2_ = _gradients_128[perm_001[2]];
+			gradient_3_ = _gradients_128[perm_001[3]];
 			
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -456,10 +542,10 @@ namespace EmuMath::Functors
 			vals_001_ = EmuSIMD::add(vals_001_, EmuSIMD::mul_all(row_, tz_1_));
 			
 			// 010
-			gradient_0_ = _gradients_128[perm_010_[0]];
-			gradient_1_ = _gradients_128[perm_010_[1]];
-			gradient_2_ = _gradients_128[perm_010_[2]];
-			gradient_3_ = _gradients_128[perm_010_[3]];
+			gradient_0_ = _gradients_128[perm_010[0]];
+			gradient_1_ = _gradients_128[perm_010[1]];
+			gradient_2_ = _gradients_128[perm_010[2]];
+			gradient_3_ = _gradients_128[perm_010[3]];
 			
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -478,10 +564,10 @@ namespace EmuMath::Functors
 			vals_010_ = EmuSIMD::add(vals_010_, EmuSIMD::mul_all(row_, tz_0_));
 			
 			// 011
-			gradient_0_ = _gradients_128[perm_011_[0]];
-			gradient_1_ = _gradients_128[perm_011_[1]];
-			gradient_2_ = _gradients_128[perm_011_[2]];
-			gradient_3_ = _gradients_128[perm_011_[3]];
+			gradient_0_ = _gradients_128[perm_011[0]];
+			gradient_1_ = _gradients_128[perm_011[1]];
+			gradient_2_ = _gradients_128[perm_011[2]];
+			gradient_3_ = _gradients_128[perm_011[3]];
 			
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -500,10 +586,10 @@ namespace EmuMath::Functors
 			vals_011_ = EmuSIMD::add(vals_011_, EmuSIMD::mul_all(row_, tz_1_));
 			
 			// 100
-			gradient_0_ = _gradients_128[perm_100_[0]];
-			gradient_1_ = _gradients_128[perm_100_[1]];
-			gradient_2_ = _gradients_128[perm_100_[2]];
-			gradient_3_ = _gradients_128[perm_100_[3]];
+			gradient_0_ = _gradients_128[perm_100[0]];
+			gradient_1_ = _gradients_128[perm_100[1]];
+			gradient_2_ = _gradients_128[perm_100[2]];
+			gradient_3_ = _gradients_128[perm_100[3]];
 			
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -522,10 +608,10 @@ namespace EmuMath::Functors
 			vals_100_ = EmuSIMD::add(vals_100_, EmuSIMD::mul_all(row_, tz_0_));
 			
 			// 101
-			gradient_0_ = _gradients_128[perm_101_[0]];
-			gradient_1_ = _gradients_128[perm_101_[1]];
-			gradient_2_ = _gradients_128[perm_101_[2]];
-			gradient_3_ = _gradients_128[perm_101_[3]];
+			gradient_0_ = _gradients_128[perm_101[0]];
+			gradient_1_ = _gradients_128[perm_101[1]];
+			gradient_2_ = _gradients_128[perm_101[2]];
+			gradient_3_ = _gradients_128[perm_101[3]];
 			
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -544,10 +630,10 @@ namespace EmuMath::Functors
 			vals_101_ = EmuSIMD::add(vals_101_, EmuSIMD::mul_all(row_, tz_1_));
 			
 			// 110
-			gradient_0_ = _gradients_128[perm_110_[0]];
-			gradient_1_ = _gradients_128[perm_110_[1]];
-			gradient_2_ = _gradients_128[perm_110_[2]];
-			gradient_3_ = _gradients_128[perm_110_[3]];
+			gradient_0_ = _gradients_128[perm_110[0]];
+			gradient_1_ = _gradients_128[perm_110[1]];
+			gradient_2_ = _gradients_128[perm_110[2]];
+			gradient_3_ = _gradients_128[perm_110[3]];
 			
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -566,10 +652,10 @@ namespace EmuMath::Functors
 			vals_110_ = EmuSIMD::add(vals_110_, EmuSIMD::mul_all(row_, tz_0_));
 			
 			// 111
-			gradient_0_ = _gradients_128[perm_111_[0]];
-			gradient_1_ = _gradients_128[perm_111_[1]];
-			gradient_2_ = _gradients_128[perm_111_[2]];
-			gradient_3_ = _gradients_128[perm_111_[3]];
+			gradient_0_ = _gradients_128[perm_111[0]];
+			gradient_1_ = _gradients_128[perm_111[1]];
+			gradient_2_ = _gradients_128[perm_111[2]];
+			gradient_3_ = _gradients_128[perm_111[3]];
 			
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -595,6 +681,14 @@ namespace EmuMath::Functors
 		std::array<int, num_elements_in_register> iy_1;
 		std::array<int, num_elements_in_register> iz_0;
 		std::array<int, num_elements_in_register> iz_1;
+		std::array<int, num_elements_in_register> perm_000;
+		std::array<int, num_elements_in_register> perm_001;
+		std::array<int, num_elements_in_register> perm_010;
+		std::array<int, num_elements_in_register> perm_011;
+		std::array<int, num_elements_in_register> perm_100;
+		std::array<int, num_elements_in_register> perm_101;
+		std::array<int, num_elements_in_register> perm_110;
+		std::array<int, num_elements_in_register> perm_111;
 		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<register_type> smooth_t;
 	};
 
@@ -624,6 +718,14 @@ namespace EmuMath::Functors
 			iy_1(),
 			iz_0(),
 			iz_1(),
+			perm_000(),
+			perm_001(),
+			perm_010(),
+			perm_011(),
+			perm_100(),
+			perm_101(),
+			perm_110(),
+			perm_111(),
 			_gradients_128(gradients::template init_registers<_duplicate_gradient_index>())
 		{
 		}
@@ -674,22 +776,14 @@ namespace EmuMath::Functors
 			int_register_type iy_1_128_ = EmuSIMD::bitwise_and(permutations_mask_128_, EmuSIMD::add<per_element_width>(iy_0_128_, one_128i_));
 			int_register_type iz_1_128_ = EmuSIMD::bitwise_and(permutations_mask_128_, EmuSIMD::add<per_element_width>(iz_0_128_, one_128i_));
 
-			// Store last calculated values first for best chance at a cache hit
-			EmuSIMD::store(iz_1_128_, iz_1.data());
-			EmuSIMD::store(iz_0_128_, iz_0.data());
-
-			EmuSIMD::store(iy_1_128_, iy_1.data());
-			EmuSIMD::store(iy_0_128_, iy_0.data());
-
-			EmuSIMD::store(ix_1_128_, ix_1.data());
-			EmuSIMD::store(ix_0_128_, ix_0.data());
+			// Hash the permutations of all corners to find the index of the gradient used for each
+			_find_gradient_indices(permutations_, ix_0_128_, ix_1_128_, iy_0_128_, iy_1_128_, iz_0_128_, iz_1_128_);
 
 			// Find the gradients we'll be making use of in interpolations
 			// --- No benefit from manually inlining this part within the function in release, so best to just keep this function cleaner
 			register_type vals_000_, vals_001_, vals_010_, vals_011_, vals_100_, vals_101_, vals_110_, vals_111_;
 			_calculate_values_to_lerp
 			(
-				permutations_,
 				tx_0_128_,
 				ty_0_128_,
 				tz_0_128_,
@@ -727,9 +821,76 @@ namespace EmuMath::Functors
 		}
 
 	private:
-		inline void _calculate_values_to_lerp
+		inline void _find_gradient_indices
 		(
 			const EmuMath::NoisePermutations& permutations_,
+			int_register_type ix_0_,
+			int_register_type ix_1_,
+			int_register_type iy_0_,
+			int_register_type iy_1_,
+			int_register_type iz_0_,
+			int_register_type iz_1_
+		)
+		{
+			if constexpr (_underlying_noise_gen::_fast_gather_supported_v<register_type>)
+			{
+				int_register_type gradients_mask_ = EmuSIMD::set1<int_register_type, per_element_width>(static_cast<std::int32_t>(gradients::mask));
+				int_register_type perm_0_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_0_);
+				int_register_type perm_1_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_1_);
+
+				int_register_type perm_00_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_0_, iy_0_);
+				int_register_type perm_01_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_0_, iy_1_);
+				int_register_type perm_10_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_1_, iy_0_);
+				int_register_type perm_11_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_1_, iy_1_);
+
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_00_, iz_0_), gradients_mask_), perm_000.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_00_, iz_1_), gradients_mask_), perm_001.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_01_, iz_0_), gradients_mask_), perm_010.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_01_, iz_1_), gradients_mask_), perm_011.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_10_, iz_0_), gradients_mask_), perm_100.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_10_, iz_1_), gradients_mask_), perm_101.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_11_, iz_0_), gradients_mask_), perm_110.data());
+				EmuSIMD::store(EmuSIMD::bitwise_and(_underlying_noise_gen::_fast_permutation_hash_step(permutations_, perm_11_, iz_1_), gradients_mask_), perm_111.data());
+			}
+			else
+			{
+				// Store last calculated values first for best chance at a cache hit
+				EmuSIMD::store(iz_1_, iz_1.data());
+				EmuSIMD::store(iz_0_, iz_0.data());
+
+				EmuSIMD::store(iy_1_, iy_1.data());
+				EmuSIMD::store(iy_0_, iy_0.data());
+
+				EmuSIMD::store(ix_1_, ix_1.data());
+				EmuSIMD::store(ix_0_, ix_0.data());
+
+				std::size_t perm_0_, perm_1_, perm_00_, perm_01_, perm_10_, perm_11_;
+
+				// One permutation per value per item; since we're working with 4 outputs, this means we need to loop 4 times
+				for (std::size_t i = 0; i < num_elements_in_register; ++i)
+				{
+					perm_0_ = static_cast<std::size_t>(permutations_[ix_0[i]]);
+					perm_1_ = static_cast<std::size_t>(permutations_[ix_1[i]]);
+
+					perm_00_ = static_cast<std::size_t>(permutations_[perm_0_ + iy_0[i]]);
+					perm_01_ = static_cast<std::size_t>(permutations_[perm_0_ + iy_1[i]]);
+					perm_10_ = static_cast<std::size_t>(permutations_[perm_1_ + iy_0[i]]);
+					perm_11_ = static_cast<std::size_t>(permutations_[perm_1_ + iy_1[i]]);
+
+					perm_000[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_00_ + iz_0[i]]) & gradients::mask);
+					perm_001[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_00_ + iz_1[i]]) & gradients::mask);
+					perm_010[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_01_ + iz_0[i]]) & gradients::mask);
+					perm_011[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_01_ + iz_1[i]]) & gradients::mask);
+					perm_100[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_10_ + iz_0[i]]) & gradients::mask);
+					perm_101[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_10_ + iz_1[i]]) & gradients::mask);
+					perm_110[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_11_ + iz_0[i]]) & gradients::mask);
+					perm_111[i] = static_cast<int>(static_cast<std::size_t>(permutations_[perm_11_ + iz_1[i]]) & gradients::mask);
+				}
+			}
+		}
+
+		inline void _calculate_values_to_lerp
+		(
 			typename EmuSIMD::TMP::register_as_arg_type<register_type>::type tx_0_,
 			typename EmuSIMD::TMP::register_as_arg_type<register_type>::type ty_0_,
 			typename EmuSIMD::TMP::register_as_arg_type<register_type>::type tz_0_,
@@ -746,49 +907,16 @@ namespace EmuMath::Functors
 			register_type& vals_111_
 		)
 		{
-			// Find our permutation values; all will be initialised in the upcoming loop
-			std::size_t perm_000_[num_elements_in_register];
-			std::size_t perm_001_[num_elements_in_register];
-			std::size_t perm_010_[num_elements_in_register];
-			std::size_t perm_011_[num_elements_in_register];
-			std::size_t perm_100_[num_elements_in_register];
-			std::size_t perm_101_[num_elements_in_register];
-			std::size_t perm_110_[num_elements_in_register];
-			std::size_t perm_111_[num_elements_in_register];
-			std::size_t perm_0_, perm_1_, perm_00_, perm_01_, perm_10_, perm_11_;
-			std::size_t mask_ = static_cast<std::size_t>(permutations_.HighestStoredValue());
-
-			// One permutation per value per item; since we're working with 4 outputs, this means we need to loop 4 times
-			for (std::size_t i = 0; i < num_elements_in_register; ++i)
-			{
-				perm_0_ = static_cast<std::size_t>(permutations_[ix_0[i]]);
-				perm_1_ = static_cast<std::size_t>(permutations_[ix_1[i]]);
-
-				perm_00_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_0[i]) & mask_]);
-				perm_01_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_1[i]) & mask_]);
-				perm_10_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_0[i]) & mask_]);
-				perm_11_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_1[i]) & mask_]);
-
-				perm_000_[i] = static_cast<std::size_t>(permutations_[(perm_00_ + iz_0[i]) & mask_]) & gradients::mask;
-				perm_001_[i] = static_cast<std::size_t>(permutations_[(perm_00_ + iz_1[i]) & mask_]) & gradients::mask;
-				perm_010_[i] = static_cast<std::size_t>(permutations_[(perm_01_ + iz_0[i]) & mask_]) & gradients::mask;
-				perm_011_[i] = static_cast<std::size_t>(permutations_[(perm_01_ + iz_1[i]) & mask_]) & gradients::mask;
-				perm_100_[i] = static_cast<std::size_t>(permutations_[(perm_10_ + iz_0[i]) & mask_]) & gradients::mask;
-				perm_101_[i] = static_cast<std::size_t>(permutations_[(perm_10_ + iz_1[i]) & mask_]) & gradients::mask;
-				perm_110_[i] = static_cast<std::size_t>(permutations_[(perm_11_ + iz_0[i]) & mask_]) & gradients::mask;
-				perm_111_[i] = static_cast<std::size_t>(permutations_[(perm_11_ + iz_1[i]) & mask_]) & gradients::mask;
-			}
-
 			// Use discovered permutations to form gradient dot products for our output values
 			// 000
-			register_type gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_000_[0]]);
-			register_type gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_000_[1]]);
-			register_type gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_000_[2]]);
-			register_type gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_000_[3]]);
-			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_000_[4]], 1);
-			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_000_[5]], 1);
-			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_000_[6]], 1);
-			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_000_[7]], 1);
+			register_type gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_000[0]]);
+			register_type gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_000[1]]);
+			register_type gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_000[2]]);
+			register_type gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_000[3]]);
+			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_000[4]], 1);
+			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_000[5]], 1);
+			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_000[6]], 1);
+			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_000[7]], 1);
 			
 			// X - Pre-store the Y components in the indices [1] and [3] from each temp shuffle
 			register_type temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -809,14 +937,14 @@ namespace EmuMath::Functors
 			
 			// ABOVE COMMENTS APPLY TO SUBSEQUENT OUTPUTS
 			// 001
-			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_001_[0]]);
-			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_001_[1]]);
-			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_001_[2]]);
-			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_001_[3]]);
-			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_001_[4]], 1);
-			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_001_[5]], 1);
-			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_001_[6]], 1);
-			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_001_[7]], 1);
+			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_001[0]]);
+			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_001[1]]);
+			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_001[2]]);
+			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_001[3]]);
+			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_001[4]], 1);
+			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_001[5]], 1);
+			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_001[6]], 1);
+			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_001[7]], 1);
 			
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -835,14 +963,14 @@ namespace EmuMath::Functors
 			vals_001_ = EmuSIMD::add(vals_001_, EmuSIMD::mul_all(row_, tz_1_));
 			
 			// 010
-			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_010_[0]]);
-			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_010_[1]]);
-			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_010_[2]]);
-			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_010_[3]]);
-			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_010_[4]], 1);
-			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_010_[5]], 1);
-			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_010_[6]], 1);
-			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_010_[7]], 1);
+			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_010[0]]);
+			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_010[1]]);
+			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_010[2]]);
+			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_010[3]]);
+			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_010[4]], 1);
+			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_010[5]], 1);
+			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_010[6]], 1);
+			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_010[7]], 1);
 			
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -861,14 +989,14 @@ namespace EmuMath::Functors
 			vals_010_ = EmuSIMD::add(vals_010_, EmuSIMD::mul_all(row_, tz_0_));
 			
 			// 011
-			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_011_[0]]);
-			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_011_[1]]);
-			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_011_[2]]);
-			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_011_[3]]);
-			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_011_[4]], 1);
-			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_011_[5]], 1);
-			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_011_[6]], 1);
-			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_011_[7]], 1);
+			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_011[0]]);
+			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_011[1]]);
+			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_011[2]]);
+			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_011[3]]);
+			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_011[4]], 1);
+			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_011[5]], 1);
+			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_011[6]], 1);
+			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_011[7]], 1);
 
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -887,14 +1015,14 @@ namespace EmuMath::Functors
 			vals_011_ = EmuSIMD::add(vals_011_, EmuSIMD::mul_all(row_, tz_1_));
 
 			// 100
-			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_100_[0]]);
-			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_100_[1]]);
-			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_100_[2]]);
-			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_100_[3]]);
-			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_100_[4]], 1);
-			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_100_[5]], 1);
-			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_100_[6]], 1);
-			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_100_[7]], 1);
+			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_100[0]]);
+			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_100[1]]);
+			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_100[2]]);
+			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_100[3]]);
+			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_100[4]], 1);
+			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_100[5]], 1);
+			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_100[6]], 1);
+			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_100[7]], 1);
 
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -913,14 +1041,14 @@ namespace EmuMath::Functors
 			vals_100_ = EmuSIMD::add(vals_100_, EmuSIMD::mul_all(row_, tz_0_));
 
 			// 101
-			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_101_[0]]);
-			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_101_[1]]);
-			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_101_[2]]);
-			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_101_[3]]);
-			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_101_[4]], 1);
-			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_101_[5]], 1);
-			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_101_[6]], 1);
-			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_101_[7]], 1);
+			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_101[0]]);
+			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_101[1]]);
+			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_101[2]]);
+			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_101[3]]);
+			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_101[4]], 1);
+			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_101[5]], 1);
+			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_101[6]], 1);
+			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_101[7]], 1);
 
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -939,14 +1067,14 @@ namespace EmuMath::Functors
 			vals_101_ = EmuSIMD::add(vals_101_, EmuSIMD::mul_all(row_, tz_1_));
 
 			// 110
-			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_110_[0]]);
-			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_110_[1]]);
-			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_110_[2]]);
-			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_110_[3]]);
-			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_110_[4]], 1);
-			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_110_[5]], 1);
-			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_110_[6]], 1);
-			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_110_[7]], 1);
+			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_110[0]]);
+			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_110[1]]);
+			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_110[2]]);
+			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_110[3]]);
+			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_110[4]], 1);
+			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_110[5]], 1);
+			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_110[6]], 1);
+			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_110[7]], 1);
 
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -965,14 +1093,14 @@ namespace EmuMath::Functors
 			vals_110_ = EmuSIMD::add(vals_110_, EmuSIMD::mul_all(row_, tz_0_));
 
 			// 111
-			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_111_[0]]);
-			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_111_[1]]);
-			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_111_[2]]);
-			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_111_[3]]);
-			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_111_[4]], 1);
-			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_111_[5]], 1);
-			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_111_[6]], 1);
-			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_111_[7]], 1);
+			gradient_0_ = EmuSIMD::cast<register_type>(_gradients_128[perm_111[0]]);
+			gradient_1_ = EmuSIMD::cast<register_type>(_gradients_128[perm_111[1]]);
+			gradient_2_ = EmuSIMD::cast<register_type>(_gradients_128[perm_111[2]]);
+			gradient_3_ = EmuSIMD::cast<register_type>(_gradients_128[perm_111[3]]);
+			gradient_0_ = _mm256_insertf128_ps(gradient_0_, _gradients_128[perm_111[4]], 1);
+			gradient_1_ = _mm256_insertf128_ps(gradient_1_, _gradients_128[perm_111[5]], 1);
+			gradient_2_ = _mm256_insertf128_ps(gradient_2_, _gradients_128[perm_111[6]], 1);
+			gradient_3_ = _mm256_insertf128_ps(gradient_3_, _gradients_128[perm_111[7]], 1);
 			
 			// X
 			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
@@ -998,7 +1126,608 @@ namespace EmuMath::Functors
 		std::array<int, num_elements_in_register> iy_1;
 		std::array<int, num_elements_in_register> iz_0;
 		std::array<int, num_elements_in_register> iz_1;
+		std::array<int, num_elements_in_register> perm_000;
+		std::array<int, num_elements_in_register> perm_001;
+		std::array<int, num_elements_in_register> perm_010;
+		std::array<int, num_elements_in_register> perm_011;
+		std::array<int, num_elements_in_register> perm_100;
+		std::array<int, num_elements_in_register> perm_101;
+		std::array<int, num_elements_in_register> perm_110;
+		std::array<int, num_elements_in_register> perm_111;
+		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<register_type> smooth_t;
+	};
+
+	/// <summary>
+	/// <para> Functor to produce 3-dimensional smooth perlin noise for every element of registers without a dedicated specialisation, such as f64x2 and f64x4. </para>
+	/// <para> This allows noise to be generated at double precision, avoiding the banding that single precision produces at large coordinates. </para>
+	/// <para> Gradients are selected from hashes in registers, and corners are interpolated in the same order as make_fast_noise_3d_derivatives for PERLIN noise. </para>
+	/// </summary>
+	template<EmuConcepts::KnownSIMD SIMDRegister_>
+	requires
+	(
+		EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_> &&
+		!EmuConcepts::UnqualifiedMatch<SIMDRegister_, EmuSIMD::f32x4> &&
+		!EmuConcepts::UnqualifiedMatch<SIMDRegister_, EmuSIMD::f32x8>
+	)
+	struct make_fast_noise_3d<EmuMath::NoiseType::PERLIN, SIMDRegister_>
+	{
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		using int_register_type = typename EmuSIMD::TMP::register_as_integral<register_type>::type;
+		static constexpr std::size_t num_elements_per_register = EmuSIMD::TMP::determine_register_element_count<register_type>();
+		static constexpr std::size_t per_element_width = EmuSIMD::TMP::determine_register_per_element_width<register_type>();
+		static constexpr bool is_signed = true;
+
+		inline make_fast_noise_3d() :
+			smooth_t(),
+			one(EmuSIMD::set1<register_type>(1.0f))
+		{
+		}
+
+		[[nodiscard]] inline auto operator()
+		(
+			register_type points_x_,
+			register_type points_y_,
+			register_type points_z_,
+			typename EmuSIMD::TMP::register_as_arg_type<register_type>::type freq_,
+			typename EmuSIMD::TMP::register_as_arg_type<int_register_type>::type permutations_mask_128_,
+			const EmuMath::NoisePermutations& permutations_
+		) -> register_type
+		{
+			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
+			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
+			points_z_ = EmuSIMD::mul_all(points_z_, freq_);
+
+			register_type floor_x_ = EmuSIMD::floor(points_x_);
+			register_type floor_y_ = EmuSIMD::floor(points_y_);
+			register_type floor_z_ = EmuSIMD::floor(points_z_);
+			register_type tx_0_ = EmuSIMD::sub(points_x_, floor_x_);
+			register_type ty_0_ = EmuSIMD::sub(points_y_, floor_y_);
+			register_type tz_0_ = EmuSIMD::sub(points_z_, floor_z_);
+			register_type tx_1_ = EmuSIMD::sub(tx_0_, one);
+			register_type ty_1_ = EmuSIMD::sub(ty_0_, one);
+			register_type tz_1_ = EmuSIMD::sub(tz_0_, one);
+
+			int_register_type one_i_ = _to_int(one);
+			int_register_type ix_0_ = EmuSIMD::bitwise_and(_to_int(floor_x_), permutations_mask_128_);
+			int_register_type iy_0_ = EmuSIMD::bitwise_and(_to_int(floor_y_), permutations_mask_128_);
+			int_register_type iz_0_ = EmuSIMD::bitwise_and(_to_int(floor_z_), permutations_mask_128_);
+			int_register_type ix_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(ix_0_, one_i_), permutations_mask_128_);
+			int_register_type iy_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iy_0_, one_i_), permutations_mask_128_);
+			int_register_type iz_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iz_0_, one_i_), permutations_mask_128_);
+
+			int_register_type perm_0_ = _lookup(permutations_, ix_0_);
+			int_register_type perm_1_ = _lookup(permutations_, ix_1_);
+			int_register_type perm_00_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perm_0_, iy_0_));
+			int_register_type perm_01_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perm_0_, iy_1_));
+			int_register_type perm_10_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perm_1_, iy_0_));
+			int_register_type perm_11_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perm_1_, iy_1_));
+
+			// Corners are indexed as XYZ bits, where X is the most significant (e.g. [6] is 110)
+			register_type vals_[8];
+			vals_[0] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_00_, iz_0_)), tx_0_, ty_0_, tz_0_);
+			vals_[1] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_00_, iz_1_)), tx_0_, ty_0_, tz_1_);
+			vals_[2] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_01_, iz_0_)), tx_0_, ty_1_, tz_0_);
+			vals_[3] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_01_, iz_1_)), tx_0_, ty_1_, tz_1_);
+			vals_[4] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_10_, iz_0_)), tx_1_, ty_0_, tz_0_);
+			vals_[5] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_10_, iz_1_)), tx_1_, ty_0_, tz_1_);
+			vals_[6] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_11_, iz_0_)), tx_1_, ty_1_, tz_0_);
+			vals_[7] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_11_, iz_1_)), tx_1_, ty_1_, tz_1_);
+
+			tx_0_ = smooth_t(tx_0_);
+			ty_0_ = smooth_t(ty_0_);
+			tz_0_ = smooth_t(tz_0_);
+			return EmuSIMD::fused_lerp
+			(
+				EmuSIMD::fused_lerp(EmuSIMD::fused_lerp(vals_[0], vals_[4], tx_0_), EmuSIMD::fused_lerp(vals_[2], vals_[6], tx_0_), ty_0_),
+				EmuSIMD::fused_lerp(EmuSIMD::fused_lerp(vals_[1], vals_[5], tx_0_), EmuSIMD::fused_lerp(vals_[3], vals_[7], tx_0_), ty_0_),
+				tz_0_
+			);
+		}
+
+	private:
+		[[nodiscard]] static inline int_register_type _to_int(typename EmuSIMD::TMP::register_as_arg_type<register_type>::type values_)
+		{
+			return EmuSIMD::convert<int_register_type, per_element_width, is_signed, per_element_width, is_signed>(values_);
+		}
+
+		[[nodiscard]] static inline int_register_type _lookup(const EmuMath::NoisePermutations& permutations_, int_register_type indices_)
+		{
+			return _underlying_noise_gen::_fast_lookup_permutations<register_type>(permutations_, indices_);
+		}
+
+		[[nodiscard]] static inline register_type _corner(int_register_type hash_, register_type x_, register_type y_, register_type z_)
+		{
+			register_type grad_x_, grad_y_, grad_z_;
+			_underlying_noise_gen::_fast_perlin_gradient_3d(hash_, grad_x_, grad_y_, grad_z_);
+			return EmuSIMD::fmadd(grad_z_, z_, EmuSIMD::fmadd(grad_y_, y_, EmuSIMD::mul_all(grad_x_, x_)));
+		}
+
+	public:
+		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<register_type> smooth_t;
+		register_type one;
+	};
+
+	/// <summary>
+	/// <para> Functor to produce 3-dimensional simplex noise for every element of the provided registers. Produced noise targets the range -1:1. </para>
+	/// <para> Only the 4 corners of each point's containing tetrahedron are hashed and evaluated, and every step is branchless across elements. </para>
+	/// </summary>
+	template<EmuConcepts::KnownSIMD SIMDRegister_>
+	requires((EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>))
+	struct make_fast_noise_3d<EmuMath::NoiseType::SIMPLEX, SIMDRegister_>
+	{
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		using int_register_type = typename EmuSIMD::TMP::register_as_integral<register_type>::type;
+		using scalar_fp = typename std::conditional
+		<
+			EmuCore::TMP::is_any_comparison_true<std::is_same, register_type, EmuSIMD::f32x4, EmuSIMD::f32x8, EmuSIMD::f32x16>::value,
+			float,
+			double
+		>::type;
+		using scalar_int = typename std::conditional
+		<
+			EmuCore::TMP::is_any_comparison_true<std::is_same, register_type, EmuSIMD::f32x4, EmuSIMD::f32x8, EmuSIMD::f32x16>::value,
+			std::int32_t,
+			std::int64_t
+		>::type;
+		using constants = EmuMath::Functors::_underlying_noise_gen::simplex_constants<3, scalar_fp>;
+		static constexpr std::size_t num_elements_per_register = EmuSIMD::TMP::determine_register_element_count<register_type>();
+		static constexpr std::size_t per_element_width = EmuSIMD::TMP::determine_register_per_element_width<register_type>();
+		static constexpr bool is_signed = true;
+
+		inline make_fast_noise_3d() :
+			skew(EmuSIMD::set1<register_type>(constants::skew)),
+			unskew(EmuSIMD::set1<register_type>(constants::unskew)),
+			unskew_2(EmuSIMD::set1<register_type>(scalar_fp(2) * constants::unskew)),
+			unskew_3_minus_1(EmuSIMD::set1<register_type>((scalar_fp(3) * constants::unskew) - scalar_fp(1))),
+			falloff(EmuSIMD::set1<register_type>(constants::falloff)),
+			output_scale(EmuSIMD::set1<register_type>(constants::output_scale)),
+			one(EmuSIMD::set1<register_type>(scalar_fp(1)))
+		{
+		}
+
+		[[nodiscard]] inline auto operator()
+		(
+			register_type points_x_,
+			register_type points_y_,
+			register_type points_z_,
+			typename EmuSIMD::TMP::register_to_arg_type<register_type>::type freq_,
+			typename EmuSIMD::TMP::register_to_arg_type<int_register_type>::type permutations_mask_128_,
+			const EmuMath::NoisePermutations& permutations_
+		) -> register_type
+		{
+			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
+			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
+			points_z_ = EmuSIMD::mul_all(points_z_, freq_);
+
+			// Skew points to find the origins of their containing cubes, then unskew those origins to find each point's offset from its first simplex corner
+			register_type temp_ = EmuSIMD::mul_all(EmuSIMD::add(EmuSIMD::add(points_x_, points_y_), points_z_), skew);
+			register_type cell_x_ = EmuSIMD::floor(EmuSIMD::add(points_x_, temp_));
+			register_type cell_y_ = EmuSIMD::floor(EmuSIMD::add(points_y_, temp_));
+			register_type cell_z_ = EmuSIMD::floor(EmuSIMD::add(points_z_, temp_));
+			temp_ = EmuSIMD::mul_all(EmuSIMD::add(EmuSIMD::add(cell_x_, cell_y_), cell_z_), unskew);
+			register_type x_0_ = EmuSIMD::sub(points_x_, EmuSIMD::sub(cell_x_, temp_));
+			register_type y_0_ = EmuSIMD::sub(points_y_, EmuSIMD::sub(cell_y_, temp_));
+			register_type z_0_ = EmuSIMD::sub(points_z_, EmuSIMD::sub(cell_z_, temp_));
+
+			// Rank offsets to find the containing tetrahedron of each point, producing steps of 1 or 0 by masking a register of 1s
+			// --- The second corner steps along the greatest offset's axis; the third steps along all but the smallest offset's axis
+			register_type x_ge_y_ = EmuSIMD::cmpge(x_0_, y_0_);
+			register_type y_ge_z_ = EmuSIMD::cmpge(y_0_, z_0_);
+			register_type x_ge_z_ = EmuSIMD::cmpge(x_0_, z_0_);
+			register_type step_x_1_ = EmuSIMD::bitwise_and(EmuSIMD::bitwise_and(x_ge_y_, x_ge_z_), one);
+			register_type step_y_1_ = EmuSIMD::bitwise_and(EmuSIMD::bitwise_andnot(x_ge_y_, y_ge_z_), one);
+			register_type step_z_1_ = EmuSIMD::bitwise_andnot(EmuSIMD::bitwise_or(x_ge_z_, y_ge_z_), one);
+			register_type step_x_2_ = EmuSIMD::bitwise_and(EmuSIMD::bitwise_or(x_ge_y_, x_ge_z_), one);
+			register_type step_y_2_ = EmuSIMD::bitwise_andnot(EmuSIMD::bitwise_andnot(y_ge_z_, x_ge_y_), one);
+			register_type step_z_2_ = EmuSIMD::bitwise_andnot(EmuSIMD::bitwise_and(x_ge_z_, y_ge_z_), one);
+
+			// Corner lattice indices
+			int_register_type ix_0_ = EmuSIMD::bitwise_and(_to_int(cell_x_), permutations_mask_128_);
+			int_register_type iy_0_ = EmuSIMD::bitwise_and(_to_int(cell_y_), permutations_mask_128_);
+			int_register_type iz_0_ = EmuSIMD::bitwise_and(_to_int(cell_z_), permutations_mask_128_);
+			int_register_type ix_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(ix_0_, _to_int(step_x_1_)), permutations_mask_128_);
+			int_register_type iy_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iy_0_, _to_int(step_y_1_)), permutations_mask_128_);
+			int_register_type iz_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iz_0_, _to_int(step_z_1_)), permutations_mask_128_);
+			int_register_type ix_2_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(ix_0_, _to_int(step_x_2_)), permutations_mask_128_);
+			int_register_type iy_2_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iy_0_, _to_int(step_y_2_)), permutations_mask_128_);
+			int_register_type iz_2_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iz_0_, _to_int(step_z_2_)), permutations_mask_128_);
+			int_register_type one_i_ = _to_int(one);
+			int_register_type ix_3_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(ix_0_, one_i_), permutations_mask_128_);
+			int_register_type iy_3_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iy_0_, one_i_), permutations_mask_128_);
+			int_register_type iz_3_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iz_0_, one_i_), permutations_mask_128_);
+
+			// Sum contributions of all corners
+			register_type result_ = _corner_contribution(_hash(permutations_, ix_0_, iy_0_, iz_0_), x_0_, y_0_, z_0_);
+			result_ = EmuSIMD::add
+			(
+				result_,
+				_corner_contribution
+				(
+					_hash(permutations_, ix_1_, iy_1_, iz_1_),
+					EmuSIMD::add(EmuSIMD::sub(x_0_, step_x_1_), unskew),
+					EmuSIMD::add(EmuSIMD::sub(y_0_, step_y_1_), unskew),
+					EmuSIMD::add(EmuSIMD::sub(z_0_, step_z_1_), unskew)
+				)
+			);
+			result_ = EmuSIMD::add
+			(
+				result_,
+				_corner_contribution
+				(
+					_hash(permutations_, ix_2_, iy_2_, iz_2_),
+					EmuSIMD::add(EmuSIMD::sub(x_0_, step_x_2_), unskew_2),
+					EmuSIMD::add(EmuSIMD::sub(y_0_, step_y_2_), unskew_2),
+					EmuSIMD::add(EmuSIMD::sub(z_0_, step_z_2_), unskew_2)
+				)
+			);
+			result_ = EmuSIMD::add
+			(
+				result_,
+				_corner_contribution
+				(
+					_hash(permutations_, ix_3_, iy_3_, iz_3_),
+					EmuSIMD::add(x_0_, unskew_3_minus_1),
+					EmuSIMD::add(y_0_, unskew_3_minus_1),
+					EmuSIMD::add(z_0_, unskew_3_minus_1)
+				)
+			);
+			return EmuSIMD::mul_all(result_, output_scale);
+		}
+
+	private:
+		[[nodiscard]] static inline int_register_type _to_int(typename EmuSIMD::TMP::register_as_arg_type<register_type>::type values_)
+		{
+			return EmuSIMD::convert<int_register_type, per_element_width, is_signed, per_element_width, is_signed>(values_);
+		}
+
+		[[nodiscard]] static inline int_register_type _hash
+		(
+			const EmuMath::NoisePermutations& permutations_,
+			int_register_type ix_,
+			int_register_type iy_,
+			int_register_type iz_
+		)
+		{
+			if constexpr (_underlying_noise_gen::_fast_gather_supported_v<register_type>)
+			{
+				int_register_type perms_ = _underlying_noise_gen::_fast_gather_permutations(permutations_, ix_);
+				perms_ = _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perms_, iy_);
+				return _underlying_noise_gen::_fast_permutation_hash_step(permutations_, perms_, iz_);
+			}
+			else
+			{
+				scalar_int ix_array_[num_elements_per_register];
+				scalar_int iy_array_[num_elements_per_register];
+				scalar_int iz_array_[num_elements_per_register];
+				EmuSIMD::store(iz_, iz_array_);
+				EmuSIMD::store(iy_, iy_array_);
+				EmuSIMD::store(ix_, ix_array_);
+
+				scalar_int perms_[num_elements_per_register];
+				for (std::size_t i = 0; i < num_elements_per_register; ++i)
+				{
+					std::size_t perm_x_ = static_cast<std::size_t>(permutations_[ix_array_[i]]);
+					std::size_t perm_xy_ = static_cast<std::size_t>(permutations_[perm_x_ + iy_array_[i]]);
+					perms_[i] = static_cast<scalar_int>(permutations_[perm_xy_ + iz_array_[i]]);
+				}
+				return EmuSIMD::load<int_register_type>(perms_);
+			}
+		}
+
+		[[nodiscard]] inline register_type _corner_contribution(int_register_type hash_, register_type x_, register_type y_, register_type z_) const
+		{
+			register_type t_ = EmuSIMD::sub(falloff, EmuSIMD::mul_all(x_, x_));
+			t_ = EmuSIMD::sub(t_, EmuSIMD::mul_all(y_, y_));
+			t_ = EmuSIMD::sub(t_, EmuSIMD::mul_all(z_, z_));
+
+			// Corners beyond the falloff radius have no influence, so clamp t to 0 instead of branching
+			t_ = EmuSIMD::max(t_, EmuSIMD::setzero<register_type>());
+			t_ = EmuSIMD::mul_all(t_, t_);
+			t_ = EmuSIMD::mul_all(t_, t_);
+			return EmuSIMD::mul_all(t_, _underlying_noise_gen::_fast_perlin_gradient_dot_3d(hash_, x_, y_, z_));
+		}
+
+	public:
+		register_type skew;
+		register_type unskew;
+		register_type unskew_2;
+		register_type unskew_3_minus_1;
+		register_type falloff;
+		register_type output_scale;
+		register_type one;
+	};
+
+	/// <summary>
+	/// <para> Functor to produce 3-dimensional cellular (Worley) noise for every element of the provided registers. </para>
+	/// <para> Uses the CellularNoiseOutput and CellularNoiseDistance of the provided cellular NoiseType, and matches make_noise_3d for the same NoiseType. </para>
+	/// <para> All 27 cells neighbouring each point are evaluated, and nearest distances are reduced via min/max in registers so that every step is branchless across elements. </para>
+	/// <para> Produced noise is a distance in frequency-scaled lattice units, and is not remapped. Euclidean F1 outputs are typically within the range 0:1. </para>
+	/// </summary>
+	template<EmuMath::NoiseType NoiseType_, EmuConcepts::KnownSIMD SIMDRegister_>
+	requires(EmuMath::is_cellular_noise_type(NoiseType_) && EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>)
+	struct make_fast_noise_3d<NoiseType_, SIMDRegister_>
+	{
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		using int_register_type = typename EmuSIMD::TMP::register_as_integral<register_type>::type;
+		using scalar_fp = typename std::conditional
+		<
+			EmuCore::TMP::is_any_comparison_true<std::is_same, register_type, EmuSIMD::f32x4, EmuSIMD::f32x8, EmuSIMD::f32x16>::value,
+			float,
+			double
+		>::type;
+		static constexpr EmuMath::CellularNoiseOutput output = EmuMath::cellular_noise_output(NoiseType_);
+		static constexpr EmuMath::CellularNoiseDistance distance = EmuMath::cellular_noise_distance(NoiseType_);
+		static constexpr std::size_t per_element_width = EmuSIMD::TMP::determine_register_per_element_width<register_type>();
+		static constexpr bool is_signed = true;
+
+		inline make_fast_noise_3d() :
+			one(EmuSIMD::set1<register_type>(scalar_fp(1))),
+			max_distance(EmuSIMD::set1<register_type>(std::numeric_limits<scalar_fp>::max()))
+		{
+		}
+
+		[[nodiscard]] inline auto operator()
+		(
+			register_type points_x_,
+			register_type points_y_,
+			register_type points_z_,
+			typename EmuSIMD::TMP::register_to_arg_type<register_type>::type freq_,
+			typename EmuSIMD::TMP::register_to_arg_type<int_register_type>::type permutations_mask_128_,
+			const EmuMath::NoisePermutations& permutations_
+		) -> register_type
+		{
+			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
+			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
+			points_z_ = EmuSIMD::mul_all(points_z_, freq_);
+
+			register_type cell_x_ = EmuSIMD::floor(points_x_);
+			register_type cell_y_ = EmuSIMD::floor(points_y_);
+			register_type cell_z_ = EmuSIMD::floor(points_z_);
+			int_register_type ix_ = EmuSIMD::bitwise_and(_to_int(cell_x_), permutations_mask_128_);
+			int_register_type iy_ = EmuSIMD::bitwise_and(_to_int(cell_y_), permutations_mask_128_);
+			int_register_type iz_ = EmuSIMD::bitwise_and(_to_int(cell_z_), permutations_mask_128_);
+			register_type jitter_scale_ = EmuSIMD::div(one, EmuSIMD::add(_to_fp(permutations_mask_128_), one));
+
+			// Lattice indices and offsets of the 3 cells along each axis, from the cell before each point's cell to the cell after it
+			int_register_type one_i_ = _to_int(one);
+			int_register_type cells_x_[3] =
+			{
+				EmuSIMD::bitwise_and(EmuSIMD::sub<per_element_width>(ix_, one_i_), permutations_mask_128_),
+				ix_,
+				EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(ix_, one_i_), permutations_mask_128_)
+			};
+			int_register_type cells_y_[3] =
+			{
+				EmuSIMD::bitwise_and(EmuSIMD::sub<per_element_width>(iy_, one_i_), permutations_mask_128_),
+				iy_,
+				EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iy_, one_i_), permutations_mask_128_)
+			};
+			int_register_type cells_z_[3] =
+			{
+				EmuSIMD::bitwise_and(EmuSIMD::sub<per_element_width>(iz_, one_i_), permutations_mask_128_),
+				iz_,
+				EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iz_, one_i_), permutations_mask_128_)
+			};
+			register_type offset_x_ = EmuSIMD::sub(cell_x_, points_x_);
+			register_type offset_y_ = EmuSIMD::sub(cell_y_, points_y_);
+			register_type offset_z_ = EmuSIMD::sub(cell_z_, points_z_);
+			register_type offsets_x_[3] = { EmuSIMD::sub(offset_x_, one), offset_x_, EmuSIMD::add(offset_x_, one) };
+			register_type offsets_y_[3] = { EmuSIMD::sub(offset_y_, one), offset_y_, EmuSIMD::add(offset_y_, one) };
+			register_type offsets_z_[3] = { EmuSIMD::sub(offset_z_, one), offset_z_, EmuSIMD::add(offset_z_, one) };
+
+			int_register_type jitter_y_index_ = one_i_;
+			int_register_type jitter_z_index_ = EmuSIMD::add<per_element_width>(one_i_, one_i_);
+			register_type f1_ = max_distance;
+			register_type f2_ = max_distance;
+			for (std::size_t cx_ = 0; cx_ < 3; ++cx_)
+			{
+				int_register_type perm_x_ = _lookup(permutations_, cells_x_[cx_]);
+				for (std::size_t cy_ = 0; cy_ < 3; ++cy_)
+				{
+					int_register_type perm_xy_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perm_x_, cells_y_[cy_]));
+					for (std::size_t cz_ = 0; cz_ < 3; ++cz_)
+					{
+						int_register_type hash_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perm_xy_, cells_z_[cz_]));
+						_underlying_noise_gen::_fast_cellular_reduce
+						(
+							f1_,
+							f2_,
+							_underlying_noise_gen::_fast_cellular_distance<distance>
+							(
+								EmuSIMD::fmadd(_to_fp(_lookup(permutations_, hash_)), jitter_scale_, offsets_x_[cx_]),
+								EmuSIMD::fmadd(_to_fp(_lookup(permutations_, EmuSIMD::add<per_element_width>(hash_, jitter_y_index_))), jitter_scale_, offsets_y_[cy_]),
+								EmuSIMD::fmadd(_to_fp(_lookup(permutations_, EmuSIMD::add<per_element_width>(hash_, jitter_z_index_))), jitter_scale_, offsets_z_[cz_])
+							)
+						);
+					}
+				}
+			}
+			return _underlying_noise_gen::_fast_cellular_noise_finish<output, distance>(f1_, f2_);
+		}
+
+	private:
+		[[nodiscard]] static inline int_register_type _to_int(typename EmuSIMD::TMP::register_as_arg_type<register_type>::type values_)
+		{
+			return EmuSIMD::convert<int_register_type, per_element_width, is_signed, per_element_width, is_signed>(values_);
+		}
+
+		[[nodiscard]] static inline register_type _to_fp(typename EmuSIMD::TMP::register_as_arg_type<int_register_type>::type values_)
+		{
+			return EmuSIMD::convert<register_type, per_element_width, is_signed, per_element_width, is_signed>(values_);
+		}
+
+		[[nodiscard]] static inline int_register_type _lookup(const EmuMath::NoisePermutations& permutations_, int_register_type indices_)
+		{
+			return _underlying_noise_gen::_fast_lookup_permutations<register_type>(permutations_, indices_);
+		}
+
+	public:
+		register_type one;
+		register_type max_distance;
+	};
+
+	template<EmuMath::NoiseType NoiseType_, class Register_ = __m128>
+	struct make_fast_noise_3d_derivatives
+	{
+		static_assert(EmuMath::Validity::assert_valid_noise_type<NoiseType_>(), "Invalid NoiseType_ argument provided to EmuMath::Functors::make_fast_noise_3d_derivatives.");
+		constexpr make_fast_noise_3d_derivatives()
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to construct a make_fast_noise_3d_derivatives instance for a NoiseType that does not support analytical derivatives.");
+		}
+	};
+
+	/// <summary>
+	/// <para> Functor to produce 3-dimensional smooth perlin noise alongside its analytical derivatives for every element of the provided registers, from a single evaluation. </para>
+	/// <para> Outputs are registers in the order { value, d/dx, d/dy, d/dz }, and match make_noise_3d_derivatives for PERLIN noise. </para>
+	/// <para> Derivatives are with respect to the input points before they are scaled by freq_, and as such are scaled by freq_ themselves. </para>
+	/// <para> Gradients are selected from hashes in registers instead of looked up per element, as their components are needed beyond a single dot product. </para>
+	/// </summary>
+	template<EmuConcepts::KnownSIMD SIMDRegister_>
+	requires((EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>))
+	struct make_fast_noise_3d_derivatives<EmuMath::NoiseType::PERLIN, SIMDRegister_>
+	{
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		using int_register_type = typename EmuSIMD::TMP::register_as_integral<register_type>::type;
+		using output_type = std::array<register_type, 4>;
+		static constexpr std::size_t num_elements_per_register = EmuSIMD::TMP::determine_register_element_count<register_type>();
+		static constexpr std::size_t per_element_width = EmuSIMD::TMP::determine_register_per_element_width<register_type>();
+		static constexpr bool is_signed = true;
+
+		inline make_fast_noise_3d_derivatives() :
+			smooth_t(),
+			smooth_t_derivative(),
+			one(EmuSIMD::set1<register_type>(1.0f))
+		{
+		}
+
+		[[nodiscard]] inline auto operator()
+		(
+			register_type points_x_,
+			register_type points_y_,
+			register_type points_z_,
+			typename EmuSIMD::TMP::register_as_arg_type<register_type>::type freq_,
+			typename EmuSIMD::TMP::register_as_arg_type<int_register_type>::type permutations_mask_128_,
+			const EmuMath::NoisePermutations& permutations_
+		) -> output_type
+		{
+			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
+			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
+			points_z_ = EmuSIMD::mul_all(points_z_, freq_);
+
+			register_type floor_x_ = EmuSIMD::floor(points_x_);
+			register_type floor_y_ = EmuSIMD::floor(points_y_);
+			register_type floor_z_ = EmuSIMD::floor(points_z_);
+			register_type tx_0_ = EmuSIMD::sub(points_x_, floor_x_);
+			register_type ty_0_ = EmuSIMD::sub(points_y_, floor_y_);
+			register_type tz_0_ = EmuSIMD::sub(points_z_, floor_z_);
+			register_type tx_1_ = EmuSIMD::sub(tx_0_, one);
+			register_type ty_1_ = EmuSIMD::sub(ty_0_, one);
+			register_type tz_1_ = EmuSIMD::sub(tz_0_, one);
+
+			int_register_type one_i_ = _to_int(one);
+			int_register_type ix_0_ = EmuSIMD::bitwise_and(_to_int(floor_x_), permutations_mask_128_);
+			int_register_type iy_0_ = EmuSIMD::bitwise_and(_to_int(floor_y_), permutations_mask_128_);
+			int_register_type iz_0_ = EmuSIMD::bitwise_and(_to_int(floor_z_), permutations_mask_128_);
+			int_register_type ix_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(ix_0_, one_i_), permutations_mask_128_);
+			int_register_type iy_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iy_0_, one_i_), permutations_mask_128_);
+			int_register_type iz_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<per_element_width>(iz_0_, one_i_), permutations_mask_128_);
+
+			// Hash the permutations of all corners
+			int_register_type perm_0_ = _lookup(permutations_, ix_0_);
+			int_register_type perm_1_ = _lookup(permutations_, ix_1_);
+			int_register_type perm_00_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perm_0_, iy_0_));
+			int_register_type perm_01_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perm_0_, iy_1_));
+			int_register_type perm_10_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perm_1_, iy_0_));
+			int_register_type perm_11_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perm_1_, iy_1_));
+
+			// Corners are indexed as XYZ bits, where X is the most significant (e.g. [6] is 110)
+			register_type grad_x_[8], grad_y_[8], grad_z_[8], vals_[8];
+			vals_[0] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_00_, iz_0_)), tx_0_, ty_0_, tz_0_, grad_x_[0], grad_y_[0], grad_z_[0]);
+			vals_[1] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_00_, iz_1_)), tx_0_, ty_0_, tz_1_, grad_x_[1], grad_y_[1], grad_z_[1]);
+			vals_[2] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_01_, iz_0_)), tx_0_, ty_1_, tz_0_, grad_x_[2], grad_y_[2], grad_z_[2]);
+			vals_[3] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_01_, iz_1_)), tx_0_, ty_1_, tz_1_, grad_x_[3], grad_y_[3], grad_z_[3]);
+			vals_[4] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_10_, iz_0_)), tx_1_, ty_0_, tz_0_, grad_x_[4], grad_y_[4], grad_z_[4]);
+			vals_[5] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_10_, iz_1_)), tx_1_, ty_0_, tz_1_, grad_x_[5], grad_y_[5], grad_z_[5]);
+			vals_[6] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_11_, iz_0_)), tx_1_, ty_1_, tz_0_, grad_x_[6], grad_y_[6], grad_z_[6]);
+			vals_[7] = _corner(_lookup(permutations_, EmuSIMD::add<per_element_width>(perm_11_, iz_1_)), tx_1_, ty_1_, tz_1_, grad_x_[7], grad_y_[7], grad_z_[7]);
+
+			register_type dtx_ = smooth_t_derivative(tx_0_);
+			register_type dty_ = smooth_t_derivative(ty_0_);
+			register_type dtz_ = smooth_t_derivative(tz_0_);
+			tx_0_ = smooth_t(tx_0_);
+			ty_0_ = smooth_t(ty_0_);
+			tz_0_ = smooth_t(tz_0_);
+
+			// Each derivative is the interpolated gradient along its axis, plus the change in interpolated values along that axis scaled by the derivative of its weighting
+			register_type change_x_ = EmuSIMD::fused_lerp
+			(
+				EmuSIMD::fused_lerp(EmuSIMD::sub(vals_[4], vals_[0]), EmuSIMD::sub(vals_[6], vals_[2]), ty_0_),
+				EmuSIMD::fused_lerp(EmuSIMD::sub(vals_[5], vals_[1]), EmuSIMD::sub(vals_[7], vals_[3]), ty_0_),
+				tz_0_
+			);
+			register_type change_y_ = EmuSIMD::fused_lerp
+			(
+				EmuSIMD::fused_lerp(EmuSIMD::sub(vals_[2], vals_[0]), EmuSIMD::sub(vals_[6], vals_[4]), tx_0_),
+				EmuSIMD::fused_lerp(EmuSIMD::sub(vals_[3], vals_[1]), EmuSIMD::sub(vals_[7], vals_[5]), tx_0_),
+				tz_0_
+			);
+			register_type change_z_ = EmuSIMD::fused_lerp
+			(
+				EmuSIMD::fused_lerp(EmuSIMD::sub(vals_[1], vals_[0]), EmuSIMD::sub(vals_[5], vals_[4]), tx_0_),
+				EmuSIMD::fused_lerp(EmuSIMD::sub(vals_[3], vals_[2]), EmuSIMD::sub(vals_[7], vals_[6]), tx_0_),
+				ty_0_
+			);
+
+			return output_type
+			{
+				_interpolate(vals_, tx_0_, ty_0_, tz_0_),
+				EmuSIMD::mul_all(EmuSIMD::fmadd(dtx_, change_x_, _interpolate(grad_x_, tx_0_, ty_0_, tz_0_)), freq_),
+				EmuSIMD::mul_all(EmuSIMD::fmadd(dty_, change_y_, _interpolate(grad_y_, tx_0_, ty_0_, tz_0_)), freq_),
+				EmuSIMD::mul_all(EmuSIMD::fmadd(dtz_, change_z_, _interpolate(grad_z_, tx_0_, ty_0_, tz_0_)), freq_)
+			};
+		}
+
+	private:
+		[[nodiscard]] static inline int_register_type _to_int(typename EmuSIMD::TMP::register_as_arg_type<register_type>::type values_)
+		{
+			return EmuSIMD::convert<int_register_type, per_element_width, is_signed, per_element_width, is_signed>(values_);
+		}
+
+		[[nodiscard]] static inline int_register_type _lookup(const EmuMath::NoisePermutations& permutations_, int_register_type indices_)
+		{
+			return _underlying_noise_gen::_fast_lookup_permutations<register_type>(permutations_, indices_);
+		}
+
+		[[nodiscard]] static inline register_type _corner
+		(
+			int_register_type hash_,
+			register_type x_,
+			register_type y_,
+			register_type z_,
+			register_type& out_grad_x_,
+			register_type& out_grad_y_,
+			register_type& out_grad_z_
+		)
+		{
+			_underlying_noise_gen::_fast_perlin_gradient_3d(hash_, out_grad_x_, out_grad_y_, out_grad_z_);
+			return EmuSIMD::fmadd(out_grad_z_, z_, EmuSIMD::fmadd(out_grad_y_, y_, EmuSIMD::mul_all(out_grad_x_, x_)));
+		}
+
+		/// <summary> Trilinearly interpolates the 8 corner values in the provided array, using the same order of lerps as make_fast_noise_3d for PERLIN noise. </summary>
+		[[nodiscard]] static inline register_type _interpolate(const register_type(&corners_)[8], register_type tx_, register_type ty_, register_type tz_)
+		{
+			return EmuSIMD::fused_lerp
+			(
+				EmuSIMD::fused_lerp(EmuSIMD::fused_lerp(corners_[0], corners_[4], tx_), EmuSIMD::fused_lerp(corners_[2], corners_[6], tx_), ty_),
+				EmuSIMD::fused_lerp(EmuSIMD::fused_lerp(corners_[1], corners_[5], tx_), EmuSIMD::fused_lerp(corners_[3], corners_[7], tx_), ty_),
+				tz_
+			);
+		}
+
+	public:
 		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<register_type> smooth_t;
+		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t_derivative<register_type> smooth_t_derivative;
+		register_type one;
 	};
 }
 
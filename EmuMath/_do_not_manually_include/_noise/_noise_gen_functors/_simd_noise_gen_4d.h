@@ -0,0 +1,443 @@
+#ifndef EMU_MATH_FAST_NOISE_GEN_FUNCTOR_4D_H_INC_
+#define EMU_MATH_FAST_NOISE_GEN_FUNCTOR_4D_H_INC_ 1
+
+#include "_common_fast_noise_gen_functors_includes.h"
+#include "../../../../EmuSIMD/SIMDHelpers.h"
+#include "../../../../EmuCore/TMPHelpers/TypeComparators.h"
+#include "../../../../EmuCore/TMPHelpers/Values.h"
+#include <type_traits>
+#include <utility>
+
+namespace EmuMath::Validity
+{
+	template<class Reg_>
+	[[nodiscard]] static constexpr inline bool _assert_fast_noise_4d_valid_register()
+	{
+		if constexpr (EmuSIMD::TMP::is_floating_point_simd_register_v<Reg_>)
+		{
+			return true;
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Reg_>(), "Provided an unsupported register for fast_noise_4d. Only floating-point SIMD registers are supported.");
+			return false;
+		}
+	}
+}
+
+namespace EmuMath::Functors::_underlying_noise_gen
+{
+	/// <summary>
+	/// <para> Register equivalent of noise_4d_w_axis, calculating the W-axis lattice cells of every element and optionally looping them after a period. </para>
+	/// <para> Results are calculated with the same operations as noise_4d_w_axis, so looping scalar and SIMD noise wrap at identical points. </para>
+	/// </summary>
+	template<class Register_>
+	struct _fast_noise_4d_w_axis
+	{
+		static constexpr std::size_t per_element_width = EmuSIMD::TMP::determine_register_per_element_width<Register_>();
+
+		/// <summary> W-coordinates of the samples within the lattice, before being floored. </summary>
+		Register_ lattice_w;
+		/// <summary> Floored lattice_w, wrapped into the range 0:period when looping. </summary>
+		Register_ cell_0;
+		/// <summary> Cells after cell_0, wrapped into the range 0:period when looping. </summary>
+		Register_ cell_1;
+
+		/// <summary> Calculates the W-axis cells of a batch of samples. </summary>
+		/// <param name="w_">W-coordinates to sample, before being scaled by frequency.</param>
+		/// <param name="freq_">Frequency that the samples are being generated at.</param>
+		/// <param name="period_">Period of W after which noise loops. Only used if loops_ is true, in which case every element must be greater than 0.</param>
+		/// <param name="loops_">If true, noise loops every period_; otherwise period_ is ignored.</param>
+		inline _fast_noise_4d_w_axis(Register_ w_, Register_ freq_, Register_ period_, bool loops_)
+		{
+			const Register_ one_ = EmuSIMD::set1<Register_>(1.0f);
+			if (loops_)
+			{
+				Register_ lattice_period_ = EmuSIMD::max(EmuSIMD::floor(EmuSIMD::add(EmuSIMD::mul_all(period_, freq_), EmuSIMD::set1<Register_>(0.5f))), one_);
+				lattice_w = EmuSIMD::mul_all(w_, EmuSIMD::div(lattice_period_, period_));
+
+				Register_ floor_w_ = EmuSIMD::floor(lattice_w);
+				cell_0 = EmuSIMD::sub(floor_w_, EmuSIMD::mul_all(EmuSIMD::floor(EmuSIMD::div(floor_w_, lattice_period_)), lattice_period_));
+				cell_0 = _wrap(cell_0, lattice_period_);
+				cell_1 = EmuSIMD::add(cell_0, one_);
+				cell_1 = EmuSIMD::blendv<per_element_width>(cell_1, EmuSIMD::sub(cell_1, lattice_period_), EmuSIMD::cmpge(cell_1, lattice_period_));
+
+				// Offset lattice_w so that subtracting cell_0 produces each sample's offset from its cell
+				lattice_w = EmuSIMD::add(cell_0, EmuSIMD::sub(lattice_w, floor_w_));
+			}
+			else
+			{
+				lattice_w = EmuSIMD::mul_all(w_, freq_);
+				cell_0 = EmuSIMD::floor(lattice_w);
+				cell_1 = EmuSIMD::add(cell_0, one_);
+			}
+		}
+
+	private:
+		[[nodiscard]] static inline Register_ _wrap(Register_ cell_, Register_ lattice_period_)
+		{
+			Register_ below_ = EmuSIMD::cmplt(cell_, EmuSIMD::setzero<Register_>());
+			Register_ above_ = EmuSIMD::cmpge(cell_, lattice_period_);
+			cell_ = EmuSIMD::blendv<per_element_width>(cell_, EmuSIMD::add(cell_, lattice_period_), below_);
+			return EmuSIMD::blendv<per_element_width>(cell_, EmuSIMD::sub(cell_, lattice_period_), EmuSIMD::bitwise_andnot(below_, above_));
+		}
+	};
+
+	/// <summary>
+	/// <para> Calculates the permutation hash of all 16 corners of the 4D lattice cells of a batch of samples. </para>
+	/// <para> Output corners are indexed as XYZW bits, where X is the most significant (e.g. [12] is 1100). </para>
+	/// </summary>
+	/// <param name="permutations_">Permutations to hash lattice indices with.</param>
+	/// <param name="indices_">Masked lower ([n][0]) and upper ([n][1]) lattice indices of each axis, in the order X, Y, Z, W.</param>
+	/// <param name="out_hashes_">Array to output the hash of each corner to.</param>
+	template<class FloatRegister_, class IntRegister_>
+	inline void _fast_noise_4d_corner_hashes(const EmuMath::NoisePermutations& permutations_, const IntRegister_(&indices_)[4][2], IntRegister_(&out_hashes_)[16])
+	{
+		constexpr std::size_t per_element_width = EmuSIMD::TMP::determine_register_per_element_width<FloatRegister_>();
+
+		IntRegister_ perm_x_[2];
+		for (std::size_t x = 0; x < 2; ++x)
+		{
+			perm_x_[x] = _fast_lookup_permutations<FloatRegister_>(permutations_, indices_[0][x]);
+		}
+
+		IntRegister_ perm_xy_[4];
+		for (std::size_t xy = 0; xy < 4; ++xy)
+		{
+			perm_xy_[xy] = _fast_lookup_permutations<FloatRegister_>(permutations_, EmuSIMD::add<per_element_width>(perm_x_[xy >> 1], indices_[1][xy & 1]));
+		}
+
+		IntRegister_ perm_xyz_[8];
+		for (std::size_t xyz = 0; xyz < 8; ++xyz)
+		{
+			perm_xyz_[xyz] = _fast_lookup_permutations<FloatRegister_>(permutations_, EmuSIMD::add<per_element_width>(perm_xy_[xyz >> 1], indices_[2][xyz & 1]));
+		}
+
+		for (std::size_t xyzw = 0; xyzw < 16; ++xyzw)
+		{
+			out_hashes_[xyzw] = _fast_lookup_permutations<FloatRegister_>(permutations_, EmuSIMD::add<per_element_width>(perm_xyz_[xyzw >> 1], indices_[3][xyzw & 1]));
+		}
+	}
+
+	/// <summary> Register equivalent of noise_4d_interpolate_corners, interpolating 16 corners along W, then Z, then Y, then X. </summary>
+	template<class Register_>
+	[[nodiscard]] inline Register_ _fast_noise_4d_interpolate_corners(const Register_(&corners_)[16], Register_ tx_, Register_ ty_, Register_ tz_, Register_ tw_)
+	{
+		Register_ along_w_[8];
+		for (std::size_t i = 0; i < 8; ++i)
+		{
+			along_w_[i] = EmuSIMD::fused_lerp(corners_[i * 2], corners_[i * 2 + 1], tw_);
+		}
+		Register_ along_z_[4];
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			along_z_[i] = EmuSIMD::fused_lerp(along_w_[i * 2], along_w_[i * 2 + 1], tz_);
+		}
+		return EmuSIMD::fused_lerp(EmuSIMD::fused_lerp(along_z_[0], along_z_[1], ty_), EmuSIMD::fused_lerp(along_z_[2], along_z_[3], ty_), tx_);
+	}
+
+	/// <summary> Common members of make_fast_noise_4d specialisations: register typedefs, the W-period, and conversions between lattice coordinates and indices. </summary>
+	template<class Register_>
+	struct _fast_noise_4d_base
+	{
+		using register_type = typename std::remove_cvref<Register_>::type;
+		using int_register_type = typename EmuSIMD::TMP::register_as_integral<register_type>::type;
+		using scalar_fp = typename std::conditional
+		<
+			EmuCore::TMP::is_any_comparison_true<std::is_same, register_type, EmuSIMD::f32x4, EmuSIMD::f32x8, EmuSIMD::f32x16>::value,
+			float,
+			double
+		>::type;
+		static constexpr std::size_t num_elements_per_register = EmuSIMD::TMP::determine_register_element_count<register_type>();
+		static constexpr std::size_t per_element_width = EmuSIMD::TMP::determine_register_per_element_width<register_type>();
+		static constexpr bool is_signed = true;
+
+		inline _fast_noise_4d_base(scalar_fp w_period_) :
+			w_period(EmuSIMD::set1<register_type>(w_period_ > scalar_fp(0) ? w_period_ : scalar_fp(1))),
+			loops(w_period_ > scalar_fp(0))
+		{
+		}
+
+		[[nodiscard]] inline _fast_noise_4d_w_axis<register_type> make_w_axis(register_type points_w_, register_type freq_) const
+		{
+			return _fast_noise_4d_w_axis<register_type>(points_w_, freq_, w_period, loops);
+		}
+
+		[[nodiscard]] static inline int_register_type to_index(register_type floored_, int_register_type permutations_mask_)
+		{
+			return EmuSIMD::bitwise_and
+			(
+				EmuSIMD::convert<int_register_type, per_element_width, is_signed, per_element_width, is_signed>(floored_),
+				permutations_mask_
+			);
+		}
+
+		[[nodiscard]] static inline register_type to_fp(int_register_type values_)
+		{
+			return EmuSIMD::convert<register_type, per_element_width, is_signed, per_element_width, is_signed>(values_);
+		}
+
+		/// <summary> Period of W after which noise loops. Set to 1 if noise does not loop, to avoid divisions by 0. </summary>
+		register_type w_period;
+		/// <summary> True if noise loops after w_period. </summary>
+		bool loops;
+	};
+}
+
+namespace EmuMath::Functors
+{
+	/// <summary>
+	/// <para> Functor to produce 4-dimensional noise for every element of the provided registers, most commonly used to animate 3D noise by treating W as time. </para>
+	/// <para> A W-period may be provided on construction, in which case noise loops seamlessly every time W advances by that period. </para>
+	/// <para> All implemented NoiseTypes support every floating-point register, with permutation lookups gathered where supported. </para>
+	/// </summary>
+	template<EmuMath::NoiseType NoiseType_, class Register_ = __m128>
+	struct make_fast_noise_4d
+	{
+		static_assert(EmuMath::Validity::assert_valid_noise_type<NoiseType_>(), "Invalid NoiseType_ argument provided to EmuMath::Functors::make_fast_noise_4d.");
+		static_assert(EmuMath::Validity::_assert_fast_noise_4d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_4d.");
+		constexpr make_fast_noise_4d()
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to construct a make_fast_noise_4d instance for a NoiseType that has not been implemented.");
+		}
+	};
+
+	template<EmuConcepts::KnownSIMD SIMDRegister_>
+	requires((EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>))
+	struct make_fast_noise_4d<EmuMath::NoiseType::VALUE, SIMDRegister_> : public _underlying_noise_gen::_fast_noise_4d_base<SIMDRegister_>
+	{
+		using base_type = _underlying_noise_gen::_fast_noise_4d_base<SIMDRegister_>;
+		using typename base_type::register_type;
+		using typename base_type::int_register_type;
+		using typename base_type::scalar_fp;
+		using base_type::per_element_width;
+
+		inline make_fast_noise_4d(scalar_fp w_period_ = scalar_fp(0)) : base_type(w_period_)
+		{
+		}
+
+		[[nodiscard]] inline auto operator()
+		(
+			register_type points_x_,
+			register_type points_y_,
+			register_type points_z_,
+			register_type points_w_,
+			typename EmuSIMD::TMP::register_as_arg_type<register_type>::type freq_,
+			typename EmuSIMD::TMP::register_as_arg_type<int_register_type>::type permutations_mask_128_,
+			const EmuMath::NoisePermutations& permutations_
+		) -> register_type
+		{
+			_underlying_noise_gen::_fast_noise_4d_w_axis<register_type> w_axis_ = this->make_w_axis(points_w_, freq_);
+			int_register_type ix_ = this->to_index(EmuSIMD::floor(EmuSIMD::mul_all(points_x_, freq_)), permutations_mask_128_);
+			int_register_type iy_ = this->to_index(EmuSIMD::floor(EmuSIMD::mul_all(points_y_, freq_)), permutations_mask_128_);
+			int_register_type iz_ = this->to_index(EmuSIMD::floor(EmuSIMD::mul_all(points_z_, freq_)), permutations_mask_128_);
+			int_register_type iw_ = this->to_index(w_axis_.cell_0, permutations_mask_128_);
+
+			int_register_type perms_ = _lookup(permutations_, ix_);
+			perms_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perms_, iy_));
+			perms_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perms_, iz_));
+			perms_ = _lookup(permutations_, EmuSIMD::add<per_element_width>(perms_, iw_));
+			return EmuSIMD::div(this->to_fp(perms_), this->to_fp(permutations_mask_128_));
+		}
+
+	private:
+		[[nodiscard]] static inline int_register_type _lookup(const EmuMath::NoisePermutations& permutations_, int_register_type indices_)
+		{
+			return _underlying_noise_gen::_fast_lookup_permutations<register_type>(permutations_, indices_);
+		}
+	};
+
+	template<EmuConcepts::KnownSIMD SIMDRegister_>
+	requires((EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>))
+	struct make_fast_noise_4d<EmuMath::NoiseType::VALUE_SMOOTH, SIMDRegister_> : public _underlying_noise_gen::_fast_noise_4d_base<SIMDRegister_>
+	{
+		using base_type = _underlying_noise_gen::_fast_noise_4d_base<SIMDRegister_>;
+		using typename base_type::register_type;
+		using typename base_type::int_register_type;
+		using typename base_type::scalar_fp;
+		using base_type::per_element_width;
+
+		inline make_fast_noise_4d(scalar_fp w_period_ = scalar_fp(0)) : base_type(w_period_), smooth_t()
+		{
+		}
+
+		[[nodiscard]] inline auto operator()
+		(
+			register_type points_x_,
+			register_type points_y_,
+			register_type points_z_,
+			register_type points_w_,
+			typename EmuSIMD::TMP::register_as_arg_type<register_type>::type freq_,
+			typename EmuSIMD::TMP::register_as_arg_type<int_register_type>::type permutations_mask_128_,
+			const EmuMath::NoisePermutations& permutations_
+		) -> register_type
+		{
+			_underlying_noise_gen::_fast_noise_4d_w_axis<register_type> w_axis_ = this->make_w_axis(points_w_, freq_);
+			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
+			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
+			points_z_ = EmuSIMD::mul_all(points_z_, freq_);
+			register_type floor_x_ = EmuSIMD::floor(points_x_);
+			register_type floor_y_ = EmuSIMD::floor(points_y_);
+			register_type floor_z_ = EmuSIMD::floor(points_z_);
+
+			const register_type one_ = EmuSIMD::set1<register_type>(1.0f);
+			int_register_type indices_[4][2];
+			indices_[0][0] = this->to_index(floor_x_, permutations_mask_128_);
+			indices_[1][0] = this->to_index(floor_y_, permutations_mask_128_);
+			indices_[2][0] = this->to_index(floor_z_, permutations_mask_128_);
+			indices_[3][0] = this->to_index(w_axis_.cell_0, permutations_mask_128_);
+			indices_[0][1] = this->to_index(EmuSIMD::add(floor_x_, one_), permutations_mask_128_);
+			indices_[1][1] = this->to_index(EmuSIMD::add(floor_y_, one_), permutations_mask_128_);
+			indices_[2][1] = this->to_index(EmuSIMD::add(floor_z_, one_), permutations_mask_128_);
+			indices_[3][1] = this->to_index(w_axis_.cell_1, permutations_mask_128_);
+
+			int_register_type hashes_[16];
+			_underlying_noise_gen::_fast_noise_4d_corner_hashes<register_type>(permutations_, indices_, hashes_);
+
+			register_type corners_[16];
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				corners_[i] = this->to_fp(hashes_[i]);
+			}
+
+			return EmuSIMD::div
+			(
+				_underlying_noise_gen::_fast_noise_4d_interpolate_corners
+				(
+					corners_,
+					smooth_t(EmuSIMD::sub(points_x_, floor_x_)),
+					smooth_t(EmuSIMD::sub(points_y_, floor_y_)),
+					smooth_t(EmuSIMD::sub(points_z_, floor_z_)),
+					smooth_t(EmuSIMD::sub(w_axis_.lattice_w, w_axis_.cell_0))
+				),
+				this->to_fp(permutations_mask_128_)
+			);
+		}
+
+		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<register_type> smooth_t;
+	};
+
+	/// <summary>
+	/// <para> Functor to produce 4-dimensional smooth perlin noise for every element of the provided registers. Produced noise targets the range -1:1. </para>
+	/// <para> Gradients are selected from hashes in registers via _fast_perlin_gradient_dot_4d, so no per-element gradient lookups are performed. </para>
+	/// </summary>
+	template<EmuConcepts::KnownSIMD SIMDRegister_>
+	requires((EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>))
+	struct make_fast_noise_4d<EmuMath::NoiseType::PERLIN, SIMDRegister_> : public _underlying_noise_gen::_fast_noise_4d_base<SIMDRegister_>
+	{
+		using base_type = _underlying_noise_gen::_fast_noise_4d_base<SIMDRegister_>;
+		using typename base_type::register_type;
+		using typename base_type::int_register_type;
+		using typename base_type::scalar_fp;
+		using base_type::per_element_width;
+
+		inline make_fast_noise_4d(scalar_fp w_period_ = scalar_fp(0)) : base_type(w_period_), smooth_t()
+		{
+		}
+
+		[[nodiscard]] inline auto operator()
+		(
+			register_type points_x_,
+			register_type points_y_,
+			register_type points_z_,
+			register_type points_w_,
+			typename EmuSIMD::TMP::register_as_arg_type<register_type>::type freq_,
+			typename EmuSIMD::TMP::register_as_arg_type<int_register_type>::type permutations_mask_128_,
+			const EmuMath::NoisePermutations& permutations_
+		) -> register_type
+		{
+			_underlying_noise_gen::_fast_noise_4d_w_axis<register_type> w_axis_ = this->make_w_axis(points_w_, freq_);
+			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
+			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
+			points_z_ = EmuSIMD::mul_all(points_z_, freq_);
+			register_type floor_x_ = EmuSIMD::floor(points_x_);
+			register_type floor_y_ = EmuSIMD::floor(points_y_);
+			register_type floor_z_ = EmuSIMD::floor(points_z_);
+
+			// Offsets from the lower ([n][0]) and upper ([n][1]) cell on each axis
+			const register_type one_ = EmuSIMD::set1<register_type>(1.0f);
+			register_type offsets_[4][2];
+			offsets_[0][0] = EmuSIMD::sub(points_x_, floor_x_);
+			offsets_[1][0] = EmuSIMD::sub(points_y_, floor_y_);
+			offsets_[2][0] = EmuSIMD::sub(points_z_, floor_z_);
+			offsets_[3][0] = EmuSIMD::sub(w_axis_.lattice_w, w_axis_.cell_0);
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				offsets_[i][1] = EmuSIMD::sub(offsets_[i][0], one_);
+			}
+
+			int_register_type indices_[4][2];
+			indices_[0][0] = this->to_index(floor_x_, permutations_mask_128_);
+			indices_[1][0] = this->to_index(floor_y_, permutations_mask_128_);
+			indices_[2][0] = this->to_index(floor_z_, permutations_mask_128_);
+			indices_[3][0] = this->to_index(w_axis_.cell_0, permutations_mask_128_);
+			indices_[0][1] = this->to_index(EmuSIMD::add(floor_x_, one_), permutations_mask_128_);
+			indices_[1][1] = this->to_index(EmuSIMD::add(floor_y_, one_), permutations_mask_128_);
+			indices_[2][1] = this->to_index(EmuSIMD::add(floor_z_, one_), permutations_mask_128_);
+			indices_[3][1] = this->to_index(w_axis_.cell_1, permutations_mask_128_);
+
+			int_register_type hashes_[16];
+			_underlying_noise_gen::_fast_noise_4d_corner_hashes<register_type>(permutations_, indices_, hashes_);
+
+			register_type corners_[16];
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				corners_[i] = _underlying_noise_gen::_fast_perlin_gradient_dot_4d
+				(
+					hashes_[i],
+					offsets_[0][(i >> 3) & 1],
+					offsets_[1][(i >> 2) & 1],
+					offsets_[2][(i >> 1) & 1],
+					offsets_[3][i & 1]
+				);
+			}
+
+			return _underlying_noise_gen::_fast_noise_4d_interpolate_corners
+			(
+				corners_,
+				smooth_t(offsets_[0][0]),
+				smooth_t(offsets_[1][0]),
+				smooth_t(offsets_[2][0]),
+				smooth_t(offsets_[3][0])
+			);
+		}
+
+		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<register_type> smooth_t;
+	};
+
+	/// <summary>
+	/// <para> Generator which samples a 3D slice of 4D noise at a fixed W, allowing 4D generators to be used wherever 3D batches of points are generated. </para>
+	/// <para> The wrapped generator must be invocable with 4 coordinate registers, such as fractal_noise_wrapper or no_fractal_noise_wrapper of a make_fast_noise_4d generator. </para>
+	/// </summary>
+	template<class Generator_, EmuConcepts::KnownSIMD SIMDRegister_>
+	requires(EmuSIMD::TMP::is_floating_point_simd_register_v<SIMDRegister_>)
+	struct fast_noise_time_slice_wrapper
+	{
+	public:
+		using generator_type = Generator_;
+		using register_type = typename std::remove_cvref<SIMDRegister_>::type;
+		/// <summary> Float if __m128, __m256, or __m512 is the register type. Otherwise double, due to implied __m128d, __m256d, or __m512d. </summary>
+		using value_type = std::conditional_t
+		<
+			EmuCore::TMP::is_any_comparison_true<std::is_same, register_type, EmuSIMD::f32x4, EmuSIMD::f32x8, EmuSIMD::f32x16>::value,
+			float,
+			double
+		>;
+
+		inline fast_noise_time_slice_wrapper(generator_type generator_, value_type time_) :
+			generator(std::move(generator_)),
+			time(EmuSIMD::set1<register_type>(time_))
+		{
+		}
+
+		[[nodiscard]] inline register_type operator()(register_type points_x_, register_type points_y_, register_type points_z_)
+		{
+			return generator(points_x_, points_y_, points_z_, time);
+		}
+
+		generator_type generator;
+		register_type time;
+	};
+}
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef EMU_MATH_DOMAIN_WARP_INFO_H_INC_
+#define EMU_MATH_DOMAIN_WARP_INFO_H_INC_ 1
+
+#include "_fractal_noise_info.h"
+#include "_noise_permutation_info.h"
+#include "../_noise_tmp.h"
+
+namespace EmuMath::Info
+{
+	/// <summary>
+	/// <para> Informative data structure describing the noise used to warp the points of a noise table before its samples are generated. </para>
+	/// <para> Each axis of a point is offset by warp noise sampled at that point, multiplied by amplitude. Offsets are applied before the table's own frequency. </para>
+	/// </summary>
+	template<typename FP_>
+	struct DomainWarpInfo
+	{
+	public:
+		static_assert(EmuMath::TMP::assert_valid_noise_table_sample_type<FP_>(), "Provided an invalid FP_ to instantiate an EmuMath::Info::DomainWarpInfo template.");
+		using value_type = FP_;
+		using fractal_info_type = EmuMath::Info::FractalNoiseInfo<value_type>;
+
+		static constexpr value_type _default_amplitude = value_type(1);
+		static constexpr value_type _default_freq = value_type(1);
+		static constexpr bool _default_use_fractal_noise = false;
+
+		DomainWarpInfo() :
+			DomainWarpInfo
+			(
+				_default_amplitude,
+				_default_freq,
+				_default_use_fractal_noise,
+				EmuMath::Info::NoisePermutationInfo(),
+				fractal_info_type()
+			)
+		{
+		}
+		constexpr DomainWarpInfo
+		(
+			value_type amplitude_,
+			value_type freq_,
+			bool use_fractal_noise_,
+			const EmuMath::Info::NoisePermutationInfo& permutation_info_,
+			const fractal_info_type& fractal_noise_info_
+		) :
+			amplitude(amplitude_),
+			freq(freq_),
+			use_fractal_noise(use_fractal_noise_),
+			permutation_info(permutation_info_),
+			fractal_noise_info(fractal_noise_info_)
+		{
+		}
+		constexpr DomainWarpInfo(const DomainWarpInfo& to_copy_) :
+			DomainWarpInfo
+			(
+				to_copy_.amplitude,
+				to_copy_.freq,
+				to_copy_.use_fractal_noise,
+				to_copy_.permutation_info,
+				to_copy_.fractal_noise_info
+			)
+		{
+		}
+
+		/// <summary> Multiplier applied to warp noise to form the offset applied to each axis of a point. </summary>
+		value_type amplitude;
+		/// <summary> Frequency multiplier to apply to points when generating warp noise. </summary>
+		value_type freq;
+		/// <summary> Boolean indicating if fractal noise generation should be used for warp noise. </summary>
+		bool use_fractal_noise;
+		/// <summary> Informative data structure for creating the permutations used to generate warp noise. </summary>
+		EmuMath::Info::NoisePermutationInfo permutation_info;
+		/// <summary> Informative data structure for use when use_fractal_noise is true only. </summary>
+		fractal_info_type fractal_noise_info;
+	};
+}
+
+#endif
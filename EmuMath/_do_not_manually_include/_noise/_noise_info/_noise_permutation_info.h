@@ -43,6 +43,7 @@ namespace EmuMath::Info
 		static constexpr std::size_t _default_permutation_count = 512;
 		static constexpr EmuMath::Info::NoisePermutationShuffleMode _default_shuffle_mode = EmuMath::Info::NoisePermutationShuffleMode::DEFAULT;
 		static constexpr bool _default_bool_input = true;
+		static constexpr std::size_t _default_tile_period = 0;
 		static seed_32_type _default_seed_32() { return EmuMath::NoisePermutations::default_seed_32(); }
 		static seed_64_type _default_seed_64() { return EmuMath::NoisePermutations::default_seed_64(); }
 
@@ -53,7 +54,8 @@ namespace EmuMath::Info
 				_default_shuffle_mode,
 				_default_bool_input,
 				_default_seed_32(),
-				_default_seed_64()
+				_default_seed_64(),
+				_default_tile_period
 			)
 		{
 		}
@@ -63,13 +65,15 @@ namespace EmuMath::Info
 			EmuMath::Info::NoisePermutationShuffleMode shuffle_mode_,
 			bool bool_input_,
 			seed_32_type seed_32_,
-			seed_64_type seed_64_
+			seed_64_type seed_64_,
+			std::size_t tile_period_ = _default_tile_period
 		) :
 			target_num_permutations(target_num_permutations_),
 			shuffle_mode(shuffle_mode_),
 			bool_input(bool_input_),
 			seed_32(seed_32_),
-			seed_64(seed_64_)
+			seed_64(seed_64_),
+			tile_period(tile_period_)
 		{
 		}
 		constexpr NoisePermutationInfo(const NoisePermutationInfo& to_copy_) :
@@ -79,7 +83,8 @@ namespace EmuMath::Info
 				to_copy_.shuffle_mode,
 				to_copy_.bool_input,
 				to_copy_.seed_32,
-				to_copy_.seed_64
+				to_copy_.seed_64,
+				to_copy_.tile_period
 			)
 		{
 		}
@@ -117,25 +122,77 @@ namespace EmuMath::Info
 
 		[[nodiscard]] inline EmuMath::NoisePermutations MakePermutations() const
 		{
+			return MakePermutationsAs<EmuMath::NoisePermutationValue, EmuMath::NoisePermutations::is_doubled>();
+		}
+
+		/// <summary>
+		/// <para> Creates permutations as described by this info, stored as the provided value type and optionally in a doubled layout. </para>
+		/// <para> The number of permutations is limited to the maximum size of the output sequence type, so narrow types such as std::uint8_t will contain at most 256 permutations. </para>
+		/// <para> Shuffling is independent of the stored type, so permutations of the same count will contain the same sequence regardless of Value_. </para>
+		/// </summary>
+		/// <returns>Shuffled sequence of permutations stored as the provided Value_ type.</returns>
+		template<typename Value_, bool Doubled_ = false>
+		[[nodiscard]] inline EmuMath::ShuffledIntSequence<Value_, Doubled_> MakePermutationsAs() const
+		{
+			using out_sequence = EmuMath::ShuffledIntSequence<Value_, Doubled_>;
+			std::size_t count_ = TargetCountToPowerOf2();
+			if (count_ > out_sequence::max_size())
+			{
+				count_ = EmuCore::ArithmeticHelpers::highest_set_bit<std::size_t>(out_sequence::max_size());
+			}
+
 			switch (EmuMath::Info::validate_noise_permutation_shuffle_mode(shuffle_mode))
 			{
 				case EmuMath::Info::NoisePermutationShuffleMode::SEED_32:
-					return EmuMath::NoisePermutations(TargetCountToPowerOf2(), seed_32);
+					return _apply_tile_period(out_sequence(count_, seed_32));
 					break;
 				case EmuMath::Info::NoisePermutationShuffleMode::SEED_64:
-					return EmuMath::NoisePermutations(TargetCountToPowerOf2(), seed_64);
+					return _apply_tile_period(out_sequence(count_, seed_64));
 					break;
 				default:
-					return EmuMath::NoisePermutations(TargetCountToPowerOf2(), bool_input);
+					return _apply_tile_period(out_sequence(count_, bool_input));
 					break;
 			}
 		}
 
+		/// <summary>
+		/// <para> The tile period that permutations made from this info will wrap lattice coordinates with, rounded to the previous power of 2. </para>
+		/// <para> Returns 0 if tiling is disabled, which is also the case where tile_period is at least the number of permutations. </para>
+		/// </summary>
+		[[nodiscard]] inline std::size_t TilePeriodToPowerOf2() const
+		{
+			if (tile_period == 0 || tile_period >= TargetCountToPowerOf2())
+			{
+				return 0;
+			}
+			else
+			{
+				return EmuCore::ArithmeticHelpers::highest_set_bit<std::size_t>(tile_period);
+			}
+		}
+
 		std::size_t target_num_permutations;
 		EmuMath::Info::NoisePermutationShuffleMode shuffle_mode;
 		bool bool_input;
 		seed_32_type seed_32;
 		seed_64_type seed_64;
+		/// <summary>
+		/// <para> If non-zero, permutations are laid out periodically so that all lattice coordinates used for hashing wrap modulo this many cells. </para>
+		/// <para> 
+		///		This makes noise seamlessly tile every (tile_period / freq) units, at no cost to generation. 
+		///		Fractal noise additionally requires an integral lacunarity to tile, and simplex noise does not tile as its lattice is skewed. 
+		/// </para>
+		/// <para> Should be a power of 2 less than the number of permutations, and will be rounded down to one otherwise. 0 disables tiling. </para>
+		/// </summary>
+		std::size_t tile_period;
+
+	private:
+		template<class Sequence_>
+		[[nodiscard]] inline Sequence_ _apply_tile_period(Sequence_&& sequence_) const
+		{
+			const std::size_t tile_period_ = TilePeriodToPowerOf2();
+			return tile_period_ == 0 ? std::move(sequence_) : sequence_.AsPeriodic(tile_period_);
+		}
 	};
 }
 
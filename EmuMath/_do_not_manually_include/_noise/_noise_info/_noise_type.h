@@ -14,9 +14,73 @@ namespace EmuMath
 		// Value noise with no smoothing
 		VALUE = 0x02,
 		// Value noise with smoothing applied
-		VALUE_SMOOTH = 0x04
+		VALUE_SMOOTH = 0x04,
+		// Simplex noise, evaluating one gradient per corner of the simplex containing each point rather than per corner of a hypercube
+		SIMPLEX = 0x08,
+		// Cellular (Worley) noise outputting the Euclidean distance to the nearest feature point (F1)
+		CELLULAR = 0x10,
+		// Cellular noise outputting the Euclidean distance to the second-nearest feature point (F2)
+		CELLULAR_F2 = 0x11,
+		// Cellular noise outputting the difference between the Euclidean distances to the second-nearest and nearest feature points (F2 - F1)
+		CELLULAR_F2_MINUS_F1 = 0x12,
+		// Cellular noise outputting the Manhattan distance to the nearest feature point (F1)
+		CELLULAR_MANHATTAN = 0x14,
+		// Cellular noise outputting the Manhattan distance to the second-nearest feature point (F2)
+		CELLULAR_F2_MANHATTAN = 0x15,
+		// Cellular noise outputting the difference between the Manhattan distances to the second-nearest and nearest feature points (F2 - F1)
+		CELLULAR_F2_MINUS_F1_MANHATTAN = 0x16,
+		// Cellular noise outputting the Chebyshev distance to the nearest feature point (F1)
+		CELLULAR_CHEBYSHEV = 0x18,
+		// Cellular noise outputting the Chebyshev distance to the second-nearest feature point (F2)
+		CELLULAR_F2_CHEBYSHEV = 0x19,
+		// Cellular noise outputting the difference between the Chebyshev distances to the second-nearest and nearest feature points (F2 - F1)
+		CELLULAR_F2_MINUS_F1_CHEBYSHEV = 0x1A
 	};
 
+	/// <summary> Value output by cellular NoiseTypes, identified by the lowest 2 bits of a cellular NoiseType. </summary>
+	enum class CellularNoiseOutput : std::uint8_t
+	{
+		// Distance to the nearest feature point
+		F1 = 0x00,
+		// Distance to the second-nearest feature point
+		F2 = 0x01,
+		// Difference between the distances to the second-nearest and nearest feature points
+		F2_MINUS_F1 = 0x02
+	};
+
+	/// <summary> Distance metric used by cellular NoiseTypes, identified by bits 2:3 of a cellular NoiseType. </summary>
+	enum class CellularNoiseDistance : std::uint8_t
+	{
+		EUCLIDEAN = 0x00,
+		MANHATTAN = 0x04,
+		CHEBYSHEV = 0x08
+	};
+
+	/// <summary> Returns a boolean indicating if the passed NoiseType is one of the cellular NoiseTypes. </summary>
+	[[nodiscard]] constexpr inline bool is_cellular_noise_type(const NoiseType noise_type_)
+	{
+		const std::uint8_t bits_ = static_cast<std::uint8_t>(noise_type_);
+		return (bits_ & 0xF0) == 0x10 && (bits_ & 0x03) != 0x03 && (bits_ & 0x0C) != 0x0C;
+	}
+
+	/// <summary> Returns the CellularNoiseOutput of the passed NoiseType. This is only meaningful if is_cellular_noise_type(noise_type_) is true. </summary>
+	[[nodiscard]] constexpr inline CellularNoiseOutput cellular_noise_output(const NoiseType noise_type_)
+	{
+		return static_cast<CellularNoiseOutput>(static_cast<std::uint8_t>(noise_type_) & 0x03);
+	}
+
+	/// <summary> Returns the CellularNoiseDistance of the passed NoiseType. This is only meaningful if is_cellular_noise_type(noise_type_) is true. </summary>
+	[[nodiscard]] constexpr inline CellularNoiseDistance cellular_noise_distance(const NoiseType noise_type_)
+	{
+		return static_cast<CellularNoiseDistance>(static_cast<std::uint8_t>(noise_type_) & 0x0C);
+	}
+
+	/// <summary> Returns the cellular NoiseType which outputs the passed CellularNoiseOutput using the passed CellularNoiseDistance. </summary>
+	[[nodiscard]] constexpr inline NoiseType make_cellular_noise_type(const CellularNoiseOutput output_, const CellularNoiseDistance distance_)
+	{
+		return static_cast<NoiseType>(static_cast<std::uint8_t>(NoiseType::CELLULAR) | static_cast<std::uint8_t>(output_) | static_cast<std::uint8_t>(distance_));
+	}
+
 	namespace Validity
 	{
 		[[nodiscard]] constexpr inline bool is_valid_noise_type(const NoiseType noise_type_)
@@ -28,7 +92,9 @@ namespace EmuMath
 			(
 				noise_type_ == NoiseType::PERLIN ||
 				noise_type_ == NoiseType::VALUE ||
-				noise_type_ == NoiseType::VALUE_SMOOTH
+				noise_type_ == NoiseType::VALUE_SMOOTH ||
+				noise_type_ == NoiseType::SIMPLEX ||
+				is_cellular_noise_type(noise_type_)
 			);
 			EMU_CORE_MSVC_POP_WARNING_STACK
 		}
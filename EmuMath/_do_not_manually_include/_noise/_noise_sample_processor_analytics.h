@@ -2,10 +2,21 @@
 #define EMU_MATH_NOISE_SAMPLE_PROCESSOR_ANALYTICS_H_INC_
 
 #include "../../../EmuCore/TMPHelpers/Values.h"
+#include <cstddef>
 #include <tuple>
+#include <type_traits>
 
 namespace EmuMath::Functors
 {
+	namespace _underlying_noise_analytics
+	{
+		template<class Analytic_>
+		concept MergeableAnalytic = requires(Analytic_& analytic_, const Analytic_& other_)
+		{
+			analytic_.Merge(other_);
+		};
+	}
+
 	template<class Processor_, class...AnalyticFunctors_>
 	struct noise_sample_processor_with_analytics
 	{
@@ -82,6 +93,41 @@ namespace EmuMath::Functors
 			return sample_;
 		}
 
+		/// <summary>
+		/// <para> Processes a batch of samples where only the first num_valid_elements_ are part of the output, such as the final batch of a row. </para>
+		/// <para> Analytics which may be invoked with the number of valid elements are passed it, so that samples outside of the output are not analysed. </para>
+		/// </summary>
+		template<typename Sample_>
+		[[nodiscard]] constexpr inline Sample_ operator()(Sample_ sample_, const std::size_t num_valid_elements_)
+		{
+			sample_ = underlying_processor(sample_);
+			_do_partial_analysis<0, Sample_>(sample_, num_valid_elements_);
+			return sample_;
+		}
+
+		/// <summary> Resets all analytics which have a Reset function. The underlying processor is unaffected. </summary>
+		inline void Reset()
+		{
+			std::apply
+			(
+				[](auto&...analytics_)
+				{
+					(_reset_analytic(analytics_), ...);
+				},
+				analytics
+			);
+		}
+
+		/// <summary>
+		/// <para> Merges the analytics of another processor into those of this processor, such as when combining per-thread results. </para>
+		/// <para> Only available when all analytics have a Merge function. </para>
+		/// </summary>
+		inline void Merge(const noise_sample_processor_with_analytics& other_)
+			requires((_underlying_noise_analytics::MergeableAnalytic<AnalyticFunctors_> && ...))
+		{
+			_do_merge<0>(other_);
+		}
+
 		processor_type underlying_processor;
 		analytic_tuple analytics;
 
@@ -96,6 +142,45 @@ namespace EmuMath::Functors
 				_do_analysis<Index_ + 1, Sample_>(processed_sample_);
 			}
 		}
+
+		template<std::size_t Index_, typename Sample_>
+		inline void _do_partial_analysis(const Sample_& processed_sample_, const std::size_t num_valid_elements_)
+		{
+			if constexpr (Index_ < num_analytics)
+			{
+				using std::get;
+				auto& analytic_ = get<Index_>(analytics);
+				if constexpr (std::is_invocable_v<decltype(analytic_), const Sample_&, std::size_t>)
+				{
+					analytic_(processed_sample_, num_valid_elements_);
+				}
+				else
+				{
+					analytic_(processed_sample_);
+				}
+				_do_partial_analysis<Index_ + 1, Sample_>(processed_sample_, num_valid_elements_);
+			}
+		}
+
+		template<std::size_t Index_>
+		inline void _do_merge(const noise_sample_processor_with_analytics& other_)
+		{
+			if constexpr (Index_ < num_analytics)
+			{
+				using std::get;
+				get<Index_>(analytics).Merge(get<Index_>(other_.analytics));
+				_do_merge<Index_ + 1>(other_);
+			}
+		}
+
+		template<class Analytic_>
+		static inline void _reset_analytic(Analytic_& analytic_)
+		{
+			if constexpr (requires { analytic_.Reset(); })
+			{
+				analytic_.Reset();
+			}
+		}
 	};
 }
 
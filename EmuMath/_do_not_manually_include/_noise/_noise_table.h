@@ -4,18 +4,24 @@
 #include "_scalar_noise_functors.h"
 #include "_scalar_noise_sample_processors.h"
 #include "_noise_table_options.h"
+#include "_noise_table_export.h"
+#include "_noise_table_storage.h"
 #include "_noise_tmp.h"
 #include "../../../EmuCore/TMPHelpers/TypeComparators.h"
 #include "../../../EmuCore/TMPHelpers/TypeConvertors.h"
 #include "../../../EmuCore/TMPHelpers/Values.h"
+#include <algorithm>
 #include <ostream>
 #include <sstream>
 #include <vector>
 
 namespace EmuMath
 {
-	/// <summary> Class used to generate and store X-dimensional noise with customisable parameters. </summary>
-	template<std::size_t Dimensions_, typename SampleTypeFP_>
+	/// <summary>
+	/// <para> Class used to generate and store X-dimensional noise with customisable parameters. </para>
+	/// <para> StorageMode_ determines how samples are stored. FLAT storage keeps all samples in a single 64-byte-aligned allocation in X-Y-Z order, with Z contiguous. </para>
+	/// </summary>
+	template<std::size_t Dimensions_, typename SampleTypeFP_, EmuMath::NoiseTableStorageMode StorageMode_ = EmuMath::NoiseTableStorageMode::DEFAULT>
 	class NoiseTable
 	{
 	public:
@@ -26,20 +32,24 @@ namespace EmuMath
 		static constexpr std::size_t num_dimensions = Dimensions_;
 		/// <summary> Type used to store individual samples within this table. </summary>
 		using value_type = SampleTypeFP_;
-		using this_type = NoiseTable<num_dimensions, value_type>;
+		/// <summary> The way in which this table stores its samples. </summary>
+		static constexpr EmuMath::NoiseTableStorageMode storage_mode = StorageMode_;
+		/// <summary> Boolean indicating if this table stores its samples in a single flat allocation. </summary>
+		static constexpr bool is_flat = storage_mode == EmuMath::NoiseTableStorageMode::FLAT;
+		using this_type = NoiseTable<num_dimensions, value_type, storage_mode>;
 		using options_type = EmuMath::NoiseTableOptions<num_dimensions, value_type>;
 
 	private:
-		/// <summary>table_storage will be a Dimensions_-dimensional vector of value_types.</summary>
-		using table_storage = EmuMath::TMP::_full_noise_table_storage<num_dimensions, value_type>;
+		/// <summary>table_storage will be a Dimensions_-dimensional vector of value_types, or a single flat allocation of value_types if this table is flat.</summary>
+		using table_storage = EmuMath::TMP::_noise_table_storage<num_dimensions, value_type, storage_mode>;
 
 	public:
 		/// <summary> Type returned when accessing this table via a single scalar index. </summary>
-		using return_single_index = typename EmuMath::TMP::_noise_table_access<1, num_dimensions, value_type>::type;
+		using return_single_index = typename EmuMath::TMP::_noise_table_storage_access<1, num_dimensions, value_type, storage_mode>::type;
 		/// <summary> Type returned when accessing this table via 2 scalar indices. If void, 2-scalar index accesses are invalid on this table. </summary>
-		using return_double_index = typename EmuMath::TMP::_noise_table_access<2, num_dimensions, value_type>::type;
+		using return_double_index = typename EmuMath::TMP::_noise_table_storage_access<2, num_dimensions, value_type, storage_mode>::type;
 		/// <summary> Type returned when accessing this table via 3 scalar indices. If void, 3-scalar index accesses are invalid on this table. </summary>
-		using return_triple_index = typename EmuMath::TMP::_noise_table_access<3, num_dimensions, value_type>::type;
+		using return_triple_index = typename EmuMath::TMP::_noise_table_storage_access<3, num_dimensions, value_type, storage_mode>::type;
 
 		/// <summary> Default constructor which creates an empty noise table. </summary>
 		NoiseTable() : table_data(), table_size()
@@ -82,7 +92,18 @@ namespace EmuMath
 		/// <returns>Copy of the sample at the provided index if 1D; otherwise, a constant reference to the first layer of the table.</returns>
 		[[nodiscard]] inline return_single_index at(std::size_t index_x_) const
 		{
-			return table_data[index_x_];
+			if constexpr (is_flat && num_dimensions == 2)
+			{
+				return return_single_index(table_data.data() + _flat_index(index_x_, 0), { table_size.template at<1>() });
+			}
+			else if constexpr (is_flat && num_dimensions == 3)
+			{
+				return return_single_index(table_data.data() + _flat_index(index_x_, 0, 0), { table_size.template at<1>(), table_size.template at<2>() });
+			}
+			else
+			{
+				return table_data[index_x_];
+			}
 		}
 		/// <summary>
 		/// <para> Accesses the second layer of this noise table. </para>
@@ -95,7 +116,15 @@ namespace EmuMath
 		template<typename RequiresAtLeast2D_ = std::enable_if_t<num_dimensions >= 2>>
 		[[nodiscard]] inline return_double_index at(std::size_t index_x_, std::size_t index_y_) const
 		{
-			if constexpr (num_dimensions >= 2)
+			if constexpr (is_flat && num_dimensions == 2)
+			{
+				return table_data[_flat_index(index_x_, index_y_)];
+			}
+			else if constexpr (is_flat && num_dimensions == 3)
+			{
+				return return_double_index(table_data.data() + _flat_index(index_x_, index_y_, 0), { table_size.template at<2>() });
+			}
+			else if constexpr (num_dimensions >= 2)
 			{
 				return table_data[index_x_][index_y_];
 			}
@@ -112,7 +141,11 @@ namespace EmuMath
 		template<typename RequiresAtLeast3D_ = std::enable_if_t<num_dimensions >= 3>>
 		[[nodiscard]] inline return_triple_index at(std::size_t index_x_, std::size_t index_y_, std::size_t index_z_) const
 		{
-			if constexpr (num_dimensions >= 3)
+			if constexpr (is_flat && num_dimensions >= 3)
+			{
+				return table_data[_flat_index(index_x_, index_y_, index_z_)];
+			}
+			else if constexpr (num_dimensions >= 3)
 			{
 				return table_data[index_x_][index_y_][index_z_];
 			}
@@ -445,6 +478,25 @@ namespace EmuMath
 			to_swap_with_.table_size = temp_;
 		}
 
+		/// <summary>
+		/// <para> Provides constant access to the contiguous samples of this table. </para>
+		/// <para> Samples are stored in X-Y-Z order, with Z contiguous; the sample at (x, y, z) is at index ((x * size&lt;1&gt;()) + y) * size&lt;2&gt;() + z. </para>
+		/// <para> This method is only available for tables using FLAT storage. </para>
+		/// </summary>
+		/// <returns>Pointer to the first sample of this table, aligned to a 64-byte boundary.</returns>
+		[[nodiscard]] inline const value_type* data() const
+		{
+			if constexpr (is_flat)
+			{
+				return table_data.data();
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<std::size_t, num_dimensions>(), "Attempted to access the contiguous data of an EmuMath::NoiseTable which does not use FLAT storage.");
+				return nullptr;
+			}
+		}
+
 		/// <summary> Clears all data within this table. Heap deallocation is not guaranteed; for such behaviour, use Release instead. </summary>
 		inline void clear()
 		{
@@ -455,7 +507,7 @@ namespace EmuMath
 		inline void shrink_to_fit()
 		{
 			table_data.shrink_to_fit();
-			if constexpr (num_dimensions >= 2)
+			if constexpr (!is_flat && num_dimensions >= 2)
 			{
 				for (std::size_t x = 0, end_x_ = table_size.template at<0>(); x < end_x_; ++x)
 				{
@@ -509,6 +561,66 @@ namespace EmuMath
 		}
 #pragma endregion
 
+#pragma region EXPORT
+		/// <summary>
+		/// <para> Writes all samples of this table to the provided binary stream as raw 32-bit floats in native byte order, without any header. </para>
+		/// <para> Samples are written with X varying fastest, followed by Y and then Z. Samples of other types are converted to float a row at a time. </para>
+		/// </summary>
+		/// <param name="str_">Binary stream to write samples to.</param>
+		/// <returns>Reference to the passed stream.</returns>
+		inline std::ostream& WriteRawFloat32(std::ostream& str_) const
+		{
+			return EmuMath::_underlying_noise_export::write_raw_float32(str_, [this](auto& row_func_) { _for_each_export_row(row_func_); });
+		}
+
+		/// <summary>
+		/// <para> Writes this table to the provided binary stream as a 16-bit binary PGM (P5) image. This method is only available for 2-dimensional tables. </para>
+		/// <para> Each row of the image contains samples of increasing X, with rows written in order of increasing Y. </para>
+		/// <para> Samples are quantised so that min_ maps to 0 and max_ maps to 65535, with samples outside of this range clamped. </para>
+		/// </summary>
+		/// <param name="str_">Binary stream to write the image to.</param>
+		/// <param name="min_">Sample value to output as black.</param>
+		/// <param name="max_">Sample value to output as white.</param>
+		/// <returns>Reference to the passed stream.</returns>
+		template<std::size_t Unused_ = 0, typename OnlyAvailableFor2Dimensional_ = std::enable_if_t<Unused_ == 0 && num_dimensions == 2>>
+		inline std::ostream& WritePGM16(std::ostream& str_, const value_type min_ = value_type(0), const value_type max_ = value_type(1)) const
+		{
+			return EmuMath::_underlying_noise_export::write_pgm16
+			(
+				str_,
+				table_size.template at<0>(),
+				table_size.template at<1>(),
+				static_cast<float>(min_),
+				static_cast<float>(max_),
+				[this](auto& row_func_) { _for_each_export_row(row_func_); }
+			);
+		}
+
+		/// <summary>
+		/// <para> Quantises this table to 8-bit grayscale, invoking row_func_ for every row. This method is only available for 2-dimensional tables. </para>
+		/// <para>
+		///		row_func_ is invoked with a pointer to the row's samples as std::uint8_t, and the number of samples in the row.
+		///		Rows match PNG's 8-bit grayscale format without a filter byte, so they may be passed straight to row-based PNG encoders.
+		/// </para>
+		/// <para> Each row contains samples of increasing X, with rows provided in order of increasing Y. The quantised row is only valid during the call. </para>
+		/// </summary>
+		/// <param name="row_func_">Function to invoke with every quantised row.</param>
+		/// <param name="min_">Sample value to output as 0.</param>
+		/// <param name="max_">Sample value to output as 255.</param>
+		template<class RowFunc_, std::size_t Unused_ = 0, typename OnlyAvailableFor2Dimensional_ = std::enable_if_t<Unused_ == 0 && num_dimensions == 2>>
+		inline void ForEachGrayscale8Row(RowFunc_&& row_func_, const value_type min_ = value_type(0), const value_type max_ = value_type(1)) const
+		{
+			EmuMath::_underlying_noise_export::for_each_grayscale8_row
+			(
+				table_size.template at<0>(),
+				static_cast<float>(min_),
+				static_cast<float>(max_),
+				[this](auto& export_row_func_) { _for_each_export_row(export_row_func_); },
+				row_func_
+			);
+		}
+#pragma endregion
+
 #pragma region GENERATION
 		/// <summary>
 		/// <para> Resizes and fills this table with noise samples created via the passed options. </para>
@@ -561,6 +673,63 @@ namespace EmuMath
 			return GenerateNoise<NoiseType_, SampleProcessor_&>(options_, sample_processor_);
 		}
 
+		/// <summary>
+		/// <para> Resizes and fills this 3-dimensional table with a 3D slice of 4D noise, sampling every point of this table at the W-coordinate time_. </para>
+		/// <para> If loop_period_ is greater than 0, noise loops seamlessly every time time_ advances by loop_period_ (see EmuMath::Functors::make_noise_4d). </para>
+		/// <para> The returned boolean indicates success. If this function returns false, the generation operation did not fully complete. </para>
+		/// </summary>
+		/// <typeparam name="SampleProcessor_">Functor to process noise samples further after generation. The default argument for this makes no change to samples.</typeparam>
+		/// <param name="options_">Options to create this table's samples via. Frequency and fractal octaves apply to time_ in the same way as to points.</param>
+		/// <param name="time_">W-coordinate to sample 4D noise at.</param>
+		/// <param name="loop_period_">Period of time_ after which noise loops. If this is less than or equal to 0, noise does not loop.</param>
+		/// <param name="SampleProcessor_">Functor to process final samples via. May be omitted to use the default construction of this functor.</param>
+		/// <returns>Boolean indicating the success of this generation operation; true only when generation is not cancelled.</returns>
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::noise_sample_processor_default>
+		inline bool GenerateNoiseAtTime(const options_type& options_, value_type time_, value_type loop_period_, SampleProcessor_ sample_processor_)
+		{
+			static_assert(num_dimensions == 3, "Attempted to generate a time slice of 4D noise via an EmuMath::NoiseTable that is not 3-dimensional.");
+			using underlying_noise_gen_functor = EmuMath::noise_gen_functor<4, NoiseType_, value_type>;
+			if (_valid_resolution(options_.table_resolution))
+			{
+				_do_resize(options_.table_resolution);
+				if (options_.use_fractal_noise)
+				{
+					using FractalGenerator_ = EmuMath::Functors::fractal_noise_wrapper<underlying_noise_gen_functor, value_type>;
+					using Generator_ = EmuMath::Functors::noise_time_slice_wrapper<FractalGenerator_, value_type>;
+					_do_generation<Generator_, SampleProcessor_&>
+					(
+						Generator_(FractalGenerator_(options_.freq, options_.permutation_info.MakePermutations(), options_.fractal_noise_info, loop_period_), time_),
+						sample_processor_,
+						options_.start_point,
+						options_.MakeStep()
+					);
+				}
+				else
+				{
+					using NoFractalGenerator_ = EmuMath::Functors::no_fractal_noise_wrapper<underlying_noise_gen_functor, value_type>;
+					using Generator_ = EmuMath::Functors::noise_time_slice_wrapper<NoFractalGenerator_, value_type>;
+					_do_generation<Generator_, SampleProcessor_&>
+					(
+						Generator_(NoFractalGenerator_(options_.freq, options_.permutation_info.MakePermutations(), loop_period_), time_),
+						sample_processor_,
+						options_.start_point,
+						options_.MakeStep()
+					);
+				}
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::noise_sample_processor_default>
+		inline bool GenerateNoiseAtTime(const options_type& options_, value_type time_, value_type loop_period_ = value_type(0))
+		{
+			SampleProcessor_ sample_processor_ = SampleProcessor_();
+			return GenerateNoiseAtTime<NoiseType_, SampleProcessor_&>(options_, time_, loop_period_, sample_processor_);
+		}
+
 		/// <summary>
 		/// <para> Helper to construct options for generating noise for this table with the provided arguments. </para>
 		/// <para> Provided arguments are the respective arguments (including order) for the full custom constructor of this table's options. </para>
@@ -595,6 +764,68 @@ namespace EmuMath
 		table_storage table_data;
 		EmuMath::Vector<num_dimensions, std::size_t> table_size;
 
+		[[nodiscard]] inline std::size_t _flat_index(std::size_t index_x_, std::size_t index_y_) const
+		{
+			return (index_x_ * table_size.template at<1>()) + index_y_;
+		}
+		[[nodiscard]] inline std::size_t _flat_index(std::size_t index_x_, std::size_t index_y_, std::size_t index_z_) const
+		{
+			return (_flat_index(index_x_, index_y_) * table_size.template at<2>()) + index_z_;
+		}
+
+		/// <summary>
+		/// <para> Invokes row_func_ with every row of this table in X-fastest order, as a pointer to 32-bit floats and the width of the row. </para>
+		/// <para> Samples are stored with Z (or Y for 2D tables) contiguous, so rows are transposed or gathered into a scratch row first. </para>
+		/// </summary>
+		template<class RowFunc_>
+		inline void _for_each_export_row(RowFunc_& row_func_) const
+		{
+			std::vector<float> scratch_;
+			const std::size_t width_ = table_size.template at<0>();
+			if constexpr (num_dimensions == 1)
+			{
+				EmuMath::_underlying_noise_export::emit_row(table_data.data(), width_, row_func_, scratch_);
+			}
+			else if constexpr (num_dimensions == 2)
+			{
+				auto column_func_ = [this](const std::size_t x_)
+				{
+					if constexpr (is_flat)
+					{
+						return table_data.data() + _flat_index(x_, 0);
+					}
+					else
+					{
+						return table_data[x_].data();
+					}
+				};
+				EmuMath::_underlying_noise_export::emit_transposed_rows(width_, table_size.template at<1>(), column_func_, row_func_, scratch_);
+			}
+			else
+			{
+				const std::size_t height_ = table_size.template at<1>();
+				const std::size_t depth_ = table_size.template at<2>();
+				for (std::size_t z_ = 0; z_ < depth_; ++z_)
+				{
+					for (std::size_t y_ = 0; y_ < height_; ++y_)
+					{
+						auto element_func_ = [this, y_, z_](const std::size_t x_)
+						{
+							if constexpr (is_flat)
+							{
+								return table_data[_flat_index(x_, y_, z_)];
+							}
+							else
+							{
+								return table_data[x_][y_][z_];
+							}
+						};
+						EmuMath::_underlying_noise_export::emit_gathered_row(width_, element_func_, row_func_, scratch_);
+					}
+				}
+			}
+		}
+
 		static constexpr inline bool _valid_resolution(const EmuMath::Vector<num_dimensions, std::size_t>& res_)
 		{
 			return !res_.CmpAnyEqual(std::size_t(0));
@@ -606,7 +837,17 @@ namespace EmuMath
 			// --- Not particularly necessary for 1D, but avoids a potentially large construction that won't even be used for greater dimensions
 			if (res_.CmpAnyNotEqual(table_size))
 			{
-				if constexpr (num_dimensions == 1)
+				if constexpr (is_flat)
+				{
+					// Samples are fully overwritten by generation, so there is no need to preserve or initialise them here
+					std::size_t total_size_ = 1;
+					for (std::size_t i = 0; i < num_dimensions; ++i)
+					{
+						total_size_ *= res_[i];
+					}
+					table_data.resize(total_size_);
+				}
+				else if constexpr (num_dimensions == 1)
 				{
 					table_data.resize(res_.template at<0>(), value_type());
 				}
@@ -644,7 +885,40 @@ namespace EmuMath
 		)
 		{
 			EmuMath::Vector<num_dimensions, value_type> point_(start_);
-			if constexpr (num_dimensions == 1)
+			if constexpr (is_flat && num_dimensions == 2)
+			{
+				value_type* out_ = table_data.data();
+				for (std::size_t x_ = 0, end_x_ = table_size.template at<0>(); x_ < end_x_; ++x_)
+				{
+					point_.template at<1>() = start_.template at<1>();
+					for (std::size_t y_ = 0, end_y_ = table_size.template at<1>(); y_ < end_y_; ++y_)
+					{
+						*(out_++) = sample_processor_(generator_(point_));
+						point_.template at<1>() += step_.template at<1>();
+					}
+					point_.template at<0>() += step_.template at<0>();
+				}
+			}
+			else if constexpr (is_flat && num_dimensions == 3)
+			{
+				value_type* out_ = table_data.data();
+				for (std::size_t x_ = 0, end_x_ = table_size.template at<0>(); x_ < end_x_; ++x_)
+				{
+					point_.template at<1>() = start_.template at<1>();
+					for (std::size_t y_ = 0, end_y_ = table_size.template at<1>(); y_ < end_y_; ++y_)
+					{
+						point_.template at<2>() = start_.template at<2>();
+						for (std::size_t z_ = 0, end_z_ = table_size.template at<2>(); z_ < end_z_; ++z_)
+						{
+							*(out_++) = sample_processor_(generator_(point_));
+							point_.template at<2>() += step_.template at<2>();
+						}
+						point_.template at<1>() += step_.template at<1>();
+					}
+					point_.template at<0>() += step_.template at<0>();
+				}
+			}
+			else if constexpr (num_dimensions == 1)
 			{
 				for (std::size_t x_ = 0, end_x_ = table_data.size(); x_ < end_x_; ++x_)
 				{
@@ -694,7 +968,11 @@ namespace EmuMath
 
 		inline void _set_all(value_type val_)
 		{
-			if constexpr (num_dimensions == 1)
+			if constexpr (is_flat)
+			{
+				std::fill(table_data.data(), table_data.data() + table_data.size(), val_);
+			}
+			else if constexpr (num_dimensions == 1)
 			{
 				for (std::size_t x_ = 0, x_end_ = size<0>(); x_ < x_end_; ++x_)
 				{
@@ -735,7 +1013,15 @@ namespace EmuMath
 
 		inline void _do_normalise(value_type reciprocal_multiplier_, value_type min_)
 		{
-			if constexpr (num_dimensions == 1)
+			if constexpr (is_flat)
+			{
+				value_type* val_ = table_data.data();
+				for (value_type* end_ = val_ + table_data.size(); val_ != end_; ++val_)
+				{
+					*val_ = (*val_ - min_) * reciprocal_multiplier_;
+				}
+			}
+			else if constexpr (num_dimensions == 1)
 			{
 				for (std::size_t x_ = 0, x_end_ = size<0>(); x_ < x_end_; ++x_)
 				{
@@ -779,15 +1065,15 @@ namespace EmuMath
 	};
 }
 
-template<std::size_t num_dimensions, typename FP_>
-std::ostream& operator<<(std::ostream& str_, const EmuMath::NoiseTable<num_dimensions, FP_>& noise_table_)
+template<std::size_t num_dimensions, typename FP_, EmuMath::NoiseTableStorageMode StorageMode_>
+std::ostream& operator<<(std::ostream& str_, const EmuMath::NoiseTable<num_dimensions, FP_, StorageMode_>& noise_table_)
 {
 	noise_table_.AppendToStream(str_);
 	return str_;
 }
 
-template<std::size_t num_dimensions, typename FP_>
-std::wostream& operator<<(std::wostream& str_, const EmuMath::NoiseTable<num_dimensions, FP_>& noise_table_)
+template<std::size_t num_dimensions, typename FP_, EmuMath::NoiseTableStorageMode StorageMode_>
+std::wostream& operator<<(std::wostream& str_, const EmuMath::NoiseTable<num_dimensions, FP_, StorageMode_>& noise_table_)
 {
 	noise_table_.AppendToStream(str_);
 	return str_;
@@ -0,0 +1,177 @@
+#ifndef EMU_MATH_NOISE_TABLE_EXPORT_H_INC_
+#define EMU_MATH_NOISE_TABLE_EXPORT_H_INC_ 1
+
+#include "../../../EmuSIMD/SIMDHelpers.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace EmuMath::_underlying_noise_export
+{
+	/// <summary> Number of rows transposed at a time when exporting rows that are not contiguous in table storage. </summary>
+	static constexpr std::size_t transpose_band_rows = 64;
+
+	/// <summary>
+	/// <para> Passes a contiguous row of samples to row_func_ as 32-bit floats. </para>
+	/// <para> Rows of floats are passed straight from table storage; other sample types are converted into the provided scratch_ buffer first. </para>
+	/// </summary>
+	template<typename T_, class RowFunc_>
+	inline void emit_row(const T_* row_, const std::size_t width_, RowFunc_& row_func_, std::vector<float>& scratch_)
+	{
+		if constexpr (std::is_same_v<T_, float>)
+		{
+			row_func_(row_, width_);
+		}
+		else
+		{
+			scratch_.resize(width_);
+			std::transform(row_, row_ + width_, scratch_.begin(), [](const T_ sample_) { return static_cast<float>(sample_); });
+			row_func_(static_cast<const float*>(scratch_.data()), width_);
+		}
+	}
+
+	/// <summary> Gathers a row of width_ samples via element_func_(x) into the provided scratch_ buffer, and passes it to row_func_. </summary>
+	template<class ElementFunc_, class RowFunc_>
+	inline void emit_gathered_row(const std::size_t width_, ElementFunc_ element_func_, RowFunc_& row_func_, std::vector<float>& scratch_)
+	{
+		scratch_.resize(width_);
+		for (std::size_t x_ = 0; x_ < width_; ++x_)
+		{
+			scratch_[x_] = static_cast<float>(element_func_(x_));
+		}
+		row_func_(static_cast<const float*>(scratch_.data()), width_);
+	}
+
+	/// <summary>
+	/// <para> Passes num_rows_ rows of width_ samples to row_func_, where the samples of each column are contiguous in table storage. </para>
+	/// <para> column_func_(x) must provide a pointer to the sample of the first row in column x. </para>
+	/// <para> Rows are transposed in bands of transpose_band_rows, so that every column is read contiguously rather than once per row. </para>
+	/// </summary>
+	template<class ColumnFunc_, class RowFunc_>
+	inline void emit_transposed_rows(const std::size_t width_, const std::size_t num_rows_, ColumnFunc_ column_func_, RowFunc_& row_func_, std::vector<float>& scratch_)
+	{
+		scratch_.resize(width_ * std::min(num_rows_, transpose_band_rows));
+		for (std::size_t band_begin_ = 0; band_begin_ < num_rows_; band_begin_ += transpose_band_rows)
+		{
+			const std::size_t band_size_ = std::min(transpose_band_rows, num_rows_ - band_begin_);
+			for (std::size_t x_ = 0; x_ < width_; ++x_)
+			{
+				const auto* column_ = column_func_(x_) + band_begin_;
+				for (std::size_t row_ = 0; row_ < band_size_; ++row_)
+				{
+					scratch_[(row_ * width_) + x_] = static_cast<float>(column_[row_]);
+				}
+			}
+
+			for (std::size_t row_ = 0; row_ < band_size_; ++row_)
+			{
+				row_func_(static_cast<const float*>(scratch_.data() + (row_ * width_)), width_);
+			}
+		}
+	}
+
+	/// <summary>
+	/// <para> Quantises count_ samples in the range [min_, max_] to unsigned integers in the full range of Out_, rounding to nearest. </para>
+	/// <para> Samples outside of the range are clamped. Scaling and conversion are performed on registers via EmuSIMD::convert. </para>
+	/// </summary>
+	template<typename Out_>
+	inline void quantise_row(const float* samples_, Out_* out_, const std::size_t count_, const float min_, const float max_)
+	{
+		constexpr float out_max_ = static_cast<float>(std::numeric_limits<Out_>::max());
+		constexpr std::size_t num_elements_per_batch = 4;
+		const float scale_ = (max_ != min_) ? (out_max_ / (max_ - min_)) : 0.0f;
+
+		const EmuSIMD::f32x4 min_reg_ = EmuSIMD::set1<EmuSIMD::f32x4>(min_);
+		const EmuSIMD::f32x4 scale_reg_ = EmuSIMD::set1<EmuSIMD::f32x4>(scale_);
+		const EmuSIMD::f32x4 zero_ = EmuSIMD::setzero<EmuSIMD::f32x4>();
+		const EmuSIMD::f32x4 out_max_reg_ = EmuSIMD::set1<EmuSIMD::f32x4>(out_max_);
+
+		const std::size_t end_batch_ = count_ - (count_ % num_elements_per_batch);
+		std::int32_t quantised_[num_elements_per_batch] = {};
+		std::size_t i_ = 0;
+		for (; i_ < end_batch_; i_ += num_elements_per_batch)
+		{
+			EmuSIMD::f32x4 scaled_ = EmuSIMD::mul_all(EmuSIMD::sub(EmuSIMD::load<EmuSIMD::f32x4>(samples_ + i_), min_reg_), scale_reg_);
+			scaled_ = EmuSIMD::clamp(scaled_, zero_, out_max_reg_);
+			EmuSIMD::store(EmuSIMD::convert<EmuSIMD::i32x4, 32, true, 32, true>(scaled_), quantised_);
+			for (std::size_t index_ = 0; index_ < num_elements_per_batch; ++index_)
+			{
+				out_[i_ + index_] = static_cast<Out_>(quantised_[index_]);
+			}
+		}
+
+		for (; i_ < count_; ++i_)
+		{
+			// Rounded in the same way as conversion of registers, which rounds halves to even under the default rounding mode
+			out_[i_] = static_cast<Out_>(std::nearbyint(std::clamp((samples_[i_] - min_) * scale_, 0.0f, out_max_)));
+		}
+	}
+
+	/// <summary> Writes rows provided by for_each_row_ to the provided stream as raw 32-bit floats in native byte order, without a header. </summary>
+	template<class ForEachRow_>
+	inline std::ostream& write_raw_float32(std::ostream& str_, ForEachRow_&& for_each_row_)
+	{
+		auto row_func_ = [&str_](const float* row_, const std::size_t row_width_)
+		{
+			str_.write(reinterpret_cast<const char*>(row_), static_cast<std::streamsize>(row_width_ * sizeof(float)));
+		};
+		for_each_row_(row_func_);
+		return str_;
+	}
+
+	/// <summary>
+	/// <para> Writes a binary 16-bit PGM (P5) image to the provided stream, with rows provided by for_each_row_ in top-to-bottom order. </para>
+	/// <para> for_each_row_ is invoked with a row function taking a pointer to a row of 32-bit floats and the width of the row. </para>
+	/// </summary>
+	template<class ForEachRow_>
+	inline std::ostream& write_pgm16
+	(
+		std::ostream& str_,
+		const std::size_t width_,
+		const std::size_t height_,
+		const float min_,
+		const float max_,
+		ForEachRow_&& for_each_row_
+	)
+	{
+		const std::string header_ = "P5\n" + std::to_string(width_) + " " + std::to_string(height_) + "\n65535\n";
+		str_.write(header_.data(), static_cast<std::streamsize>(header_.size()));
+
+		std::vector<std::uint16_t> quantised_row_(width_);
+		std::vector<char> row_bytes_(width_ * 2);
+		auto row_func_ = [&](const float* row_, const std::size_t row_width_)
+		{
+			quantise_row(row_, quantised_row_.data(), row_width_, min_, max_);
+			// PGM samples wider than 8 bits are stored most-significant byte first, regardless of the host's byte order
+			for (std::size_t i = 0; i < row_width_; ++i)
+			{
+				row_bytes_[i * 2] = static_cast<char>(static_cast<std::uint8_t>(quantised_row_[i] >> 8));
+				row_bytes_[(i * 2) + 1] = static_cast<char>(static_cast<std::uint8_t>(quantised_row_[i] & 0xFF));
+			}
+			str_.write(row_bytes_.data(), static_cast<std::streamsize>(row_width_ * 2));
+		};
+		for_each_row_(row_func_);
+		return str_;
+	}
+
+	/// <summary> Quantises rows provided by for_each_row_ to 8-bit grayscale, and passes each quantised row to out_row_func_ with its width. </summary>
+	template<class ForEachRow_, class OutRowFunc_>
+	inline void for_each_grayscale8_row(const std::size_t width_, const float min_, const float max_, ForEachRow_&& for_each_row_, OutRowFunc_& out_row_func_)
+	{
+		std::vector<std::uint8_t> quantised_row_(width_);
+		auto row_func_ = [&](const float* row_, const std::size_t row_width_)
+		{
+			quantise_row(row_, quantised_row_.data(), row_width_, min_, max_);
+			out_row_func_(static_cast<const std::uint8_t*>(quantised_row_.data()), row_width_);
+		};
+		for_each_row_(row_func_);
+	}
+}
+
+#endif
@@ -120,6 +120,26 @@ namespace EmuMath
 			}
 		}
 
+		/// <summary>
+		/// <para> Configures these options to produce a table which seamlessly tiles, without generating any additional samples. </para>
+		/// <para> 
+		///		permutation_info.tile_period is set to tile_period_, and the end point is set to cover exactly one tile of (tile_period_ / freq) units from start_point. 
+		///		As the automatic step excludes the end point, the sample following the final sample on any axis is equal to the first sample on that axis.
+		/// </para>
+		/// <para> The tile period must be a power of 2 less than the number of permutations, and is rounded down to one otherwise. </para>
+		/// </summary>
+		/// <param name="tile_period_">Number of lattice cells covered by a single tile along each axis.</param>
+		inline void MakeTileable(std::size_t tile_period_)
+		{
+			permutation_info.tile_period = tile_period_;
+			const std::size_t applied_period_ = permutation_info.TilePeriodToPowerOf2();
+			if (applied_period_ != 0)
+			{
+				step_mode = false;
+				end_point_or_step = start_point + (value_type(applied_period_) / freq);
+			}
+		}
+
 		/// <summary> Number of items to be present on the table when using these options. </summary>
 		EmuMath::Vector<num_dimensions, std::size_t> table_resolution;
 		/// <summary> Starting point when creating noise samples using these options. </summary>
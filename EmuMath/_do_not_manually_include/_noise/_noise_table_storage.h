@@ -0,0 +1,308 @@
+#ifndef EMU_MATH_NOISE_TABLE_STORAGE_H_INC_
+#define EMU_MATH_NOISE_TABLE_STORAGE_H_INC_ 1
+
+#include "_noise_tmp.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> Enum used to select the way in which noise tables store their samples. </para>
+	/// <para> NESTED: Samples are stored in nested vectors, with one heap allocation per stored row. </para>
+	/// <para> FLAT: Samples are stored in a single 64-byte-aligned allocation, indexed via strides. </para>
+	/// </summary>
+	enum class NoiseTableStorageMode : std::uint8_t
+	{
+		NESTED = 0x00,
+		FLAT = 0x01,
+
+		DEFAULT = NESTED
+	};
+}
+
+namespace EmuMath::TMP
+{
+	/// <summary>
+	/// <para> Single contiguous allocation of noise samples, aligned to a 64-byte boundary. </para>
+	/// <para> Unlike std::vector, resizing does not initialise or preserve samples, as noise tables fully regenerate their samples after every resize. </para>
+	/// <para> Allocations are reused when shrinking, and only replaced when growing beyond the current capacity. </para>
+	/// </summary>
+	template<typename T_>
+	class _flat_noise_table_storage
+	{
+	public:
+		using value_type = T_;
+		static constexpr std::size_t alignment = 64;
+
+		_flat_noise_table_storage() noexcept : samples(nullptr), num_samples(0), sample_capacity(0)
+		{
+		}
+		_flat_noise_table_storage(const _flat_noise_table_storage& to_copy_) : samples(nullptr), num_samples(0), sample_capacity(0)
+		{
+			resize(to_copy_.num_samples);
+			std::copy(to_copy_.samples, to_copy_.samples + to_copy_.num_samples, samples);
+		}
+		_flat_noise_table_storage(_flat_noise_table_storage&& to_move_) noexcept : samples(to_move_.samples), num_samples(to_move_.num_samples), sample_capacity(to_move_.sample_capacity)
+		{
+			to_move_.samples = nullptr;
+			to_move_.num_samples = 0;
+			to_move_.sample_capacity = 0;
+		}
+		~_flat_noise_table_storage()
+		{
+			_deallocate(samples);
+		}
+
+		inline _flat_noise_table_storage& operator=(const _flat_noise_table_storage& to_copy_)
+		{
+			if (this != &to_copy_)
+			{
+				resize(to_copy_.num_samples);
+				std::copy(to_copy_.samples, to_copy_.samples + to_copy_.num_samples, samples);
+			}
+			return *this;
+		}
+		inline _flat_noise_table_storage& operator=(_flat_noise_table_storage&& to_move_) noexcept
+		{
+			_flat_noise_table_storage(std::move(to_move_)).swap(*this);
+			return *this;
+		}
+
+		[[nodiscard]] inline value_type& operator[](std::size_t index_)
+		{
+			return samples[index_];
+		}
+		[[nodiscard]] inline const value_type& operator[](std::size_t index_) const
+		{
+			return samples[index_];
+		}
+
+		[[nodiscard]] inline value_type* data()
+		{
+			return samples;
+		}
+		[[nodiscard]] inline const value_type* data() const
+		{
+			return samples;
+		}
+
+		[[nodiscard]] inline std::size_t size() const
+		{
+			return num_samples;
+		}
+		[[nodiscard]] inline std::size_t capacity() const
+		{
+			return sample_capacity;
+		}
+
+		/// <summary> Changes the number of samples stored. The values of all samples are unspecified after this call. </summary>
+		/// <param name="new_size_">Number of samples to be stored.</param>
+		inline void resize(std::size_t new_size_)
+		{
+			if (new_size_ > sample_capacity)
+			{
+				value_type* new_samples_ = _allocate(new_size_);
+				_deallocate(samples);
+				samples = new_samples_;
+				sample_capacity = new_size_;
+			}
+			num_samples = new_size_;
+		}
+
+		inline void clear()
+		{
+			num_samples = 0;
+		}
+
+		inline void shrink_to_fit()
+		{
+			if (num_samples < sample_capacity)
+			{
+				value_type* new_samples_ = num_samples != 0 ? _allocate(num_samples) : nullptr;
+				std::copy(samples, samples + num_samples, new_samples_);
+				_deallocate(samples);
+				samples = new_samples_;
+				sample_capacity = num_samples;
+			}
+		}
+
+		inline void swap(_flat_noise_table_storage& to_swap_with_) noexcept
+		{
+			std::swap(samples, to_swap_with_.samples);
+			std::swap(num_samples, to_swap_with_.num_samples);
+			std::swap(sample_capacity, to_swap_with_.sample_capacity);
+		}
+
+	private:
+		value_type* samples;
+		std::size_t num_samples;
+		std::size_t sample_capacity;
+
+		[[nodiscard]] static inline value_type* _allocate(std::size_t count_)
+		{
+			return static_cast<value_type*>(::operator new(count_ * sizeof(value_type), std::align_val_t(alignment)));
+		}
+		static inline void _deallocate(value_type* samples_) noexcept
+		{
+			if (samples_ != nullptr)
+			{
+				::operator delete(samples_, std::align_val_t(alignment));
+			}
+		}
+	};
+
+	/// <summary>
+	/// <para> Single definition of the order in which noise tables store their samples, and of the indices of samples within flat storage. </para>
+	/// <para>
+	///		Samples are stored in alphabetical order excluding the major dimension, which is always innermost
+	///		(i.e. X-major is stored YZX, Y-major stored XZY, Z-major stored XYZ). Flat strides are dense, based on the size of the stored samples.
+	/// </para>
+	/// </summary>
+	template<std::size_t NumDimensions_, std::size_t MajorDimensionIndex_>
+	struct _noise_table_layout
+	{
+		static constexpr std::size_t num_dimensions = NumDimensions_;
+		static constexpr std::size_t major_dimension = MajorDimensionIndex_;
+		/// <summary> Dimension iterated by the outermost layer of storage. </summary>
+		static constexpr std::size_t outer_dimension = (num_dimensions != 1 && major_dimension == 0) ? 1 : 0;
+		/// <summary> Dimension iterated by the middle layer of storage. Only meaningful for 3-dimensional tables. </summary>
+		static constexpr std::size_t middle_dimension = (major_dimension == 2) ? 1 : 2;
+
+		/// <summary>
+		/// <para> Calculates the index of a sample within flat storage of the provided size, from its outer, middle and major storage indices. </para>
+		/// <para> The outer index is ignored for 1-dimensional tables, and the middle index is ignored for tables of fewer than 3 dimensions. </para>
+		/// </summary>
+		template<class Size_>
+		[[nodiscard]] static constexpr inline std::size_t flat_index
+		(
+			const Size_& size_,
+			const std::size_t outer_index_,
+			const std::size_t middle_index_,
+			const std::size_t major_index_
+		)
+		{
+			if constexpr (num_dimensions == 1)
+			{
+				return major_index_;
+			}
+			else if constexpr (num_dimensions == 2)
+			{
+				return (outer_index_ * size_.template at<major_dimension>()) + major_index_;
+			}
+			else
+			{
+				return (((outer_index_ * size_.template at<middle_dimension>()) + middle_index_) * size_.template at<major_dimension>()) + major_index_;
+			}
+		}
+
+		/// <summary> Calculates the index of the sample at the provided XYZ-ordered coordinates within flat storage of the provided size. </summary>
+		template<class Size_, class Coords_>
+		[[nodiscard]] static constexpr inline std::size_t flat_index(const Size_& size_, const Coords_& coords_)
+		{
+			const std::size_t major_index_ = coords_.template at<major_dimension>();
+			if constexpr (num_dimensions == 1)
+			{
+				return major_index_;
+			}
+			else if constexpr (num_dimensions == 2)
+			{
+				return flat_index(size_, coords_.template at<outer_dimension>(), 0, major_index_);
+			}
+			else
+			{
+				return flat_index(size_, coords_.template at<outer_dimension>(), coords_.template at<middle_dimension>(), major_index_);
+			}
+		}
+	};
+
+	/// <summary>
+	/// <para> Read-only view of a layer within a flat noise table, mimicking the read interface of the nested storage's layers. </para>
+	/// <para> NumDimensions_ is the number of dimensions remaining within the viewed layer; indexing a 1-dimensional layer provides a sample. </para>
+	/// </summary>
+	template<std::size_t NumDimensions_, typename T_>
+	class _flat_noise_table_layer
+	{
+	public:
+		using value_type = T_;
+		using index_result = std::conditional_t<NumDimensions_ == 1, value_type, _flat_noise_table_layer<NumDimensions_ - 1, value_type>>;
+
+		_flat_noise_table_layer(const value_type* layer_samples_, const std::array<std::size_t, NumDimensions_>& layer_sizes_) :
+			layer_samples(layer_samples_),
+			layer_sizes(layer_sizes_)
+		{
+		}
+
+		[[nodiscard]] inline index_result operator[](std::size_t index_) const
+		{
+			if constexpr (NumDimensions_ == 1)
+			{
+				return layer_samples[index_];
+			}
+			else
+			{
+				std::array<std::size_t, NumDimensions_ - 1> inner_sizes_ = {};
+				std::size_t stride_ = 1;
+				for (std::size_t i = 1; i < NumDimensions_; ++i)
+				{
+					inner_sizes_[i - 1] = layer_sizes[i];
+					stride_ *= layer_sizes[i];
+				}
+				return index_result(layer_samples + (index_ * stride_), inner_sizes_);
+			}
+		}
+		[[nodiscard]] inline index_result at(std::size_t index_) const
+		{
+			return operator[](index_);
+		}
+
+		[[nodiscard]] inline std::size_t size() const
+		{
+			return layer_sizes[0];
+		}
+
+		[[nodiscard]] inline const value_type* data() const
+		{
+			return layer_samples;
+		}
+
+	private:
+		const value_type* layer_samples;
+		std::array<std::size_t, NumDimensions_> layer_sizes;
+	};
+
+	template<std::size_t NumDimensions_, typename value_type, EmuMath::NoiseTableStorageMode StorageMode_>
+	using _noise_table_storage = std::conditional_t
+	<
+		StorageMode_ == EmuMath::NoiseTableStorageMode::FLAT,
+		_flat_noise_table_storage<value_type>,
+		_full_noise_table_storage<NumDimensions_, value_type>
+	>;
+
+	template<std::size_t TargetDimension_, std::size_t ActualDimensions_, typename value_type, EmuMath::NoiseTableStorageMode StorageMode_>
+	struct _noise_table_storage_access
+	{
+		using type = typename _noise_table_access<TargetDimension_, ActualDimensions_, value_type>::type;
+	};
+	template<std::size_t TargetDimension_, std::size_t ActualDimensions_, typename value_type>
+	struct _noise_table_storage_access<TargetDimension_, ActualDimensions_, value_type, EmuMath::NoiseTableStorageMode::FLAT>
+	{
+	private:
+		using _nested_type = typename _noise_table_access<TargetDimension_, ActualDimensions_, value_type>::type;
+
+	public:
+		/// <summary> Partial-layer accesses of flat storage provide a view instead of a reference to a nested layer. </summary>
+		using type = std::conditional_t
+		<
+			std::is_reference_v<_nested_type>,
+			_flat_noise_table_layer<(ActualDimensions_ > TargetDimension_) ? (ActualDimensions_ - TargetDimension_) : 1, value_type>,
+			_nested_type
+		>;
+	};
+}
+
+#endif
@@ -51,6 +51,22 @@ namespace EmuMath::TMP
 		}
 	}
 
+	/// <summary>
+	/// <para> Type trait indicating if a noise sample processor can be reset and have the results of another instance merged into it. </para>
+	/// <para> Parallel generation of fast noise tables uses this to combine the results of each task into the processor provided by the caller. </para>
+	/// </summary>
+	template<class Processor_>
+	struct is_mergeable_noise_sample_processor
+	{
+		static constexpr bool value = requires(Processor_& processor_, const Processor_& other_)
+		{
+			processor_.Reset();
+			processor_.Merge(other_);
+		};
+	};
+	template<class Processor_>
+	static constexpr bool is_mergeable_noise_sample_processor_v = is_mergeable_noise_sample_processor<Processor_>::value;
+
 	template<std::size_t Dimensions_, class If1_, class If2_, class If3_>
 	struct _noise_table_dimension_conditional
 	{
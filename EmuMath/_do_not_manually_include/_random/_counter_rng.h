@@ -0,0 +1,340 @@
+#ifndef EMU_MATH_COUNTER_RNG_H_INC_
+#define EMU_MATH_COUNTER_RNG_H_INC_ 1
+
+#include "../../../EmuCore/CommonConcepts/Arithmetic.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> The Philox4x32-10 counter-based bijection, mapping a 128-bit counter and 64-bit key to 128 bits of random output. </para>
+	/// <para> As a pure function, any block of output may be produced independently of all others. </para>
+	/// </summary>
+	struct Philox4x32
+	{
+	public:
+		using counter_type = std::array<std::uint32_t, 4>;
+		using key_type = std::array<std::uint32_t, 2>;
+		static constexpr std::size_t num_rounds = 10;
+		static constexpr std::uint32_t multiplier_0 = 0xD2511F53;
+		static constexpr std::uint32_t multiplier_1 = 0xCD9E8D57;
+		static constexpr std::uint32_t key_bump_0 = 0x9E3779B9;
+		static constexpr std::uint32_t key_bump_1 = 0xBB67AE85;
+
+		/// <summary> Produces the 4 output words for the provided counter and key. </summary>
+		[[nodiscard]] static constexpr inline counter_type Generate(counter_type counter_, key_type key_) noexcept
+		{
+			for (std::size_t round_ = 0; round_ < num_rounds; ++round_)
+			{
+				if (round_ != 0)
+				{
+					key_[0] += key_bump_0;
+					key_[1] += key_bump_1;
+				}
+				const std::uint64_t product_0_ = static_cast<std::uint64_t>(multiplier_0) * counter_[0];
+				const std::uint64_t product_1_ = static_cast<std::uint64_t>(multiplier_1) * counter_[2];
+				counter_ = counter_type
+				({
+					static_cast<std::uint32_t>(product_1_ >> 32) ^ counter_[1] ^ key_[0],
+					static_cast<std::uint32_t>(product_1_),
+					static_cast<std::uint32_t>(product_0_ >> 32) ^ counter_[3] ^ key_[1],
+					static_cast<std::uint32_t>(product_0_)
+				});
+			}
+			return counter_;
+		}
+	};
+
+	/// <summary>
+	/// <para> Stateless random number generator mapping (seed, stream, index) to a value via Philox4x32-10. </para>
+	/// <para>
+	///		Element i of a sequence may be produced on any thread without shared state or locks,
+	///		so splitting generation of a sequence across workers produces identical results regardless of scheduling.
+	/// </para>
+	/// <para>
+	///		The 32-bit word sequence places word i in word (i % 4) of block (i / 4), with the stream occupying the upper half of each block's counter.
+	///		64-bit value i is formed from words (2 * i) and (2 * i + 1).
+	///		Outputs of 4 bytes or fewer are read from the 32-bit word sequence at their index, and wider outputs from the 64-bit sequence.
+	/// </para>
+	/// <para>
+	///		Integers are mapped into range via a single multiply-shift, so ranges are not perfectly uniform; bias is at most (range / 2^32) for narrow outputs and (range / 2^64) for wide outputs.
+	///		Reals are within the range min (inclusive) : max (exclusive), formed from 23 or 52 mantissa bits for float and wider types respectively.
+	/// </para>
+	/// <para> EmuMath::FastCounterRng, available via EmuMath/FastRandom.h, produces identical sequences with SIMD bulk generation. </para>
+	/// </summary>
+	class CounterRng
+	{
+	public:
+		using seed_type = std::uint64_t;
+		using stream_type = std::uint64_t;
+		using counter_type = EmuMath::Philox4x32::counter_type;
+		using key_type = EmuMath::Philox4x32::key_type;
+		static constexpr std::size_t words_per_block = 4;
+
+		constexpr CounterRng() noexcept : CounterRng(seed_type(0), stream_type(0))
+		{
+		}
+		constexpr explicit CounterRng(seed_type seed_, stream_type stream_ = 0) noexcept :
+			key({ static_cast<std::uint32_t>(seed_), static_cast<std::uint32_t>(seed_ >> 32) }),
+			stream(stream_)
+		{
+		}
+
+		/// <summary> Provides a generator with the same seed as this generator, but targeting a different stream. </summary>
+		[[nodiscard]] constexpr inline CounterRng WithStream(stream_type stream_) const noexcept
+		{
+			return CounterRng(GetSeed(), stream_);
+		}
+
+		[[nodiscard]] constexpr inline seed_type GetSeed() const noexcept
+		{
+			return static_cast<seed_type>(key[0]) | (static_cast<seed_type>(key[1]) << 32);
+		}
+		[[nodiscard]] constexpr inline stream_type GetStream() const noexcept
+		{
+			return stream;
+		}
+
+		/// <summary> Produces the 4 words of the provided block in this generator's stream. Word i of the 32-bit sequence is in word (i % 4) of block (i / 4). </summary>
+		[[nodiscard]] constexpr inline counter_type Block(std::uint64_t block_index_) const noexcept
+		{
+			return EmuMath::Philox4x32::Generate(_make_counter(block_index_), key);
+		}
+
+		/// <summary> Produces the word at the provided index of this generator's 32-bit sequence. </summary>
+		[[nodiscard]] constexpr inline std::uint32_t Bits32(std::uint64_t index_) const noexcept
+		{
+			return Block(index_ / words_per_block)[index_ % words_per_block];
+		}
+		/// <summary> Produces the value at the provided index of this generator's 64-bit sequence, formed from words (2 * index_) and (2 * index_ + 1). </summary>
+		[[nodiscard]] constexpr inline std::uint64_t Bits64(std::uint64_t index_) const noexcept
+		{
+			const counter_type block_ = Block(index_ / 2);
+			const std::size_t offset_ = (index_ % 2) * 2;
+			return (static_cast<std::uint64_t>(block_[offset_]) << 32) | block_[offset_ + 1];
+		}
+
+		/// <summary> Produces the integer at the provided index, within the inclusive range min_:max_. </summary>
+		template<EmuConcepts::Integer OutInt_>
+		[[nodiscard]] constexpr inline OutInt_ IntAt(std::uint64_t index_, OutInt_ min_, OutInt_ max_) const noexcept
+		{
+			if (max_ < min_)
+			{
+				std::swap(min_, max_);
+			}
+
+			if constexpr (_is_wide<OutInt_>())
+			{
+				return _int_from_bits(Bits64(index_), min_, max_);
+			}
+			else
+			{
+				return _int_from_bits(Bits32(index_), min_, max_);
+			}
+		}
+
+		/// <summary> Produces the real at the provided index, within the range min_ (inclusive) : max_ (exclusive). </summary>
+		template<EmuConcepts::FloatingPoint OutFP_>
+		[[nodiscard]] inline OutFP_ RealAt(std::uint64_t index_, OutFP_ min_, OutFP_ max_) const noexcept
+		{
+			if (max_ < min_)
+			{
+				std::swap(min_, max_);
+			}
+
+			if constexpr (_is_wide<OutFP_>())
+			{
+				return _real_from_bits(Bits64(index_), min_, max_);
+			}
+			else
+			{
+				return _real_from_bits(Bits32(index_), min_, max_);
+			}
+		}
+
+		/// <summary> Writes count_ consecutive words of this generator's 32-bit sequence, starting at first_index_, to the pointed-to contiguous items. </summary>
+		inline void FillBits(std::uint32_t* p_out_, std::size_t count_, std::uint64_t first_index_) const
+		{
+			while (count_ != 0)
+			{
+				const counter_type block_ = Block(first_index_ / words_per_block);
+				for (std::size_t word_ = first_index_ % words_per_block; word_ < words_per_block && count_ != 0; ++word_, --count_, ++first_index_)
+				{
+					*p_out_++ = block_[word_];
+				}
+			}
+		}
+
+		/// <summary>
+		/// <para> Fills the passed span with consecutive outputs starting at first_index_, as though by IntAt or RealAt for each index. </para>
+		/// <para> If no range is provided, integers use the full range of Out_ and reals use the range 0 (inclusive) : 1 (exclusive). </para>
+		/// </summary>
+		/// <param name="out_">Span of items to fill.</param>
+		/// <param name="first_index_">Index in this generator's sequence of the first output.</param>
+		template<typename Out_>
+		inline void Fill(std::span<Out_> out_, std::uint64_t first_index_) const
+		{
+			_fill_via_words
+			(
+				[this](std::uint32_t* p_words_, std::size_t count_, std::uint64_t first_) { FillBits(p_words_, count_, first_); },
+				out_,
+				first_index_,
+				_default_min<Out_>(),
+				_default_max<Out_>()
+			);
+		}
+		template<typename Out_>
+		inline void Fill(std::span<Out_> out_, std::uint64_t first_index_, std::type_identity_t<Out_> min_, std::type_identity_t<Out_> max_) const
+		{
+			_fill_via_words
+			(
+				[this](std::uint32_t* p_words_, std::size_t count_, std::uint64_t first_) { FillBits(p_words_, count_, first_); },
+				out_,
+				first_index_,
+				min_,
+				max_
+			);
+		}
+
+	protected:
+		template<typename Out_>
+		[[nodiscard]] static constexpr inline bool _is_wide()
+		{
+			return sizeof(Out_) > sizeof(std::uint32_t);
+		}
+
+		template<typename Out_>
+		[[nodiscard]] static constexpr inline Out_ _default_min()
+		{
+			return std::is_floating_point_v<Out_> ? Out_(0) : std::numeric_limits<Out_>::lowest();
+		}
+		template<typename Out_>
+		[[nodiscard]] static constexpr inline Out_ _default_max()
+		{
+			return std::is_floating_point_v<Out_> ? Out_(1) : std::numeric_limits<Out_>::max();
+		}
+
+		[[nodiscard]] static constexpr inline std::uint64_t _mul_hi_64(const std::uint64_t a_, const std::uint64_t b_) noexcept
+		{
+			const std::uint64_t a_lo_ = a_ & 0xFFFFFFFFULL, a_hi_ = a_ >> 32;
+			const std::uint64_t b_lo_ = b_ & 0xFFFFFFFFULL, b_hi_ = b_ >> 32;
+			const std::uint64_t hi_lo_ = a_hi_ * b_lo_;
+			const std::uint64_t cross_ = ((a_lo_ * b_lo_) >> 32) + (hi_lo_ & 0xFFFFFFFFULL) + (a_lo_ * b_hi_);
+			return (a_hi_ * b_hi_) + (hi_lo_ >> 32) + (cross_ >> 32);
+		}
+
+		template<typename Bits_, typename OutInt_>
+		[[nodiscard]] static constexpr inline OutInt_ _int_from_bits(const Bits_ bits_, const OutInt_ min_, const OutInt_ max_) noexcept
+		{
+			using out_uint = std::make_unsigned_t<OutInt_>;
+			const Bits_ range_ = static_cast<Bits_>(static_cast<out_uint>(static_cast<out_uint>(max_) - static_cast<out_uint>(min_)));
+			Bits_ offset_ = bits_;
+			if (range_ != std::numeric_limits<Bits_>::max())
+			{
+				if constexpr (std::is_same_v<Bits_, std::uint32_t>)
+				{
+					offset_ = static_cast<Bits_>((static_cast<std::uint64_t>(bits_) * (static_cast<std::uint64_t>(range_) + 1)) >> 32);
+				}
+				else
+				{
+					offset_ = _mul_hi_64(bits_, range_ + 1);
+				}
+			}
+			return static_cast<OutInt_>(static_cast<out_uint>(static_cast<out_uint>(min_) + static_cast<out_uint>(offset_)));
+		}
+
+		template<typename Bits_, typename OutFP_>
+		[[nodiscard]] static inline OutFP_ _real_from_bits(const Bits_ bits_, const OutFP_ min_, const OutFP_ max_) noexcept
+		{
+			// Mantissa bits beneath an exponent of 0 produce a value in [1, 2), matching the layout used for SIMD generation
+			using unit_type = std::conditional_t<std::is_same_v<Bits_, std::uint32_t>, float, double>;
+			unit_type unit_;
+			if constexpr (std::is_same_v<Bits_, std::uint32_t>)
+			{
+				unit_ = std::bit_cast<float>((bits_ >> 9) | 0x3F800000u) - 1.0f;
+			}
+			else
+			{
+				unit_ = std::bit_cast<double>((bits_ >> 12) | 0x3FF0000000000000ULL) - 1.0;
+			}
+			const OutFP_ out_ = min_ + (static_cast<OutFP_>(unit_) * (max_ - min_));
+			return (out_ < max_ || !(min_ < max_)) ? out_ : std::nextafter(max_, min_);
+		}
+
+		/// <summary> Converts words produced by the passed filler into outputs, in chunks, so that all generators of this sequence share conversion. </summary>
+		template<class WordFiller_, typename Out_>
+		inline void _fill_via_words(WordFiller_&& fill_words_, std::span<Out_> out_, std::uint64_t first_index_, Out_ min_, Out_ max_) const
+		{
+			static_assert
+			(
+				(std::is_integral_v<Out_> && !std::is_same_v<Out_, bool>) || std::is_floating_point_v<Out_>,
+				"Invalid Out_ type provided to fill via an EmuMath::CounterRng: Items must be of an integral or floating-point type."
+			);
+			if (max_ < min_)
+			{
+				std::swap(min_, max_);
+			}
+
+			constexpr std::size_t chunk_words_ = 256;
+			constexpr std::size_t words_per_out_ = _is_wide<Out_>() ? 2 : 1;
+			alignas(64) std::uint32_t words_[chunk_words_];
+			std::size_t done_ = 0;
+			while (done_ < out_.size())
+			{
+				const std::size_t chunk_count_ = std::min<std::size_t>(out_.size() - done_, chunk_words_ / words_per_out_);
+				fill_words_(words_, chunk_count_ * words_per_out_, (first_index_ + done_) * words_per_out_);
+				for (std::size_t i = 0; i < chunk_count_; ++i)
+				{
+					Out_& item_ = out_[done_ + i];
+					if constexpr (words_per_out_ == 2)
+					{
+						const std::uint64_t bits_ = (static_cast<std::uint64_t>(words_[i * 2]) << 32) | words_[(i * 2) + 1];
+						if constexpr (std::is_floating_point_v<Out_>)
+						{
+							item_ = _real_from_bits(bits_, min_, max_);
+						}
+						else
+						{
+							item_ = _int_from_bits(bits_, min_, max_);
+						}
+					}
+					else
+					{
+						if constexpr (std::is_floating_point_v<Out_>)
+						{
+							item_ = _real_from_bits(words_[i], min_, max_);
+						}
+						else
+						{
+							item_ = _int_from_bits(words_[i], min_, max_);
+						}
+					}
+				}
+				done_ += chunk_count_;
+			}
+		}
+
+		[[nodiscard]] constexpr inline counter_type _make_counter(std::uint64_t block_index_) const noexcept
+		{
+			return counter_type
+			({
+				static_cast<std::uint32_t>(block_index_),
+				static_cast<std::uint32_t>(block_index_ >> 32),
+				static_cast<std::uint32_t>(stream),
+				static_cast<std::uint32_t>(stream >> 32)
+			});
+		}
+
+		key_type key;
+		stream_type stream;
+	};
+}
+
+#endif
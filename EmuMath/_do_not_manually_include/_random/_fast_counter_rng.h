@@ -0,0 +1,185 @@
+#ifndef EMU_MATH_FAST_COUNTER_RNG_H_INC_
+#define EMU_MATH_FAST_COUNTER_RNG_H_INC_ 1
+
+#include "_counter_rng.h"
+#include "../../../EmuSIMD/SIMDHelpers.h"
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> EmuMath::CounterRng with SIMD bulk generation, computing one Philox4x32-10 block per 32-bit lane of the provided integral SIMD register on every step. </para>
+	/// <para> Produces sequences identical to a CounterRng of the same seed and stream, so the two may be mixed freely, such as for scalar remainders. </para>
+	/// </summary>
+	template<class IntRegister_ = EmuSIMD::i256_generic>
+	class FastCounterRng : public EmuMath::CounterRng
+	{
+	public:
+		using register_type = typename EmuCore::TMP::remove_ref_cv<IntRegister_>::type;
+		static_assert
+		(
+			EmuSIMD::TMP::is_integral_simd_register_v<register_type>,
+			"Invalid IntRegister_ provided to EmuMath::FastCounterRng: The register must be an integral SIMD register."
+		);
+		static constexpr std::size_t register_width = EmuSIMD::TMP::simd_register_width_v<register_type>;
+		/// <summary> Number of Philox blocks produced per step, which is the number of 32-bit lanes in this generator's register. </summary>
+		static constexpr std::size_t num_lanes = register_width / 32;
+		static constexpr std::size_t words_per_step = num_lanes * words_per_block;
+
+		constexpr FastCounterRng() noexcept : EmuMath::CounterRng()
+		{
+		}
+		constexpr explicit FastCounterRng(seed_type seed_, stream_type stream_ = 0) noexcept : EmuMath::CounterRng(seed_, stream_)
+		{
+		}
+		constexpr explicit FastCounterRng(const EmuMath::CounterRng& to_copy_) noexcept : EmuMath::CounterRng(to_copy_)
+		{
+		}
+
+		/// <summary> Provides a generator with the same seed as this generator, but targeting a different stream. </summary>
+		[[nodiscard]] constexpr inline FastCounterRng WithStream(stream_type stream_) const noexcept
+		{
+			return FastCounterRng(GetSeed(), stream_);
+		}
+
+		/// <summary> Writes count_ consecutive words of this generator's 32-bit sequence, starting at first_index_, to the pointed-to contiguous items. </summary>
+		inline void FillBits(std::uint32_t* p_out_, std::size_t count_, std::uint64_t first_index_) const
+		{
+			// Align to a block boundary so that each step writes whole blocks
+			const std::size_t head_ = std::min<std::size_t>(count_, static_cast<std::size_t>((words_per_block - (first_index_ % words_per_block)) % words_per_block));
+			EmuMath::CounterRng::FillBits(p_out_, head_, first_index_);
+			p_out_ += head_;
+			count_ -= head_;
+			first_index_ += head_;
+
+			alignas(64) std::uint32_t block_words_[words_per_block][num_lanes];
+			while (count_ >= words_per_step)
+			{
+				_generate_blocks(first_index_ / words_per_block, block_words_);
+				for (std::size_t lane_ = 0; lane_ < num_lanes; ++lane_)
+				{
+					for (std::size_t word_ = 0; word_ < words_per_block; ++word_)
+					{
+						*p_out_++ = block_words_[word_][lane_];
+					}
+				}
+				count_ -= words_per_step;
+				first_index_ += words_per_step;
+			}
+			EmuMath::CounterRng::FillBits(p_out_, count_, first_index_);
+		}
+
+		/// <summary>
+		/// <para> Fills the passed span with consecutive outputs starting at first_index_, identically to EmuMath::CounterRng::Fill. </para>
+		/// <para> If no range is provided, integers use the full range of Out_ and reals use the range 0 (inclusive) : 1 (exclusive). </para>
+		/// </summary>
+		/// <param name="out_">Span of items to fill.</param>
+		/// <param name="first_index_">Index in this generator's sequence of the first output.</param>
+		template<typename Out_>
+		inline void Fill(std::span<Out_> out_, std::uint64_t first_index_) const
+		{
+			_fill_via_words
+			(
+				[this](std::uint32_t* p_words_, std::size_t count_, std::uint64_t first_) { FillBits(p_words_, count_, first_); },
+				out_,
+				first_index_,
+				_default_min<Out_>(),
+				_default_max<Out_>()
+			);
+		}
+		template<typename Out_>
+		inline void Fill(std::span<Out_> out_, std::uint64_t first_index_, std::type_identity_t<Out_> min_, std::type_identity_t<Out_> max_) const
+		{
+			_fill_via_words
+			(
+				[this](std::uint32_t* p_words_, std::size_t count_, std::uint64_t first_) { FillBits(p_words_, count_, first_); },
+				out_,
+				first_index_,
+				min_,
+				max_
+			);
+		}
+
+	private:
+		/// <summary> Splits a multiplier into 16-bit halves, as there is no widening 32-bit multiplication available to all integral registers. </summary>
+		struct _split_multiplier
+		{
+			explicit _split_multiplier(std::uint32_t multiplier_) :
+				full(EmuSIMD::set1<register_type, 32>(multiplier_)),
+				lo(EmuSIMD::set1<register_type, 32>(multiplier_ & 0xFFFF)),
+				hi(EmuSIMD::set1<register_type, 32>(multiplier_ >> 16))
+			{
+			}
+
+			register_type full;
+			register_type lo;
+			register_type hi;
+		};
+
+		/// <summary> Outputs the high and low 32 bits of the 64-bit product of each lane of x_ with the passed multiplier. </summary>
+		static inline void _mul_hi_lo(const register_type& x_, const _split_multiplier& multiplier_, const register_type& mask_16_, register_type& out_hi_, register_type& out_lo_)
+		{
+			const register_type x_lo_ = EmuSIMD::bitwise_and(x_, mask_16_);
+			const register_type x_hi_ = EmuSIMD::shift_right_logical<16, 32>(x_);
+
+			// Each partial product of 16-bit halves fits in 32 bits, so only the cross-term carry needs tracking
+			const register_type lo_lo_ = EmuSIMD::mul_all<32>(x_lo_, multiplier_.lo);
+			const register_type lo_hi_ = EmuSIMD::mul_all<32>(x_lo_, multiplier_.hi);
+			const register_type hi_lo_ = EmuSIMD::mul_all<32>(x_hi_, multiplier_.lo);
+			const register_type hi_hi_ = EmuSIMD::mul_all<32>(x_hi_, multiplier_.hi);
+			register_type carry_ = EmuSIMD::add<32>(EmuSIMD::shift_right_logical<16, 32>(lo_lo_), EmuSIMD::bitwise_and(lo_hi_, mask_16_));
+			carry_ = EmuSIMD::shift_right_logical<16, 32>(EmuSIMD::add<32>(carry_, EmuSIMD::bitwise_and(hi_lo_, mask_16_)));
+
+			out_hi_ = EmuSIMD::add<32>(hi_hi_, EmuSIMD::shift_right_logical<16, 32>(lo_hi_));
+			out_hi_ = EmuSIMD::add<32>(out_hi_, EmuSIMD::add<32>(EmuSIMD::shift_right_logical<16, 32>(hi_lo_), carry_));
+			out_lo_ = EmuSIMD::mul_all<32>(x_, multiplier_.full);
+		}
+
+		/// <summary> Computes num_lanes consecutive blocks from the provided first block, storing word w of lane l's block in out_words_[w][l]. </summary>
+		inline void _generate_blocks(std::uint64_t first_block_, std::uint32_t(&out_words_)[words_per_block][num_lanes]) const
+		{
+			for (std::size_t lane_ = 0; lane_ < num_lanes; ++lane_)
+			{
+				const counter_type counter_ = _make_counter(first_block_ + lane_);
+				for (std::size_t word_ = 0; word_ < words_per_block; ++word_)
+				{
+					out_words_[word_][lane_] = counter_[word_];
+				}
+			}
+
+			register_type c0_ = EmuSIMD::load<register_type>(out_words_[0]);
+			register_type c1_ = EmuSIMD::load<register_type>(out_words_[1]);
+			register_type c2_ = EmuSIMD::load<register_type>(out_words_[2]);
+			register_type c3_ = EmuSIMD::load<register_type>(out_words_[3]);
+			register_type k0_ = EmuSIMD::set1<register_type, 32>(key[0]);
+			register_type k1_ = EmuSIMD::set1<register_type, 32>(key[1]);
+			const register_type bump_0_ = EmuSIMD::set1<register_type, 32>(EmuMath::Philox4x32::key_bump_0);
+			const register_type bump_1_ = EmuSIMD::set1<register_type, 32>(EmuMath::Philox4x32::key_bump_1);
+			const register_type mask_16_ = EmuSIMD::set1<register_type, 32>(std::uint32_t(0xFFFF));
+			const _split_multiplier multiplier_0_(EmuMath::Philox4x32::multiplier_0);
+			const _split_multiplier multiplier_1_(EmuMath::Philox4x32::multiplier_1);
+
+			register_type hi_0_, lo_0_, hi_1_, lo_1_;
+			for (std::size_t round_ = 0; round_ < EmuMath::Philox4x32::num_rounds; ++round_)
+			{
+				if (round_ != 0)
+				{
+					k0_ = EmuSIMD::add<32>(k0_, bump_0_);
+					k1_ = EmuSIMD::add<32>(k1_, bump_1_);
+				}
+				_mul_hi_lo(c0_, multiplier_0_, mask_16_, hi_0_, lo_0_);
+				_mul_hi_lo(c2_, multiplier_1_, mask_16_, hi_1_, lo_1_);
+				c0_ = EmuSIMD::bitwise_xor(EmuSIMD::bitwise_xor(hi_1_, c1_), k0_);
+				c1_ = lo_1_;
+				c2_ = EmuSIMD::bitwise_xor(EmuSIMD::bitwise_xor(hi_0_, c3_), k1_);
+				c3_ = lo_0_;
+			}
+
+			EmuSIMD::store(c0_, out_words_[0]);
+			EmuSIMD::store(c1_, out_words_[1]);
+			EmuSIMD::store(c2_, out_words_[2]);
+			EmuSIMD::store(c3_, out_words_[3]);
+		}
+	};
+}
+
+#endif
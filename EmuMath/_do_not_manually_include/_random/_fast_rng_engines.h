@@ -0,0 +1,201 @@
+#ifndef EMU_MATH_FAST_RNG_ENGINES_H_INC_
+#define EMU_MATH_FAST_RNG_ENGINES_H_INC_ 1
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> Advances the passed SplitMix64 state and returns its next output. </para>
+	/// <para> Used to expand single seeds into the full state of the fast engines, as recommended by the authors of xoshiro. </para>
+	/// </summary>
+	/// <param name="state_">SplitMix64 state to advance.</param>
+	/// <returns>Next 64-bit output of the SplitMix64 sequence.</returns>
+	[[nodiscard]] constexpr inline std::uint64_t splitmix_64_next(std::uint64_t& state_) noexcept
+	{
+		std::uint64_t z_ = (state_ += 0x9E3779B97F4A7C15ULL);
+		z_ = (z_ ^ (z_ >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z_ = (z_ ^ (z_ >> 27)) * 0x94D049BB133111EBULL;
+		return z_ ^ (z_ >> 31);
+	}
+
+	/// <summary>
+	/// <para> The xoshiro256++ engine, producing 64-bit outputs from 256 bits of state with a period of 2^256 - 1. </para>
+	/// <para> Satisfies UniformRandomBitGenerator, so may be used with the standard distributions as well as EmuMath::FastRngWrapper. </para>
+	/// <para> Jump() advances the engine by 2^128 outputs, which may be used to create non-overlapping streams from a single seed. </para>
+	/// </summary>
+	class Xoshiro256PlusPlus
+	{
+	public:
+		using result_type = std::uint64_t;
+		using seed_type = std::uint64_t;
+		static constexpr std::size_t state_size = 4;
+
+		[[nodiscard]] static constexpr inline result_type min() noexcept
+		{
+			return std::numeric_limits<result_type>::min();
+		}
+		[[nodiscard]] static constexpr inline result_type max() noexcept
+		{
+			return std::numeric_limits<result_type>::max();
+		}
+
+		constexpr Xoshiro256PlusPlus() noexcept : Xoshiro256PlusPlus(seed_type(0))
+		{
+		}
+		constexpr explicit Xoshiro256PlusPlus(seed_type seed_) noexcept : state()
+		{
+			seed(seed_);
+		}
+
+		/// <summary> Resets this engine's state from the provided seed, expanded via SplitMix64. </summary>
+		constexpr inline void seed(seed_type seed_) noexcept
+		{
+			for (std::size_t i = 0; i < state_size; ++i)
+			{
+				state[i] = EmuMath::splitmix_64_next(seed_);
+			}
+		}
+
+		constexpr inline result_type operator()() noexcept
+		{
+			const std::uint64_t result_ = _rotate_left(state[0] + state[3], 23) + state[0];
+			const std::uint64_t t_ = state[1] << 17;
+			state[2] ^= state[0];
+			state[3] ^= state[1];
+			state[1] ^= state[2];
+			state[0] ^= state[3];
+			state[2] ^= t_;
+			state[3] = _rotate_left(state[3], 45);
+			return result_;
+		}
+
+		/// <summary> Advances this engine as though 2^128 outputs were generated. </summary>
+		constexpr inline void Jump() noexcept
+		{
+			constexpr std::uint64_t jump_table_[state_size] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+			std::uint64_t jumped_[state_size] = { 0, 0, 0, 0 };
+			for (std::size_t i = 0; i < state_size; ++i)
+			{
+				for (std::size_t bit_ = 0; bit_ < 64; ++bit_)
+				{
+					if (jump_table_[i] & (std::uint64_t(1) << bit_))
+					{
+						for (std::size_t j = 0; j < state_size; ++j)
+						{
+							jumped_[j] ^= state[j];
+						}
+					}
+					this->operator()();
+				}
+			}
+			for (std::size_t i = 0; i < state_size; ++i)
+			{
+				state[i] = jumped_[i];
+			}
+		}
+
+		/// <summary> Provides read access to this engine's state, which is state_size 64-bit items. </summary>
+		[[nodiscard]] constexpr inline const std::uint64_t* State() const noexcept
+		{
+			return state;
+		}
+
+		[[nodiscard]] constexpr inline bool operator==(const Xoshiro256PlusPlus& rhs_) const noexcept
+		{
+			return state[0] == rhs_.state[0] && state[1] == rhs_.state[1] && state[2] == rhs_.state[2] && state[3] == rhs_.state[3];
+		}
+
+	private:
+		[[nodiscard]] static constexpr inline std::uint64_t _rotate_left(const std::uint64_t x_, const int k_) noexcept
+		{
+			return (x_ << k_) | (x_ >> (64 - k_));
+		}
+
+		std::uint64_t state[state_size];
+	};
+
+	/// <summary>
+	/// <para> The PCG32 (XSH-RR) engine, producing 32-bit outputs from a 64-bit LCG state with a period of 2^64. </para>
+	/// <para> Each distinct stream selects a different LCG increment, providing 2^63 independent sequences per seed. </para>
+	/// <para> Satisfies UniformRandomBitGenerator, so may be used with the standard distributions as well as EmuMath::FastRngWrapper. </para>
+	/// </summary>
+	class Pcg32
+	{
+	public:
+		using result_type = std::uint32_t;
+		using seed_type = std::uint64_t;
+		static constexpr std::uint64_t multiplier = 6364136223846793005ULL;
+		static constexpr std::uint64_t default_stream = 0xDA3E39CB94B95BDBULL;
+
+		[[nodiscard]] static constexpr inline result_type min() noexcept
+		{
+			return std::numeric_limits<result_type>::min();
+		}
+		[[nodiscard]] static constexpr inline result_type max() noexcept
+		{
+			return std::numeric_limits<result_type>::max();
+		}
+
+		constexpr Pcg32() noexcept : Pcg32(seed_type(0))
+		{
+		}
+		constexpr explicit Pcg32(seed_type seed_, std::uint64_t stream_ = default_stream) noexcept : state(0), increment(0)
+		{
+			seed(seed_, stream_);
+		}
+
+		/// <summary> Resets this engine's state to the start of the provided stream for the provided seed. </summary>
+		constexpr inline void seed(seed_type seed_, std::uint64_t stream_ = default_stream) noexcept
+		{
+			state = 0;
+			increment = (stream_ << 1) | 1;
+			this->operator()();
+			state += seed_;
+			this->operator()();
+		}
+
+		constexpr inline result_type operator()() noexcept
+		{
+			const std::uint64_t old_state_ = state;
+			state = old_state_ * multiplier + increment;
+			const std::uint32_t xor_shifted_ = static_cast<std::uint32_t>(((old_state_ >> 18) ^ old_state_) >> 27);
+			const std::uint32_t rot_ = static_cast<std::uint32_t>(old_state_ >> 59);
+			return (xor_shifted_ >> rot_) | (xor_shifted_ << ((0u - rot_) & 31));
+		}
+
+		/// <summary> Advances this engine as though the provided number of outputs were generated, in O(log(num_steps_)) time. </summary>
+		constexpr inline void Advance(std::uint64_t num_steps_) noexcept
+		{
+			std::uint64_t acc_mult_ = 1;
+			std::uint64_t acc_plus_ = 0;
+			std::uint64_t cur_mult_ = multiplier;
+			std::uint64_t cur_plus_ = increment;
+			while (num_steps_ > 0)
+			{
+				if (num_steps_ & 1)
+				{
+					acc_mult_ *= cur_mult_;
+					acc_plus_ = acc_plus_ * cur_mult_ + cur_plus_;
+				}
+				cur_plus_ = (cur_mult_ + 1) * cur_plus_;
+				cur_mult_ *= cur_mult_;
+				num_steps_ >>= 1;
+			}
+			state = acc_mult_ * state + acc_plus_;
+		}
+
+		[[nodiscard]] constexpr inline bool operator==(const Pcg32& rhs_) const noexcept
+		{
+			return state == rhs_.state && increment == rhs_.increment;
+		}
+
+	private:
+		std::uint64_t state;
+		std::uint64_t increment;
+	};
+}
+
+#endif
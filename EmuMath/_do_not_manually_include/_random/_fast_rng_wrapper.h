@@ -0,0 +1,340 @@
+#ifndef EMU_MATH_FAST_RNG_WRAPPER_H_INC_
+#define EMU_MATH_FAST_RNG_WRAPPER_H_INC_ 1
+
+#include "_fast_rng_engines.h"
+#include "_rng_wrapper.h"
+#include <cmath>
+#include <ctime>
+#include <span>
+#include <type_traits>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> Wrapper for fast non-cryptographic engines such as EmuMath::Xoshiro256PlusPlus and EmuMath::Pcg32, sharing the interface of EmuMath::RngWrapper. </para>
+	/// <para>
+	///		Unlike RngWrapper, no standard distribution is constructed per call.
+	///		Integers are produced via unbiased multiply-shift range reduction, and reals from the top mantissa bits of a single output.
+	/// </para>
+	/// <para> Real outputs are within the range min (inclusive) : max (exclusive), and integral outputs are within the range min : max (both inclusive). </para>
+	/// <para>
+	///		Engines may optionally provide `FillReal(out_, count_, min_, max_)` to accelerate bulk real generation via Fill,
+	///		as is done by the SIMD engines available via EmuMath/FastRandom.h.
+	/// </para>
+	/// </summary>
+	template<class Engine_ = EmuMath::Xoshiro256PlusPlus>
+	class FastRngWrapper
+	{
+	public:
+#pragma region STATIC_INFO
+		/// <summary> The engine that this item acts as a wrapper for. </summary>
+		using underlying_engine = Engine_;
+		/// <summary> Raw output type of this wrapper's underlying engine. </summary>
+		using engine_result_type = typename underlying_engine::result_type;
+		static_assert
+		(
+			std::is_same_v<engine_result_type, std::uint32_t> || std::is_same_v<engine_result_type, std::uint64_t>,
+			"Invalid Engine_ provided to EmuMath::FastRngWrapper: The engine's result_type must be std::uint32_t or std::uint64_t."
+		);
+		/// <summary> Type used to seed this wrapper's underlying engine. </summary>
+		using seed_type = typename underlying_engine::seed_type;
+
+		/// <summary> Boolean indicating if this wrapper's underlying engine produces 64-bit outputs. </summary>
+		static constexpr bool is_64_bit = sizeof(engine_result_type) == 8;
+		/// <summary> Correct bit-size integer for this wrapper's underlying engine. </summary>
+		using int_type = typename std::conditional<is_64_bit, std::int64_t, std::int32_t>::type;
+		/// <summary> Matching bit-size unsigned type of the integer for this wrapper's underlying engine. </summary>
+		using unsigned_int_type = typename std::make_unsigned<int_type>::type;
+
+		/// <summary> The lowest value that may be stored for an int of the bit-size that this wrapper's underlying engine makes use of. </summary>
+		static constexpr int_type lowest_possible_int = std::numeric_limits<int_type>::lowest();
+		/// <summary> The highest value that may be stored for an int of the bit-size that this wrapper's underlying engine makes use of. </summary>
+		static constexpr int_type highest_possible_int = std::numeric_limits<int_type>::max();
+		/// <summary> Default minimum value to use in construction when a custom range is not provided. </summary>
+		static constexpr double default_min = static_cast<double>(lowest_possible_int);
+		/// <summary> Default maximum value to use in construction when a custom range is not provided. </summary>
+		static constexpr double default_max = static_cast<double>(highest_possible_int);
+
+		/// <summary> Default seed used when one is not provided. Equates to a cast of time(0) to this wrapper's seed_type at the time of calling. </summary>
+		/// <returns>Default seed to be used by constructors where a seed is not provided.</returns>
+		[[nodiscard]] static inline seed_type default_seed()
+		{
+			return static_cast<seed_type>(time(0));
+		}
+
+		/// <summary> Creates an integer of this wrapper's int_type from the provided float, clamped within its minimum and maximum range. </summary>
+		[[nodiscard]] static inline int_type IntFromFloat(const double in_float_)
+		{
+			return EmuMath::RngWrapper<is_64_bit>::IntFromFloat(in_float_);
+		}
+		/// <summary> Creates a value from this wrapper's int_type, performing safely clamped conversions to the provided Out_ type. </summary>
+		template<typename Out_>
+		[[nodiscard]] static inline Out_ ValueFromInt(const int_type in_int_)
+		{
+			return EmuMath::RngWrapper<is_64_bit>::template ValueFromInt<Out_>(in_int_);
+		}
+#pragma endregion
+
+		/// <summary> Creates a wrapper with all default arguments. See all static FastRngWrapper items prefixed with default_. </summary>
+		FastRngWrapper() : FastRngWrapper(default_seed())
+		{
+		}
+		/// <summary> Creates a wrapper with a custom seed and the default min-max range. See FastRngWrapper::default_min and FastRngWrapper::default_max. </summary>
+		/// <param name="seed_">Seed to initialise this wrapper's underlying engine with.</param>
+		FastRngWrapper(seed_type seed_) : FastRngWrapper(default_min, default_max, seed_)
+		{
+		}
+		/// <summary> Creates a wrapper with a custom min-max range and the default seed. See FastRngWrapper::default_seed. </summary>
+		/// <param name="min_">Minimum value for this wrapper to output.</param>
+		/// <param name="max_">Maximum value for this wrapper to output.</param>
+		FastRngWrapper(const double min_, const double max_) : FastRngWrapper(min_, max_, default_seed())
+		{
+		}
+		/// <summary> Creates a fully custom wrapper, making use of no defaults. </summary>
+		/// <param name="min_">Minimum value for this wrapper to output.</param>
+		/// <param name="max_">Maximum value for this wrapper to output.</param>
+		/// <param name="seed_">Seed to initialise this wrapper's underlying engine with.</param>
+		FastRngWrapper(const double min_, const double max_, seed_type seed_) : rng(seed_)
+		{
+			SetMinMax(min_, max_);
+		}
+
+		/// <summary> Provides a copy of this wrapper's underlying engine. Note that the wrapper's engine itself may not be directly accessed. </summary>
+		/// <returns>Copy of this wrapper's underlying engine.</returns>
+		[[nodiscard]] inline underlying_engine CopyEngine() const
+		{
+			return underlying_engine(rng);
+		}
+
+		/// <summary>
+		/// <para> Sets the minimum and maximum values that this wrapper may output. </para>
+		/// <para> Input will be logically corrected if the passed min_ is greater than max_. </para>
+		/// <para> Minimum and maximum integral values will be clamped within their valid range if min_ or max_ exceed their range in either direction. </para>
+		/// </summary>
+		/// <param name="min_">Value to set the minimum output from this wrapper to.</param>
+		/// <param name="max_">Value to set the maximum output from this wrapper to.</param>
+		inline void SetMinMax(double min_, double max_)
+		{
+			if (min_ <= max_)
+			{
+				min_float = min_;
+				max_float = max_;
+			}
+			else
+			{
+				min_float = max_;
+				max_float = min_;
+			}
+			min_int = IntFromFloat(min_float);
+			max_int = IntFromFloat(max_float);
+		}
+
+		[[nodiscard]] inline double GetMin() const
+		{
+			return min_float;
+		}
+		[[nodiscard]] inline double GetMax() const
+		{
+			return max_float;
+		}
+		[[nodiscard]] inline int_type GetMinInt() const
+		{
+			return min_int;
+		}
+		[[nodiscard]] inline int_type GetMaxInt() const
+		{
+			return max_int;
+		}
+
+		/// <summary> Seeds the underlying RNG engine of this wrapper via the provided seed. </summary>
+		/// <param name="seed_">Seed to apply to this wrapper's underlying engine.</param>
+		inline void Seed(seed_type seed_)
+		{
+			rng.seed(seed_);
+		}
+
+		/// <summary> Produces the next output from this wrapper's engine as the provided OutInt_, within the range of the stored MinInt and MaxInt. </summary>
+		/// <typeparam name="OutInt_">Type to output, defaulting to this wrapper's int_type. Must be integral.</typeparam>
+		/// <returns>Next uniformly distributed integer from this wrapper's engine.</returns>
+		template<EmuConcepts::Integer OutInt_ = int_type>
+		[[nodiscard]] inline OutInt_ NextInt()
+		{
+			return _next_int_in_range<OutInt_>(ValueFromInt<OutInt_>(min_int), ValueFromInt<OutInt_>(max_int));
+		}
+		/// <summary> Produces the next output from this wrapper's engine as the provided OutInt_, using a custom min-max range which ignores that set for this wrapper. </summary>
+		/// <typeparam name="OutInt_">Type to output, defaulting to this wrapper's int_type. Must be integral.</typeparam>
+		/// <returns>Next uniformly distributed integer from this wrapper's engine, within the inclusive range custom_min_:custom_max_.</returns>
+		template<EmuConcepts::Integer OutInt_ = int_type>
+		[[nodiscard]] inline OutInt_ NextInt(OutInt_ custom_min_, OutInt_ custom_max_)
+		{
+			return (custom_min_ <= custom_max_) ? _next_int_in_range<OutInt_>(custom_min_, custom_max_) : _next_int_in_range<OutInt_>(custom_max_, custom_min_);
+		}
+
+		/// <summary> Produces the next output from this wrapper's engine as the provided OutFP_, within the range of the stored Min (inclusive) and Max (exclusive). </summary>
+		/// <typeparam name="OutFP_">Type to output, defaulting to double. Must be a floating point type.</typeparam>
+		/// <returns>Next uniformly distributed real from this wrapper's engine.</returns>
+		template<EmuConcepts::FloatingPoint OutFP_ = double>
+		[[nodiscard]] inline OutFP_ NextReal()
+		{
+			return _next_real_in_range<OutFP_>(static_cast<OutFP_>(min_float), static_cast<OutFP_>(max_float));
+		}
+		/// <summary> Produces the next output from this wrapper's engine as the provided OutFP_, using a custom min-max range which ignores that set for this wrapper. </summary>
+		/// <typeparam name="OutFP_">Type to output, defaulting to double. Must be a floating point type.</typeparam>
+		/// <returns>Next uniformly distributed real from this wrapper's engine, within the range custom_min_ (inclusive) : custom_max_ (exclusive).</returns>
+		template<EmuConcepts::FloatingPoint OutFP_ = double>
+		[[nodiscard]] inline OutFP_ NextReal(OutFP_ custom_min_, OutFP_ custom_max_)
+		{
+			return (custom_min_ <= custom_max_) ? _next_real_in_range<OutFP_>(custom_min_, custom_max_) : _next_real_in_range<OutFP_>(custom_max_, custom_min_);
+		}
+
+		/// <summary>
+		/// <para> Fills all items in the passed span with the next outputs from this wrapper's engine, within the range of this wrapper's stored min and max. </para>
+		/// <para> Integral items are produced as though by NextInt, and floating-point items as though by NextReal. </para>
+		/// </summary>
+		/// <param name="out_">Span of items to fill.</param>
+		template<typename Out_>
+		inline void Fill(std::span<Out_> out_)
+		{
+			if constexpr (std::is_floating_point_v<Out_>)
+			{
+				Fill(out_, static_cast<Out_>(min_float), static_cast<Out_>(max_float));
+			}
+			else
+			{
+				Fill(out_, ValueFromInt<Out_>(min_int), ValueFromInt<Out_>(max_int));
+			}
+		}
+		/// <summary>
+		/// <para> Fills all items in the passed span with the next outputs from this wrapper's engine, within a custom range which ignores that set for this wrapper. </para>
+		/// <para> Integral items are within the inclusive range custom_min_:custom_max_. Floating-point items exclude custom_max_. </para>
+		/// </summary>
+		/// <param name="out_">Span of items to fill.</param>
+		/// <param name="custom_min_">Minimum value to output.</param>
+		/// <param name="custom_max_">Maximum value to output.</param>
+		template<typename Out_>
+		inline void Fill(std::span<Out_> out_, std::type_identity_t<Out_> custom_min_, std::type_identity_t<Out_> custom_max_)
+		{
+			if (custom_max_ < custom_min_)
+			{
+				std::swap(custom_min_, custom_max_);
+			}
+
+			if constexpr (std::is_floating_point_v<Out_>)
+			{
+				if constexpr (requires(underlying_engine& engine_) { engine_.FillReal(out_.data(), out_.size(), custom_min_, custom_max_); })
+				{
+					rng.FillReal(out_.data(), out_.size(), custom_min_, custom_max_);
+				}
+				else
+				{
+					for (Out_& item_ : out_)
+					{
+						item_ = _next_real_in_range<Out_>(custom_min_, custom_max_);
+					}
+				}
+			}
+			else
+			{
+				static_assert(std::is_integral_v<Out_> && !std::is_same_v<Out_, bool>, "Invalid Out_ type provided to EmuMath::FastRngWrapper::Fill: Items must be of an integral or floating-point type.");
+				for (Out_& item_ : out_)
+				{
+					item_ = _next_int_in_range<Out_>(custom_min_, custom_max_);
+				}
+			}
+		}
+
+	private:
+		template<typename Bits_>
+		[[nodiscard]] inline Bits_ _next_bits()
+		{
+			if constexpr (sizeof(Bits_) == sizeof(engine_result_type))
+			{
+				return static_cast<Bits_>(rng());
+			}
+			else if constexpr (sizeof(Bits_) < sizeof(engine_result_type))
+			{
+				// Upper bits are used, as they have the best statistical quality for all supported engines
+				return static_cast<Bits_>(rng() >> 32);
+			}
+			else
+			{
+				const std::uint64_t hi_ = static_cast<std::uint64_t>(rng());
+				return static_cast<Bits_>((hi_ << 32) | static_cast<std::uint64_t>(rng()));
+			}
+		}
+
+		[[nodiscard]] static inline std::uint32_t _mul_wide(const std::uint32_t a_, const std::uint32_t b_, std::uint32_t& out_hi_)
+		{
+			const std::uint64_t product_ = static_cast<std::uint64_t>(a_) * b_;
+			out_hi_ = static_cast<std::uint32_t>(product_ >> 32);
+			return static_cast<std::uint32_t>(product_);
+		}
+		[[nodiscard]] static inline std::uint64_t _mul_wide(const std::uint64_t a_, const std::uint64_t b_, std::uint64_t& out_hi_)
+		{
+			const std::uint64_t a_lo_ = a_ & 0xFFFFFFFFULL, a_hi_ = a_ >> 32;
+			const std::uint64_t b_lo_ = b_ & 0xFFFFFFFFULL, b_hi_ = b_ >> 32;
+			const std::uint64_t lo_lo_ = a_lo_ * b_lo_;
+			const std::uint64_t hi_lo_ = a_hi_ * b_lo_;
+			const std::uint64_t lo_hi_ = a_lo_ * b_hi_;
+			const std::uint64_t cross_ = (lo_lo_ >> 32) + (hi_lo_ & 0xFFFFFFFFULL) + lo_hi_;
+			out_hi_ = (a_hi_ * b_hi_) + (hi_lo_ >> 32) + (cross_ >> 32);
+			return (cross_ << 32) | (lo_lo_ & 0xFFFFFFFFULL);
+		}
+
+		/// <summary> Unbiased integer in the range 0:(bound_ - 1) via Lemire's multiply-shift reduction, only dividing when a rejection may be needed. </summary>
+		template<typename Bits_>
+		[[nodiscard]] inline Bits_ _next_bounded(const Bits_ bound_)
+		{
+			Bits_ hi_;
+			Bits_ lo_ = _mul_wide(_next_bits<Bits_>(), bound_, hi_);
+			if (lo_ < bound_)
+			{
+				const Bits_ threshold_ = static_cast<Bits_>(Bits_(0) - bound_) % bound_;
+				while (lo_ < threshold_)
+				{
+					lo_ = _mul_wide(_next_bits<Bits_>(), bound_, hi_);
+				}
+			}
+			return hi_;
+		}
+
+		template<typename OutInt_>
+		[[nodiscard]] inline OutInt_ _next_int_in_range(const OutInt_ min_, const OutInt_ max_)
+		{
+			using out_uint = std::make_unsigned_t<OutInt_>;
+			using bits_type = std::conditional_t<(sizeof(OutInt_) <= 4), std::uint32_t, std::uint64_t>;
+			const bits_type range_ = static_cast<bits_type>(static_cast<out_uint>(static_cast<out_uint>(max_) - static_cast<out_uint>(min_)));
+			const bits_type offset_ = (range_ == std::numeric_limits<bits_type>::max()) ? _next_bits<bits_type>() : _next_bounded<bits_type>(range_ + 1);
+			return static_cast<OutInt_>(static_cast<out_uint>(static_cast<out_uint>(min_) + static_cast<out_uint>(offset_)));
+		}
+
+		template<typename OutFP_>
+		[[nodiscard]] inline OutFP_ _next_unit_real()
+		{
+			if constexpr (std::is_same_v<OutFP_, float>)
+			{
+				return static_cast<float>(_next_bits<std::uint32_t>() >> 8) * (1.0f / 16777216.0f);
+			}
+			else
+			{
+				return static_cast<OutFP_>(static_cast<double>(_next_bits<std::uint64_t>() >> 11) * (1.0 / 9007199254740992.0));
+			}
+		}
+
+		template<typename OutFP_>
+		[[nodiscard]] inline OutFP_ _next_real_in_range(const OutFP_ min_, const OutFP_ max_)
+		{
+			const OutFP_ out_ = min_ + (_next_unit_real<OutFP_>() * (max_ - min_));
+			// Rounding may land on max_ for wide ranges, so pull such results back into the half-open range
+			return (out_ < max_ || !(min_ < max_)) ? out_ : std::nextafter(max_, min_);
+		}
+
+		underlying_engine rng;
+		double min_float;
+		double max_float;
+		int_type min_int;
+		int_type max_int;
+	};
+}
+
+#endif
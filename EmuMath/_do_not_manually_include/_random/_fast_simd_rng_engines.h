@@ -0,0 +1,179 @@
+#ifndef EMU_MATH_FAST_SIMD_RNG_ENGINES_H_INC_
+#define EMU_MATH_FAST_SIMD_RNG_ENGINES_H_INC_ 1
+
+#include "_fast_rng_engines.h"
+#include "../../../EmuSIMD/SIMDHelpers.h"
+#include <cmath>
+#include <cstring>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> Vectorised xoshiro256++ engine, advancing one independent xoshiro256++ stream per 64-bit lane of the provided integral SIMD register on every step. </para>
+	/// <para> Lanes are seeded from a single seed, with each lane's stream jumped 2^128 outputs beyond the previous lane's so that no lanes overlap. </para>
+	/// <para>
+	///		Satisfies UniformRandomBitGenerator via a lane buffer, but is intended for bulk generation via FillBits and FillReal,
+	///		which write a full register of output per step. FillReal produces (2 * num_lanes) floats or num_lanes doubles per step.
+	/// </para>
+	/// <para> May be wrapped in an EmuMath::FastRngWrapper to share the interface of EmuMath::RngWrapper, in which case Fill makes use of FillReal. </para>
+	/// </summary>
+	template<class IntRegister_ = EmuSIMD::i256_generic>
+	class FastXoshiro256PlusPlus
+	{
+	public:
+		using register_type = typename EmuCore::TMP::remove_ref_cv<IntRegister_>::type;
+		static_assert
+		(
+			EmuSIMD::TMP::is_integral_simd_register_v<register_type>,
+			"Invalid IntRegister_ provided to EmuMath::FastXoshiro256PlusPlus: The register must be an integral SIMD register."
+		);
+		using result_type = std::uint64_t;
+		using seed_type = std::uint64_t;
+		using scalar_engine = EmuMath::Xoshiro256PlusPlus;
+
+		static constexpr std::size_t register_width = EmuSIMD::TMP::simd_register_width_v<register_type>;
+		static constexpr std::size_t num_lanes = register_width / 64;
+		using float_register_type = EmuSIMD::TMP::register_type_t<float, register_width>;
+		using double_register_type = EmuSIMD::TMP::register_type_t<double, register_width>;
+
+		[[nodiscard]] static constexpr inline result_type min() noexcept
+		{
+			return std::numeric_limits<result_type>::min();
+		}
+		[[nodiscard]] static constexpr inline result_type max() noexcept
+		{
+			return std::numeric_limits<result_type>::max();
+		}
+
+		FastXoshiro256PlusPlus() : FastXoshiro256PlusPlus(seed_type(0))
+		{
+		}
+		explicit FastXoshiro256PlusPlus(seed_type seed_) : state(), buffer(), buffer_index(num_lanes)
+		{
+			seed(seed_);
+		}
+
+		/// <summary> Resets all lanes of this engine from the provided seed, and discards any buffered output. </summary>
+		inline void seed(seed_type seed_)
+		{
+			scalar_engine lane_engine_(seed_);
+			alignas(64) std::uint64_t lane_states_[scalar_engine::state_size][num_lanes];
+			for (std::size_t lane_ = 0; lane_ < num_lanes; ++lane_)
+			{
+				const std::uint64_t* p_state_ = lane_engine_.State();
+				for (std::size_t i = 0; i < scalar_engine::state_size; ++i)
+				{
+					lane_states_[i][lane_] = p_state_[i];
+				}
+				lane_engine_.Jump();
+			}
+
+			for (std::size_t i = 0; i < scalar_engine::state_size; ++i)
+			{
+				state[i] = EmuSIMD::load<register_type>(lane_states_[i]);
+			}
+			buffer_index = num_lanes;
+		}
+
+		/// <summary> Provides the next output from a single lane, stepping all lanes only once every num_lanes outputs. </summary>
+		inline result_type operator()()
+		{
+			if (buffer_index == num_lanes)
+			{
+				EmuSIMD::store(NextRegister(), buffer);
+				buffer_index = 0;
+			}
+			return buffer[buffer_index++];
+		}
+
+		/// <summary> Steps all lanes of this engine, returning a register containing the next output of each lane. </summary>
+		[[nodiscard]] inline register_type NextRegister()
+		{
+			const register_type result_ = EmuSIMD::add<64>(_rotate_left<23>(EmuSIMD::add<64>(state[0], state[3])), state[0]);
+			const register_type t_ = EmuSIMD::shift_left<17, 64>(state[1]);
+			state[2] = EmuSIMD::bitwise_xor(state[2], state[0]);
+			state[3] = EmuSIMD::bitwise_xor(state[3], state[1]);
+			state[1] = EmuSIMD::bitwise_xor(state[1], state[2]);
+			state[0] = EmuSIMD::bitwise_xor(state[0], state[3]);
+			state[2] = EmuSIMD::bitwise_xor(state[2], t_);
+			state[3] = _rotate_left<45>(state[3]);
+			return result_;
+		}
+
+		/// <summary> Fills the pointed-to contiguous items with raw 64-bit outputs, writing a full register per step. </summary>
+		/// <param name="p_out_">Pointer to the first of count_ items to write to.</param>
+		/// <param name="count_">Number of items to write.</param>
+		inline void FillBits(std::uint64_t* p_out_, std::size_t count_)
+		{
+			std::size_t i = 0;
+			for (; i + num_lanes <= count_; i += num_lanes)
+			{
+				EmuSIMD::store(NextRegister(), p_out_ + i);
+			}
+			for (; i < count_; ++i)
+			{
+				p_out_[i] = this->operator()();
+			}
+		}
+
+		/// <summary>
+		/// <para> Fills the pointed-to contiguous items with uniformly distributed reals in the range min_ (inclusive) : max_ (exclusive), writing a full register per step. </para>
+		/// <para> Reals are formed directly from output mantissa bits, providing 23 random bits per float and 52 per double. </para>
+		/// </summary>
+		/// <param name="p_out_">Pointer to the first of count_ items to write to.</param>
+		/// <param name="count_">Number of items to write.</param>
+		/// <param name="min_">Inclusive lower bound of output.</param>
+		/// <param name="max_">Exclusive upper bound of output. If equal to min_, all outputs will be min_.</param>
+		template<EmuConcepts::FloatingPoint FP_>
+		requires(std::is_same_v<FP_, float> || std::is_same_v<FP_, double>)
+		inline void FillReal(FP_* p_out_, std::size_t count_, FP_ min_, FP_ max_)
+		{
+			using fp_register = std::conditional_t<std::is_same_v<FP_, float>, float_register_type, double_register_type>;
+			using bits_type = std::conditional_t<std::is_same_v<FP_, float>, std::uint32_t, std::uint64_t>;
+			constexpr std::size_t bit_width_ = sizeof(FP_) * 8;
+			constexpr std::size_t per_register_ = register_width / bit_width_;
+			constexpr std::int32_t mantissa_shift_ = std::is_same_v<FP_, float> ? 9 : 12;
+			constexpr bits_type one_bits_ = std::is_same_v<FP_, float> ? bits_type(0x3F800000) : bits_type(0x3FF0000000000000ULL);
+
+			const FP_ highest_ = (min_ < max_) ? std::nextafter(max_, min_) : max_;
+			const register_type one_bits_reg_ = EmuSIMD::set1<register_type, bit_width_>(one_bits_);
+			const fp_register one_ = EmuSIMD::set1<fp_register>(FP_(1));
+			const fp_register min_reg_ = EmuSIMD::set1<fp_register>(min_);
+			const fp_register range_reg_ = EmuSIMD::set1<fp_register>(max_ - min_);
+			const fp_register highest_reg_ = EmuSIMD::set1<fp_register>(highest_);
+
+			auto make_reals_ = [&]() -> fp_register
+			{
+				// Mantissa bits beneath an exponent of 0 produce a value in [1, 2)
+				const register_type bits_ = EmuSIMD::bitwise_or(EmuSIMD::shift_right_logical<mantissa_shift_, bit_width_>(NextRegister()), one_bits_reg_);
+				const fp_register unit_ = EmuSIMD::sub(EmuSIMD::cast<fp_register>(bits_), one_);
+				return EmuSIMD::min<bit_width_, true>(EmuSIMD::fmadd(unit_, range_reg_, min_reg_), highest_reg_);
+			};
+
+			std::size_t i = 0;
+			for (; i + per_register_ <= count_; i += per_register_)
+			{
+				EmuSIMD::store(make_reals_(), p_out_ + i);
+			}
+			if (i < count_)
+			{
+				alignas(64) FP_ tail_[per_register_];
+				EmuSIMD::store(make_reals_(), tail_);
+				std::memcpy(p_out_ + i, tail_, (count_ - i) * sizeof(FP_));
+			}
+		}
+
+	private:
+		template<std::int32_t Shifts_>
+		[[nodiscard]] static inline register_type _rotate_left(const register_type& x_)
+		{
+			return EmuSIMD::bitwise_or(EmuSIMD::shift_left<Shifts_, 64>(x_), EmuSIMD::shift_right_logical<64 - Shifts_, 64>(x_));
+		}
+
+		register_type state[scalar_engine::state_size];
+		alignas(64) std::uint64_t buffer[num_lanes];
+		std::size_t buffer_index;
+	};
+}
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "../../../EmuCore/ArithmeticHelpers/BitHelpers.h"
 #include "_rng_wrapper.h"
+#include <limits>
 #include <ostream>
 #include <vector>
 
@@ -11,17 +12,38 @@ namespace EmuMath
 	/// <summary> 
 	/// <para> Class to produce a shuffled sequence of integers. Defaults to storing signed 32-bit integers. </para>
 	/// <para> Created sequences will contain values within the range of 0 (inclusive) : size (exclusive). </para>
+	/// <para> Narrow integer types such as std::uint8_t and std::uint16_t may be used; the size of such sequences is limited to max_size(). </para>
+	/// <para>
+	///		If Doubled_ is true, the sequence is stored twice back-to-back so that any index in the range 0:(2 * size()) may be read,
+	///		allowing a nested lookup of the form `seq[seq[a] + b]` (where a and b are in the range 0:size()) to be performed without masking.
+	///		Doubled storage is additionally padded with enough trailing items that a 32-bit read starting at any item is in bounds.
+	/// </para>
 	/// </summary>
-	template<typename T_>
+	template<typename T_, bool Doubled_ = false>
 	class ShuffledIntSequence
 	{
 	public:
 		using value_type = T_;
+		static constexpr bool is_doubled = Doubled_;
+		static constexpr std::size_t num_padding_items = (Doubled_ && sizeof(value_type) < 4) ? ((4 / sizeof(value_type)) - 1) : 0;
 		using seed_32_type = EmuMath::RngWrapper<false>::unsigned_int_type;
 		using seed_64_type = EmuMath::RngWrapper<true>::unsigned_int_type;
 		static seed_32_type default_seed_32() { return EmuMath::RngWrapper<false>::default_seed(); };
 		static seed_64_type default_seed_64() { return EmuMath::RngWrapper<true>::default_seed(); };
 
+		/// <summary> The maximum number of items that a sequence of this type may contain, limited by the range of value_type. </summary>
+		[[nodiscard]] static constexpr inline std::size_t max_size()
+		{
+			if constexpr (std::numeric_limits<value_type>::digits < std::numeric_limits<std::size_t>::digits)
+			{
+				return static_cast<std::size_t>(std::numeric_limits<value_type>::max()) + 1;
+			}
+			else
+			{
+				return std::numeric_limits<std::size_t>::max();
+			}
+		}
+
 	private:
 		using item_storage = std::vector<value_type>;
 		explicit ShuffledIntSequence(std::size_t size_) : items(size_), max_contained_value(static_cast<value_type>(size_) - 1)
@@ -30,6 +52,7 @@ namespace EmuMath
 		}
 		explicit ShuffledIntSequence(const item_storage& items_to_copy_) : items(items_to_copy_), max_contained_value(static_cast<value_type>(items_to_copy_.size()) - 1)
 		{
+			_mirror_items();
 		}
 
 	public:
@@ -37,7 +60,7 @@ namespace EmuMath
 		using const_reverse_iterator = typename item_storage::const_reverse_iterator;
 
 		ShuffledIntSequence() = delete;
-		ShuffledIntSequence(const ShuffledIntSequence<value_type>& to_copy_) : items(to_copy_.items), max_contained_value(to_copy_.max_contained_value)
+		ShuffledIntSequence(const ShuffledIntSequence& to_copy_) : items(to_copy_.items), max_contained_value(to_copy_.max_contained_value)
 		{
 		}
 		ShuffledIntSequence(std::size_t size_, bool do_64_bit_shuffle_) : ShuffledIntSequence(size_)
@@ -52,17 +75,18 @@ namespace EmuMath
 		{
 			Shuffle(shuffle_seed_64_);
 		}
-		ShuffledIntSequence(ShuffledIntSequence<value_type>&& to_move_) noexcept : ShuffledIntSequence()
+		ShuffledIntSequence(ShuffledIntSequence&& to_move_) noexcept : items(), max_contained_value(0)
 		{
 			items.swap(to_move_.items);
 			max_contained_value = to_move_.max_contained_value;
 			to_move_.max_contained_value = value_type(0);
 		}
 
-		inline ShuffledIntSequence<value_type>& operator=(const ShuffledIntSequence<value_type>& to_copy_)
+		inline ShuffledIntSequence& operator=(const ShuffledIntSequence& to_copy_)
 		{
 			items = to_copy_.items;
 			max_contained_value = to_copy_.max_contained_value;
+			return *this;
 		}
 
 		[[nodiscard]] inline bool operator!() const
@@ -70,7 +94,7 @@ namespace EmuMath
 			return items.size() == 0;
 		}
 
-		[[nodiscard]] inline ShuffledIntSequence<value_type> operator<<(std::size_t num_shifts_) const
+		[[nodiscard]] inline ShuffledIntSequence operator<<(std::size_t num_shifts_) const
 		{
 			const std::size_t size_ = size();
 			if (size_ >= 2)
@@ -88,20 +112,20 @@ namespace EmuMath
 					{
 						out_[i] = items[offset_];
 					}
-					return ShuffledIntSequence<value_type>(out_);
+					return ShuffledIntSequence(out_);
 				}
 				else
 				{
-					return ShuffledIntSequence<value_type>(items);
+					return *this;
 				}
 			}
 			else
 			{
-				return ShuffledIntSequence(items);
+				return *this;
 			}
 		}
 
-		[[nodiscard]] inline ShuffledIntSequence<value_type> operator>>(std::size_t num_shifts_) const
+		[[nodiscard]] inline ShuffledIntSequence operator>>(std::size_t num_shifts_) const
 		{
 			const std::size_t size_ = size();
 			if (size_ >= 2)
@@ -121,26 +145,26 @@ namespace EmuMath
 						out_[i] = items[i - num_shifts_];
 					}
 
-					return ShuffledIntSequence<value_type>(out_);
+					return ShuffledIntSequence(out_);
 				}
 				else
 				{
-					return ShuffledIntSequence<value_type>(items);
+					return *this;
 				}
 			}
 			else
 			{
-				return ShuffledIntSequence(items);
+				return *this;
 			}
 		}
 
-		inline ShuffledIntSequence<value_type>& operator<<=(std::size_t num_shifts_)
+		inline ShuffledIntSequence& operator<<=(std::size_t num_shifts_)
 		{
 			this->operator=(this->operator<<(num_shifts_));
 			return *this;
 		}
 
-		inline ShuffledIntSequence<value_type>& operator>>=(std::size_t num_shifts_)
+		inline ShuffledIntSequence& operator>>=(std::size_t num_shifts_)
 		{
 			this->operator=(this->operator>>(num_shifts_));
 			return *this;
@@ -151,16 +175,37 @@ namespace EmuMath
 			return at(index_);
 		}
 
+		/// <summary> Accesses the item at the provided index. If this sequence is doubled, the index may be anywhere in the range 0:(2 * size()). </summary>
 		[[nodiscard]] inline const value_type& at(std::size_t index_) const
 		{
 			return items[index_];
 		}
 
 		[[nodiscard]] inline std::size_t size() const
+		{
+			if constexpr (Doubled_)
+			{
+				return items.size() == 0 ? 0 : (static_cast<std::size_t>(max_contained_value) + 1);
+			}
+			else
+			{
+				return items.size();
+			}
+		}
+
+		/// <summary> The number of items readable via data(). This is size() for non-doubled sequences, and (2 * size()) + num_padding_items for doubled ones. </summary>
+		[[nodiscard]] inline std::size_t stored_size() const
 		{
 			return items.size();
 		}
 
+		/// <summary> Provides a pointer to the contiguous storage of this sequence's items, containing stored_size() elements. </summary>
+		/// <returns>Pointer to the first item in this sequence.</returns>
+		[[nodiscard]] inline const value_type* data() const
+		{
+			return items.data();
+		}
+
 		inline void swap(ShuffledIntSequence& to_swap_with_)
 		{
 			items.swap(to_swap_with_.items);
@@ -175,12 +220,12 @@ namespace EmuMath
 		}
 		[[nodiscard]] inline const_iterator cend() const
 		{
-			return items.cend();
+			return items.cbegin() + size();
 		}
 
 		[[nodiscard]] inline const_reverse_iterator crbegin() const
 		{
-			return items.crbegin();
+			return const_reverse_iterator(cend());
 		}
 		[[nodiscard]] inline const_reverse_iterator crend() const
 		{
@@ -232,16 +277,62 @@ namespace EmuMath
 		inline void Reverse()
 		{
 			item_storage reversed_(size());
-			std::copy(items.rbegin(), items.rend(), reversed_.begin());
+			std::copy(crbegin(), crend(), reversed_.begin());
 			reversed_.swap(items);
+			_mirror_items();
 		}
 
 		/// <summary> Provides a reversed form of this sequence without modifying this instance. </summary>
 		/// <returns>Copy of this instance with its contained elements reversed.</returns>
-		[[nodiscard]] inline ShuffledIntSequence<value_type> AsReversed() const
+		[[nodiscard]] inline ShuffledIntSequence AsReversed() const
 		{
 			item_storage out_(size());
-			std::copy(items.rbegin(), items.rend(), out_.begin());
+			std::copy(crbegin(), crend(), out_.begin());
+			return ShuffledIntSequence(out_);
+		}
+
+		/// <summary>
+		/// <para> Provides a periodic form of this sequence without modifying this instance, in which the item at any index i is equal to the item at index (i % period_). </para>
+		/// <para>
+		///		The first period_ items are the first items of this sequence to each have a unique value modulo period_, in the order they appear.
+		///		As such, values remain within the range 0:size(), but reduced modulo period_ they form a shuffled sequence of 0:period_.
+		/// </para>
+		/// <para>
+		///		When used for nested lookups of the form `seq[(seq[a & mask] + b) & mask]`, the result only depends on a and b modulo period_.
+		///		This is only the case where the sequence contains a power of 2, so a copy of this sequence is returned unchanged otherwise.
+		/// </para>
+		/// <para> period_ is reduced to the previous power of 2 if it is not one, and a period_ of 0 or at least size() returns an unchanged copy. </para>
+		/// </summary>
+		/// <param name="period_">Number of items after which the output sequence repeats.</param>
+		/// <returns>Copy of this sequence laid out to repeat every period_ items.</returns>
+		[[nodiscard]] inline ShuffledIntSequence AsPeriodic(std::size_t period_) const
+		{
+			const std::size_t size_ = size();
+			if (period_ == 0 || period_ >= size_ || !ContainsPowerOf2())
+			{
+				return *this;
+			}
+
+			period_ = EmuCore::ArithmeticHelpers::highest_set_bit<std::size_t>(period_);
+			const std::size_t period_mask_ = period_ - 1;
+			std::vector<bool> residue_found_(period_, false);
+			item_storage period_items_;
+			period_items_.reserve(period_);
+			for (std::size_t i = 0; i < size_ && period_items_.size() < period_; ++i)
+			{
+				const std::size_t residue_ = static_cast<std::size_t>(items[i]) & period_mask_;
+				if (!residue_found_[residue_])
+				{
+					residue_found_[residue_] = true;
+					period_items_.push_back(items[i]);
+				}
+			}
+
+			item_storage out_(size_);
+			for (std::size_t i = 0; i < size_; ++i)
+			{
+				out_[i] = period_items_[i & period_mask_];
+			}
 			return ShuffledIntSequence(out_);
 		}
 
@@ -356,7 +447,7 @@ namespace EmuMath
 		template<class Rng_, typename Seed_>
 		inline void _do_shuffle(Seed_ seed_)
 		{
-			std::size_t n = items.size();
+			std::size_t n = size();
 			if (n > 1)
 			{
 				Rng_ rng(seed_);
@@ -369,6 +460,7 @@ namespace EmuMath
 
 				} while (n > 1);
 			}
+			_mirror_items();
 		}
 
 		inline void _fill_items_pre_shuffle()
@@ -379,36 +471,54 @@ namespace EmuMath
 			}
 			max_contained_value = static_cast<value_type>(items.size()) - 1;
 		}
+
+		/// <summary> Copies the first size() items into the remainder of doubled storage. Does nothing for non-doubled sequences. </summary>
+		inline void _mirror_items()
+		{
+			if constexpr (Doubled_)
+			{
+				const std::size_t size_ = size();
+				if (size_ != 0)
+				{
+					const std::size_t stored_size_ = (size_ * 2) + num_padding_items;
+					items.resize(stored_size_);
+					for (std::size_t i = size_; i < stored_size_; ++i)
+					{
+						items[i] = items[i % size_];
+					}
+				}
+			}
+		}
 	};
 }
 
-template<typename T_>
-inline std::ostream& operator<<(std::ostream& str_, const EmuMath::ShuffledIntSequence<T_>& permutations_)
+template<typename T_, bool Doubled_>
+inline std::ostream& operator<<(std::ostream& str_, const EmuMath::ShuffledIntSequence<T_, Doubled_>& permutations_)
 {
 	str_ << "{";
 	std::size_t size_ = permutations_.size();
 	if (size_ != 0)
 	{
-		str_ << " " << permutations_[0];
+		str_ << " " << +permutations_[0];
 		for (std::size_t i = 1; i < size_; ++i)
 		{
-			str_ << ", " << permutations_[i];
+			str_ << ", " << +permutations_[i];
 		}
 	}
 	str_ << " }";
 	return str_;
 }
-template<typename T_>
-inline std::wostream& operator<<(std::wostream& str_, const EmuMath::ShuffledIntSequence<T_>& permutations_)
+template<typename T_, bool Doubled_>
+inline std::wostream& operator<<(std::wostream& str_, const EmuMath::ShuffledIntSequence<T_, Doubled_>& permutations_)
 {
 	str_ << L"{";
 	std::size_t size_ = permutations_.size();
 	if (size_ != 0)
 	{
-		str_ << L" " << permutations_[0];
+		str_ << L" " << +permutations_[0];
 		for (std::size_t i = 1; i < size_; ++i)
 		{
-			str_ << L", " << permutations_[i];
+			str_ << L", " << +permutations_[i];
 		}
 	}
 	str_ << L" }";
@@ -788,6 +788,130 @@ namespace EmuSIMD::Funcs
 			static_assert(EmuCore::TMP::get_false<std::size_t, IndexCount_>(), "Invalid IndexCount_ passed to make an all-indices set mask: Valid values are: 2, 4, 8, 16, 32, 64");
 		}
 	}
+
+	namespace _underlying_funcs
+	{
+		/// <summary>
+		/// <para> Converts the 64-bit floats in the passed register to 64-bit signed integers using the current rounding mode. </para>
+		/// <para> Uses the native instruction where AVX-512DQ and AVX-512VL are available. </para>
+		/// <para> 
+		///		Otherwise, values within +/-2^51 are converted exactly by adding 2^52 + 2^51 and reinterpreting the mantissa, 
+		///		and registers containing any other values are converted per element. 
+		/// </para>
+		/// </summary>
+		[[nodiscard]] inline __m128i _cvt_f64_i64_128(__m128d a_) noexcept
+		{
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+			return _mm_cvtpd_epi64(a_);
+#else
+			const __m128d rounded_ = _mm_round_pd(a_, _MM_FROUND_CUR_DIRECTION);
+			const __m128d magic_ = _mm_set1_pd(6755399441055744.0);
+			const __m128d abs_ = _mm_andnot_pd(_mm_set1_pd(-0.0), rounded_);
+			if (_mm_movemask_pd(_mm_cmplt_pd(abs_, _mm_set1_pd(2251799813685248.0))) == 0x3)
+			{
+				return _mm_sub_epi64(_mm_castpd_si128(_mm_add_pd(rounded_, magic_)), _mm_castpd_si128(magic_));
+			}
+			else
+			{
+				alignas(16) double in_[2];
+				_mm_store_pd(in_, rounded_);
+				return _mm_set_epi64x(static_cast<std::int64_t>(in_[1]), static_cast<std::int64_t>(in_[0]));
+			}
+#endif
+		}
+
+		/// <summary>
+		/// <para> 256-bit variant of _cvt_f64_i64_128. </para>
+		/// </summary>
+		[[nodiscard]] inline __m256i _cvt_f64_i64_256(__m256d a_) noexcept
+		{
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+			return _mm256_cvtpd_epi64(a_);
+#else
+			const __m256d rounded_ = _mm256_round_pd(a_, _MM_FROUND_CUR_DIRECTION);
+			const __m256d magic_ = _mm256_set1_pd(6755399441055744.0);
+			const __m256d abs_ = _mm256_andnot_pd(_mm256_set1_pd(-0.0), rounded_);
+			if (_mm256_movemask_pd(_mm256_cmp_pd(abs_, _mm256_set1_pd(2251799813685248.0), _CMP_LT_OQ)) == 0xF)
+			{
+				return _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(rounded_, magic_)), _mm256_castpd_si256(magic_));
+			}
+			else
+			{
+				alignas(32) double in_[4];
+				_mm256_store_pd(in_, rounded_);
+				return _mm256_set_epi64x
+				(
+					static_cast<std::int64_t>(in_[3]),
+					static_cast<std::int64_t>(in_[2]),
+					static_cast<std::int64_t>(in_[1]),
+					static_cast<std::int64_t>(in_[0])
+				);
+			}
+#endif
+		}
+
+		/// <summary>
+		/// <para> Converts the 64-bit signed integers in the passed register to 64-bit floats. </para>
+		/// <para> Uses the native instruction where AVX-512DQ and AVX-512VL are available. </para>
+		/// <para> Otherwise, values within +/-2^51 are converted exactly via the inverse of _cvt_f64_i64_128's magic number, and any others per element. </para>
+		/// </summary>
+		[[nodiscard]] inline __m128d _cvt_i64_f64_128(__m128i a_) noexcept
+		{
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+			return _mm_cvtepi64_pd(a_);
+#else
+			const __m128i in_range_ = _mm_and_si128
+			(
+				_mm_cmpgt_epi64(a_, _mm_set1_epi64x(-2251799813685248LL)),
+				_mm_cmpgt_epi64(_mm_set1_epi64x(2251799813685248LL), a_)
+			);
+			if (_mm_movemask_pd(_mm_castsi128_pd(in_range_)) == 0x3)
+			{
+				const __m128d magic_ = _mm_set1_pd(6755399441055744.0);
+				return _mm_sub_pd(_mm_castsi128_pd(_mm_add_epi64(a_, _mm_castpd_si128(magic_))), magic_);
+			}
+			else
+			{
+				alignas(16) std::int64_t in_[2];
+				_mm_store_si128(reinterpret_cast<__m128i*>(in_), a_);
+				return _mm_set_pd(static_cast<double>(in_[1]), static_cast<double>(in_[0]));
+			}
+#endif
+		}
+
+		/// <summary>
+		/// <para> 256-bit variant of _cvt_i64_f64_128. </para>
+		/// </summary>
+		[[nodiscard]] inline __m256d _cvt_i64_f64_256(__m256i a_) noexcept
+		{
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+			return _mm256_cvtepi64_pd(a_);
+#else
+			const __m256i in_range_ = _mm256_and_si256
+			(
+				_mm256_cmpgt_epi64(a_, _mm256_set1_epi64x(-2251799813685248LL)),
+				_mm256_cmpgt_epi64(_mm256_set1_epi64x(2251799813685248LL), a_)
+			);
+			if (_mm256_movemask_pd(_mm256_castsi256_pd(in_range_)) == 0xF)
+			{
+				const __m256d magic_ = _mm256_set1_pd(6755399441055744.0);
+				return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_add_epi64(a_, _mm256_castpd_si256(magic_))), magic_);
+			}
+			else
+			{
+				alignas(32) std::int64_t in_[4];
+				_mm256_store_si256(reinterpret_cast<__m256i*>(in_), a_);
+				return _mm256_set_pd
+				(
+					static_cast<double>(in_[3]),
+					static_cast<double>(in_[2]),
+					static_cast<double>(in_[1]),
+					static_cast<double>(in_[0])
+				);
+			}
+#endif
+		}
+	}
 }
 
 #endif
@@ -349,12 +349,12 @@ namespace EmuSIMD::Funcs
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_i8x16_f64x2(i8x16_arg a_)
 	{
-		return _mm_cvtepi64_pd(_mm_cvtepi8_epi64(a_));
+		return _underlying_funcs::_cvt_i64_f64_128(_mm_cvtepi8_epi64(a_));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_i16x8_f64x2(i16x8_arg a_)
 	{
-		return _mm_cvtepi64_pd(_mm_cvtepi16_epi64(a_));
+		return _underlying_funcs::_cvt_i64_f64_128(_mm_cvtepi16_epi64(a_));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_i32x4_f64x2(i32x4_arg a_)
@@ -364,17 +364,17 @@ namespace EmuSIMD::Funcs
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_i64x2_f64x2(i64x2_arg a_)
 	{
-		return _mm_cvtepi64_pd(a_);
+		return _underlying_funcs::_cvt_i64_f64_128(a_);
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_i8x32_f64x2(i8x32_arg a_)
 	{
-		return _mm_cvtepi64_pd(_mm_cvtepi8_epi64(_mm256_castsi256_si128(a_)));
+		return _underlying_funcs::_cvt_i64_f64_128(_mm_cvtepi8_epi64(_mm256_castsi256_si128(a_)));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_i16x16_f64x2(i16x16_arg a_)
 	{
-		return _mm_cvtepi64_pd(_mm_cvtepi16_epi64(_mm256_castsi256_si128(a_)));
+		return _underlying_funcs::_cvt_i64_f64_128(_mm_cvtepi16_epi64(_mm256_castsi256_si128(a_)));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_i32x8_f64x2(i32x8_arg a_)
@@ -384,7 +384,7 @@ namespace EmuSIMD::Funcs
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_i64x4_f64x2(i64x4_arg a_)
 	{
-		return _mm_cvtepi64_pd(_mm256_castsi256_si128(a_));
+		return _underlying_funcs::_cvt_i64_f64_128(_mm256_castsi256_si128(a_));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_i8x64_f64x2(i8x64_arg a_)
@@ -425,12 +425,12 @@ namespace EmuSIMD::Funcs
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_u8x16_f64x2(u8x16_arg a_)
 	{
-		return _mm_cvtepi64_pd(_mm_cvtepu8_epi64(a_));
+		return _underlying_funcs::_cvt_i64_f64_128(_mm_cvtepu8_epi64(a_));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_u16x8_f64x2(u16x8_arg a_)
 	{
-		return _mm_cvtepi64_pd(_mm_cvtepu16_epi64(a_));
+		return _underlying_funcs::_cvt_i64_f64_128(_mm_cvtepu16_epi64(a_));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_u32x4_f64x2(u32x4_arg a_)
@@ -445,12 +445,12 @@ namespace EmuSIMD::Funcs
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_u8x32_f64x2(u8x32_arg a_)
 	{
-		return _mm_cvtepi64_pd(_mm_cvtepu8_epi64(_mm256_castsi256_si128(a_)));
+		return _underlying_funcs::_cvt_i64_f64_128(_mm_cvtepu8_epi64(_mm256_castsi256_si128(a_)));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_u16x16_f64x2(u16x16_arg a_)
 	{
-		return _mm_cvtepi64_pd(_mm_cvtepu16_epi64(_mm256_castsi256_si128(a_)));
+		return _underlying_funcs::_cvt_i64_f64_128(_mm_cvtepu16_epi64(_mm256_castsi256_si128(a_)));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x2 cvt_u32x8_f64x2(u32x8_arg a_)
@@ -361,12 +361,12 @@ namespace EmuSIMD::Funcs
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_i8x16_f64x4(i8x16_arg a_)
 	{
-		return _mm256_cvtepi64_pd(_mm256_cvtepi8_epi64(a_));
+		return _underlying_funcs::_cvt_i64_f64_256(_mm256_cvtepi8_epi64(a_));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_i16x8_f64x4(i16x8_arg a_)
 	{
-		return _mm256_cvtepi64_pd(_mm256_cvtepi16_epi64(a_));
+		return _underlying_funcs::_cvt_i64_f64_256(_mm256_cvtepi16_epi64(a_));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_i32x4_f64x4(i32x4_arg a_)
@@ -376,17 +376,17 @@ namespace EmuSIMD::Funcs
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_i64x2_f64x4(i64x2_arg a_)
 	{
-		return _mm256_castpd128_pd256(_mm_cvtepi64_pd(a_));
+		return _mm256_castpd128_pd256(_underlying_funcs::_cvt_i64_f64_128(a_));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_i8x32_f64x4(i8x32_arg a_)
 	{
-		return _mm256_cvtepi64_pd(_mm256_cvtepi8_epi64(_mm256_castsi256_si128(a_)));
+		return _underlying_funcs::_cvt_i64_f64_256(_mm256_cvtepi8_epi64(_mm256_castsi256_si128(a_)));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_i16x16_f64x4(i16x16_arg a_)
 	{
-		return _mm256_cvtepi64_pd(_mm256_cvtepi16_epi64(_mm256_castsi256_si128(a_)));
+		return _underlying_funcs::_cvt_i64_f64_256(_mm256_cvtepi16_epi64(_mm256_castsi256_si128(a_)));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_i32x8_f64x4(i32x8_arg a_)
@@ -396,7 +396,7 @@ namespace EmuSIMD::Funcs
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_i64x4_f64x4(i64x4_arg a_)
 	{
-		return _mm256_cvtepi64_pd(a_);
+		return _underlying_funcs::_cvt_i64_f64_256(a_);
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_i8x64_f64x4(i8x64_arg a_)
@@ -437,12 +437,12 @@ namespace EmuSIMD::Funcs
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_u8x16_f64x4(u8x16_arg a_)
 	{
-		return _mm256_cvtepi64_pd(_mm256_cvtepu8_epi64(a_));
+		return _underlying_funcs::_cvt_i64_f64_256(_mm256_cvtepu8_epi64(a_));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_u16x8_f64x4(u16x8_arg a_)
 	{
-		return _mm256_cvtepi64_pd(_mm256_cvtepu16_epi64(a_));
+		return _underlying_funcs::_cvt_i64_f64_256(_mm256_cvtepu16_epi64(a_));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_u32x4_f64x4(u32x4_arg a_)
@@ -457,12 +457,12 @@ namespace EmuSIMD::Funcs
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_u8x32_f64x4(u8x32_arg a_)
 	{
-		return _mm256_cvtepi64_pd(_mm256_cvtepu8_epi64(_mm256_castsi256_si128(a_)));
+		return _underlying_funcs::_cvt_i64_f64_256(_mm256_cvtepu8_epi64(_mm256_castsi256_si128(a_)));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_u16x16_f64x4(u16x16_arg a_)
 	{
-		return _mm256_cvtepi64_pd(_mm256_cvtepu16_epi64(_mm256_castsi256_si128(a_)));
+		return _underlying_funcs::_cvt_i64_f64_256(_mm256_cvtepu16_epi64(_mm256_castsi256_si128(a_)));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::f64x4 cvt_u32x8_f64x4(u32x8_arg a_)
@@ -327,12 +327,12 @@ namespace EmuSIMD::Funcs
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::i64x4 cvt_f64x2_i64x4(f64x2_arg a_)
 	{
-		return _mm256_castsi128_si256(_mm_cvtpd_epi64(a_));
+		return _mm256_castsi128_si256(_underlying_funcs::_cvt_f64_i64_128(a_));
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::i64x4 cvt_f64x4_i64x4(f64x4_arg a_)
 	{
-		return _mm256_cvtpd_epi64(a_);
+		return _underlying_funcs::_cvt_f64_i64_256(a_);
 	}
 
 	EMU_SIMD_COMMON_FUNC_SPEC EmuSIMD::i64x4 cvt_f64x8_i64x4(f64x8_arg a_)
@@ -3,19 +3,42 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstdint>
 #include <deque>
+#include <functional>
 #include <future>
 #include <iterator>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
 #include <type_traits>
-#include <variant>
+#include <vector>
 
+#include "InlineTask.h"
+#include "TaskFuture.h"
+#include "ThreadPoolIdlePolicy.h"
+#include "WorkStealingDeque.h"
 #include "../EmuCore/CommonConcepts/CommonRequirements.h"
-#include "../EmuCore/CommonPreprocessor/Warning.h"
 
 namespace EmuThreads
 {
+	/// <summary>
+	/// <para> Work-stealing Thread Pool executing tasks of the provided Func_ type. </para>
+	/// <para>
+	///		Each Worker Thread owns a lock-free deque of tasks. Tasks added by a Worker Thread go to the bottom of its own deque,
+	///		whereas tasks added from any other thread go to a shared injection queue.
+	/// </para>
+	/// <para>
+	///		Idle Worker Threads first take from their own deque, then claim a share of the injection queue, and finally steal from the top of other Worker Threads' deques,
+	///		starting from a random victim. As such, the shared lock is only taken once per batch of injected tasks rather than once per executed task.
+	/// </para>
+	/// <para> Worker Threads which remain unable to acquire a task behave as described by the Thread Pool's `idle_policy`. </para>
+	/// <para>
+	///		Each queued task is a single allocation holding the constructed Func_ and, if a future was requested, the result's shared state.
+	///		Using an EmuThreads::InlineTask as Func_ avoids any further allocation for small callables.
+	/// </para>
+	/// </summary>
 	template<EmuConcepts::Invocable<> Func_>
 	class BasicThreadPool
 	{
@@ -23,54 +46,102 @@ namespace EmuThreads
 		using func_type = Func_;
 		using func_return_type = typename std::invoke_result<func_type>::type;
 
-	private:
-		using packaged_func_type = std::packaged_task<func_return_type()>;
+		/// <summary>
+		/// <para> Type of future returned by AddTaskToQueue&lt;true&gt;. This is an EmuThreads::TaskFuture rather than a std::future, so that the result's shared state lives in the task's own allocation. </para>
+		/// <para> It provides the same get, wait, wait_for, wait_until, share and valid members as std::future, but code naming std::future as the result type must use this alias instead. </para>
+		/// </summary>
+		using future_type = EmuThreads::TaskFuture<func_return_type>;
 
-		struct task_or_packaged_task_type
+	private:
+		/// <summary>
+		/// <para> Base of all queued tasks, which are stored by pointer as they are passed between queues. </para>
+		/// <para> `consume` either executes (if its bool argument is true) or abandons the task, and releases the task in either case. </para>
+		/// </summary>
+		struct task_node
 		{
-		public:
-			using func_variant_type = std::variant<Func_, packaged_func_type>;
+			using consume_func = void(*)(task_node*, bool);
 
-			task_or_packaged_task_type() = delete;
-			task_or_packaged_task_type(const task_or_packaged_task_type&) = delete;
-			task_or_packaged_task_type& operator=(const task_or_packaged_task_type&) = delete;
-			task_or_packaged_task_type& operator=(task_or_packaged_task_type&&) = delete;
+			explicit constexpr task_node(consume_func consume_) noexcept :
+				consume(consume_)
+			{
+			}
+
+			const consume_func consume;
+		};
 
-			task_or_packaged_task_type(task_or_packaged_task_type&& to_move_) noexcept :
-				is_packaged(to_move_.is_packaged),
-				func(std::move(to_move_.func))
+		struct plain_task_node : public task_node
+		{
+			template<class...FuncConstructionArgs_>
+			explicit plain_task_node(FuncConstructionArgs_&&...func_construction_args_) :
+				task_node(&_consume),
+				func(std::forward<FuncConstructionArgs_>(func_construction_args_)...)
 			{
 			}
 
-			template<EmuConcepts::UnqualifiedMatch<Func_> TaskFunc_>
-			constexpr task_or_packaged_task_type(TaskFunc_&& task_func_) noexcept(std::is_nothrow_constructible_v<func_variant_type, TaskFunc_>) :
-				is_packaged(false),
-				func(std::forward<TaskFunc_>(task_func_))
+			static inline void _consume(task_node* p_task_, bool execute_)
 			{
+				std::unique_ptr<plain_task_node> owned_task_(static_cast<plain_task_node*>(p_task_));
+				if (execute_)
+				{
+					owned_task_->func();
+				}
 			}
 
-			template<EmuConcepts::UnqualifiedMatch<packaged_func_type> PackagedTaskFunc_>
-			constexpr task_or_packaged_task_type(PackagedTaskFunc_&& packaged_task_func_) noexcept(std::is_nothrow_constructible_v<func_variant_type, PackagedTaskFunc_>) :
-				is_packaged(true),
-				func(std::forward<PackagedTaskFunc_>(packaged_task_func_))
+			func_type func;
+		};
+
+		/// <summary>
+		/// <para> Task whose result is provided to a future via a shared state embedded in the task itself, so no separate allocation is made for the result. </para>
+		/// <para> The function is destroyed as soon as it is consumed, while the rest of the task lives until the future also releases it. </para>
+		/// </summary>
+		struct future_task_node : public task_node, public EmuThreads::TaskSharedState<func_return_type>
+		{
+			using state_type = EmuThreads::TaskSharedState<func_return_type>;
+
+			template<class...FuncConstructionArgs_>
+			explicit future_task_node(FuncConstructionArgs_&&...func_construction_args_) :
+				task_node(&_consume),
+				state_type(&_on_final_release),
+				func(std::in_place, std::forward<FuncConstructionArgs_>(func_construction_args_)...)
 			{
 			}
 
-			inline void operator()()
+			static inline void _consume(task_node* p_task_, bool execute_)
 			{
-				if (is_packaged)
+				future_task_node* p_future_task_ = static_cast<future_task_node*>(p_task_);
+				if (execute_)
 				{
-					std::get<packaged_func_type>(func)();
+					try
+					{
+						if constexpr (std::is_void_v<func_return_type>)
+						{
+							(*(p_future_task_->func))();
+							p_future_task_->SetValue();
+						}
+						else
+						{
+							p_future_task_->SetValue((*(p_future_task_->func))());
+						}
+					}
+					catch (...)
+					{
+						p_future_task_->SetException(std::current_exception());
+					}
 				}
 				else
 				{
-					std::get<func_type>(func)();
+					p_future_task_->SetException(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
 				}
+				p_future_task_->func.reset();
+				p_future_task_->ReleaseReference();
+			}
+
+			static inline void _on_final_release(state_type* p_state_) noexcept
+			{
+				delete static_cast<future_task_node*>(p_state_);
 			}
 
-		private:
-			const bool is_packaged;
-			func_variant_type func;
+			std::optional<func_type> func;
 		};
 
 		template<class CountType_>
@@ -98,6 +169,29 @@ namespace EmuThreads
 			count_type& count_ref;
 		};
 
+		using task_pointer = task_node*;
+
+		/// <summary> Data owned by a single Worker Thread. Aligned so that separate Worker Threads do not share cache lines. </summary>
+		struct alignas(64) worker_data
+		{
+			worker_data() :
+				deque(),
+				num_tasks_being_added(0)
+			{
+			}
+
+			EmuThreads::WorkStealingDeque<task_pointer> deque;
+			std::atomic<std::size_t> num_tasks_being_added;
+		};
+
+		/// <summary> Identifies which pool, if any, the current thread is a Worker Thread of, alongside its state for choosing steal victims. </summary>
+		struct this_thread_info
+		{
+			const BasicThreadPool<Func_>* p_pool;
+			std::size_t worker_index;
+			std::uint32_t steal_rng_state;
+		};
+
 		friend struct thread_loop;
 		struct thread_loop
 		{
@@ -107,28 +201,38 @@ namespace EmuThreads
 			thread_loop& operator=(thread_loop&&) = delete;
 
 
-			constexpr thread_loop(BasicThreadPool<Func_>& parent_pool_) noexcept :
-				parent_pool(parent_pool_)
+			constexpr thread_loop(BasicThreadPool<Func_>& parent_pool_, const std::size_t worker_index_) noexcept :
+				parent_pool(parent_pool_),
+				worker_index(worker_index_)
 			{
 			}
 			constexpr thread_loop(thread_loop&& to_move_) noexcept :
-				parent_pool(to_move_.parent_pool)
+				parent_pool(to_move_.parent_pool),
+				worker_index(to_move_.worker_index)
 			{
 			}
 
 			inline void operator()() const
 			{
+				_this_thread.p_pool = &parent_pool;
+				_this_thread.worker_index = worker_index;
+				std::size_t num_failed_attempts_ = 0;
 				while (!parent_pool._threads_closing)
 				{
-					// Either execute a task or yield
-					if (!parent_pool._execute_task())
+					// Either execute a task or idle according to the pool's policy
+					if (parent_pool._execute_task())
 					{
-						std::this_thread::yield();
+						num_failed_attempts_ = 0;
+					}
+					else
+					{
+						parent_pool._idle(num_failed_attempts_);
 					}
 				}
 			}
 
 			BasicThreadPool<Func_>& parent_pool;
+			const std::size_t worker_index;
 		};
 
 	public:
@@ -149,6 +253,12 @@ namespace EmuThreads
 		/// </summary>
 		static constexpr bool destructing_thread_may_contribute_to_tasks = true;
 
+		/// <summary>
+		/// <para> The maximum number of additional tasks that a Worker Thread will move from the injection queue into its own deque whenever it takes from the injection queue. </para>
+		/// <para> A Worker Thread never claims more than its fair share of the injection queue (i.e. the queue's size divided by the number of Worker Threads). </para>
+		/// </summary>
+		static constexpr std::size_t max_injection_batch_size = 32;
+
 		BasicThreadPool(const BasicThreadPool<Func_>&) = delete;
 		BasicThreadPool<Func_>& operator=(const BasicThreadPool<Func_>&) = delete;
 
@@ -166,7 +276,7 @@ namespace EmuThreads
 		/// </summary>
 		/// <param name="to_move_">Thread Pool to move.</param>
 		explicit BasicThreadPool(BasicThreadPool<Func_>&& to_move_) noexcept :
-			BasicThreadPool(to_move_.num_worker_threads)
+			BasicThreadPool(to_move_.num_worker_threads, to_move_.idle_policy)
 		{
 			_move_pool(std::move(to_move_));
 		}
@@ -175,14 +285,21 @@ namespace EmuThreads
 		/// <para> Initialises a Thread Pool with the specified number of Worker Threads. </para>
 		/// </summary>
 		/// <param name="num_worker_threads_">Number of Worker Threads for this Thread Pool to use. Clamped to a minimum of `min_num_worker_threads`.</param>
-		explicit BasicThreadPool(const std::size_t num_worker_threads_) :
+		/// <param name="idle_policy_">Policy describing how Worker Threads behave while unable to acquire a task. By default, they briefly spin and yield before parking.</param>
+		explicit BasicThreadPool(const std::size_t num_worker_threads_, const EmuThreads::ThreadPoolIdlePolicy& idle_policy_ = EmuThreads::ThreadPoolIdlePolicy()) :
 			num_worker_threads(num_worker_threads_ <= min_num_worker_threads ? min_num_worker_threads : num_worker_threads_),
-			_mutex_for_task_queue(),
-			_task_queue(),
+			idle_policy(idle_policy_),
+			_threads_closing(false),
 			_accepting_tasks(true),
-			_tasks_currently_being_added(0),
 			_num_merges_in_progress(0),
-			_threads_closing(false)
+			_tasks_currently_being_added(0),
+			_injection_queue_size(0),
+			_num_parked_workers(0),
+			_wake_signal(0),
+			_injection_queue(),
+			_mutex_for_injection_queue(),
+			_worker_data(),
+			_worker_threads()
 		{
 			_launch_threads();
 		}
@@ -193,6 +310,9 @@ namespace EmuThreads
 			{
 				Close<must_finish_tasks_on_destruction, destructing_thread_may_contribute_to_tasks>();
 			}
+
+			// Tasks abandoned by a non-finishing Close are never executed, but must still be released
+			_drain_queued_tasks([](task_pointer task_) { task_->consume(task_, false); });
 		}
 
 		/// <summary>
@@ -231,34 +351,26 @@ namespace EmuThreads
 		template<bool MustFinishTasks_ = must_finish_tasks_on_destruction, bool ThisThreadMayContribute_ = destructing_thread_may_contribute_to_tasks>
 		inline void Close()
 		{
-			// False warnings - MSVC doesn't properly tell that control is correctly handled for locks between functions here
-			EMU_CORE_MSVC_PUSH_WARNING_STACK;
-			EMU_CORE_MSVC_DISABLE_WARNING(26115);
 			if constexpr (MustFinishTasks_)
 			{
-				// Use personal task_queue_lock to check if the queue is populated
-				// --- This is to allow this thread to lock if needed
 				_accepting_tasks = false;
-				std::unique_lock<std::mutex> task_queue_lock(_mutex_for_task_queue);
-				while (_has_potential_tasks_for_calling_thread<false>())
+				while (_has_potential_tasks_for_calling_thread())
 				{
 					if constexpr (ThisThreadMayContribute_)
 					{
-						// Contribute a task
-						// --- We're dedicating this thread to helping with closing the pool, so no yields are performed
-						// --- lock is released in the middle of _execute_task
-						_execute_task(task_queue_lock);
+						// Contribute a task, only yielding if all remaining tasks are momentarily in the hands of other threads
+						if (!_execute_task())
+						{
+							std::this_thread::yield();
+						}
 					}
 					else
 					{
-						task_queue_lock.unlock();
 						std::this_thread::yield();
 					}
-					task_queue_lock.lock();
 				}
 			}
 			_close_threads();
-			EMU_CORE_MSVC_POP_WARNING_STACK;
 		}
 
 		/// <summary>
@@ -267,19 +379,15 @@ namespace EmuThreads
 		/// </summary>
 		inline void UseThisThreadForCurrentQueue()
 		{
-			// False warnings - MSVC doesn't properly tell that control is correctly handled for locks between functions here
-			EMU_CORE_MSVC_PUSH_WARNING_STACK;
-			EMU_CORE_MSVC_DISABLE_WARNING(26115);
-			std::unique_lock<std::mutex> task_queue_lock(_mutex_for_task_queue);
-			while (_has_potential_tasks_for_calling_thread<false>())
+			while (_has_potential_tasks_for_calling_thread())
 			{
 				// Contribute a task
-				// --- We're dedicating this thread to helping with the current queue, so no yields are performed
-				// --- lock is released in the middle of _execute_task
-				_execute_task(task_queue_lock);
-				task_queue_lock.lock();
+				// --- We're dedicating this thread to helping with the current queue, so we only yield if nothing could be acquired
+				if (!_execute_task())
+				{
+					std::this_thread::yield();
+				}
 			}
-			EMU_CORE_MSVC_POP_WARNING_STACK;
 		}
 
 		/// <summary>
@@ -288,7 +396,7 @@ namespace EmuThreads
 		/// <para> Alternatively, this function will return once the calling thread has contributed a number of tasks equal to MaxTasks_. </para>
 		/// <para> If MaxTasks_ is 0, this function will return immediately and the calling thread will not contribute. </para>
 		/// </summary>
-		/// <returns>Number of tasks that the calling thread attempted to execute. This will be in the inclusive range of 0:MaxTasks_.</returns>
+		/// <returns>Number of tasks that the calling thread executed. This will be in the inclusive range of 0:MaxTasks_.</returns>
 		template<std::size_t MaxTasks_>
 		inline std::size_t UseThisThreadForCurrentQueue()
 		{
@@ -297,26 +405,25 @@ namespace EmuThreads
 				return 0;
 			}
 
-			// False warnings - MSVC doesn't properly tell that control is correctly handled for locks between functions here
-			EMU_CORE_MSVC_PUSH_WARNING_STACK;
-			EMU_CORE_MSVC_DISABLE_WARNING(26115);
 			std::size_t num_tasks_contributed = 0;
-			std::unique_lock<std::mutex> task_queue_lock(_mutex_for_task_queue);
-			while (_has_potential_tasks_for_calling_thread<false>())
+			while (_has_potential_tasks_for_calling_thread())
 			{
 				// Contribute a task
-				// --- We're dedicating this thread to helping with the current queue, so no yields are performed
-				// --- lock is released in the middle of _execute_task
-				_execute_task(task_queue_lock);
-				++num_tasks_contributed;
-				if (num_tasks_contributed == MaxTasks_)
+				// --- We're dedicating this thread to helping with the current queue, so we only yield if nothing could be acquired
+				if (_execute_task())
 				{
-					return num_tasks_contributed;
+					++num_tasks_contributed;
+					if (num_tasks_contributed == MaxTasks_)
+					{
+						return num_tasks_contributed;
+					}
+				}
+				else
+				{
+					std::this_thread::yield();
 				}
-				task_queue_lock.lock();
 			}
 			return num_tasks_contributed;
-			EMU_CORE_MSVC_POP_WARNING_STACK;
 		}
 
 		/// <summary>
@@ -330,31 +437,29 @@ namespace EmuThreads
 		template<EmuConcepts::InvocableWithReturn<bool> EarlyBreakTest_>
 		inline bool UseThisThreadForCurrentQueue(EarlyBreakTest_ early_break_test_)
 		{
-			// False warnings - MSVC doesn't properly tell that control is correctly handled for locks between functions here
-			EMU_CORE_MSVC_PUSH_WARNING_STACK;
-			EMU_CORE_MSVC_DISABLE_WARNING(26115);
-			std::unique_lock<std::mutex> task_queue_lock(_mutex_for_task_queue);
-			while (_has_potential_tasks_for_calling_thread<false>())
+			while (_has_potential_tasks_for_calling_thread())
 			{
 				// Contribute a task
-				// --- We're dedicating this thread to helping with the current queue, so no yields are performed
-				// --- lock is released in the middle of _execute_task
-				_execute_task(task_queue_lock);
+				// --- We're dedicating this thread to helping with the current queue, so we only yield if nothing could be acquired
+				if (!_execute_task())
+				{
+					std::this_thread::yield();
+				}
+
 				if (early_break_test_())
 				{
 					return true;
 				}
-				task_queue_lock.lock();
 			}
 			return false;
-			EMU_CORE_MSVC_POP_WARNING_STACK;
 		}
 
 		/// <summary>
 		/// <para> Adds a Task to this Thread Pool's Task Queue. </para>
 		/// <para> If this thread Pool is not accepting tasks or is closing its threads, this will immediately execute the task without queuing. </para>
+		/// <para> If called by one of this Thread Pool's Worker Threads, the task is pushed to that Worker Thread's own deque; otherwise it is pushed to the shared injection queue. </para>
 		/// <para>
-		///		If ReturnFuture_ is true: this will return a future to the return value of the task being queued. 
+		///		If ReturnFuture_ is true: this will return a future_type (an EmuThreads::TaskFuture, not a std::future) to the return value of the task being queued, or to any exception that it throws.
 		///		This queuing method is guaranteed to be the most expensive of the two options.
 		/// </para>
 		///	<para> 
@@ -371,70 +476,68 @@ namespace EmuThreads
 		template<bool ReturnFuture_, class...FuncConstructionArgs_>
 		requires(std::is_constructible_v<Func_, FuncConstructionArgs_...>)
 		inline auto AddTaskToQueue(FuncConstructionArgs_&&...func_construction_args_)
-			-> typename std::conditional<ReturnFuture_, std::future<func_return_type>, void>::type
+			-> typename std::conditional<ReturnFuture_, future_type, void>::type
 		{
-			auto tasks_being_added_count_guard = _make_count_guard(_tasks_currently_being_added);
-			auto task = func_type(std::forward<FuncConstructionArgs_>(func_construction_args_)...);
-			if (_accepting_tasks && !_threads_closing)
+			// Workers track their own additions so that adding from within tasks doesn't contend on a shared counter
+			worker_data* p_worker_ = _this_thread_worker_data();
+			auto tasks_being_added_count_guard = _make_count_guard(p_worker_ != nullptr ? p_worker_->num_tasks_being_added : _tasks_currently_being_added);
+			const bool can_queue_ = _accepting_tasks && !_threads_closing;
+			if constexpr (ReturnFuture_)
 			{
-				if constexpr (ReturnFuture_)
+				future_task_node* p_task_ = new future_task_node(std::forward<FuncConstructionArgs_>(func_construction_args_)...);
+				future_type future = future_type(p_task_);
+				if (can_queue_)
 				{
-					auto task_packaged = packaged_func_type(std::move(task));
-					std::future<func_return_type> future = task_packaged.get_future();
-
-					std::lock_guard<std::mutex> task_queue_lock(_mutex_for_task_queue);
-					_task_queue.emplace_back(std::move(task_packaged));
-					return future;
+					_push_task(p_worker_, p_task_);
 				}
 				else
 				{
-					std::lock_guard<std::mutex> task_queue_lock(_mutex_for_task_queue);
-					_task_queue.emplace_back(std::move(task));
+					// Can't execute in pool so execute now instead of abandoning, which immediately fulfils the future
+					p_task_->consume(p_task_, true);
 				}
+				return future;
 			}
 			else
 			{
-				// Can't execute in pool so execute now instead of abandoning
-				if constexpr (ReturnFuture_)
+				if (can_queue_)
 				{
-					// Returns a future, so make a fake promise which we immediately fulfil
-					auto fake_promise = std::promise<func_return_type>();
-					if constexpr (std::is_void_v<func_return_type>)
-					{
-						task();
-						fake_promise.set_value();
-					}
-					else
-					{
-						fake_promise.set_value(task());
-					}
-					return fake_promise.get_future();
+					_push_task(p_worker_, new plain_task_node(std::forward<FuncConstructionArgs_>(func_construction_args_)...));
 				}
 				else
 				{
+					// Can't execute in pool so execute now instead of abandoning
+					auto task = func_type(std::forward<FuncConstructionArgs_>(func_construction_args_)...);
 					task();
 				}
 			}
 		}
 
 		/// <summary>
-		/// <para> Returns the number of tasks currently waiting to be allocated to a Worker Thread in this Thread Pool's Task Queue. </para>
+		/// <para> Returns the number of tasks currently waiting to be executed in this Thread Pool's injection queue and Worker Thread deques. </para>
 		/// <para> This does not account for tasks currently being executed. </para>
-		/// <para> If Lock_ is true, this will lock the Task Queue before determining the count. By default, Lock_ is true. </para>
+		/// <para> If Lock_ is true, this will lock the injection queue before determining its count. By default, Lock_ is true. </para>
+		/// <para> Worker Thread deques are never locked, so their contribution to the count is an estimate if any Worker Threads are active. </para>
 		/// </summary>
-		/// <returns>Number of tasks currently waiting to be allocated to a Worker Thread in this Thread Pool's Task Queue.</returns>
+		/// <returns>Number of tasks currently waiting to be executed in this Thread Pool's injection queue and Worker Thread deques.</returns>
 		template<bool Lock_ = true>
 		[[nodiscard]] inline std::size_t GetNumTasksInQueue() const noexcept(!Lock_)
 		{
+			std::size_t num_tasks_ = 0;
 			if constexpr (Lock_)
 			{
-				std::lock_guard<std::mutex> task_queue_lock(_mutex_for_task_queue);
-				return _task_queue.size();
+				std::lock_guard<std::mutex> injection_queue_lock(_mutex_for_injection_queue);
+				num_tasks_ = _injection_queue.size();
 			}
 			else
 			{
-				return _task_queue.size();
+				num_tasks_ = _injection_queue_size;
+			}
+
+			for (const auto& p_worker_ : _worker_data)
+			{
+				num_tasks_ += p_worker_->deque.SizeApprox();
 			}
+			return num_tasks_;
 		}
 
 		/// <summary>
@@ -456,7 +559,12 @@ namespace EmuThreads
 		/// <returns>Number of tasks currently in the process of being added to this Thread Pool's Task Queue.</returns>
 		[[nodiscard]] inline std::size_t GetNumTasksCurrentlyBeingAdded() const noexcept
 		{
-			return _tasks_currently_being_added;
+			std::size_t num_tasks_ = _tasks_currently_being_added;
+			for (const auto& p_worker_ : _worker_data)
+			{
+				num_tasks_ += p_worker_->num_tasks_being_added;
+			}
+			return num_tasks_;
 		}
 
 		/// <summary>
@@ -466,7 +574,7 @@ namespace EmuThreads
 		/// <returns>True if any tasks are currently being added to this Thread Pool's Task Queue; otherwise false.</returns>
 		[[nodiscard]] inline bool CurrentlyAddingTasksToQueue() const noexcept
 		{
-			return _tasks_currently_being_added > 0;
+			return GetNumTasksCurrentlyBeingAdded() > 0;
 		}
 
 		/// <summary>
@@ -495,6 +603,11 @@ namespace EmuThreads
 		/// </summary>
 		const std::size_t num_worker_threads;
 
+		/// <summary>
+		/// <para> The policy describing how this Thread Pool's Worker Threads behave while they are unable to acquire a task. </para>
+		/// </summary>
+		const EmuThreads::ThreadPoolIdlePolicy idle_policy;
+
 	private:
 		template<class T_>
 		requires(!std::is_const_v<T_>)
@@ -503,86 +616,269 @@ namespace EmuThreads
 			return count_guard<T_>(count_ref_);
 		}
 
-		template<bool Lock_>
-		[[nodiscard]] inline bool _has_potential_tasks_for_calling_thread()
+		[[nodiscard]] inline bool _has_potential_tasks_for_calling_thread() const
 		{
-			return HasAnyTasksInQueue<Lock_>() || CurrentlyAddingTasksToQueue() || CurrentlyMerging();
+			// Order matters: a task whose addition completes is visible in a queue before it stops counting as being added,
+			// and a worker only shrinks the injection queue's published size once claimed tasks are in its deque
+			if (_tasks_currently_being_added > 0 || _injection_queue_size > 0)
+			{
+				return true;
+			}
+
+			for (const auto& p_worker_ : _worker_data)
+			{
+				if (p_worker_->num_tasks_being_added > 0 || !p_worker_->deque.IsEmpty())
+				{
+					return true;
+				}
+			}
+			return CurrentlyMerging();
 		}
 
-		inline void _move_pool(BasicThreadPool<Func_>&& to_move_) noexcept
+		[[nodiscard]] inline bool _has_queued_tasks() const noexcept
 		{
-			constexpr bool finish_tasks_before_moving = false;
-			constexpr bool help_with_tasks_if_finishing_before_moving = true;
+			if (_injection_queue_size > 0)
+			{
+				return true;
+			}
 
-			// Close the moved pool's threads before moving on (we don't want any dangling references)
-			to_move_.Close<finish_tasks_before_moving, help_with_tasks_if_finishing_before_moving>();
+			for (const auto& p_worker_ : _worker_data)
+			{
+				if (!p_worker_->deque.IsEmpty())
+				{
+					return true;
+				}
+			}
+			return false;
+		}
 
-			// Transfer moved pool's remaining queue data to the end of this queue
-			// --- Lock both queues to ensure nothing new is added before merge is finished
-			std::lock_guard<std::mutex> moved_task_queue_lock(to_move_._mutex_for_task_queue);
-			if (to_move_._task_queue.size() > 0)
+		/// <summary> Performs a Worker Thread's idle behaviour after its latest failure to acquire a task, as described by this pool's idle_policy. </summary>
+		/// <param name="num_failed_attempts_">Number of consecutive failed attempts, which is incremented or reset by this call.</param>
+		inline void _idle(std::size_t& num_failed_attempts_)
+		{
+			if (num_failed_attempts_ < idle_policy.num_spins)
+			{
+				++num_failed_attempts_;
+			}
+			else if ((num_failed_attempts_ - idle_policy.num_spins) < idle_policy.num_yields || !idle_policy.may_park)
 			{
-				std::lock_guard<std::mutex> own_task_queue_lock(_mutex_for_task_queue);
-				std::move(to_move_._task_queue.begin(), to_move_._task_queue.end(), std::back_inserter(_task_queue));
-				to_move_._task_queue.clear();
+				++num_failed_attempts_;
+				std::this_thread::yield();
+			}
+			else
+			{
+				_park_worker();
+				num_failed_attempts_ = 0;
 			}
 		}
 
-		inline void _launch_threads()
+		/// <summary> Blocks the calling Worker Thread until a task may be available or this pool is closing. </summary>
+		inline void _park_worker()
 		{
-			_worker_threads.reserve(num_worker_threads);
-			for (std::size_t i = 0; i < num_worker_threads; ++i)
+			// The signal is read before registering as parked, so any wake issued after registering causes the wait to return immediately
+			const std::uint32_t wake_signal_ = _wake_signal.load();
+			++_num_parked_workers;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (!_threads_closing && !_has_queued_tasks())
 			{
-				_worker_threads.emplace_back(thread_loop(*this));
+				_wake_signal.wait(wake_signal_);
 			}
+			--_num_parked_workers;
 		}
 
-		inline bool _execute_task()
+		/// <summary> Wakes one parked Worker Thread, if there are any. Must be called after making a task visible in any queue. </summary>
+		inline void _wake_parked_worker() noexcept
 		{
-			// False warnings - MSVC doesn't properly tell that control is correctly handled for locks between functions here
-			EMU_CORE_MSVC_PUSH_WARNING_STACK;
-			EMU_CORE_MSVC_DISABLE_WARNING(26115);
-			if (!_threads_closing)
+			// Pairs with registration in _park_worker: either the parker sees the new task, or we see the parker
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (_num_parked_workers.load(std::memory_order_relaxed) > 0)
+			{
+				++_wake_signal;
+				_wake_signal.notify_one();
+			}
+		}
+
+		inline void _wake_all_parked_workers() noexcept
+		{
+			++_wake_signal;
+			_wake_signal.notify_all();
+		}
+
+		[[nodiscard]] inline worker_data* _this_thread_worker_data() const noexcept
+		{
+			return _this_thread.p_pool == this ? _worker_data[_this_thread.worker_index].get() : nullptr;
+		}
+
+		inline void _push_task(worker_data* p_worker_, task_pointer task_)
+		{
+			try
 			{
-				std::unique_lock<std::mutex> task_queue_lock(_mutex_for_task_queue);
-				if (_task_queue.size() > 0)
+				if (p_worker_ != nullptr)
+				{
+					p_worker_->deque.Push(task_);
+				}
+				else
+				{
+					std::lock_guard<std::mutex> injection_queue_lock(_mutex_for_injection_queue);
+					_injection_queue.push_back(task_);
+					_injection_queue_size = _injection_queue.size();
+				}
+			}
+			catch (...)
+			{
+				task_->consume(task_, false);
+				throw;
+			}
+			_wake_parked_worker();
+		}
+
+		/// <summary>
+		/// <para> Takes the oldest task from the injection queue. </para>
+		/// <para> If the calling thread is a Worker Thread, it additionally moves up to its share of the remaining injection queue into its own deque. </para>
+		/// </summary>
+		inline bool _take_from_injection_queue(worker_data* p_worker_, task_pointer& out_task_)
+		{
+			if (_injection_queue_size == 0)
+			{
+				return false;
+			}
+
+			std::lock_guard<std::mutex> injection_queue_lock(_mutex_for_injection_queue);
+			if (_injection_queue.empty())
+			{
+				return false;
+			}
+
+			out_task_ = _injection_queue.front();
+			_injection_queue.pop_front();
+			if (p_worker_ != nullptr)
+			{
+				const std::size_t batch_size_ = std::min(_injection_queue.size() / num_worker_threads, max_injection_batch_size);
+				for (std::size_t i = 0; i < batch_size_; ++i)
+				{
+					p_worker_->deque.Push(_injection_queue.front());
+					_injection_queue.pop_front();
+				}
+			}
+			_injection_queue_size = _injection_queue.size();
+			return true;
+		}
+
+		/// <summary> Attempts to steal from each Worker Thread other than the calling thread once, starting from a random victim. </summary>
+		inline bool _steal_task(const worker_data* p_thief_, task_pointer& out_task_)
+		{
+			const std::size_t num_workers_ = _worker_data.size();
+			std::size_t victim_index_ = _next_steal_random() % num_workers_;
+			for (std::size_t attempt_ = 0; attempt_ < num_workers_; ++attempt_)
+			{
+				worker_data* p_victim_ = _worker_data[victim_index_].get();
+				if (p_victim_ != p_thief_ && p_victim_->deque.Steal(out_task_))
 				{
-					auto task = std::move(_task_queue.front());
-					_task_queue.pop_front();
-					task_queue_lock.unlock(); // Finished with queue; unlock so task doesn't consume bandwidth
-					task();
 					return true;
 				}
+				victim_index_ = (victim_index_ + 1 == num_workers_) ? 0 : victim_index_ + 1;
 			}
 			return false;
-			EMU_CORE_MSVC_POP_WARNING_STACK;
 		}
 
-		inline bool _execute_task(std::unique_lock<std::mutex>& prepared_task_queue_lock_)
+		[[nodiscard]] static inline std::uint32_t _next_steal_random() noexcept
 		{
-			// False warnings - MSVC doesn't properly tell that control is correctly handled for locks between functions here
-			EMU_CORE_MSVC_PUSH_WARNING_STACK;
-			EMU_CORE_MSVC_DISABLE_WARNING(26115);
-			if (!_threads_closing)
+			std::uint32_t state_ = _this_thread.steal_rng_state;
+			if (state_ == 0)
 			{
-				if (_task_queue.size() > 0)
+				state_ = static_cast<std::uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1;
+			}
+
+			// xorshift32; quality is irrelevant beyond spreading thieves across victims
+			state_ ^= state_ << 13;
+			state_ ^= state_ >> 17;
+			state_ ^= state_ << 5;
+			_this_thread.steal_rng_state = state_;
+			return state_;
+		}
+
+		inline bool _acquire_task(task_pointer& out_task_)
+		{
+			worker_data* p_worker_ = _this_thread_worker_data();
+			if (p_worker_ != nullptr && p_worker_->deque.Take(out_task_))
+			{
+				return true;
+			}
+			return _take_from_injection_queue(p_worker_, out_task_) || _steal_task(p_worker_, out_task_);
+		}
+
+		/// <summary> Invokes the passed function with every queued task, removing them from all queues. Only valid once all Worker Threads have been closed. </summary>
+		template<class OnTask_>
+		inline void _drain_queued_tasks(OnTask_&& on_task_)
+		{
+			{
+				std::lock_guard<std::mutex> injection_queue_lock(_mutex_for_injection_queue);
+				for (task_pointer task_ : _injection_queue)
 				{
-					auto task = std::move(_task_queue.front());
-					_task_queue.pop_front();
-					prepared_task_queue_lock_.unlock(); // Finished with queue; unlock so task doesn't consume bandwidth
-					task();
-					return true;
+					on_task_(task_);
+				}
+				_injection_queue.clear();
+				_injection_queue_size = 0;
+			}
+
+			// Owners are closed, so stealing drains each deque in the order that its tasks were pushed
+			task_pointer task_ = nullptr;
+			for (auto& p_worker_ : _worker_data)
+			{
+				while (p_worker_->deque.Steal(task_))
+				{
+					on_task_(task_);
 				}
 			}
-			prepared_task_queue_lock_.unlock(); // Only reach this point if not already unlocked by task execution
+		}
+
+		inline void _move_pool(BasicThreadPool<Func_>&& to_move_) noexcept
+		{
+			constexpr bool finish_tasks_before_moving = false;
+			constexpr bool help_with_tasks_if_finishing_before_moving = true;
+
+			// Close the moved pool's threads before moving on (we don't want any dangling references)
+			to_move_.Close<finish_tasks_before_moving, help_with_tasks_if_finishing_before_moving>();
+
+			// Transfer moved pool's remaining tasks to the end of this pool's injection queue
+			// --- Lock our queue to ensure nothing new is added before merge is finished
+			std::lock_guard<std::mutex> own_injection_queue_lock(_mutex_for_injection_queue);
+			to_move_._drain_queued_tasks([this](task_pointer task_) { _injection_queue.push_back(task_); });
+			_injection_queue_size = _injection_queue.size();
+			_wake_all_parked_workers();
+		}
+
+		inline void _launch_threads()
+		{
+			_worker_data.reserve(num_worker_threads);
+			for (std::size_t i = 0; i < num_worker_threads; ++i)
+			{
+				_worker_data.emplace_back(std::make_unique<worker_data>());
+			}
+
+			_worker_threads.reserve(num_worker_threads);
+			for (std::size_t i = 0; i < num_worker_threads; ++i)
+			{
+				_worker_threads.emplace_back(thread_loop(*this, i));
+			}
+		}
+
+		inline bool _execute_task()
+		{
+			task_pointer task_ = nullptr;
+			if (!_threads_closing && _acquire_task(task_))
+			{
+				task_->consume(task_, true);
+				return true;
+			}
 			return false;
-			EMU_CORE_MSVC_POP_WARNING_STACK;
 		}
 
 		inline void _close_threads()
 		{
 			_accepting_tasks = false;
 			_threads_closing = true;
+			_wake_all_parked_workers();
 
 			if (_worker_threads.size() > 0)
 			{
@@ -597,12 +893,18 @@ namespace EmuThreads
 			}
 		}
 
-		bool _threads_closing;
-		bool _accepting_tasks;
+		static inline thread_local this_thread_info _this_thread = { nullptr, 0, 0 };
+
+		std::atomic<bool> _threads_closing;
+		std::atomic<bool> _accepting_tasks;
 		std::atomic<std::size_t> _num_merges_in_progress;
 		std::atomic<std::size_t> _tasks_currently_being_added;
-		std::deque<task_or_packaged_task_type> _task_queue;
-		std::mutex _mutex_for_task_queue;
+		std::atomic<std::size_t> _injection_queue_size;
+		std::atomic<std::size_t> _num_parked_workers;
+		std::atomic<std::uint32_t> _wake_signal;
+		std::deque<task_pointer> _injection_queue;
+		mutable std::mutex _mutex_for_injection_queue;
+		std::vector<std::unique_ptr<worker_data>> _worker_data;
 		std::vector<std::thread> _worker_threads;
 	};
 }
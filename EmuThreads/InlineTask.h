@@ -0,0 +1,203 @@
+#ifndef EMU_THREADS_INLINE_TASK_H_INC_
+#define EMU_THREADS_INLINE_TASK_H_INC_ 1
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace EmuThreads
+{
+	template<class Signature_, std::size_t InlineSize_ = 64>
+	class InlineTask;
+
+	/// <summary>
+	/// <para> Move-only, type-erased callable with the provided signature, storing callables of up to InlineSize_ bytes in an inline buffer instead of on the heap. </para>
+	/// <para> Callables which are too large, over-aligned, or not nothrow-move-constructible are instead stored on the heap, as with std::function. </para>
+	/// <para> Unlike std::function, move-only callables (such as lambdas capturing a std::unique_ptr) may be stored. </para>
+	/// <para> Intended as the Func_ argument of an EmuThreads::BasicThreadPool, so that submitting small tasks does not allocate for the callable. </para>
+	/// </summary>
+	template<class Out_, class...Args_, std::size_t InlineSize_>
+	class InlineTask<Out_(Args_...), InlineSize_>
+	{
+	public:
+		using result_type = Out_;
+
+		/// <summary> Number of bytes available for storing callables inline. </summary>
+		static constexpr std::size_t inline_size = InlineSize_ < sizeof(void*) ? sizeof(void*) : InlineSize_;
+
+		/// <summary> Maximum alignment of callables that may be stored inline. </summary>
+		static constexpr std::size_t inline_alignment = alignof(std::max_align_t);
+
+		/// <summary> True if a callable of type Callable_ will be stored in this task's inline buffer; otherwise false, in which case it is stored on the heap. </summary>
+		template<class Callable_>
+		static constexpr bool is_stored_inline =
+		(
+			sizeof(Callable_) <= inline_size &&
+			alignof(Callable_) <= inline_alignment &&
+			std::is_nothrow_move_constructible_v<Callable_>
+		);
+
+	private:
+		struct callable_operations
+		{
+			Out_(*invoke)(void*, Args_&&...);
+			void(*move_and_destroy_source)(void*, void*) noexcept;
+			void(*destroy)(void*) noexcept;
+		};
+
+		template<class Callable_, bool Inline_ = is_stored_inline<Callable_>>
+		struct operations_for
+		{
+			[[nodiscard]] static inline Callable_& get(void* p_storage_) noexcept
+			{
+				if constexpr (Inline_)
+				{
+					return *std::launder(reinterpret_cast<Callable_*>(p_storage_));
+				}
+				else
+				{
+					return **reinterpret_cast<Callable_**>(p_storage_);
+				}
+			}
+
+			static inline Out_ invoke(void* p_storage_, Args_&&...args_)
+			{
+				return static_cast<Out_>(std::invoke(get(p_storage_), std::forward<Args_>(args_)...));
+			}
+
+			static inline void move_and_destroy_source(void* p_to_storage_, void* p_from_storage_) noexcept
+			{
+				if constexpr (Inline_)
+				{
+					Callable_& from_ = get(p_from_storage_);
+					::new(p_to_storage_) Callable_(std::move(from_));
+					from_.~Callable_();
+				}
+				else
+				{
+					// Heap-stored callables are moved by transferring ownership of the pointer
+					*reinterpret_cast<Callable_**>(p_to_storage_) = *reinterpret_cast<Callable_**>(p_from_storage_);
+				}
+			}
+
+			static inline void destroy(void* p_storage_) noexcept
+			{
+				if constexpr (Inline_)
+				{
+					get(p_storage_).~Callable_();
+				}
+				else
+				{
+					delete &get(p_storage_);
+				}
+			}
+
+			static constexpr callable_operations operations = { &invoke, &move_and_destroy_source, &destroy };
+		};
+
+	public:
+		InlineTask(const InlineTask&) = delete;
+		InlineTask& operator=(const InlineTask&) = delete;
+
+		/// <summary> Creates an empty task, which may not be invoked. </summary>
+		constexpr InlineTask() noexcept :
+			_p_operations(nullptr)
+		{
+		}
+
+		constexpr InlineTask(std::nullptr_t) noexcept :
+			InlineTask()
+		{
+		}
+
+		InlineTask(InlineTask&& to_move_) noexcept :
+			_p_operations(to_move_._p_operations)
+		{
+			if (_p_operations != nullptr)
+			{
+				_p_operations->move_and_destroy_source(_storage, to_move_._storage);
+				to_move_._p_operations = nullptr;
+			}
+		}
+
+		/// <summary>
+		/// <para> Creates a task storing a decayed copy of the passed callable, which will be moved into this task if it is an rvalue. </para>
+		/// </summary>
+		/// <param name="callable_">Callable to store. Must be invocable with this task's arguments, with a result convertible to this task's result_type.</param>
+		template<class Callable_>
+		requires
+		(
+			!std::is_same_v<std::decay_t<Callable_>, InlineTask> &&
+			std::is_move_constructible_v<std::decay_t<Callable_>> &&
+			std::is_invocable_r_v<Out_, std::decay_t<Callable_>&, Args_...>
+		)
+		InlineTask(Callable_&& callable_) :
+			_p_operations(&operations_for<std::decay_t<Callable_>>::operations)
+		{
+			using callable_type = std::decay_t<Callable_>;
+			if constexpr (is_stored_inline<callable_type>)
+			{
+				::new(static_cast<void*>(_storage)) callable_type(std::forward<Callable_>(callable_));
+			}
+			else
+			{
+				*reinterpret_cast<callable_type**>(_storage) = new callable_type(std::forward<Callable_>(callable_));
+			}
+		}
+
+		~InlineTask()
+		{
+			_reset();
+		}
+
+		InlineTask& operator=(InlineTask&& to_move_) noexcept
+		{
+			if (this != &to_move_)
+			{
+				_reset();
+				if (to_move_._p_operations != nullptr)
+				{
+					to_move_._p_operations->move_and_destroy_source(_storage, to_move_._storage);
+					_p_operations = to_move_._p_operations;
+					to_move_._p_operations = nullptr;
+				}
+			}
+			return *this;
+		}
+
+		InlineTask& operator=(std::nullptr_t) noexcept
+		{
+			_reset();
+			return *this;
+		}
+
+		/// <summary> Invokes the stored callable with the passed arguments. This task must not be empty. </summary>
+		inline Out_ operator()(Args_...args_)
+		{
+			return _p_operations->invoke(_storage, std::forward<Args_>(args_)...);
+		}
+
+		/// <summary> Returns true if this task stores a callable; otherwise false. </summary>
+		[[nodiscard]] explicit inline operator bool() const noexcept
+		{
+			return _p_operations != nullptr;
+		}
+
+	private:
+		inline void _reset() noexcept
+		{
+			if (_p_operations != nullptr)
+			{
+				_p_operations->destroy(_storage);
+				_p_operations = nullptr;
+			}
+		}
+
+		alignas(inline_alignment) unsigned char _storage[inline_size];
+		const callable_operations* _p_operations;
+	};
+}
+
+#endif
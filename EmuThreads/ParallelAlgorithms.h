@@ -0,0 +1,378 @@
+#ifndef EMU_THREADS_PARALLEL_ALGORITHMS_H_INC_
+#define EMU_THREADS_PARALLEL_ALGORITHMS_H_INC_ 1
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BasicThreadPool.h"
+
+namespace EmuThreads
+{
+	/// <summary>
+	/// <para> Describes how the range of a parallel algorithm is divided between its participating threads. </para>
+	/// <para> STATIC: The range is divided into one contiguous block per participant up-front. Cheapest to schedule, but sensitive to uneven work. </para>
+	/// <para> DYNAMIC: Participants repeatedly claim the next grain-sized chunk from a shared counter until the range is exhausted. </para>
+	/// <para>
+	///		GUIDED: As DYNAMIC, but claimed chunks are proportional to the remaining range divided by the number of participants, never smaller than the grain size.
+	///		Large early chunks keep scheduling costs low, while small late chunks balance the tail.
+	/// </para>
+	/// </summary>
+	enum class ParallelChunking : std::uint8_t
+	{
+		STATIC = 0x00,
+		DYNAMIC = 0x01,
+		GUIDED = 0x02,
+
+		DEFAULT = DYNAMIC
+	};
+
+	namespace _underlying_parallel
+	{
+		inline constexpr std::size_t cache_line_size = 64;
+
+		/// <summary> Wraps an item so that it occupies its own cache line(s), preventing false sharing between items written by different threads. </summary>
+		template<class T_>
+		struct alignas(cache_line_size) padded_item
+		{
+			T_ value;
+		};
+
+		/// <summary> Hands out chunks of a range to participants as described by Chunking_. </summary>
+		template<ParallelChunking Chunking_>
+		class chunk_scheduler
+		{
+		public:
+			chunk_scheduler(const std::size_t begin_, const std::size_t end_, const std::size_t grain_size_, const std::size_t num_participants_) noexcept :
+				begin(begin_),
+				end(end_),
+				grain_size(grain_size_),
+				num_participants(num_participants_),
+				next(begin_),
+				cancelled(false)
+			{
+			}
+
+			/// <summary> Attempts to claim the next chunk for the specified participant, outputting its half-open bounds on success. </summary>
+			/// <param name="participant_claims_">Number of chunks already claimed by this participant; only read and updated when using STATIC chunking.</param>
+			inline bool Claim(const std::size_t participant_index_, std::size_t& participant_claims_, std::size_t& out_begin_, std::size_t& out_end_) noexcept
+			{
+				if (cancelled.load(std::memory_order_relaxed))
+				{
+					return false;
+				}
+
+				if constexpr (Chunking_ == ParallelChunking::STATIC)
+				{
+					if (participant_claims_++ != 0)
+					{
+						return false;
+					}
+					const std::size_t count_ = end - begin;
+					out_begin_ = begin + _mul_div(count_, participant_index_, num_participants);
+					out_end_ = begin + _mul_div(count_, participant_index_ + 1, num_participants);
+					return out_begin_ < out_end_;
+				}
+				else if constexpr (Chunking_ == ParallelChunking::DYNAMIC)
+				{
+					// Check before adding so that repeated failed claims cannot overflow the counter
+					if (next.load(std::memory_order_relaxed) >= end)
+					{
+						return false;
+					}
+					out_begin_ = next.fetch_add(grain_size, std::memory_order_relaxed);
+					if (out_begin_ >= end)
+					{
+						return false;
+					}
+					out_end_ = (end - out_begin_) < grain_size ? end : out_begin_ + grain_size;
+					return true;
+				}
+				else
+				{
+					std::size_t claimed_begin_ = next.load(std::memory_order_relaxed);
+					while (claimed_begin_ < end)
+					{
+						const std::size_t remaining_ = end - claimed_begin_;
+						const std::size_t chunk_size_ = std::min(remaining_, std::max(grain_size, (remaining_ + num_participants - 1) / num_participants));
+						if (next.compare_exchange_weak(claimed_begin_, claimed_begin_ + chunk_size_, std::memory_order_relaxed))
+						{
+							out_begin_ = claimed_begin_;
+							out_end_ = claimed_begin_ + chunk_size_;
+							return true;
+						}
+					}
+					return false;
+				}
+			}
+
+			/// <summary> Prevents any further chunks from being claimed, such as after a participant throws. </summary>
+			inline void Cancel() noexcept
+			{
+				cancelled.store(true, std::memory_order_relaxed);
+			}
+
+		private:
+			[[nodiscard]] static constexpr inline std::size_t _mul_div(const std::size_t count_, const std::size_t numerator_, const std::size_t denominator_) noexcept
+			{
+				// Split to avoid overflowing count_ * numerator_ with extremely large ranges
+				return (count_ / denominator_) * numerator_ + ((count_ % denominator_) * numerator_) / denominator_;
+			}
+
+			const std::size_t begin;
+			const std::size_t end;
+			const std::size_t grain_size;
+			const std::size_t num_participants;
+			alignas(cache_line_size) std::atomic<std::size_t> next;
+			std::atomic<bool> cancelled;
+		};
+
+		/// <summary>
+		/// <para> Decides how many threads participate in processing count_ items with the provided grain size, and resolves a grain size of 0 to an automatic grain size. </para>
+		/// </summary>
+		template<ParallelChunking Chunking_>
+		[[nodiscard]] inline std::size_t prepare_participants(const std::size_t count_, std::size_t& in_out_grain_size_, const std::size_t max_participants_) noexcept
+		{
+			constexpr std::size_t auto_chunks_per_participant_ = 8;
+			if (in_out_grain_size_ == 0)
+			{
+				const std::size_t auto_grain_size_ = count_ / (max_participants_ * auto_chunks_per_participant_);
+				in_out_grain_size_ = auto_grain_size_ == 0 ? 1 : auto_grain_size_;
+			}
+			const std::size_t num_chunks_ = (count_ / in_out_grain_size_) + ((count_ % in_out_grain_size_) != 0);
+			return std::min(num_chunks_, max_participants_);
+		}
+
+		/// <summary>
+		/// <para> Invokes participate_ once with each participant index in the range 0:num_participants_ (exclusive), with the calling thread taking index 0 and queued tasks taking the rest. </para>
+		/// <para> Only returns once every participant has finished; the calling thread helps execute the pool's queue while waiting, so this may be safely used from within a task. </para>
+		/// <para> The first exception thrown by any participant is rethrown once all participants have finished. </para>
+		/// </summary>
+		template<class PoolFunc_, class Scheduler_, class Participate_>
+		inline void run_participants(EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_, const std::size_t num_participants_, Scheduler_& scheduler_, Participate_& participate_)
+		{
+			using pool_return_type = typename EmuThreads::BasicThreadPool<PoolFunc_>::func_return_type;
+			alignas(cache_line_size) std::atomic<std::size_t> num_running_participants_(num_participants_);
+			std::atomic<bool> has_exception_(false);
+			std::exception_ptr exception_;
+
+			auto run_participant_ = [&](const std::size_t participant_index_) noexcept
+			{
+				try
+				{
+					participate_(participant_index_);
+				}
+				catch (...)
+				{
+					scheduler_.Cancel();
+					if (!has_exception_.exchange(true, std::memory_order_relaxed))
+					{
+						exception_ = std::current_exception();
+					}
+				}
+
+				// Must be the final access to this call's state, as the calling thread may return as soon as it observes the last decrement
+				num_running_participants_.fetch_sub(1, std::memory_order_acq_rel);
+			};
+
+			std::size_t participant_index_ = 1;
+			try
+			{
+				for (; participant_index_ < num_participants_; ++participant_index_)
+				{
+					thread_pool_.template AddTaskToQueue<false>
+					(
+						[&run_participant_, participant_index_]() -> pool_return_type
+						{
+							run_participant_(participant_index_);
+							if constexpr (!std::is_void_v<pool_return_type>)
+							{
+								return pool_return_type();
+							}
+						}
+					);
+				}
+			}
+			catch (...)
+			{
+				// Already-queued participants reference this call's state, so they must still be awaited before the exception may leave
+				scheduler_.Cancel();
+				if (!has_exception_.exchange(true, std::memory_order_relaxed))
+				{
+					exception_ = std::current_exception();
+				}
+				num_running_participants_.fetch_sub(num_participants_ - participant_index_, std::memory_order_relaxed);
+			}
+			run_participant_(0);
+
+			auto all_finished_ = [&num_running_participants_]() { return num_running_participants_.load(std::memory_order_acquire) == 0; };
+			while (!all_finished_())
+			{
+				// Help with queued participants (or anything else queued) before yielding to those already running elsewhere
+				if (!thread_pool_.UseThisThreadForCurrentQueue(all_finished_) && !all_finished_())
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			if (exception_)
+			{
+				std::rethrow_exception(exception_);
+			}
+		}
+	}
+
+	/// <summary>
+	/// <para> Invokes func_ with every index in the range begin_ (inclusive) : end_ (exclusive), using the passed Thread Pool's Worker Threads and the calling thread. </para>
+	/// <para> Indices are processed in chunks as described by Chunking_, with indices within each chunk processed in ascending order. </para>
+	/// <para> Only returns once all indices have been processed. The calling thread helps execute the pool's queue while waiting, so this may be called from within a task. </para>
+	/// <para> If func_ throws, no further chunks are started and the first thrown exception is rethrown once all participants have finished. </para>
+	/// </summary>
+	/// <param name="thread_pool_">Thread Pool whose Worker Threads will assist the calling thread.</param>
+	/// <param name="begin_">Inclusive first index to process.</param>
+	/// <param name="end_">Exclusive end of the indices to process.</param>
+	/// <param name="grain_size_">Minimum number of indices per chunk. If 0, a grain size providing roughly 8 chunks per participating thread is used.</param>
+	/// <param name="func_">Function invoked with each index as a std::size_t. May be invoked concurrently from multiple threads.</param>
+	template<EmuThreads::ParallelChunking Chunking_ = EmuThreads::ParallelChunking::DEFAULT, class PoolFunc_, class Func_>
+	requires(std::is_invocable_v<Func_&, std::size_t>)
+	inline void parallel_for(EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_, const std::size_t begin_, const std::size_t end_, std::size_t grain_size_, Func_&& func_)
+	{
+		if (end_ <= begin_)
+		{
+			return;
+		}
+
+		const std::size_t num_participants_ = _underlying_parallel::prepare_participants<Chunking_>(end_ - begin_, grain_size_, thread_pool_.num_worker_threads + 1);
+		_underlying_parallel::chunk_scheduler<Chunking_> scheduler_(begin_, end_, grain_size_, num_participants_);
+		auto participate_ = [&scheduler_, &func_](const std::size_t participant_index_)
+		{
+			std::size_t num_claims_ = 0;
+			std::size_t chunk_begin_ = 0;
+			std::size_t chunk_end_ = 0;
+			while (scheduler_.Claim(participant_index_, num_claims_, chunk_begin_, chunk_end_))
+			{
+				for (std::size_t i = chunk_begin_; i < chunk_end_; ++i)
+				{
+					func_(i);
+				}
+			}
+		};
+		_underlying_parallel::run_participants(thread_pool_, num_participants_, scheduler_, participate_);
+	}
+
+	/// <summary>
+	/// <para> Reduces the results of invoking transform_ with every index in the range begin_ (inclusive) : end_ (exclusive), using the passed Thread Pool's Worker Threads and the calling thread. </para>
+	/// <para> Each participating thread accumulates into its own cache-line-padded accumulator, starting from identity_, via `accumulator = combine_(std::move(accumulator), transform_(i))`. </para>
+	/// <para> Participants' accumulators are then combined in participant order, starting from identity_, on the calling thread. </para>
+	/// <para>
+	///		combine_ must be associative and identity_ must be its identity. With DYNAMIC or GUIDED chunking, the grouping of indices varies between calls,
+	///		so non-associative operations such as floating-point addition may produce slightly different results each call. STATIC chunking groups indices identically for the same pool.
+	/// </para>
+	/// </summary>
+	/// <param name="thread_pool_">Thread Pool whose Worker Threads will assist the calling thread.</param>
+	/// <param name="begin_">Inclusive first index to process.</param>
+	/// <param name="end_">Exclusive end of the indices to process.</param>
+	/// <param name="grain_size_">Minimum number of indices per chunk. If 0, a grain size providing roughly 8 chunks per participating thread is used.</param>
+	/// <param name="identity_">Value that accumulators start from, which must not change a value when combined with it.</param>
+	/// <param name="transform_">Function invoked with each index as a std::size_t to produce the value to accumulate. May be invoked concurrently from multiple threads.</param>
+	/// <param name="combine_">
+	///		Function combining two values into one, invocable both with an accumulator and a transformed value, and with two accumulators.
+	///		May be invoked concurrently from multiple threads, but never with the same accumulator.
+	/// </param>
+	/// <returns>The combination of identity_ with the transformed value of every index.</returns>
+	template<EmuThreads::ParallelChunking Chunking_ = EmuThreads::ParallelChunking::DEFAULT, class PoolFunc_, class T_, class Transform_, class Combine_>
+	requires
+	(
+		std::is_invocable_v<Transform_&, std::size_t> &&
+		std::is_invocable_r_v<T_, Combine_&, T_&&, std::invoke_result_t<Transform_&, std::size_t>> &&
+		std::is_invocable_r_v<T_, Combine_&, T_&&, T_&&>
+	)
+	[[nodiscard]] inline T_ parallel_reduce
+	(
+		EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_,
+		const std::size_t begin_,
+		const std::size_t end_,
+		std::size_t grain_size_,
+		const T_& identity_,
+		Transform_&& transform_,
+		Combine_&& combine_
+	)
+	{
+		if (end_ <= begin_)
+		{
+			return identity_;
+		}
+
+		const std::size_t num_participants_ = _underlying_parallel::prepare_participants<Chunking_>(end_ - begin_, grain_size_, thread_pool_.num_worker_threads + 1);
+		_underlying_parallel::chunk_scheduler<Chunking_> scheduler_(begin_, end_, grain_size_, num_participants_);
+		std::vector<_underlying_parallel::padded_item<T_>> accumulators_(num_participants_, _underlying_parallel::padded_item<T_>{ identity_ });
+		auto participate_ = [&scheduler_, &transform_, &combine_, &accumulators_](const std::size_t participant_index_)
+		{
+			T_& accumulator_ = accumulators_[participant_index_].value;
+			std::size_t num_claims_ = 0;
+			std::size_t chunk_begin_ = 0;
+			std::size_t chunk_end_ = 0;
+			while (scheduler_.Claim(participant_index_, num_claims_, chunk_begin_, chunk_end_))
+			{
+				for (std::size_t i = chunk_begin_; i < chunk_end_; ++i)
+				{
+					accumulator_ = combine_(std::move(accumulator_), transform_(i));
+				}
+			}
+		};
+		_underlying_parallel::run_participants(thread_pool_, num_participants_, scheduler_, participate_);
+
+		T_ result_ = identity_;
+		for (auto& accumulator_ : accumulators_)
+		{
+			result_ = combine_(std::move(result_), std::move(accumulator_.value));
+		}
+		return result_;
+	}
+
+	/// <summary>
+	/// <para> Writes the result of invoking func_ with each item in the range in_begin_ : in_end_ to the respective item of the range starting at out_begin_, in parallel. </para>
+	/// <para> Equivalent to std::transform, except that items are processed by the passed Thread Pool's Worker Threads and the calling thread in chunks as described by Chunking_. </para>
+	/// <para> Both iterator types must be random-access. The output range may be the same as the input range, but must not otherwise overlap it. </para>
+	/// </summary>
+	/// <param name="thread_pool_">Thread Pool whose Worker Threads will assist the calling thread.</param>
+	/// <param name="in_begin_">Iterator to the first item to transform.</param>
+	/// <param name="in_end_">Iterator to the end of the items to transform.</param>
+	/// <param name="out_begin_">Iterator to the first item to output to.</param>
+	/// <param name="grain_size_">Minimum number of items per chunk. If 0, a grain size providing roughly 8 chunks per participating thread is used.</param>
+	/// <param name="func_">Function invoked with each input item to produce its output. May be invoked concurrently from multiple threads.</param>
+	/// <returns>Iterator to the end of the output range.</returns>
+	template<EmuThreads::ParallelChunking Chunking_ = EmuThreads::ParallelChunking::DEFAULT, class PoolFunc_, std::random_access_iterator InIt_, std::random_access_iterator OutIt_, class Func_>
+	inline OutIt_ parallel_transform(EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_, InIt_ in_begin_, InIt_ in_end_, OutIt_ out_begin_, std::size_t grain_size_, Func_&& func_)
+	{
+		const auto count_ = std::distance(in_begin_, in_end_);
+		if (count_ <= 0)
+		{
+			return out_begin_;
+		}
+
+		EmuThreads::parallel_for<Chunking_>
+		(
+			thread_pool_,
+			0,
+			static_cast<std::size_t>(count_),
+			grain_size_,
+			[&in_begin_, &out_begin_, &func_](const std::size_t i)
+			{
+				using difference_type = typename std::iterator_traits<InIt_>::difference_type;
+				using out_difference_type = typename std::iterator_traits<OutIt_>::difference_type;
+				out_begin_[static_cast<out_difference_type>(i)] = func_(in_begin_[static_cast<difference_type>(i)]);
+			}
+		);
+		return out_begin_ + count_;
+	}
+}
+
+#endif
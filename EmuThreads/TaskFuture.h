@@ -0,0 +1,559 @@
+#ifndef EMU_THREADS_TASK_FUTURE_H_INC_
+#define EMU_THREADS_TASK_FUTURE_H_INC_ 1
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace EmuThreads
+{
+	/// <summary>
+	/// <para> Reference-counted state shared between the producer of a task's result and any EmuThreads::TaskFuture awaiting it. </para>
+	/// <para> The result is stored inline, so no allocation is made beyond that of the state itself, which may be embedded in a larger object such as a queued task. </para>
+	/// <para> Once the final reference is released, the state is passed to the release function that it was constructed with, which is responsible for destroying it. </para>
+	/// </summary>
+	template<class T_>
+	class TaskSharedState
+	{
+	public:
+		using value_type = T_;
+		using release_func = void(*)(TaskSharedState<T_>*) noexcept;
+
+	private:
+		// References are stored as pointers; void results store nothing of interest
+		using stored_type = std::conditional_t
+		<
+			std::is_void_v<T_>,
+			unsigned char,
+			std::conditional_t<std::is_reference_v<T_>, std::remove_reference_t<T_>*, T_>
+		>;
+
+		static constexpr std::uint32_t _status_pending = 0;
+		static constexpr std::uint32_t _status_value = 1;
+		static constexpr std::uint32_t _status_exception = 2;
+
+	public:
+		TaskSharedState() = delete;
+		TaskSharedState(const TaskSharedState&) = delete;
+		TaskSharedState(TaskSharedState&&) = delete;
+		TaskSharedState& operator=(const TaskSharedState&) = delete;
+		TaskSharedState& operator=(TaskSharedState&&) = delete;
+
+		/// <summary>
+		/// <para> Creates a pending state with a single reference, owned by the creator. </para>
+		/// </summary>
+		/// <param name="on_final_release_">Function invoked with this state when its final reference is released, which must destroy this state.</param>
+		explicit TaskSharedState(release_func on_final_release_) noexcept :
+			_status(_status_pending),
+			_num_references(1),
+			_on_final_release(on_final_release_),
+			_exception()
+		{
+		}
+
+		~TaskSharedState()
+		{
+			if constexpr (!std::is_trivially_destructible_v<stored_type>)
+			{
+				if (_status.load(std::memory_order_relaxed) == _status_value)
+				{
+					_stored_value().~stored_type();
+				}
+			}
+		}
+
+		/// <summary> Allocates a standalone pending state, for use when a state is not embedded in another object. </summary>
+		[[nodiscard]] static inline TaskSharedState<T_>* MakeStandalone()
+		{
+			return new TaskSharedState<T_>([](TaskSharedState<T_>* p_state_) noexcept { delete p_state_; });
+		}
+
+		inline void AddReference() noexcept
+		{
+			_num_references.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		inline void ReleaseReference() noexcept
+		{
+			if (_num_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				_on_final_release(this);
+			}
+		}
+
+		/// <summary> Stores the passed value (or nothing for void results) and marks this state as ready. May only be called once per state, and not alongside SetException. </summary>
+		template<class...Args_>
+		inline void SetValue(Args_&&...args_)
+		{
+			if constexpr (std::is_reference_v<T_>)
+			{
+				::new(static_cast<void*>(_value_storage)) stored_type(std::addressof(args_)...);
+			}
+			else if constexpr (!std::is_void_v<T_>)
+			{
+				::new(static_cast<void*>(_value_storage)) stored_type(std::forward<Args_>(args_)...);
+			}
+			_make_ready(_status_value);
+		}
+
+		/// <summary> Stores the passed exception and marks this state as ready. May only be called once per state, and not alongside SetValue. </summary>
+		inline void SetException(std::exception_ptr exception_) noexcept
+		{
+			_exception = std::move(exception_);
+			_make_ready(_status_exception);
+		}
+
+		[[nodiscard]] inline bool IsReady() const noexcept
+		{
+			return _status.load(std::memory_order_acquire) != _status_pending;
+		}
+
+		/// <summary> Blocks the calling thread until this state is ready. </summary>
+		inline void Wait() const noexcept
+		{
+			std::uint32_t status_ = _status.load(std::memory_order_acquire);
+			while (status_ == _status_pending)
+			{
+				_status.wait(_status_pending, std::memory_order_acquire);
+				status_ = _status.load(std::memory_order_acquire);
+			}
+		}
+
+		/// <summary>
+		/// <para> Blocks the calling thread until this state is ready or the provided time point is reached, returning true if this state is ready. </para>
+		/// <para> As std::atomic provides no timed wait, this polls the state, yielding at first and then sleeping in short intervals to bound CPU usage. </para>
+		/// </summary>
+		template<class Clock_, class Duration_>
+		inline bool WaitUntil(const std::chrono::time_point<Clock_, Duration_>& timeout_time_) const
+		{
+			constexpr std::size_t num_yields_ = 64;
+			constexpr std::chrono::microseconds max_sleep_duration_ = std::chrono::microseconds(100);
+			for (std::size_t attempt_ = 0; !IsReady(); ++attempt_)
+			{
+				const auto now_ = Clock_::now();
+				if (now_ >= timeout_time_)
+				{
+					return false;
+				}
+
+				if (attempt_ < num_yields_)
+				{
+					std::this_thread::yield();
+				}
+				else
+				{
+					const auto remaining_ = timeout_time_ - now_;
+					if (remaining_ < max_sleep_duration_)
+					{
+						std::this_thread::sleep_for(remaining_);
+					}
+					else
+					{
+						std::this_thread::sleep_for(max_sleep_duration_);
+					}
+				}
+			}
+			return true;
+		}
+
+		/// <summary> Blocks the calling thread until this state is ready or the provided duration has elapsed, returning true if this state is ready. </summary>
+		template<class Rep_, class Period_>
+		inline bool WaitFor(const std::chrono::duration<Rep_, Period_>& timeout_duration_) const
+		{
+			return WaitUntil(std::chrono::steady_clock::now() + timeout_duration_);
+		}
+
+		/// <summary> Waits for this state to be ready, then rethrows its exception if it has one, or otherwise moves out its value. </summary>
+		inline T_ TakeResult()
+		{
+			Wait();
+			if (_status.load(std::memory_order_relaxed) == _status_exception)
+			{
+				std::rethrow_exception(_exception);
+			}
+
+			if constexpr (std::is_reference_v<T_>)
+			{
+				return static_cast<T_>(*_stored_value());
+			}
+			else if constexpr (!std::is_void_v<T_>)
+			{
+				return std::move(_stored_value());
+			}
+		}
+
+		/// <summary>
+		/// <para> Waits for this state to be ready, then rethrows its exception if it has one, or otherwise returns a reference to its value without moving it. </para>
+		/// <para> Returns a const reference for value results, the stored reference for reference results, and nothing for void results. </para>
+		/// </summary>
+		inline decltype(auto) GetResult() const
+		{
+			Wait();
+			if (_status.load(std::memory_order_relaxed) == _status_exception)
+			{
+				std::rethrow_exception(_exception);
+			}
+
+			if constexpr (std::is_reference_v<T_>)
+			{
+				return static_cast<T_>(*_stored_value());
+			}
+			else if constexpr (!std::is_void_v<T_>)
+			{
+				return static_cast<const T_&>(_stored_value());
+			}
+		}
+
+	private:
+		inline void _make_ready(const std::uint32_t status_) noexcept
+		{
+			_status.store(status_, std::memory_order_release);
+			_status.notify_all();
+		}
+
+		[[nodiscard]] inline stored_type& _stored_value() noexcept
+		{
+			return *std::launder(reinterpret_cast<stored_type*>(_value_storage));
+		}
+
+		[[nodiscard]] inline const stored_type& _stored_value() const noexcept
+		{
+			return *std::launder(reinterpret_cast<const stored_type*>(_value_storage));
+		}
+
+		std::atomic<std::uint32_t> _status;
+		std::atomic<std::uint32_t> _num_references;
+		release_func _on_final_release;
+		std::exception_ptr _exception;
+		alignas(stored_type) unsigned char _value_storage[sizeof(stored_type)];
+	};
+
+	template<class T_>
+	class TaskSharedFuture;
+
+	/// <summary>
+	/// <para> Lightweight, move-only counterpart to std::future, awaiting the result of an EmuThreads::TaskSharedState. </para>
+	/// <para>
+	///		Provides the get, wait, wait_for, wait_until, share and valid members of std::future, so may be used in its place for the results of an EmuThreads::BasicThreadPool's tasks.
+	///		Results are never deferred, so timed waits only return std::future_status::ready or std::future_status::timeout.
+	/// </para>
+	/// </summary>
+	template<class T_>
+	class TaskFuture
+	{
+	public:
+		using value_type = T_;
+		using state_type = EmuThreads::TaskSharedState<T_>;
+
+		TaskFuture(const TaskFuture&) = delete;
+		TaskFuture& operator=(const TaskFuture&) = delete;
+
+		/// <summary> Creates an invalid future, which does not refer to any state. </summary>
+		constexpr TaskFuture() noexcept :
+			_p_state(nullptr)
+		{
+		}
+
+		/// <summary> Creates a future referring to the passed state, adding a reference to it. </summary>
+		explicit TaskFuture(state_type* p_state_) noexcept :
+			_p_state(p_state_)
+		{
+			if (_p_state != nullptr)
+			{
+				_p_state->AddReference();
+			}
+		}
+
+		TaskFuture(TaskFuture&& to_move_) noexcept :
+			_p_state(std::exchange(to_move_._p_state, nullptr))
+		{
+		}
+
+		~TaskFuture()
+		{
+			_release();
+		}
+
+		TaskFuture& operator=(TaskFuture&& to_move_) noexcept
+		{
+			if (this != &to_move_)
+			{
+				_release();
+				_p_state = std::exchange(to_move_._p_state, nullptr);
+			}
+			return *this;
+		}
+
+		/// <summary> Returns true if this future refers to a state; otherwise false. A future is no longer valid once `get` has been called. </summary>
+		[[nodiscard]] inline bool valid() const noexcept
+		{
+			return _p_state != nullptr;
+		}
+
+		/// <summary> Blocks the calling thread until the result is ready. This future must be valid. </summary>
+		inline void wait() const noexcept
+		{
+			_p_state->Wait();
+		}
+
+		/// <summary> Blocks the calling thread until the result is ready or the provided duration has elapsed. This future must be valid. </summary>
+		template<class Rep_, class Period_>
+		inline std::future_status wait_for(const std::chrono::duration<Rep_, Period_>& timeout_duration_) const
+		{
+			return _p_state->WaitFor(timeout_duration_) ? std::future_status::ready : std::future_status::timeout;
+		}
+
+		/// <summary> Blocks the calling thread until the result is ready or the provided time point is reached. This future must be valid. </summary>
+		template<class Clock_, class Duration_>
+		inline std::future_status wait_until(const std::chrono::time_point<Clock_, Duration_>& timeout_time_) const
+		{
+			return _p_state->WaitUntil(timeout_time_) ? std::future_status::ready : std::future_status::timeout;
+		}
+
+		/// <summary> Returns true if the result is ready, in which case `get` will not block. This future must be valid. </summary>
+		[[nodiscard]] inline bool IsReady() const noexcept
+		{
+			return _p_state->IsReady();
+		}
+
+		/// <summary> Transfers this future's state to a copyable EmuThreads::TaskSharedFuture, as with std::future::share. This future will be invalid after this call. </summary>
+		[[nodiscard]] inline EmuThreads::TaskSharedFuture<T_> share() noexcept
+		{
+			return EmuThreads::TaskSharedFuture<T_>(std::move(*this));
+		}
+
+		/// <summary>
+		/// <para> Waits for the result, then returns it or rethrows the exception that it holds. This future must be valid, and will be invalid after this call. </para>
+		/// </summary>
+		inline T_ get()
+		{
+			struct release_on_exit
+			{
+				~release_on_exit()
+				{
+					p_future->_release();
+				}
+				TaskFuture* p_future;
+			};
+			release_on_exit release_guard_{ this };
+			return _p_state->TakeResult();
+		}
+
+	private:
+		friend class EmuThreads::TaskSharedFuture<T_>;
+
+		inline void _release() noexcept
+		{
+			if (_p_state != nullptr)
+			{
+				std::exchange(_p_state, nullptr)->ReleaseReference();
+			}
+		}
+
+		state_type* _p_state;
+	};
+
+	/// <summary>
+	/// <para> Lightweight, copyable counterpart to std::shared_future, created via EmuThreads::TaskFuture::share. </para>
+	/// <para> Every copy refers to the same EmuThreads::TaskSharedState, and `get` may be called any number of times on any copy without moving the result out. </para>
+	/// </summary>
+	template<class T_>
+	class TaskSharedFuture
+	{
+	public:
+		using value_type = T_;
+		using state_type = EmuThreads::TaskSharedState<T_>;
+
+		/// <summary> Creates an invalid future, which does not refer to any state. </summary>
+		constexpr TaskSharedFuture() noexcept :
+			_p_state(nullptr)
+		{
+		}
+
+		/// <summary> Takes ownership of the passed future's reference to its state. The passed future will be invalid after this call. </summary>
+		TaskSharedFuture(EmuThreads::TaskFuture<T_>&& to_share_) noexcept :
+			_p_state(std::exchange(to_share_._p_state, nullptr))
+		{
+		}
+
+		TaskSharedFuture(const TaskSharedFuture& to_copy_) noexcept :
+			_p_state(to_copy_._p_state)
+		{
+			if (_p_state != nullptr)
+			{
+				_p_state->AddReference();
+			}
+		}
+
+		TaskSharedFuture(TaskSharedFuture&& to_move_) noexcept :
+			_p_state(std::exchange(to_move_._p_state, nullptr))
+		{
+		}
+
+		~TaskSharedFuture()
+		{
+			_release();
+		}
+
+		TaskSharedFuture& operator=(const TaskSharedFuture& to_copy_) noexcept
+		{
+			if (this != &to_copy_)
+			{
+				if (to_copy_._p_state != nullptr)
+				{
+					to_copy_._p_state->AddReference();
+				}
+				_release();
+				_p_state = to_copy_._p_state;
+			}
+			return *this;
+		}
+
+		TaskSharedFuture& operator=(TaskSharedFuture&& to_move_) noexcept
+		{
+			if (this != &to_move_)
+			{
+				_release();
+				_p_state = std::exchange(to_move_._p_state, nullptr);
+			}
+			return *this;
+		}
+
+		[[nodiscard]] inline bool valid() const noexcept
+		{
+			return _p_state != nullptr;
+		}
+
+		inline void wait() const noexcept
+		{
+			_p_state->Wait();
+		}
+
+		template<class Rep_, class Period_>
+		inline std::future_status wait_for(const std::chrono::duration<Rep_, Period_>& timeout_duration_) const
+		{
+			return _p_state->WaitFor(timeout_duration_) ? std::future_status::ready : std::future_status::timeout;
+		}
+
+		template<class Clock_, class Duration_>
+		inline std::future_status wait_until(const std::chrono::time_point<Clock_, Duration_>& timeout_time_) const
+		{
+			return _p_state->WaitUntil(timeout_time_) ? std::future_status::ready : std::future_status::timeout;
+		}
+
+		[[nodiscard]] inline bool IsReady() const noexcept
+		{
+			return _p_state->IsReady();
+		}
+
+		/// <summary>
+		/// <para> Waits for the result, then returns a reference to it (or nothing for void results) or rethrows the exception that it holds. This future must be valid. </para>
+		/// <para> As with std::shared_future, value results are returned by const reference, and remain valid for as long as any future refers to the state. </para>
+		/// </summary>
+		inline decltype(auto) get() const
+		{
+			return _p_state->GetResult();
+		}
+
+	private:
+		inline void _release() noexcept
+		{
+			if (_p_state != nullptr)
+			{
+				std::exchange(_p_state, nullptr)->ReleaseReference();
+			}
+		}
+
+		state_type* _p_state;
+	};
+
+	/// <summary>
+	/// <para> Lightweight, move-only counterpart to std::promise, providing a result to EmuThreads::TaskFuture instances via a single small allocation. </para>
+	/// <para> If destroyed without a result being set, any awaiting futures receive a std::future_error with the broken_promise error code, as with std::promise. </para>
+	/// </summary>
+	template<class T_>
+	class TaskPromise
+	{
+	public:
+		using value_type = T_;
+		using state_type = EmuThreads::TaskSharedState<T_>;
+
+		TaskPromise(const TaskPromise&) = delete;
+		TaskPromise& operator=(const TaskPromise&) = delete;
+
+		TaskPromise() :
+			_p_state(state_type::MakeStandalone()),
+			_satisfied(false)
+		{
+		}
+
+		TaskPromise(TaskPromise&& to_move_) noexcept :
+			_p_state(std::exchange(to_move_._p_state, nullptr)),
+			_satisfied(to_move_._satisfied)
+		{
+		}
+
+		~TaskPromise()
+		{
+			_abandon();
+		}
+
+		TaskPromise& operator=(TaskPromise&& to_move_) noexcept
+		{
+			if (this != &to_move_)
+			{
+				_abandon();
+				_p_state = std::exchange(to_move_._p_state, nullptr);
+				_satisfied = to_move_._satisfied;
+			}
+			return *this;
+		}
+
+		/// <summary> Creates a future which awaits the result of this promise. </summary>
+		[[nodiscard]] inline EmuThreads::TaskFuture<T_> get_future() noexcept
+		{
+			return EmuThreads::TaskFuture<T_>(_p_state);
+		}
+
+		/// <summary> Stores the passed value (or nothing for void results) as this promise's result. May only be called once, and not alongside set_exception. </summary>
+		template<class...Args_>
+		inline void set_value(Args_&&...args_)
+		{
+			_p_state->SetValue(std::forward<Args_>(args_)...);
+			_satisfied = true;
+		}
+
+		/// <summary> Stores the passed exception as this promise's result. May only be called once, and not alongside set_value. </summary>
+		inline void set_exception(std::exception_ptr exception_) noexcept
+		{
+			_p_state->SetException(std::move(exception_));
+			_satisfied = true;
+		}
+
+	private:
+		inline void _abandon() noexcept
+		{
+			if (_p_state != nullptr)
+			{
+				if (!_satisfied)
+				{
+					_p_state->SetException(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+				}
+				std::exchange(_p_state, nullptr)->ReleaseReference();
+			}
+		}
+
+		state_type* _p_state;
+		bool _satisfied;
+	};
+}
+
+#endif
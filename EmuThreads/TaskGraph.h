@@ -0,0 +1,386 @@
+#ifndef EMU_THREADS_TASK_GRAPH_H_INC_
+#define EMU_THREADS_TASK_GRAPH_H_INC_ 1
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BasicThreadPool.h"
+#include "InlineTask.h"
+
+namespace EmuThreads
+{
+	/// <summary>
+	/// <para> Graph of tasks with dependency edges, executed on an EmuThreads::BasicThreadPool without any thread blocking on a task's completion. </para>
+	/// <para>
+	///		Each node counts its unfinished predecessors atomically. When a node finishes, each successor whose count reaches 0 is released straight onto the Thread Pool,
+	///		with the final released successor continuing on the same thread instead of being queued.
+	/// </para>
+	/// <para> Nodes and dependencies may only be added while the graph is not running. A graph may be run any number of times, but only once at a time. </para>
+	/// <para>
+	///		If a node's task throws, all nodes that have not yet started are skipped (while still being released in dependency order),
+	///		and the first thrown exception is rethrown by Wait.
+	/// </para>
+	/// </summary>
+	class TaskGraph
+	{
+	public:
+		/// <summary> Identifier of a node within the TaskGraph that created it. </summary>
+		using node_id = std::size_t;
+
+		/// <summary> Type used to store each node's task. Small callables are stored inline, so adding them does not allocate for the callable itself. </summary>
+		using task_type = EmuThreads::InlineTask<void()>;
+
+	private:
+		struct node
+		{
+			node(const node_id id_, task_type&& task_) :
+				id(id_),
+				task(std::move(task_)),
+				successors(),
+				num_predecessors(0),
+				num_unfinished_predecessors(0)
+			{
+			}
+
+			const node_id id;
+			task_type task;
+			std::vector<node*> successors;
+			std::size_t num_predecessors;
+			// Decremented by whichever threads finish this node's predecessors, so kept away from the read-only data above
+			alignas(64) std::atomic<std::size_t> num_unfinished_predecessors;
+		};
+
+		using submit_func = void(*)(void* p_thread_pool_, TaskGraph* p_graph_, node* p_node_);
+		using help_func = bool(*)(void* p_thread_pool_, TaskGraph* p_graph_);
+
+	public:
+		TaskGraph(const TaskGraph&) = delete;
+		TaskGraph(TaskGraph&&) = delete;
+		TaskGraph& operator=(const TaskGraph&) = delete;
+		TaskGraph& operator=(TaskGraph&&) = delete;
+
+		TaskGraph() :
+			_nodes(),
+			_is_validated(true),
+			_num_unfinished_nodes(0),
+			_cancelled(false),
+			_has_exception(false),
+			_exception(),
+			_p_thread_pool(nullptr),
+			_submit(nullptr),
+			_help(nullptr)
+		{
+		}
+
+		/// <summary>
+		/// <para> If this graph is running, the calling thread helps execute its Thread Pool's tasks until the run finishes. Any exception from the run is discarded. </para>
+		/// </summary>
+		~TaskGraph()
+		{
+			_help_until_finished();
+		}
+
+		/// <summary>
+		/// <para> Adds a node which executes the passed callable when run. This graph must not be running. </para>
+		/// </summary>
+		/// <param name="func_">Callable invocable with no arguments. It will be stored as this graph's task_type.</param>
+		/// <returns>ID of the added node, for use when adding dependencies.</returns>
+		template<class Func_>
+		requires(std::is_constructible_v<task_type, Func_&&>)
+		inline node_id AddNode(Func_&& func_)
+		{
+			_assert_not_running("AddNode");
+			_nodes.emplace_back(std::make_unique<node>(_nodes.size(), task_type(std::forward<Func_>(func_))));
+			return _nodes.size() - 1;
+		}
+
+		/// <summary>
+		/// <para> Adds a node which executes the passed callable when run, once all of the specified predecessors have finished. This graph must not be running. </para>
+		/// </summary>
+		/// <param name="func_">Callable invocable with no arguments. It will be stored as this graph's task_type.</param>
+		/// <param name="predecessors_">IDs of nodes that must finish before the added node may start.</param>
+		/// <returns>ID of the added node, for use when adding dependencies.</returns>
+		template<class Func_>
+		requires(std::is_constructible_v<task_type, Func_&&>)
+		inline node_id AddNode(Func_&& func_, std::initializer_list<node_id> predecessors_)
+		{
+			for (const node_id predecessor_ : predecessors_)
+			{
+				_assert_valid_id(predecessor_, "AddNode");
+			}
+
+			const node_id added_id_ = AddNode(std::forward<Func_>(func_));
+			for (const node_id predecessor_ : predecessors_)
+			{
+				AddDependency(predecessor_, added_id_);
+			}
+			return added_id_;
+		}
+
+		/// <summary>
+		/// <para> Adds an edge so that the successor node may only start once the predecessor node has finished. This graph must not be running. </para>
+		/// <para> Cycles are not detected here, but cause the next call to Run to throw a std::logic_error. </para>
+		/// </summary>
+		/// <param name="predecessor_">ID of the node that must finish first.</param>
+		/// <param name="successor_">ID of the node that depends on the predecessor.</param>
+		inline void AddDependency(const node_id predecessor_, const node_id successor_)
+		{
+			_assert_not_running("AddDependency");
+			_assert_valid_id(predecessor_, "AddDependency");
+			_assert_valid_id(successor_, "AddDependency");
+			if (predecessor_ == successor_)
+			{
+				throw std::invalid_argument("Invalid node IDs passed to EmuThreads::TaskGraph::AddDependency: A node may not depend on itself.");
+			}
+
+			node& successor_node_ = *_nodes[successor_];
+			_nodes[predecessor_]->successors.push_back(&successor_node_);
+			++successor_node_.num_predecessors;
+			_is_validated = false;
+		}
+
+		[[nodiscard]] inline std::size_t NumNodes() const noexcept
+		{
+			return _nodes.size();
+		}
+
+		/// <summary> Returns true if this graph is not currently running; otherwise false. </summary>
+		[[nodiscard]] inline bool IsFinished() const noexcept
+		{
+			return _num_unfinished_nodes.load(std::memory_order_acquire) == 0;
+		}
+
+		/// <summary>
+		/// <para> Starts running this graph on the passed Thread Pool by queuing every node without predecessors, then returns without waiting. </para>
+		/// <para> Remaining nodes are queued by the threads that finish their final predecessor. Call Wait to await completion and receive any exception. </para>
+		/// <para> The passed Thread Pool must outlive the run. Throws a std::logic_error if this graph is already running or contains a cycle. </para>
+		/// </summary>
+		/// <param name="thread_pool_">Thread Pool to execute this graph's nodes.</param>
+		template<class PoolFunc_>
+		inline void Run(EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_)
+		{
+			_assert_not_running("Run");
+			if (!_is_validated)
+			{
+				_validate_acyclic();
+			}
+			if (_nodes.empty())
+			{
+				return;
+			}
+
+			_p_thread_pool = std::addressof(thread_pool_);
+			_submit = &_submit_to_pool<PoolFunc_>;
+			_help = &_help_pool<PoolFunc_>;
+			_cancelled.store(false, std::memory_order_relaxed);
+			_has_exception.store(false, std::memory_order_relaxed);
+			_exception = nullptr;
+			for (auto& p_node_ : _nodes)
+			{
+				p_node_->num_unfinished_predecessors.store(p_node_->num_predecessors, std::memory_order_relaxed);
+			}
+
+			// Publishes the above to any thread that executes a node
+			_num_unfinished_nodes.store(_nodes.size(), std::memory_order_release);
+			for (auto& p_node_ : _nodes)
+			{
+				if (p_node_->num_predecessors == 0)
+				{
+					_release_node(p_node_.get());
+				}
+			}
+		}
+
+		/// <summary>
+		/// <para> Waits for the current run of this graph to finish, with the calling thread helping to execute its Thread Pool's tasks instead of blocking. </para>
+		/// <para> If any node threw an exception during the run, the first such exception is rethrown. Returns immediately if this graph is not running. </para>
+		/// </summary>
+		inline void Wait()
+		{
+			_help_until_finished();
+			if (_has_exception.exchange(false, std::memory_order_relaxed))
+			{
+				std::rethrow_exception(std::exchange(_exception, nullptr));
+			}
+		}
+
+		/// <summary> Runs this graph on the passed Thread Pool and waits for it to finish, helping to execute tasks in the meantime. </summary>
+		/// <param name="thread_pool_">Thread Pool to execute this graph's nodes.</param>
+		template<class PoolFunc_>
+		inline void RunAndWait(EmuThreads::BasicThreadPool<PoolFunc_>& thread_pool_)
+		{
+			Run(thread_pool_);
+			Wait();
+		}
+
+	private:
+		template<class PoolFunc_>
+		static inline void _submit_to_pool(void* p_thread_pool_, TaskGraph* p_graph_, node* p_node_)
+		{
+			using pool_type = EmuThreads::BasicThreadPool<PoolFunc_>;
+			using pool_return_type = typename pool_type::func_return_type;
+			static_cast<pool_type*>(p_thread_pool_)->template AddTaskToQueue<false>
+			(
+				[p_graph_, p_node_]() -> pool_return_type
+				{
+					p_graph_->_execute_node(p_node_);
+					if constexpr (!std::is_void_v<pool_return_type>)
+					{
+						return pool_return_type();
+					}
+				}
+			);
+		}
+
+		template<class PoolFunc_>
+		static inline bool _help_pool(void* p_thread_pool_, TaskGraph* p_graph_)
+		{
+			return static_cast<EmuThreads::BasicThreadPool<PoolFunc_>*>(p_thread_pool_)->UseThisThreadForCurrentQueue([p_graph_]() { return p_graph_->IsFinished(); });
+		}
+
+		/// <summary> Queues the passed ready node, or executes it on the calling thread if it cannot be queued. </summary>
+		inline void _release_node(node* p_node_) noexcept
+		{
+			try
+			{
+				_submit(_p_thread_pool, this, p_node_);
+			}
+			catch (...)
+			{
+				// The node still has to finish to release its successors, so it is executed here with the run cancelled
+				_record_exception(std::current_exception());
+				_execute_node(p_node_);
+			}
+		}
+
+		inline void _execute_node(node* p_node_) noexcept
+		{
+			while (p_node_ != nullptr)
+			{
+				if (!_cancelled.load(std::memory_order_relaxed))
+				{
+					try
+					{
+						p_node_->task();
+					}
+					catch (...)
+					{
+						_record_exception(std::current_exception());
+					}
+				}
+
+				// Successors are released before this node is counted as finished, as the graph may be destroyed as soon as the final node is counted
+				node* p_continuation_ = nullptr;
+				for (node* p_successor_ : p_node_->successors)
+				{
+					if (p_successor_->num_unfinished_predecessors.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					{
+						if (p_continuation_ != nullptr)
+						{
+							_release_node(p_continuation_);
+						}
+						p_continuation_ = p_successor_;
+					}
+				}
+
+				// A pending continuation keeps the unfinished count above 0, so this is only the final access to the graph if there is no continuation
+				_num_unfinished_nodes.fetch_sub(1, std::memory_order_acq_rel);
+				p_node_ = p_continuation_;
+			}
+		}
+
+		inline void _record_exception(std::exception_ptr exception_) noexcept
+		{
+			_cancelled.store(true, std::memory_order_relaxed);
+			if (!_has_exception.exchange(true, std::memory_order_relaxed))
+			{
+				_exception = std::move(exception_);
+			}
+		}
+
+		inline void _help_until_finished()
+		{
+			while (!IsFinished())
+			{
+				if (!_help(_p_thread_pool, this) && !IsFinished())
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		inline void _validate_acyclic() const
+		{
+			// Kahn's algorithm: every node can only be visited if the graph has no cycles
+			std::vector<std::size_t> num_unvisited_predecessors_;
+			std::vector<const node*> ready_nodes_;
+			num_unvisited_predecessors_.reserve(_nodes.size());
+			for (const auto& p_node_ : _nodes)
+			{
+				num_unvisited_predecessors_.push_back(p_node_->num_predecessors);
+				if (p_node_->num_predecessors == 0)
+				{
+					ready_nodes_.push_back(p_node_.get());
+				}
+			}
+
+			std::size_t num_visited_ = 0;
+			while (!ready_nodes_.empty())
+			{
+				const node* p_node_ = ready_nodes_.back();
+				ready_nodes_.pop_back();
+				++num_visited_;
+				for (const node* p_successor_ : p_node_->successors)
+				{
+					if (--num_unvisited_predecessors_[p_successor_->id] == 0)
+					{
+						ready_nodes_.push_back(p_successor_);
+					}
+				}
+			}
+
+			if (num_visited_ != _nodes.size())
+			{
+				throw std::logic_error("Invalid EmuThreads::TaskGraph passed to Run: The graph's dependencies contain a cycle, so it can never finish.");
+			}
+			_is_validated = true;
+		}
+
+		inline void _assert_not_running(const char* func_name_) const
+		{
+			if (!IsFinished())
+			{
+				throw std::logic_error(std::string("Invalid call to EmuThreads::TaskGraph::") + func_name_ + ": The graph is currently running.");
+			}
+		}
+
+		inline void _assert_valid_id(const node_id id_, const char* func_name_) const
+		{
+			if (id_ >= _nodes.size())
+			{
+				throw std::out_of_range(std::string("Invalid node ID passed to EmuThreads::TaskGraph::") + func_name_ + ": The ID does not refer to a node within the graph.");
+			}
+		}
+
+		std::vector<std::unique_ptr<node>> _nodes;
+		mutable bool _is_validated;
+		alignas(64) std::atomic<std::size_t> _num_unfinished_nodes;
+		std::atomic<bool> _cancelled;
+		std::atomic<bool> _has_exception;
+		std::exception_ptr _exception;
+		void* _p_thread_pool;
+		submit_func _submit;
+		help_func _help;
+	};
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef EMU_THREADS_THREAD_POOL_IDLE_POLICY_H_INC_
+#define EMU_THREADS_THREAD_POOL_IDLE_POLICY_H_INC_ 1
+
+#include <cstddef>
+#include <limits>
+
+namespace EmuThreads
+{
+	/// <summary>
+	/// <para> Describes how a Thread Pool's Worker Threads behave while they are unable to acquire a task. </para>
+	/// <para> An idle Worker Thread first immediately retries `num_spins` times, then yields its time slice between each of a further `num_yields` retries. </para>
+	/// <para>
+	///		If `may_park` is true, a Worker Thread which is still idle after this is parked, consuming no CPU time until a task is added to its Thread Pool or the Thread Pool closes.
+	///		Otherwise, it continues yielding between retries indefinitely.
+	/// </para>
+	/// <para> Fewer spins and yields reduce CPU time burned while idle, at the cost of higher latency between a task being added and a parked Worker Thread starting it. </para>
+	/// </summary>
+	struct ThreadPoolIdlePolicy
+	{
+		/// <summary> Default number of immediate retries performed by an idle Worker Thread before it starts yielding. </summary>
+		static constexpr std::size_t default_num_spins = 64;
+
+		/// <summary> Default number of yielding retries performed by an idle Worker Thread before it parks. </summary>
+		static constexpr std::size_t default_num_yields = 16;
+
+		/// <summary>
+		/// <para> Creates the default policy, which spins and yields for the default number of retries before parking. </para>
+		/// </summary>
+		constexpr ThreadPoolIdlePolicy() noexcept :
+			ThreadPoolIdlePolicy(default_num_spins, default_num_yields, true)
+		{
+		}
+
+		constexpr ThreadPoolIdlePolicy(const std::size_t num_spins_, const std::size_t num_yields_, const bool may_park_) noexcept :
+			num_spins(num_spins_),
+			num_yields(num_yields_),
+			may_park(may_park_)
+		{
+		}
+
+		/// <summary>
+		/// <para> Policy where idle Worker Threads never yield or park, providing the lowest latency at the cost of fully occupying a core per Worker Thread. </para>
+		/// </summary>
+		[[nodiscard]] static constexpr inline ThreadPoolIdlePolicy Spinning() noexcept
+		{
+			return ThreadPoolIdlePolicy(std::numeric_limits<std::size_t>::max(), 0, false);
+		}
+
+		/// <summary>
+		/// <para> Policy where idle Worker Threads yield between every retry but never park. </para>
+		/// <para> Cores remain occupied by idle Worker Threads unless other threads are waiting to run on them. </para>
+		/// </summary>
+		[[nodiscard]] static constexpr inline ThreadPoolIdlePolicy Yielding() noexcept
+		{
+			return ThreadPoolIdlePolicy(0, std::numeric_limits<std::size_t>::max(), false);
+		}
+
+		/// <summary>
+		/// <para> Policy where idle Worker Threads park after the provided number of spinning and yielding retries. </para>
+		/// <para> With 0 spins and yields, Worker Threads park as soon as they find no work, consuming the least CPU time while idle. </para>
+		/// </summary>
+		[[nodiscard]] static constexpr inline ThreadPoolIdlePolicy Blocking(const std::size_t num_spins_ = default_num_spins, const std::size_t num_yields_ = default_num_yields) noexcept
+		{
+			return ThreadPoolIdlePolicy(num_spins_, num_yields_, true);
+		}
+
+		std::size_t num_spins;
+		std::size_t num_yields;
+		bool may_park;
+	};
+}
+
+#endif
@@ -0,0 +1,212 @@
+#ifndef EMU_THREADS_WORK_STEALING_DEQUE_H_INC_
+#define EMU_THREADS_WORK_STEALING_DEQUE_H_INC_ 1
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace EmuThreads
+{
+	/// <summary>
+	/// <para> Lock-free Chase-Lev deque, owned by a single thread which pushes and takes items at the bottom while any number of other threads steal from the top. </para>
+	/// <para> Push and Take may only be called by the owning thread. Steal, IsEmpty and SizeApprox may be called by any thread. </para>
+	/// <para> Items must be trivially copyable, as they are stored atomically; owning pointers are the intended use case. </para>
+	/// <para>
+	///		Storage grows as needed and never shrinks.
+	///		Outgrown buffers are retained until destruction, as a concurrent Steal may still be reading from them.
+	/// </para>
+	/// </summary>
+	template<class T_>
+	class WorkStealingDeque
+	{
+	public:
+		using value_type = T_;
+		static_assert
+		(
+			std::is_trivially_copyable_v<value_type>,
+			"Invalid T_ provided to EmuThreads::WorkStealingDeque: The type must be trivially copyable."
+		);
+
+		/// <summary> Default capacity of a newly constructed deque. Must be a power of 2. </summary>
+		static constexpr std::size_t default_capacity = 256;
+
+	private:
+		struct circular_buffer
+		{
+			explicit circular_buffer(const std::size_t capacity_) :
+				mask(static_cast<std::int64_t>(capacity_) - 1),
+				items(std::make_unique<std::atomic<value_type>[]>(capacity_))
+			{
+			}
+
+			[[nodiscard]] inline std::int64_t Capacity() const noexcept
+			{
+				return mask + 1;
+			}
+
+			[[nodiscard]] inline value_type Get(const std::int64_t index_) const noexcept
+			{
+				return items[index_ & mask].load(std::memory_order_relaxed);
+			}
+
+			inline void Put(const std::int64_t index_, const value_type& item_) noexcept
+			{
+				items[index_ & mask].store(item_, std::memory_order_relaxed);
+			}
+
+			const std::int64_t mask;
+			std::unique_ptr<std::atomic<value_type>[]> items;
+		};
+
+	public:
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+		WorkStealingDeque(WorkStealingDeque&&) = delete;
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+		WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+		explicit WorkStealingDeque() :
+			WorkStealingDeque(default_capacity)
+		{
+		}
+
+		/// <summary>
+		/// <para> Initialises an empty deque with the specified initial capacity, which is rounded up to a power of 2. </para>
+		/// </summary>
+		/// <param name="initial_capacity_">Number of items that may be stored before this deque first needs to grow.</param>
+		explicit WorkStealingDeque(const std::size_t initial_capacity_) :
+			_top(0),
+			_bottom(0),
+			_buffer(nullptr),
+			_all_buffers()
+		{
+			std::size_t capacity_ = 1;
+			while (capacity_ < initial_capacity_)
+			{
+				capacity_ <<= 1;
+			}
+			_all_buffers.emplace_back(std::make_unique<circular_buffer>(capacity_));
+			_buffer.store(_all_buffers.back().get(), std::memory_order_relaxed);
+		}
+
+		/// <summary>
+		/// <para> Pushes the passed item to the bottom of this deque. </para>
+		/// <para> May only be called by the thread that owns this deque. </para>
+		/// </summary>
+		/// <param name="item_">Item to push.</param>
+		inline void Push(const value_type& item_)
+		{
+			const std::int64_t bottom_ = _bottom.load(std::memory_order_relaxed);
+			const std::int64_t top_ = _top.load(std::memory_order_acquire);
+			circular_buffer* buffer_ = _buffer.load(std::memory_order_relaxed);
+			if (bottom_ - top_ > buffer_->Capacity() - 1)
+			{
+				buffer_ = _grow(buffer_, top_, bottom_);
+			}
+			buffer_->Put(bottom_, item_);
+			_bottom.store(bottom_ + 1, std::memory_order_release);
+		}
+
+		/// <summary>
+		/// <para> Attempts to take the most recently pushed item from the bottom of this deque. </para>
+		/// <para> May only be called by the thread that owns this deque. </para>
+		/// </summary>
+		/// <param name="out_item_">Item to output the taken item to. Only modified if an item is successfully taken.</param>
+		/// <returns>True if an item was taken; otherwise false.</returns>
+		inline bool Take(value_type& out_item_) noexcept
+		{
+			const std::int64_t bottom_ = _bottom.load(std::memory_order_relaxed) - 1;
+			circular_buffer* buffer_ = _buffer.load(std::memory_order_relaxed);
+			_bottom.store(bottom_, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			std::int64_t top_ = _top.load(std::memory_order_relaxed);
+
+			bool taken_ = false;
+			if (top_ <= bottom_)
+			{
+				const value_type item_ = buffer_->Get(bottom_);
+				taken_ = true;
+				if (top_ == bottom_)
+				{
+					// Last item, so race any thieves for it
+					taken_ = _top.compare_exchange_strong(top_, top_ + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+					_bottom.store(bottom_ + 1, std::memory_order_relaxed);
+				}
+
+				if (taken_)
+				{
+					out_item_ = item_;
+				}
+			}
+			else
+			{
+				_bottom.store(bottom_ + 1, std::memory_order_relaxed);
+			}
+			return taken_;
+		}
+
+		/// <summary>
+		/// <para> Attempts to steal the least recently pushed item from the top of this deque. </para>
+		/// <para> May be called by any thread. This may fail spuriously if another thread takes or steals an item at the same time. </para>
+		/// </summary>
+		/// <param name="out_item_">Item to output the stolen item to. Only modified if an item is successfully stolen.</param>
+		/// <returns>True if an item was stolen; otherwise false.</returns>
+		inline bool Steal(value_type& out_item_) noexcept
+		{
+			std::int64_t top_ = _top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const std::int64_t bottom_ = _bottom.load(std::memory_order_acquire);
+			if (top_ < bottom_)
+			{
+				const value_type item_ = _buffer.load(std::memory_order_acquire)->Get(top_);
+				if (_top.compare_exchange_strong(top_, top_ + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					out_item_ = item_;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/// <summary>
+		/// <para> Returns the number of items in this deque at the time of calling. </para>
+		/// <para> If called by a thread other than the owner, this is only an estimate as items may be pushed, taken or stolen concurrently. </para>
+		/// </summary>
+		[[nodiscard]] inline std::size_t SizeApprox() const noexcept
+		{
+			const std::int64_t bottom_ = _bottom.load(std::memory_order_acquire);
+			const std::int64_t top_ = _top.load(std::memory_order_acquire);
+			return bottom_ > top_ ? static_cast<std::size_t>(bottom_ - top_) : 0;
+		}
+
+		[[nodiscard]] inline bool IsEmpty() const noexcept
+		{
+			return SizeApprox() == 0;
+		}
+
+	private:
+		inline circular_buffer* _grow(circular_buffer* old_buffer_, const std::int64_t top_, const std::int64_t bottom_)
+		{
+			auto new_buffer_ = std::make_unique<circular_buffer>(static_cast<std::size_t>(old_buffer_->Capacity()) * 2);
+			for (std::int64_t i = top_; i < bottom_; ++i)
+			{
+				new_buffer_->Put(i, old_buffer_->Get(i));
+			}
+			circular_buffer* p_new_buffer_ = new_buffer_.get();
+			_all_buffers.emplace_back(std::move(new_buffer_));
+			_buffer.store(p_new_buffer_, std::memory_order_release);
+			return p_new_buffer_;
+		}
+
+		// Top and bottom are separated to avoid thieves and the owner sharing a cache line
+		alignas(64) std::atomic<std::int64_t> _top;
+		alignas(64) std::atomic<std::int64_t> _bottom;
+		std::atomic<circular_buffer*> _buffer;
+		std::vector<std::unique_ptr<circular_buffer>> _all_buffers;
+	};
+}
+
+#endif
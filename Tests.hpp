@@ -11,14 +11,22 @@
 
 // ADDITIONAL INCLUDES
 #include "EmuMath/FastMatrix.h"
+#include "EmuMath/FastNoise.h"
+#include "EmuMath/FastRandom.h"
 #include "EmuMath/FastQuaternion.h"
 #include "EmuMath/FastVector.h"
 #include "EmuMath/Matrix.h"
 #include "EmuMath/Vector.h"
 #include "EmuMath/Random.h"
 #include "EmuMath/Quaternion.h"
+#include "EmuThreads/BasicThreadPool.h"
+#include "EmuThreads/ParallelAlgorithms.h"
+#include "EmuThreads/TaskGraph.h"
 #include <bitset>
+#include <ctime>
+#include <memory>
 #include <string_view>
+#include <thread>
 
 #if defined(WIN32) || defined(WIN64) || defined(_WIN32) || defined(_WIN64)
 #define USE_DIRECTX_TESTS 1
@@ -1017,6 +1025,1111 @@ namespace EmuCore::TestingHelpers
 	};
 #pragma endregion
 
+#pragma region EMU_THREADS
+	/// <summary>
+	/// <para> Measures the latency between a task being added to an idle BasicThreadPool and a Worker Thread starting it, with Worker Threads idling under IdlePolicy_. </para>
+	/// <para>
+	///		Each loop sleeps for idle_gap before submitting, so that Worker Threads have exhausted their spins and yields as they would between bursts of work.
+	///		As such, harness timings include the gap; the submit-to-start latencies and the CPU time burned across all loops are output by OnTestsOver.
+	/// </para>
+	/// </summary>
+	template<EmuThreads::ThreadPoolIdlePolicy IdlePolicy_>
+	struct ThreadPoolSubmitToStartTest
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 2000;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+
+		using clock_type = std::chrono::steady_clock;
+		using pool_type = EmuThreads::BasicThreadPool<std::function<void()>>;
+		static constexpr std::chrono::microseconds idle_gap = std::chrono::microseconds(500);
+
+		ThreadPoolSubmitToStartTest()
+		{
+		}
+		void Prepare()
+		{
+			latencies.resize(NUM_LOOPS);
+			num_worker_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1;
+		}
+		void operator()(std::size_t i_)
+		{
+			if (i_ == 0)
+			{
+				// Pool is created here rather than in Prepare, as spinning pools would otherwise burn CPU throughout other tests
+				pool = std::make_unique<pool_type>(num_worker_threads, IdlePolicy_);
+				begin_cpu_time = std::clock();
+				begin_wall_time = clock_type::now();
+			}
+
+			std::this_thread::sleep_for(idle_gap);
+			started.store(false, std::memory_order_relaxed);
+			const clock_type::time_point submit_time_ = clock_type::now();
+			pool->template AddTaskToQueue<false>
+			(
+				[this]()
+				{
+					start_time = clock_type::now();
+					started.store(true, std::memory_order_release);
+				}
+			);
+			while (!started.load(std::memory_order_acquire))
+			{
+				std::this_thread::yield();
+			}
+			latencies[i_] = std::chrono::duration<double, std::micro>(start_time - submit_time_).count();
+
+			if (i_ == (NUM_LOOPS - 1))
+			{
+				// std::clock provides process CPU time on POSIX systems, but wall time with MSVC
+				end_cpu_time = std::clock();
+				end_wall_time = clock_type::now();
+				pool.reset();
+			}
+		}
+		void OnTestsOver()
+		{
+			std::vector<double> sorted_ = latencies;
+			std::sort(sorted_.begin(), sorted_.end());
+			const double cpu_ms_ = 1000.0 * static_cast<double>(end_cpu_time - begin_cpu_time) / CLOCKS_PER_SEC;
+			const double wall_ms_ = std::chrono::duration<double, std::milli>(end_wall_time - begin_wall_time).count();
+			std::cout << "Worker Threads: " << num_worker_threads << "\n";
+			std::cout << "Submit-to-start latency (us): min " << sorted_.front() << ", median " << sorted_[NUM_LOOPS / 2];
+			std::cout << ", p99 " << sorted_[(NUM_LOOPS * 99) / 100] << ", max " << sorted_.back() << "\n";
+			std::cout << "CPU time: " << cpu_ms_ << "ms over " << wall_ms_ << "ms of wall time\n";
+		}
+
+		std::vector<double> latencies;
+		std::size_t num_worker_threads;
+		std::unique_ptr<pool_type> pool;
+		std::atomic<bool> started;
+		clock_type::time_point start_time;
+		std::clock_t begin_cpu_time;
+		std::clock_t end_cpu_time;
+		clock_type::time_point begin_wall_time;
+		clock_type::time_point end_wall_time;
+	};
+
+	struct ThreadPoolSpinningSubmitToStart : public ThreadPoolSubmitToStartTest<EmuThreads::ThreadPoolIdlePolicy::Spinning()>
+	{
+		static constexpr std::string_view NAME = "BasicThreadPool Submit-To-Start (Spinning)";
+	};
+
+	struct ThreadPoolYieldingSubmitToStart : public ThreadPoolSubmitToStartTest<EmuThreads::ThreadPoolIdlePolicy::Yielding()>
+	{
+		static constexpr std::string_view NAME = "BasicThreadPool Submit-To-Start (Yielding)";
+	};
+
+	struct ThreadPoolBlockingSubmitToStart : public ThreadPoolSubmitToStartTest<EmuThreads::ThreadPoolIdlePolicy::Blocking()>
+	{
+		static constexpr std::string_view NAME = "BasicThreadPool Submit-To-Start (Blocking)";
+	};
+
+	struct ThreadPoolImmediateParkSubmitToStart : public ThreadPoolSubmitToStartTest<EmuThreads::ThreadPoolIdlePolicy::Blocking(0, 0)>
+	{
+		static constexpr std::string_view NAME = "BasicThreadPool Submit-To-Start (Blocking, no spins or yields)";
+	};
+
+	/// <summary>
+	/// <para> Measures submitting tasks to a shared BasicThreadPool from several producer threads at once, where every such task submits a further task from within the pool. </para>
+	/// <para>
+	///		This exercises the injection queue, Worker Threads' own deques, and stealing between them. Every task records its executions,
+	///		and the number of tasks which did not execute exactly once across all loops is output by OnTestsOver.
+	/// </para>
+	/// </summary>
+	struct ThreadPoolExactlyOnceTest
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 200;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+		static constexpr std::string_view NAME = "BasicThreadPool Exactly-Once Execution";
+
+		using pool_type = EmuThreads::BasicThreadPool<std::function<void()>>;
+		static constexpr std::size_t num_producers = 4;
+		static constexpr std::size_t tasks_per_producer = 512;
+		/// <summary> Tasks submitted by producers occupy the first half of the IDs, and the tasks they submit from within the pool occupy the second half. </summary>
+		static constexpr std::size_t num_submitted_tasks = num_producers * tasks_per_producer;
+		static constexpr std::size_t num_tasks = num_submitted_tasks * 2;
+
+		ThreadPoolExactlyOnceTest()
+		{
+		}
+		void Prepare()
+		{
+			pool = std::make_unique<pool_type>(std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1);
+			run_counts = std::make_unique<std::atomic<std::uint32_t>[]>(num_tasks);
+			num_incorrect_runs = 0;
+		}
+		void operator()(std::size_t i_)
+		{
+			for (std::size_t task_id_ = 0; task_id_ < num_tasks; ++task_id_)
+			{
+				run_counts[task_id_].store(0, std::memory_order_relaxed);
+			}
+			num_finished_tasks.store(0, std::memory_order_relaxed);
+
+			std::vector<std::thread> producers_;
+			producers_.reserve(num_producers);
+			for (std::size_t producer_index_ = 0; producer_index_ < num_producers; ++producer_index_)
+			{
+				producers_.emplace_back
+				(
+					[this, producer_index_]()
+					{
+						for (std::size_t i = 0; i < tasks_per_producer; ++i)
+						{
+							const std::size_t task_id_ = (producer_index_ * tasks_per_producer) + i;
+							pool->template AddTaskToQueue<false>
+							(
+								[this, task_id_]()
+								{
+									pool->template AddTaskToQueue<false>([this, task_id_]() { _record_run(task_id_ + num_submitted_tasks); });
+									_record_run(task_id_);
+								}
+							);
+						}
+					}
+				);
+			}
+			for (auto& producer_ : producers_)
+			{
+				producer_.join();
+			}
+
+			auto all_finished_ = [this]() { return num_finished_tasks.load(std::memory_order_acquire) == num_tasks; };
+			while (!all_finished_())
+			{
+				if (!pool->UseThisThreadForCurrentQueue(all_finished_) && !all_finished_())
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			for (std::size_t task_id_ = 0; task_id_ < num_tasks; ++task_id_)
+			{
+				if (run_counts[task_id_].load(std::memory_order_relaxed) != 1)
+				{
+					++num_incorrect_runs;
+				}
+			}
+
+			if (i_ == (NUM_LOOPS - 1))
+			{
+				pool.reset();
+			}
+		}
+		void OnTestsOver()
+		{
+			std::cout << "Tasks per loop: " << num_tasks << " (" << num_submitted_tasks << " from " << num_producers << " producers, " << num_submitted_tasks << " from within the pool)\n";
+			std::cout << "Tasks not executed exactly once: " << num_incorrect_runs << "\n";
+		}
+
+		std::unique_ptr<pool_type> pool;
+		std::unique_ptr<std::atomic<std::uint32_t>[]> run_counts;
+		std::atomic<std::size_t> num_finished_tasks;
+		std::size_t num_incorrect_runs = 0;
+
+	private:
+		inline void _record_run(const std::size_t task_id_)
+		{
+			run_counts[task_id_].fetch_add(1, std::memory_order_relaxed);
+			num_finished_tasks.fetch_add(1, std::memory_order_release);
+		}
+	};
+
+	/// <summary>
+	/// <para> Measures running a diamond-shaped TaskGraph (top -> left, right -> bottom) on a shared BasicThreadPool, reusing the same graph every loop. </para>
+	/// <para>
+	///		Each node records the order in which it executed, and the number of runs which executed a node before any of its predecessors is output by OnTestsOver.
+	///		Also outputs whether running a graph containing a cycle was rejected.
+	/// </para>
+	/// </summary>
+	struct ThreadPoolTaskGraphTest
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 5000;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+		static constexpr std::string_view NAME = "TaskGraph Diamond Dependency Order";
+
+		using pool_type = EmuThreads::BasicThreadPool<std::function<void()>>;
+		static constexpr std::size_t top_index = 0;
+		static constexpr std::size_t left_index = 1;
+		static constexpr std::size_t right_index = 2;
+		static constexpr std::size_t bottom_index = 3;
+		static constexpr std::size_t num_nodes = 4;
+
+		ThreadPoolTaskGraphTest()
+		{
+		}
+		void Prepare()
+		{
+			pool = std::make_unique<pool_type>(std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1);
+			graph = std::make_unique<EmuThreads::TaskGraph>();
+			const auto top_ = graph->AddNode([this]() { _record_execution(top_index); });
+			const auto left_ = graph->AddNode([this]() { _record_execution(left_index); }, { top_ });
+			const auto right_ = graph->AddNode([this]() { _record_execution(right_index); }, { top_ });
+			graph->AddNode([this]() { _record_execution(bottom_index); }, { left_, right_ });
+			num_out_of_order_runs = 0;
+			num_incomplete_runs = 0;
+			cycle_rejected = false;
+		}
+		void operator()(std::size_t i_)
+		{
+			execution_orders.fill(num_nodes);
+			next_execution_order.store(0, std::memory_order_relaxed);
+			graph->RunAndWait(*pool);
+
+			// With exactly num_nodes executions, any node executed more than once leaves another node's order unrecorded
+			const bool all_executed_ = std::find(execution_orders.begin(), execution_orders.end(), num_nodes) == execution_orders.end();
+			if (next_execution_order.load(std::memory_order_relaxed) != num_nodes || !all_executed_)
+			{
+				++num_incomplete_runs;
+			}
+			else
+			{
+				const bool in_order_ =
+				(
+					execution_orders[top_index] < execution_orders[left_index] &&
+					execution_orders[top_index] < execution_orders[right_index] &&
+					execution_orders[left_index] < execution_orders[bottom_index] &&
+					execution_orders[right_index] < execution_orders[bottom_index]
+				);
+				if (!in_order_)
+				{
+					++num_out_of_order_runs;
+				}
+			}
+
+			if (i_ == (NUM_LOOPS - 1))
+			{
+				EmuThreads::TaskGraph cyclic_graph_;
+				const auto first_ = cyclic_graph_.AddNode([]() {});
+				const auto second_ = cyclic_graph_.AddNode([]() {}, { first_ });
+				cyclic_graph_.AddDependency(second_, first_);
+				try
+				{
+					cyclic_graph_.Run(*pool);
+					cyclic_graph_.Wait();
+				}
+				catch (const std::logic_error&)
+				{
+					cycle_rejected = true;
+				}
+
+				graph.reset();
+				pool.reset();
+			}
+		}
+		void OnTestsOver()
+		{
+			std::cout << "Runs with a node executed before its predecessors: " << num_out_of_order_runs << "\n";
+			std::cout << "Runs with nodes not executed exactly once: " << num_incomplete_runs << "\n";
+			std::cout << "Cyclic graph rejected: " << (cycle_rejected ? "true" : "false") << "\n";
+		}
+
+		std::unique_ptr<pool_type> pool;
+		std::unique_ptr<EmuThreads::TaskGraph> graph;
+		std::array<std::size_t, num_nodes> execution_orders = {};
+		std::atomic<std::size_t> next_execution_order;
+		std::size_t num_out_of_order_runs = 0;
+		std::size_t num_incomplete_runs = 0;
+		bool cycle_rejected = false;
+
+	private:
+		inline void _record_execution(const std::size_t node_index_)
+		{
+			execution_orders[node_index_] = next_execution_order.fetch_add(1, std::memory_order_relaxed);
+		}
+	};
+
+	/// <summary>
+	/// <para> Measures submitting tasks with futures to a BasicThreadPool of InlineTasks, with half of all tasks too large to be stored inline. </para>
+	/// <para>
+	///		Outputs the number of incorrect results, and the number of large callables left alive after every task and future is destroyed (which should be 0).
+	///		Also outputs whether a TaskPromise destroyed without a result gave its future a std::future_error with the broken_promise error code.
+	/// </para>
+	/// </summary>
+	struct ThreadPoolInlineTaskTest
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 500;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+		static constexpr std::string_view NAME = "BasicThreadPool InlineTask Futures";
+
+		using task_type = EmuThreads::InlineTask<std::size_t()>;
+		using pool_type = EmuThreads::BasicThreadPool<task_type>;
+		static constexpr std::size_t num_tasks_per_size = 512;
+
+		/// <summary> Callable too large to be stored inline, which tracks how many instances of itself are alive. </summary>
+		struct large_callable
+		{
+			large_callable(std::size_t value_, std::atomic<std::ptrdiff_t>& num_alive_) : value(value_), padding(), p_num_alive(&num_alive_)
+			{
+				p_num_alive->fetch_add(1, std::memory_order_relaxed);
+			}
+			large_callable(const large_callable& to_copy_) : value(to_copy_.value), padding(to_copy_.padding), p_num_alive(to_copy_.p_num_alive)
+			{
+				p_num_alive->fetch_add(1, std::memory_order_relaxed);
+			}
+			~large_callable()
+			{
+				p_num_alive->fetch_sub(1, std::memory_order_relaxed);
+			}
+			std::size_t operator()() const
+			{
+				return value + padding.back();
+			}
+
+			std::size_t value;
+			std::array<std::size_t, 32> padding;
+			std::atomic<std::ptrdiff_t>* p_num_alive;
+		};
+		static_assert(!task_type::is_stored_inline<large_callable>, "ThreadPoolInlineTaskTest requires a callable which is stored on the heap.");
+
+		ThreadPoolInlineTaskTest()
+		{
+		}
+		void Prepare()
+		{
+			pool = std::make_unique<pool_type>(std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1);
+			futures.reserve(num_tasks_per_size * 2);
+			num_large_callables_alive.store(0, std::memory_order_relaxed);
+			num_incorrect_results = 0;
+			broken_promise_reported = false;
+		}
+		void operator()(std::size_t i_)
+		{
+			for (std::size_t task_index_ = 0; task_index_ < num_tasks_per_size; ++task_index_)
+			{
+				futures.emplace_back(pool->template AddTaskToQueue<true>([task_index_]() { return task_index_ * 2; }));
+				futures.emplace_back(pool->template AddTaskToQueue<true>(large_callable((task_index_ * 2) + 1, num_large_callables_alive)));
+			}
+
+			for (std::size_t future_index_ = 0; future_index_ < futures.size(); ++future_index_)
+			{
+				if (futures[future_index_].get() != future_index_)
+				{
+					++num_incorrect_results;
+				}
+			}
+			futures.clear();
+
+			if (i_ == (NUM_LOOPS - 1))
+			{
+				pool.reset();
+
+				EmuThreads::TaskFuture<std::size_t> abandoned_future_;
+				{
+					EmuThreads::TaskPromise<std::size_t> abandoned_promise_;
+					abandoned_future_ = abandoned_promise_.get_future();
+				}
+				try
+				{
+					abandoned_future_.get();
+				}
+				catch (const std::future_error& error_)
+				{
+					broken_promise_reported = error_.code() == std::future_errc::broken_promise;
+				}
+			}
+		}
+		void OnTestsOver()
+		{
+			std::cout << "Incorrect results: " << num_incorrect_results << "\n";
+			std::cout << "Heap-stored callables still alive: " << num_large_callables_alive.load(std::memory_order_relaxed) << "\n";
+			std::cout << "Abandoned TaskPromise reported broken_promise: " << (broken_promise_reported ? "true" : "false") << "\n";
+		}
+
+		std::unique_ptr<pool_type> pool;
+		std::vector<typename pool_type::future_type> futures;
+		std::atomic<std::ptrdiff_t> num_large_callables_alive;
+		std::size_t num_incorrect_results = 0;
+		bool broken_promise_reported = false;
+	};
+
+	/// <summary>
+	/// <para> Measures EmuThreads::parallel_reduce with every ParallelChunking mode, with both the default grain size and a small explicit grain size. </para>
+	/// <para>
+	///		Two reductions are checked against serial results: a sum, and a product of 2x2 matrices, which is associative but not commutative
+	///		and so also checks that accumulators are combined in index order. Both wrap modulo 2^64, so results must match exactly.
+	///		The number of mismatching reductions is output by OnTestsOver.
+	/// </para>
+	/// </summary>
+	struct ParallelReduceTest
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 200;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+		static constexpr std::string_view NAME = "EmuThreads::parallel_reduce vs Serial";
+
+		using pool_type = EmuThreads::BasicThreadPool<std::function<void()>>;
+		using matrix_type = std::array<std::uint64_t, 4>;
+		static constexpr std::size_t begin_index = 3;
+		static constexpr std::size_t end_index = 100003;
+		static constexpr std::size_t small_grain_size = 7;
+
+		ParallelReduceTest()
+		{
+		}
+		void Prepare()
+		{
+			pool = std::make_unique<pool_type>(std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1);
+			serial_sum = 0;
+			serial_product = matrix_identity;
+			for (std::size_t i = begin_index; i < end_index; ++i)
+			{
+				serial_sum = sum_combine(serial_sum, sum_transform(i));
+				serial_product = product_combine(serial_product, product_transform(i));
+			}
+			num_mismatches = 0;
+			num_reductions = 0;
+		}
+		void operator()(std::size_t i_)
+		{
+			_check<EmuThreads::ParallelChunking::STATIC>();
+			_check<EmuThreads::ParallelChunking::DYNAMIC>();
+			_check<EmuThreads::ParallelChunking::GUIDED>();
+
+			if (i_ == (NUM_LOOPS - 1))
+			{
+				pool.reset();
+			}
+		}
+		void OnTestsOver()
+		{
+			std::cout << "Mismatching reductions: " << num_mismatches << " / " << num_reductions << "\n";
+		}
+
+		static constexpr matrix_type matrix_identity = { 1, 0, 0, 1 };
+
+		static inline std::uint64_t sum_transform(const std::size_t i_)
+		{
+			return static_cast<std::uint64_t>(i_) * static_cast<std::uint64_t>(i_) * 0x9E3779B97F4A7C15ULL;
+		}
+		static inline std::uint64_t sum_combine(const std::uint64_t lhs_, const std::uint64_t rhs_)
+		{
+			return lhs_ + rhs_;
+		}
+		static inline matrix_type product_transform(const std::size_t i_)
+		{
+			return matrix_type({ static_cast<std::uint64_t>(i_) | 1, 1, static_cast<std::uint64_t>(i_) >> 1, 1 });
+		}
+		static inline matrix_type product_combine(const matrix_type& lhs_, const matrix_type& rhs_)
+		{
+			return matrix_type
+			({
+				(lhs_[0] * rhs_[0]) + (lhs_[1] * rhs_[2]),
+				(lhs_[0] * rhs_[1]) + (lhs_[1] * rhs_[3]),
+				(lhs_[2] * rhs_[0]) + (lhs_[3] * rhs_[2]),
+				(lhs_[2] * rhs_[1]) + (lhs_[3] * rhs_[3])
+			});
+		}
+
+		std::unique_ptr<pool_type> pool;
+		std::uint64_t serial_sum = 0;
+		matrix_type serial_product = matrix_identity;
+		std::size_t num_mismatches = 0;
+		std::size_t num_reductions = 0;
+
+	private:
+		template<EmuThreads::ParallelChunking Chunking_>
+		inline void _check()
+		{
+			for (const std::size_t grain_size_ : { std::size_t(0), small_grain_size })
+			{
+				const std::uint64_t sum_ = EmuThreads::parallel_reduce<Chunking_>
+				(
+					*pool, begin_index, end_index, grain_size_, std::uint64_t(0), &sum_transform, &sum_combine
+				);
+				const matrix_type product_ = EmuThreads::parallel_reduce<Chunking_>
+				(
+					*pool, begin_index, end_index, grain_size_, matrix_identity, &product_transform, &product_combine
+				);
+				num_mismatches += static_cast<std::size_t>(sum_ != serial_sum) + static_cast<std::size_t>(product_ != serial_product);
+				num_reductions += 2;
+			}
+		}
+	};
+#pragma endregion
+
+#pragma region EMU_NOISE
+	/// <summary> Options shared by noise tests, using a fixed seed so that every table generated from them is identical. </summary>
+	[[nodiscard]] inline EmuMath::NoiseTableOptions<3, float> make_noise_test_options()
+	{
+		EmuMath::NoiseTableOptions<3, float> options_;
+		options_.table_resolution = EmuMath::Vector<3, std::size_t>(128, 128, 32);
+		options_.start_point = EmuMath::Vector<3, float>(0.37f, 1.1f, 2.9f);
+		options_.freq = 7.5f;
+		options_.use_fractal_noise = true;
+		options_.permutation_info.shuffle_mode = EmuMath::Info::NoisePermutationShuffleMode::SEED_32;
+		options_.permutation_info.seed_32 = static_cast<std::uint32_t>(shared_fill_seed_);
+		return options_;
+	}
+
+	/// <summary> Counts the samples which differ between two 3-dimensional noise tables of the same size. </summary>
+	template<class LhsTable_, class RhsTable_>
+	[[nodiscard]] inline std::size_t count_noise_table_mismatches(const LhsTable_& lhs_, const RhsTable_& rhs_)
+	{
+		std::size_t num_mismatches_ = 0;
+		const auto size_ = lhs_.size();
+		for (std::size_t x = 0; x < size_.template at<0>(); ++x)
+		{
+			for (std::size_t y = 0; y < size_.template at<1>(); ++y)
+			{
+				for (std::size_t z = 0; z < size_.template at<2>(); ++z)
+				{
+					if (lhs_(x, y, z) != rhs_(x, y, z))
+					{
+						++num_mismatches_;
+					}
+				}
+			}
+		}
+		return num_mismatches_;
+	}
+
+	/// <summary>
+	/// <para> Measures generating a FastNoiseTable in parallel with a persistent BasicThreadPool. </para>
+	/// <para> The final loop's table is compared against the same table generated serially, and the number of differing samples is output by OnTestsOver. </para>
+	/// </summary>
+	struct FastNoiseParallelGenerationTest
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 100;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+		static constexpr std::string_view NAME = "FastNoiseTable Parallel Generation";
+
+		using table_type = EmuMath::FastNoiseTable<3, 2>;
+		using pool_type = EmuThreads::BasicThreadPool<std::function<void()>>;
+		static constexpr EmuMath::NoiseType noise_type = EmuMath::NoiseType::PERLIN;
+
+		FastNoiseParallelGenerationTest()
+		{
+		}
+		void Prepare()
+		{
+			serial_table.template GenerateNoise<noise_type>(options);
+			pool = std::make_unique<pool_type>(std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1);
+		}
+		void operator()(std::size_t i_)
+		{
+			generated = table.template GenerateNoiseParallel<noise_type>(*pool, options);
+			if (i_ == (NUM_LOOPS - 1))
+			{
+				num_mismatches = count_noise_table_mismatches(table, serial_table);
+				pool.reset();
+			}
+		}
+		void OnTestsOver()
+		{
+			std::cout << "Generated: " << (generated ? "true" : "false") << "\n";
+			std::cout << "Samples differing from serial generation: " << num_mismatches << "\n";
+		}
+
+		EmuMath::NoiseTableOptions<3, float> options = make_noise_test_options();
+		table_type table;
+		table_type serial_table;
+		std::unique_ptr<pool_type> pool;
+		bool generated = false;
+		std::size_t num_mismatches = 0;
+	};
+
+	/// <summary>
+	/// <para> Measures generating a FastNoiseTable using FLAT storage. </para>
+	/// <para> The final loop's table is compared against the same table using NESTED storage, and the number of differing samples is output by OnTestsOver. </para>
+	/// </summary>
+	struct FastNoiseFlatStorageTest
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 100;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+		static constexpr std::string_view NAME = "FastNoiseTable FLAT Storage Generation";
+
+		using flat_table_type = EmuMath::FastNoiseTable<3, 0, EmuMath::NoiseTableStorageMode::FLAT>;
+		using nested_table_type = EmuMath::FastNoiseTable<3, 0, EmuMath::NoiseTableStorageMode::NESTED>;
+		static constexpr EmuMath::NoiseType noise_type = EmuMath::NoiseType::SIMPLEX;
+
+		FastNoiseFlatStorageTest()
+		{
+		}
+		void Prepare()
+		{
+			nested_table.template GenerateNoise<noise_type>(options);
+		}
+		void operator()(std::size_t i_)
+		{
+			generated = flat_table.template GenerateNoise<noise_type>(options);
+			if (i_ == (NUM_LOOPS - 1))
+			{
+				num_mismatches = count_noise_table_mismatches(flat_table, nested_table);
+			}
+		}
+		void OnTestsOver()
+		{
+			std::cout << "Generated: " << (generated ? "true" : "false") << "\n";
+			std::cout << "Samples differing from NESTED storage: " << num_mismatches << "\n";
+		}
+
+		EmuMath::NoiseTableOptions<3, float> options = make_noise_test_options();
+		flat_table_type flat_table;
+		nested_table_type nested_table;
+		bool generated = false;
+		std::size_t num_mismatches = 0;
+	};
+
+	/// <summary>
+	/// <para> Measures regenerating a region of a FastNoiseTable which was previously generated with different options. </para>
+	/// <para>
+	///		After the final loop, samples within the region are compared against a table fully generated with the new options,
+	///		and samples outside of it against the table's previous samples. The number of differing samples is output by OnTestsOver.
+	/// </para>
+	/// </summary>
+	struct FastNoiseRegionGenerationTest
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 1000;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+		static constexpr std::string_view NAME = "FastNoiseTable Region Regeneration";
+
+		using table_type = EmuMath::FastNoiseTable<3, 2, EmuMath::NoiseTableStorageMode::FLAT>;
+		using coordinate_type = typename table_type::coordinate_type;
+		static constexpr EmuMath::NoiseType noise_type = EmuMath::NoiseType::PERLIN;
+
+		FastNoiseRegionGenerationTest()
+		{
+		}
+		void Prepare()
+		{
+			EmuMath::NoiseTableOptions<3, float> previous_options_ = options;
+			previous_options_.freq *= 0.5f;
+			previous_table.template GenerateNoise<noise_type>(previous_options_);
+			full_table.template GenerateNoise<noise_type>(options);
+			table = previous_table;
+		}
+		void operator()(std::size_t i_)
+		{
+			generated = table.template GenerateNoiseRegion<noise_type>(options, region_begin, region_end);
+			if (i_ == (NUM_LOOPS - 1))
+			{
+				num_mismatches = _count_mismatches();
+			}
+		}
+		void OnTestsOver()
+		{
+			std::cout << "Generated: " << (generated ? "true" : "false") << "\n";
+			std::cout << "Samples differing from full generation within the region, or from previous samples outside of it: " << num_mismatches << "\n";
+		}
+
+		EmuMath::NoiseTableOptions<3, float> options = make_noise_test_options();
+		coordinate_type region_begin = coordinate_type(16, 37, 5);
+		coordinate_type region_end = coordinate_type(81, 96, 27);
+		table_type table;
+		table_type full_table;
+		table_type previous_table;
+		bool generated = false;
+		std::size_t num_mismatches = 0;
+
+	private:
+		[[nodiscard]] inline std::size_t _count_mismatches() const
+		{
+			std::size_t num_mismatches_ = 0;
+			const coordinate_type size_ = table.size();
+			for (std::size_t x = 0; x < size_.template at<0>(); ++x)
+			{
+				for (std::size_t y = 0; y < size_.template at<1>(); ++y)
+				{
+					for (std::size_t z = 0; z < size_.template at<2>(); ++z)
+					{
+						const bool in_region_ =
+						(
+							x >= region_begin.template at<0>() && x < region_end.template at<0>() &&
+							y >= region_begin.template at<1>() && y < region_end.template at<1>() &&
+							z >= region_begin.template at<2>() && z < region_end.template at<2>()
+						);
+						const float expected_ = in_region_ ? full_table(x, y, z) : previous_table(x, y, z);
+						if (table(x, y, z) != expected_)
+						{
+							++num_mismatches_;
+						}
+					}
+				}
+			}
+			return num_mismatches_;
+		}
+	};
+
+	/// <summary>
+	/// <para> Measures generating a FastNoiseTable alongside its gradient, over a region of negative coordinates. </para>
+	/// <para>
+	///		After the final loop, each sample and gradient is compared against the scalar make_noise_3d_derivatives functor at the same point,
+	///		and the greatest absolute difference is output by OnTestsOver. Differences should be limited to floating-point rounding of sample points.
+	/// </para>
+	/// </summary>
+	struct FastNoiseNegativeGradientTest
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 100;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+		static constexpr std::string_view NAME = "FastNoiseTable Gradient Generation (Negative Coordinates)";
+
+		using table_type = EmuMath::FastNoiseTable<3, 0>;
+		static constexpr EmuMath::NoiseType noise_type = EmuMath::NoiseType::PERLIN;
+
+		FastNoiseNegativeGradientTest()
+		{
+		}
+		void Prepare()
+		{
+			options.table_resolution = EmuMath::Vector<3, std::size_t>(64, 32, 48);
+			options.start_point = EmuMath::Vector<3, float>(-9.3f, -0.7f, -13.1f);
+			options.end_point_or_step = EmuMath::Vector<3, float>(0.11f, 0.13f, 0.07f);
+			options.step_mode = true;
+			options.freq = 1.9f;
+			options.use_fractal_noise = false;
+		}
+		void operator()(std::size_t i_)
+		{
+			generated = table.template GenerateNoiseWithGradient<noise_type>(options, gradient_x, gradient_y, gradient_z);
+			if (i_ == (NUM_LOOPS - 1))
+			{
+				max_difference = _find_max_difference();
+			}
+		}
+		void OnTestsOver()
+		{
+			std::cout << "Generated: " << (generated ? "true" : "false") << "\n";
+			std::cout << "Greatest difference from scalar derivatives: " << max_difference << "\n";
+		}
+
+		EmuMath::NoiseTableOptions<3, float> options = make_noise_test_options();
+		table_type table;
+		table_type gradient_x;
+		table_type gradient_y;
+		table_type gradient_z;
+		bool generated = false;
+		float max_difference = 0.0f;
+
+	private:
+		[[nodiscard]] inline float _find_max_difference() const
+		{
+			const EmuMath::NoisePermutations permutations_ = options.permutation_info.MakePermutations();
+			const EmuMath::Functors::make_noise_3d_derivatives<noise_type, float> derivatives_func_;
+			const EmuMath::Vector<3, float> step_ = options.MakeStep();
+			const auto size_ = table.size();
+
+			float max_difference_ = 0.0f;
+			for (std::size_t x = 0; x < size_.template at<0>(); ++x)
+			{
+				for (std::size_t y = 0; y < size_.template at<1>(); ++y)
+				{
+					for (std::size_t z = 0; z < size_.template at<2>(); ++z)
+					{
+						const EmuMath::Vector<3, float> point_
+						(
+							options.start_point.template at<0>() + (static_cast<float>(x) * step_.template at<0>()),
+							options.start_point.template at<1>() + (static_cast<float>(y) * step_.template at<1>()),
+							options.start_point.template at<2>() + (static_cast<float>(z) * step_.template at<2>())
+						);
+						const auto expected_ = derivatives_func_(point_, options.freq, permutations_);
+						const float differences_[4] =
+						{
+							std::abs(table(x, y, z) - expected_.template at<0>()),
+							std::abs(gradient_x(x, y, z) - expected_.template at<1>()),
+							std::abs(gradient_y(x, y, z) - expected_.template at<2>()),
+							std::abs(gradient_z(x, y, z) - expected_.template at<3>())
+						};
+						for (const float difference_ : differences_)
+						{
+							// Negated comparison so that NaNs are reported rather than ignored
+							if (!(difference_ <= max_difference_))
+							{
+								max_difference_ = difference_;
+							}
+						}
+					}
+				}
+			}
+			return max_difference_;
+		}
+	};
+
+	/// <summary>
+	/// <para> Measures evaluating the 3-dimensional SIMD noise functor for NoiseType_ over a spread of points, including negative points, with 128- and 256-bit registers. </para>
+	/// <para>
+	///		The final loop's results are compared against the scalar noise functor for NoiseType_ evaluated in double precision,
+	///		and the greatest difference (alongside whether it is within max_error) is output by OnTestsOver.
+	/// </para>
+	/// </summary>
+	template<EmuMath::NoiseType NoiseType_>
+	struct FastNoiseScalarComparisonTest
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 100;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+		static constexpr std::string_view NAME = NoiseType_ == EmuMath::NoiseType::SIMPLEX ?
+			"make_fast_noise_3d vs Scalar make_noise_3d (Simplex)" :
+			"make_fast_noise_3d vs Scalar make_noise_3d (Cellular)";
+
+		static constexpr EmuMath::NoiseType noise_type = NoiseType_;
+		static constexpr std::size_t num_points = 8192;
+		static constexpr float freq = 1.0f;
+		/// <summary>
+		/// <para> Greatest difference from the scalar functor that is considered correct, allowing for the SIMD functor's single-precision arithmetic. </para>
+		/// <para> Cellular noise only outputs a distance, without simplex noise's gradients and falloffs, so is held to a far tighter bound. </para>
+		/// </summary>
+		static constexpr float max_error = NoiseType_ == EmuMath::NoiseType::SIMPLEX ? 5.0e-6f : 1.2e-7f;
+
+		FastNoiseScalarComparisonTest()
+		{
+		}
+		void Prepare()
+		{
+			xs.resize(num_points);
+			ys.resize(num_points);
+			zs.resize(num_points);
+			results_128.resize(num_points);
+			results_256.resize(num_points);
+			expected.resize(num_points);
+
+			const EmuMath::noise_gen_functor<3, noise_type, double> scalar_func_;
+			// Points stay within roughly 12 units of the origin at a frequency of 1, so that differences reflect each functor's arithmetic rather than float rounding of large coordinates
+			for (std::size_t i = 0; i < num_points; ++i)
+			{
+				xs[i] = (static_cast<float>((i * 7) % 997) * 0.0241f) - 12.0f;
+				ys[i] = (static_cast<float>((i * 29) % 991) * 0.0173f) - 8.5f;
+				zs[i] = (static_cast<float>((i * 5) % 983) * 0.0197f) - 9.7f;
+				const EmuMath::Vector<3, double> point_(static_cast<double>(xs[i]), static_cast<double>(ys[i]), static_cast<double>(zs[i]));
+				expected[i] = scalar_func_(point_, static_cast<double>(freq), permutations);
+			}
+			max_difference = 0.0;
+		}
+		void operator()(std::size_t i_)
+		{
+			_generate<EmuSIMD::f32x4>(results_128);
+			_generate<EmuSIMD::f32x8>(results_256);
+			if (i_ == (NUM_LOOPS - 1))
+			{
+				for (std::size_t i = 0; i < num_points; ++i)
+				{
+					const double differences_[2] =
+					{
+						std::abs(static_cast<double>(results_128[i]) - expected[i]),
+						std::abs(static_cast<double>(results_256[i]) - expected[i])
+					};
+					for (const double difference_ : differences_)
+					{
+						// Negated comparison so that NaNs are reported rather than ignored
+						if (!(difference_ <= max_difference))
+						{
+							max_difference = difference_;
+						}
+					}
+				}
+			}
+		}
+		void OnTestsOver()
+		{
+			std::cout << "Greatest difference from scalar noise: " << max_difference << " (within " << max_error << ": " << (max_difference <= max_error ? "true" : "false") << ")\n";
+		}
+
+		EmuMath::NoisePermutations permutations = make_noise_test_options().permutation_info.MakePermutations();
+		std::vector<float> xs;
+		std::vector<float> ys;
+		std::vector<float> zs;
+		std::vector<float> results_128;
+		std::vector<float> results_256;
+		std::vector<double> expected;
+		double max_difference = 0.0;
+
+	private:
+		template<class Register_>
+		inline void _generate(std::vector<float>& out_)
+		{
+			using functor_type = EmuMath::fast_noise_gen_functor<3, noise_type, Register_>;
+			using int_register_type = typename EmuSIMD::TMP::register_as_integral<Register_>::type;
+			constexpr std::size_t num_elements_ = EmuSIMD::TMP::determine_register_element_count<Register_>();
+			constexpr std::size_t element_width_ = EmuSIMD::TMP::determine_register_per_element_width<Register_>();
+
+			functor_type func_;
+			const Register_ freq_ = EmuSIMD::set1<Register_>(freq);
+			const int_register_type mask_ = EmuSIMD::set1<int_register_type, element_width_>(static_cast<long long>(permutations.HighestStoredValue()));
+			for (std::size_t i = 0; i < num_points; i += num_elements_)
+			{
+				const Register_ result_ = func_
+				(
+					EmuSIMD::load<Register_>(xs.data() + i),
+					EmuSIMD::load<Register_>(ys.data() + i),
+					EmuSIMD::load<Register_>(zs.data() + i),
+					freq_,
+					mask_,
+					permutations
+				);
+				EmuSIMD::store(result_, out_.data() + i);
+			}
+		}
+	};
+#pragma endregion
+
+#pragma region EMU_RANDOM
+	/// <summary>
+	/// <para> Measures filling a buffer of floats via a FastRngWrapper using the SIMD xoshiro256++ engine. </para>
+	/// <para>
+	///		Prepare checks PCG32 against the reference implementation's known outputs, and each SIMD engine lane against a scalar engine jumped to the same stream.
+	///		The results of these checks are output by OnTestsOver.
+	/// </para>
+	/// </summary>
+	struct FastRngFillTest
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 1000;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+		static constexpr std::string_view NAME = "FastRngWrapper SIMD xoshiro256++ Fill";
+
+		using engine_type = EmuMath::FastXoshiro256PlusPlus<>;
+		static constexpr std::size_t num_samples = 65536;
+
+		/// <summary> Outputs of the reference PCG32 implementation when seeded with initstate 42 and initseq 54. </summary>
+		static constexpr std::array<std::uint32_t, 6> pcg32_known_answers = { 0xa15c02b7, 0x7b47f409, 0xba1d3330, 0x83d2f293, 0xbfa4784b, 0xcbed606e };
+
+		FastRngFillTest() : rng(0.0f, 1.0f, shared_fill_seed_)
+		{
+		}
+		void Prepare()
+		{
+			samples.resize(num_samples);
+
+			EmuMath::Pcg32 pcg32_(42, 54);
+			pcg32_matches = true;
+			for (const std::uint32_t known_answer_ : pcg32_known_answers)
+			{
+				pcg32_matches = (pcg32_() == known_answer_) && pcg32_matches;
+			}
+
+			constexpr std::size_t num_lanes_ = engine_type::num_lanes;
+			constexpr std::size_t num_steps_ = 100;
+			engine_type simd_engine_(shared_fill_seed_);
+			std::vector<std::uint64_t> simd_bits_(num_lanes_ * num_steps_);
+			simd_engine_.FillBits(simd_bits_.data(), simd_bits_.size());
+
+			EmuMath::Xoshiro256PlusPlus scalar_engine_(shared_fill_seed_);
+			num_lane_mismatches = 0;
+			for (std::size_t lane_ = 0; lane_ < num_lanes_; ++lane_)
+			{
+				EmuMath::Xoshiro256PlusPlus lane_engine_ = scalar_engine_;
+				for (std::size_t step_ = 0; step_ < num_steps_; ++step_)
+				{
+					if (simd_bits_[(step_ * num_lanes_) + lane_] != lane_engine_())
+					{
+						++num_lane_mismatches;
+					}
+				}
+				scalar_engine_.Jump();
+			}
+		}
+		void operator()(std::size_t i_)
+		{
+			rng.Fill(std::span<float>(samples));
+		}
+		void OnTestsOver()
+		{
+			std::cout << "PCG32 matches known answers: " << (pcg32_matches ? "true" : "false") << "\n";
+			std::cout << "SIMD xoshiro256++ outputs differing from jumped scalar engines: " << num_lane_mismatches << "\n";
+		}
+
+		EmuMath::FastRngWrapper<engine_type> rng;
+		std::vector<float> samples;
+		bool pcg32_matches = false;
+		std::size_t num_lane_mismatches = 0;
+	};
+
+	/// <summary>
+	/// <para> Measures filling a buffer of floats via a FastCounterRng, with each loop filling the next consecutive indices of the sequence. </para>
+	/// <para>
+	///		Prepare checks Philox4x32-10 against the Random123 known-answer vectors, and SIMD fills against scalar CounterRng fills starting at an unaligned index.
+	///		The results of these checks are output by OnTestsOver.
+	/// </para>
+	/// </summary>
+	struct FastCounterRngFillTest
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 1000;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+		static constexpr std::string_view NAME = "FastCounterRng Fill";
+
+		using counter_type = EmuMath::Philox4x32::counter_type;
+		using key_type = EmuMath::Philox4x32::key_type;
+		static constexpr std::size_t num_samples = 65536;
+
+		struct known_answer
+		{
+			counter_type counter;
+			key_type key;
+			counter_type result;
+		};
+		/// <summary> Philox4x32-10 known-answer vectors published with Random123. </summary>
+		static constexpr std::array<known_answer, 3> philox_known_answers =
+		{
+			known_answer{ { 0x00000000, 0x00000000, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000 }, { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 } },
+			known_answer{ { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff }, { 0xffffffff, 0xffffffff }, { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd } },
+			known_answer{ { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }, { 0xa4093822, 0x299f31d0 }, { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 } }
+		};
+
+		FastCounterRngFillTest() : rng(shared_fill_seed_)
+		{
+		}
+		void Prepare()
+		{
+			samples.resize(num_samples);
+
+			philox_matches = true;
+			for (const known_answer& known_answer_ : philox_known_answers)
+			{
+				philox_matches = (EmuMath::Philox4x32::Generate(known_answer_.counter, known_answer_.key) == known_answer_.result) && philox_matches;
+			}
+
+			constexpr std::uint64_t first_index_ = 5;
+			std::vector<float> simd_samples_(1001);
+			std::vector<float> scalar_samples_(simd_samples_.size());
+			rng.Fill(std::span<float>(simd_samples_), first_index_);
+			static_cast<const EmuMath::CounterRng&>(rng).Fill(std::span<float>(scalar_samples_), first_index_);
+			num_simd_mismatches = 0;
+			for (std::size_t i = 0; i < simd_samples_.size(); ++i)
+			{
+				if (simd_samples_[i] != scalar_samples_[i])
+				{
+					++num_simd_mismatches;
+				}
+			}
+		}
+		void operator()(std::size_t i_)
+		{
+			rng.Fill(std::span<float>(samples), static_cast<std::uint64_t>(i_) * num_samples);
+		}
+		void OnTestsOver()
+		{
+			std::cout << "Philox4x32-10 matches known answers: " << (philox_matches ? "true" : "false") << "\n";
+			std::cout << "SIMD outputs differing from scalar CounterRng outputs: " << num_simd_mismatches << "\n";
+		}
+
+		EmuMath::FastCounterRng<> rng;
+		std::vector<float> samples;
+		bool philox_matches = false;
+		std::size_t num_simd_mismatches = 0;
+	};
+#pragma endregion
+
 	// ----------- TESTS SELECTION -----------
 	using AllTests = std::tuple
 	<
@@ -1028,10 +2141,26 @@ namespace EmuCore::TestingHelpers
 		ScalarTan,
 		SIMDTan128,
 		SIMDTan256,
-		SIMDTan512
+		SIMDTan512,
+		FastNoiseParallelGenerationTest,
+		FastNoiseFlatStorageTest,
+		FastNoiseRegionGenerationTest,
+		FastNoiseNegativeGradientTest,
+		FastNoiseScalarComparisonTest<EmuMath::NoiseType::SIMPLEX>,
+		FastNoiseScalarComparisonTest<EmuMath::NoiseType::CELLULAR>,
+		FastRngFillTest,
+		FastCounterRngFillTest,
 		//FastMatFromScalarQuaternionTest,
 		//FastMatFromFastQuaternionTest,
-		//ScalarMatFromScalarQuaternionTest
+		//ScalarMatFromScalarQuaternionTest,
+		ThreadPoolSpinningSubmitToStart,
+		ThreadPoolYieldingSubmitToStart,
+		ThreadPoolBlockingSubmitToStart,
+		ThreadPoolImmediateParkSubmitToStart,
+		ThreadPoolExactlyOnceTest,
+		ThreadPoolTaskGraphTest,
+		ThreadPoolInlineTaskTest,
+		ParallelReduceTest
 	>;
 
 	// ----------- TESTS BEGIN -----------